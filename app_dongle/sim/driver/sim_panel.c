@@ -0,0 +1,545 @@
+/*
+ * sim_panel.c
+ *
+ *  spi.h 드라이버 + ST7789 패널 모델
+ *
+ *  - 전송 큐 : 맨 앞 전송의 시간이 지나면 ISR 컨텍스트에서 완료 처리하고 다음 전송을 시작
+ *  - spiXfer(), spiTransfer() : 완료될 때까지 세마포어로 잠들어서 기다림 (CPU 를 점유하지 않음)
+ *  - spiXferQueue(), spiTransferDma() : 큐에 넣고 바로 돌아옴, 완료는 콜백
+ *  - 전송된 바이트는 DC 핀 레벨에 따라 명령/데이터로 해석하여 패널 RAM(240x320, RGB565)에 기록
+ *  - 240x240 패널은 RAM 의 row 0~239 가 보이고, MADCTL MY(상하 반전) 이면 row 80~319 가 보인다.
+ *  - 패널은 시작부터 PANEL_FRAME_US 마다 포치 후 RAM row 0~319 를 스캔하고, TEON 이면 포치 동안 TE 핀이 HIGH
+ *  - 픽셀 전송 중 스캔이 쓰는 위치를 지나가서 한 프레임에 이전/새 내용이 섞여 보이면 lcd_tear 로 센다
+ */
+#include "sim.h"
+#include "hw.h"
+#include <zephyr/devicetree.h>
+
+
+#define SPI_FREQ_HZ             32000000
+#define SPI_XFER_OVERHEAD_NS    1000        // EasyDMA 설정 + CS
+#define SPI_QUEUE_MAX           16
+#define PANEL_RAM_WIDTH         240
+#define PANEL_RAM_HEIGHT        320
+#define PANEL_ROW_OFFSET        (PANEL_RAM_HEIGHT - SIM_LCD_HEIGHT)
+#define PANEL_FRAME_US          16600       // 60Hz 근처 (드라이버는 TE 간격으로 주기를 잰다)
+#define PANEL_PORCH_LINES       24          // VBP 12 + VFP 12
+#define PANEL_SCAN_LINES        (PANEL_RAM_HEIGHT + PANEL_PORCH_LINES)
+
+#define CMD_SLPIN               0x10
+#define CMD_SLPOUT              0x11
+#define CMD_DISPOFF             0x28
+#define CMD_DISPON              0x29
+#define CMD_CASET               0x2A
+#define CMD_RASET               0x2B
+#define CMD_RAMWR               0x2C
+#define CMD_TEOFF               0x34
+#define CMD_TEON                0x35
+#define CMD_MADCTL              0x36
+
+#define MADCTL_MY               0x80
+
+
+typedef struct
+{
+  uint8_t  cmd;
+  uint8_t  arg[4];
+  uint32_t arg_cnt;
+
+  uint16_t x0, x1;
+  uint16_t y0, y1;
+  uint16_t x, y;
+  bool     is_hi_byte;
+  uint8_t  hi_byte;
+
+  bool     is_sleep;
+  bool     is_disp_on;
+  bool     is_te_on;
+  uint8_t  madctl;
+  uint16_t ram[PANEL_RAM_HEIGHT][PANEL_RAM_WIDTH];
+} panel_t;
+
+
+typedef struct
+{
+  spi_xfer_t    xfer;
+  uint32_t      queue_time;
+  struct k_sem *p_sem;        // spiXfer() 묶음의 마지막 전송이면 기다리는 스레드
+} spi_req_t;
+
+
+static panel_t panel;
+static bool    is_init = false;
+static bool    is_dma_busy = false;
+static void  (*tx_done_func)(void) = NULL;
+static struct sim_timer dma_timer;
+static struct sim_timer scan_timer;
+static struct sim_timer te_timer;
+static sim_stats_t *p_stats = NULL;
+
+static spi_req_t    queue[SPI_QUEUE_MAX];
+static uint32_t     q_in  = 0;
+static uint32_t     q_out = 0;
+static uint32_t     remain_ns = 0;
+static struct k_sem free_sem;
+static spi_info_t   spi_info;
+
+
+static void spiDoneFunc(void *arg);
+
+
+static void panelWritePixel(uint16_t color)
+{
+  if (panel.y <= panel.y1 && panel.y < PANEL_RAM_HEIGHT && panel.x < PANEL_RAM_WIDTH)
+  {
+    panel.ram[panel.y][panel.x] = color;
+    p_stats->lcd_pixels++;
+  }
+
+  if (panel.x >= panel.x1)
+  {
+    panel.x = panel.x0;
+    panel.y++;
+  }
+  else
+  {
+    panel.x++;
+  }
+}
+
+static void panelWrite(const uint8_t *p_data, uint32_t length)
+{
+  bool is_data = simGpioGet(SIM_DT_GPIO_PIN_lcd_dc) != 0;
+
+  for (uint32_t i=0; i<length; i++)
+  {
+    uint8_t data = p_data[i];
+
+    if (is_data == false)
+    {
+      panel.cmd     = data;
+      panel.arg_cnt = 0;
+      p_stats->lcd_cmd++;
+
+      switch (data)
+      {
+        case CMD_SLPIN:   panel.is_sleep   = true;  break;
+        case CMD_SLPOUT:  panel.is_sleep   = false; break;
+        case CMD_DISPOFF: panel.is_disp_on = false; break;
+        case CMD_DISPON:  panel.is_disp_on = true;  break;
+        case CMD_TEOFF:   panel.is_te_on   = false; break;
+        case CMD_TEON:    panel.is_te_on   = true;  break;
+        case CMD_RAMWR:
+          panel.x          = panel.x0;
+          panel.y          = panel.y0;
+          panel.is_hi_byte = true;
+          p_stats->lcd_ramwr++;
+          break;
+      }
+      continue;
+    }
+
+    switch (panel.cmd)
+    {
+      case CMD_CASET:
+      case CMD_RASET:
+        if (panel.arg_cnt < 4)
+        {
+          panel.arg[panel.arg_cnt++] = data;
+        }
+        if (panel.arg_cnt == 4)
+        {
+          uint16_t start = (panel.arg[0] << 8) | panel.arg[1];
+          uint16_t end   = (panel.arg[2] << 8) | panel.arg[3];
+
+          if (panel.cmd == CMD_CASET)
+          {
+            panel.x0 = start;
+            panel.x1 = end;
+          }
+          else
+          {
+            panel.y0 = start;
+            panel.y1 = end;
+          }
+        }
+        break;
+
+      case CMD_MADCTL:
+        panel.madctl = data;
+        break;
+
+      case CMD_RAMWR:
+        // RGB565, MSB first
+        if (panel.is_hi_byte)
+        {
+          panel.hi_byte = data;
+        }
+        else
+        {
+          panelWritePixel((panel.hi_byte << 8) | data);
+        }
+        panel.is_hi_byte = !panel.is_hi_byte;
+        break;
+
+      default:
+        break;
+    }
+  }
+}
+
+static void panelTeLowISR(void *arg)
+{
+  ARG_UNUSED(arg);
+  simGpioSetInput(SIM_DT_GPIO_PIN_lcd_te, 0);
+}
+
+// 프레임 시작 (k * PANEL_FRAME_US) : 포치 동안 TE HIGH, 이후 row 0 부터 스캔
+static void panelScanISR(void *arg)
+{
+  ARG_UNUSED(arg);
+
+  if (panel.is_sleep || !panel.is_te_on)
+  {
+    return;
+  }
+  p_stats->lcd_te++;
+  simGpioSetInput(SIM_DT_GPIO_PIN_lcd_te, 1);
+  simTimerStart(&te_timer, (int64_t)PANEL_FRAME_US * PANEL_PORCH_LINES / PANEL_SCAN_LINES, 0, panelTeLowISR, NULL);
+}
+
+// start_ns 부터 d_ns 동안 RAM row first~last 를 고르게 썼을 때 스캔이 쓰는 위치를 지나가는지 확인
+static void panelCheckTear(int64_t start_ns, int64_t d_ns, int first, int last)
+{
+  int64_t frame_ns = (int64_t)PANEL_FRAME_US * 1000;
+  int64_t line_ns  = frame_ns / PANEL_SCAN_LINES;
+  int64_t row_ns;
+  int     row_offset;
+
+  row_offset = (panel.madctl & MADCTL_MY) ? PANEL_ROW_OFFSET : 0;
+  if (panel.is_sleep || !panel.is_disp_on || last < first ||
+      last < row_offset || first >= row_offset + SIM_LCD_HEIGHT)
+  {
+    return;
+  }
+  row_ns = d_ns / (last - first + 1);
+
+  for (int64_t k = start_ns / frame_ns - 1; k <= (start_ns + d_ns) / frame_ns + 1; k++)
+  {
+    // k 번째 스캔이 row 를 읽는 시간, 그 row 를 쓰기 시작/끝낸 시간
+    int64_t s0 = k * frame_ns + (PANEL_PORCH_LINES + first) * line_ns;
+    int64_t s1 = k * frame_ns + (PANEL_PORCH_LINES + last) * line_ns;
+    int64_t w0_first = start_ns;
+    int64_t w0_last  = start_ns + (last - first) * row_ns;
+    bool    is_new;
+    bool    is_old;
+
+    if (s1 + line_ns <= start_ns || s0 >= start_ns + d_ns)
+    {
+      continue;
+    }
+    is_new = s0 >= w0_first + row_ns && s1 >= w0_last + row_ns;
+    is_old = s0 + line_ns <= w0_first && s1 + line_ns <= w0_last;
+    if (!is_new && !is_old)
+    {
+      p_stats->lcd_tear++;
+      return;
+    }
+  }
+}
+
+static uint32_t spiXferTimeNs(uint32_t length)
+{
+  return (uint32_t)((uint64_t)length * 8 * 1000000000ULL / SPI_FREQ_HZ) + SPI_XFER_OVERHEAD_NS;
+}
+
+// 큐의 맨 앞 전송을 시작 : 데이터는 바로 패널에 쓰고, 전송 시간이 지나면 spiDoneFunc() 에서 완료 처리
+static void spiStartNext(void)
+{
+  spi_req_t *p_req;
+  uint32_t   length;
+  uint32_t   xfer_ns;
+  uint32_t   wait_us;
+  uint64_t   pixels;
+  uint16_t   row_first;
+  int        row_last;
+
+  if (is_dma_busy || q_out == q_in)
+  {
+    return;
+  }
+  p_req = &queue[q_out % SPI_QUEUE_MAX];
+
+  wait_us = micros() - p_req->queue_time;
+  spi_info.wait_us += wait_us;
+  if (wait_us > spi_info.wait_max_us)
+  {
+    spi_info.wait_max_us = wait_us;
+  }
+  if (p_req->xfer.dc_pin != SPI_PIN_NONE)
+  {
+    gpioPinWrite(p_req->xfer.dc_pin, p_req->xfer.dc_level);
+  }
+  if (p_req->xfer.cs_pin != SPI_PIN_NONE)
+  {
+    gpioPinWrite(p_req->xfer.cs_pin, _DEF_LOW);
+  }
+  if (p_req->xfer.rx_buf != NULL)
+  {
+    memset(p_req->xfer.rx_buf, 0xFF, p_req->xfer.rx_length);
+  }
+  pixels    = p_stats->lcd_pixels;
+  row_first = panel.y;
+  for (uint32_t i=0; i<cmax(p_req->xfer.tx_repeat, 1); i++)
+  {
+    panelWrite(p_req->xfer.tx_buf, p_req->xfer.tx_length);
+  }
+
+  length  = cmax(p_req->xfer.tx_length * cmax(p_req->xfer.tx_repeat, 1), p_req->xfer.rx_length);
+  xfer_ns = spiXferTimeNs(length);
+
+  if (p_stats->lcd_pixels > pixels)
+  {
+    row_last = panel.x == panel.x0 ? panel.y - 1 : panel.y;
+    panelCheckTear(simTimeUs() * 1000, xfer_ns, row_first, cmin(row_last, (int)panel.y1));
+  }
+  p_stats->spi_bytes   += length;
+  p_stats->spi_busy_us += xfer_ns / 1000;
+  spi_info.bytes       += length;
+  spi_info.busy_us     += xfer_ns / 1000;
+
+  // us 미만의 전송 시간은 모아서 다음 전송에 더한다
+  remain_ns += xfer_ns;
+  is_dma_busy = true;
+  simTimerStart(&dma_timer, remain_ns / 1000, 0, spiDoneFunc, NULL);
+  remain_ns %= 1000;
+}
+
+static void spiDoneFunc(void *arg)
+{
+  spi_req_t *p_req = &queue[q_out % SPI_QUEUE_MAX];
+
+  ARG_UNUSED(arg);
+
+  is_dma_busy = false;
+  q_out++;
+  spi_info.xfer_count++;
+
+  if (p_req->xfer.cs_pin != SPI_PIN_NONE)
+  {
+    gpioPinWrite(p_req->xfer.cs_pin, _DEF_HIGH);
+  }
+  if (p_req->xfer.p_done_func != NULL)
+  {
+    p_req->xfer.p_done_func(p_req->xfer.arg);
+  }
+  if (p_req->p_sem != NULL)
+  {
+    k_sem_give(p_req->p_sem);
+  }
+  k_sem_give(&free_sem);
+
+  spiStartNext();
+}
+
+static bool spiEnqueue(const spi_xfer_t *p_xfer, uint32_t count, struct k_sem *p_sem)
+{
+  uint32_t q_len = q_in - q_out;
+
+  if (q_len + count > SPI_QUEUE_MAX)
+  {
+    return false;
+  }
+  for (uint32_t i=0; i<count; i++)
+  {
+    spi_req_t *p_req = &queue[q_in % SPI_QUEUE_MAX];
+
+    p_req->xfer       = p_xfer[i];
+    p_req->queue_time = micros();
+    p_req->p_sem      = (i == count - 1) ? p_sem : NULL;
+    q_in++;
+  }
+  if (q_len + count > spi_info.queue_max)
+  {
+    spi_info.queue_max = q_len + count;
+  }
+  spiStartNext();
+  return true;
+}
+
+void simPanelInit(sim_stats_t *stats)
+{
+  p_stats = stats;
+  memset(&panel, 0, sizeof(panel));
+  panel.is_sleep = true;
+  simTimerStart(&scan_timer, PANEL_FRAME_US, PANEL_FRAME_US, panelScanISR, NULL);
+}
+
+bool simPanelSavePpm(const char *path)
+{
+  FILE *fp;
+  int row_offset;
+
+  row_offset = (panel.madctl & MADCTL_MY) ? PANEL_ROW_OFFSET : 0;
+
+  fp = fopen(path, "wb");
+  if (fp == NULL)
+  {
+    return false;
+  }
+
+  fprintf(fp, "P6\n%d %d\n255\n", SIM_LCD_WIDTH, SIM_LCD_HEIGHT);
+  for (int y=0; y<SIM_LCD_HEIGHT; y++)
+  {
+    for (int x=0; x<SIM_LCD_WIDTH; x++)
+    {
+      uint16_t color = panel.ram[y + row_offset][x];
+      uint8_t  rgb[3];
+
+      if (panel.is_sleep || !panel.is_disp_on)
+      {
+        color = 0;
+      }
+      rgb[0] = ((color >> 11) & 0x1F) * 255 / 31;
+      rgb[1] = ((color >>  5) & 0x3F) * 255 / 63;
+      rgb[2] = ((color >>  0) & 0x1F) * 255 / 31;
+      fwrite(rgb, 1, 3, fp);
+    }
+  }
+  fclose(fp);
+
+  return true;
+}
+
+
+//-- spi.h
+//
+bool spiInit(void)
+{
+  q_in  = 0;
+  q_out = 0;
+  k_sem_init(&free_sem, 0, 1);
+  memset(&spi_info, 0, sizeof(spi_info));
+  is_init = true;
+  return true;
+}
+
+void spiSetBitWidth(uint8_t ch, uint8_t bit_width)
+{
+  ARG_UNUSED(ch);
+  ARG_UNUSED(bit_width);
+}
+
+void spiAttachTxInterrupt(uint8_t ch, void (*func)())
+{
+  if (ch >= HW_SPI_MAX_CH)
+  {
+    return;
+  }
+  tx_done_func = func;
+}
+
+bool spiXfer(uint8_t ch, const spi_xfer_t *p_xfer, uint32_t count, uint32_t timeout_ms)
+{
+  struct k_sem sem;
+  uint32_t pre_time;
+
+  if (ch >= HW_SPI_MAX_CH || is_init == false || count == 0 || count > SPI_QUEUE_MAX)
+  {
+    return false;
+  }
+  k_sem_init(&sem, 0, 1);
+
+  pre_time = millis();
+  while (spiEnqueue(p_xfer, count, &sem) == false)
+  {
+    uint32_t elapsed = millis() - pre_time;
+
+    if (elapsed >= timeout_ms || k_sem_take(&free_sem, K_MSEC(timeout_ms - elapsed)) != 0)
+    {
+      spi_info.timeout_count++;
+      return false;
+    }
+  }
+
+  if (k_sem_take(&sem, K_MSEC(timeout_ms)) != 0)
+  {
+    // 모델에서는 전송을 중단하지 않고 완료 알림만 끊는다
+    for (uint32_t i=q_out; i!=q_in; i++)
+    {
+      if (queue[i % SPI_QUEUE_MAX].p_sem == &sem)
+      {
+        queue[i % SPI_QUEUE_MAX].p_sem = NULL;
+      }
+    }
+    spi_info.timeout_count++;
+    return false;
+  }
+  return true;
+}
+
+bool spiXferQueue(uint8_t ch, const spi_xfer_t *p_xfer, uint32_t count)
+{
+  if (ch >= HW_SPI_MAX_CH || is_init == false || count == 0)
+  {
+    return false;
+  }
+  return spiEnqueue(p_xfer, count, NULL);
+}
+
+bool spiTransfer(uint8_t ch, uint8_t *tx_buf, uint32_t tx_length, uint8_t *rx_buf, uint32_t rx_length, uint32_t timeout)
+{
+  spi_xfer_t xfer = {
+    .tx_buf    = tx_buf,
+    .tx_length = tx_length,
+    .rx_buf    = rx_buf,
+    .rx_length = rx_length,
+    .cs_pin    = SPI_PIN_NONE,
+    .dc_pin    = SPI_PIN_NONE,
+  };
+
+  return spiXfer(ch, &xfer, 1, timeout);
+}
+
+static void spiTransferDmaDone(void *arg)
+{
+  ARG_UNUSED(arg);
+
+  if (tx_done_func != NULL)
+  {
+    tx_done_func();
+  }
+}
+
+bool spiTransferDma(uint8_t ch, uint8_t *tx_buf, uint32_t tx_length, uint8_t *rx_buf, uint32_t rx_length)
+{
+  spi_xfer_t xfer = {
+    .tx_buf      = tx_buf,
+    .tx_length   = tx_length,
+    .rx_buf      = rx_buf,
+    .rx_length   = rx_length,
+    .cs_pin      = SPI_PIN_NONE,
+    .dc_pin      = SPI_PIN_NONE,
+    .p_done_func = spiTransferDmaDone,
+  };
+
+  return spiXferQueue(ch, &xfer, 1);
+}
+
+bool spiGetInfo(uint8_t ch, spi_info_t *p_info)
+{
+  if (ch >= HW_SPI_MAX_CH)
+  {
+    return false;
+  }
+  *p_info = spi_info;
+  return true;
+}
+
+void spiClearInfo(uint8_t ch)
+{
+  if (ch < HW_SPI_MAX_CH)
+  {
+    memset(&spi_info, 0, sizeof(spi_info));
+  }
+}
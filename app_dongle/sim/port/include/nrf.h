@@ -0,0 +1,7 @@
+/*
+ * nrf.h (sim)
+ */
+#ifndef SIM_NRF_H_
+#define SIM_NRF_H_
+
+#endif
@@ -0,0 +1,30 @@
+/*
+ * device.h (sim)
+ */
+#ifndef SIM_ZEPHYR_DEVICE_H_
+#define SIM_ZEPHYR_DEVICE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+
+struct device
+{
+  const char *name;
+  void       *data;
+};
+
+extern const struct device sim_dev_gpio0;
+extern const struct device sim_dev_flash0;
+extern const struct device sim_dev_cdc_acm_uart0;
+
+const struct device *device_get_binding(const char *name);
+
+static inline bool device_is_ready(const struct device *dev)
+{
+  return dev != NULL;
+}
+
+#include <zephyr/devicetree.h>
+
+#endif
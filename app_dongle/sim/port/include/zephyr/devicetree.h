@@ -0,0 +1,28 @@
+/*
+ * devicetree.h (sim)
+ *
+ *  동글 보드 devicetree 중 펌웨어에서 참조하는 노드만 정의 (app.overlay, nicenanov2.dts 기준)
+ */
+#ifndef SIM_ZEPHYR_DEVICETREE_H_
+#define SIM_ZEPHYR_DEVICETREE_H_
+
+#include <zephyr/device.h>
+
+
+#define DT_NODELABEL(label)                 label
+
+// lcd_pins
+#define SIM_DT_GPIO_PIN_lcd_dc              36    // P1.04
+#define SIM_DT_GPIO_PIN_lcd_rst             11    // P0.11
+#define SIM_DT_GPIO_PIN_lcd_blk             43    // P1.11
+#define SIM_DT_GPIO_PIN_lcd_te              22    // P0.22
+
+// flash partition
+#define SIM_DT_PARTITION_OFFSET_keymap_partition    0xd3000
+#define SIM_DT_PARTITION_SIZE_keymap_partition      0x2000
+
+
+#define Z_SIM_DEVICE(node)                  sim_dev_##node
+#define DEVICE_DT_GET(node)                 (&Z_SIM_DEVICE(node))
+
+#endif
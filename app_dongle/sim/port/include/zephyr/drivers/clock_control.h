@@ -0,0 +1,9 @@
+/*
+ * clock_control.h (sim)
+ */
+#ifndef SIM_ZEPHYR_DRIVERS_CLOCK_CONTROL_H_
+#define SIM_ZEPHYR_DRIVERS_CLOCK_CONTROL_H_
+
+#include <zephyr/kernel.h>
+
+#endif
@@ -0,0 +1,59 @@
+/*
+ * nrf_clock_control.h (sim)
+ *
+ *  HFXO 요청은 바로 완료되며 시작 시간(HFXO startup)만큼 가상 시간이 지나간다.
+ */
+#ifndef SIM_ZEPHYR_DRIVERS_CLOCK_CONTROL_NRF_CLOCK_CONTROL_H_
+#define SIM_ZEPHYR_DRIVERS_CLOCK_CONTROL_NRF_CLOCK_CONTROL_H_
+
+#include <zephyr/kernel.h>
+
+#define SIM_HFXO_STARTUP_US           400
+#define CLOCK_CONTROL_NRF_SUBSYS_HF   0
+
+struct sys_notify
+{
+  bool is_done;
+  int  result;
+};
+
+struct onoff_manager
+{
+  uint32_t refs;
+};
+
+struct onoff_client
+{
+  struct sys_notify notify;
+};
+
+struct onoff_manager *z_nrf_clock_control_get_onoff(int subsys);
+
+static inline void sys_notify_init_spinwait(struct sys_notify *notify)
+{
+  notify->is_done = false;
+  notify->result  = 0;
+}
+
+static inline int sys_notify_fetch_result(const struct sys_notify *notify, int *result)
+{
+  if (notify->is_done == false)
+  {
+    return -EAGAIN;
+  }
+  *result = notify->result;
+  return 0;
+}
+
+static inline int onoff_request(struct onoff_manager *mgr, struct onoff_client *cli)
+{
+  if (mgr->refs++ == 0)
+  {
+    k_busy_wait(SIM_HFXO_STARTUP_US);
+  }
+  cli->notify.is_done = true;
+  cli->notify.result  = 0;
+  return 0;
+}
+
+#endif
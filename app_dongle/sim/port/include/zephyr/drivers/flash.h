@@ -0,0 +1,17 @@
+/*
+ * flash.h (sim)
+ *
+ *  nRF52840 내부 flash 와 같이 erase 시 0xFF, write 는 1 -> 0 만 가능하도록 동작
+ */
+#ifndef SIM_ZEPHYR_DRIVERS_FLASH_H_
+#define SIM_ZEPHYR_DRIVERS_FLASH_H_
+
+#include <stddef.h>
+#include <sys/types.h>
+#include <zephyr/device.h>
+
+int flash_read(const struct device *dev, off_t offset, void *data, size_t len);
+int flash_write(const struct device *dev, off_t offset, const void *data, size_t len);
+int flash_erase(const struct device *dev, off_t offset, size_t size);
+
+#endif
@@ -0,0 +1,66 @@
+/*
+ * gpio.h (sim)
+ *
+ *  핀 상태만 저장하며 sim 드라이버(LCD 패널 모델 등)에서 simGpioGet() 으로 읽는다.
+ *  입력 핀은 sim 드라이버가 simGpioSetInput() 으로 바꾸고, 인터럽트를 켠 에지면 콜백을 ISR 컨텍스트에서 호출한다.
+ *  포트 구분 없이 핀 번호(P1.xx 는 32~) 하나로 다루며, 인터럽트는 P0(0~31) 핀만 지원한다.
+ */
+#ifndef SIM_ZEPHYR_DRIVERS_GPIO_H_
+#define SIM_ZEPHYR_DRIVERS_GPIO_H_
+
+#include <stdint.h>
+#include <zephyr/devicetree.h>
+
+
+typedef uint8_t  gpio_pin_t;
+typedef uint32_t gpio_flags_t;
+typedef uint16_t gpio_dt_flags_t;
+typedef uint32_t gpio_port_pins_t;
+
+#define GPIO_INPUT          (1U << 16)
+#define GPIO_OUTPUT         (1U << 17)
+#define GPIO_PULL_UP        (1U << 4)
+#define GPIO_PULL_DOWN      (1U << 5)
+
+#define GPIO_INT_DISABLE        (1U << 21)
+#define GPIO_INT_EDGE_RISING    (1U << 22)
+#define GPIO_INT_EDGE_FALLING   (1U << 23)
+#define GPIO_INT_EDGE_BOTH      (GPIO_INT_EDGE_RISING | GPIO_INT_EDGE_FALLING)
+
+struct gpio_dt_spec
+{
+  const struct device *port;
+  gpio_pin_t           pin;
+  gpio_dt_flags_t      dt_flags;
+};
+
+#define Z_SIM_DT_GPIO_PIN(node)       SIM_DT_GPIO_PIN_##node
+#define GPIO_DT_SPEC_GET(node, prop)  { .port = &sim_dev_gpio0, .pin = Z_SIM_DT_GPIO_PIN(node), .dt_flags = 0 }
+
+int gpio_pin_configure(const struct device *port, gpio_pin_t pin, gpio_flags_t flags);
+int gpio_pin_set(const struct device *port, gpio_pin_t pin, int value);
+int gpio_pin_get(const struct device *port, gpio_pin_t pin);
+int gpio_pin_toggle(const struct device *port, gpio_pin_t pin);
+
+struct gpio_callback;
+typedef void (*gpio_callback_handler_t)(const struct device *port, struct gpio_callback *cb, gpio_port_pins_t pins);
+
+struct gpio_callback
+{
+  struct gpio_callback    *next;
+  gpio_callback_handler_t  handler;
+  gpio_port_pins_t         pin_mask;
+};
+
+static inline void gpio_init_callback(struct gpio_callback *callback, gpio_callback_handler_t handler, gpio_port_pins_t pin_mask)
+{
+  callback->next     = NULL;
+  callback->handler  = handler;
+  callback->pin_mask = pin_mask;
+}
+
+int gpio_add_callback(const struct device *port, struct gpio_callback *callback);
+int gpio_remove_callback(const struct device *port, struct gpio_callback *callback);
+int gpio_pin_interrupt_configure(const struct device *port, gpio_pin_t pin, gpio_flags_t flags);
+
+#endif
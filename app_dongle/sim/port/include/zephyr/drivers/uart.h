@@ -0,0 +1,34 @@
+/*
+ * uart.h (sim)
+ *
+ *  CDC ACM UART(cdc_acm_uart0) 인터럽트 API. 수신 데이터는 시나리오의 cli 명령으로 들어온다.
+ */
+#ifndef SIM_ZEPHYR_DRIVERS_UART_H_
+#define SIM_ZEPHYR_DRIVERS_UART_H_
+
+#include <stdint.h>
+#include <zephyr/device.h>
+
+
+enum uart_line_ctrl
+{
+  UART_LINE_CTRL_BAUD_RATE = 1 << 0,
+  UART_LINE_CTRL_RTS       = 1 << 1,
+  UART_LINE_CTRL_DTR       = 1 << 2,
+  UART_LINE_CTRL_DCD       = 1 << 3,
+  UART_LINE_CTRL_DSR       = 1 << 4,
+};
+
+typedef void (*uart_irq_callback_user_data_t)(const struct device *dev, void *user_data);
+
+int  uart_line_ctrl_get(const struct device *dev, uint32_t ctrl, uint32_t *val);
+int  uart_line_ctrl_set(const struct device *dev, uint32_t ctrl, uint32_t val);
+int  uart_irq_callback_set(const struct device *dev, uart_irq_callback_user_data_t cb);
+void uart_irq_rx_enable(const struct device *dev);
+int  uart_irq_update(const struct device *dev);
+int  uart_irq_is_pending(const struct device *dev);
+int  uart_irq_rx_ready(const struct device *dev);
+int  uart_fifo_read(const struct device *dev, uint8_t *rx_data, const int size);
+int  uart_fifo_fill(const struct device *dev, const uint8_t *tx_data, int size);
+
+#endif
@@ -0,0 +1,9 @@
+/*
+ * irq.h (sim)
+ */
+#ifndef SIM_ZEPHYR_IRQ_H_
+#define SIM_ZEPHYR_IRQ_H_
+
+#include <zephyr/kernel.h>
+
+#endif
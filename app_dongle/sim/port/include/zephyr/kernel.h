@@ -0,0 +1,245 @@
+/*
+ * kernel.h (sim)
+ *
+ *  펌웨어에서 사용하는 Zephyr 커널 API 를 호스트에서 흉내낸다.
+ *  - 스레드는 ucontext 기반 협력형(cooperative) 스케줄링
+ *  - 시간은 가상 시간(us) 이며, 실행할 스레드가 없을 때만 다음 이벤트까지 진행
+ */
+#ifndef SIM_ZEPHYR_KERNEL_H_
+#define SIM_ZEPHYR_KERNEL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <errno.h>
+#include <stdio.h>
+
+#include <zephyr/sys/util.h>
+#include <zephyr/sys/time_units.h>
+#include <zephyr/sys/atomic.h>
+
+
+typedef struct
+{
+  int64_t us;     // < 0 : forever
+} k_timeout_t;
+
+#define K_FOREVER             ((k_timeout_t){ .us = -1 })
+#define K_NO_WAIT             ((k_timeout_t){ .us = 0 })
+#define K_USEC(t)             ((k_timeout_t){ .us = (int64_t)(t) })
+#define K_MSEC(t)             ((k_timeout_t){ .us = (int64_t)(t) * 1000 })
+#define K_SECONDS(t)          K_MSEC((int64_t)(t) * 1000)
+#define K_TIMEOUT_EQ(a, b)    ((a).us == (b).us)
+
+
+//-- Thread
+//
+typedef void (*k_thread_entry_t)(void *p1, void *p2, void *p3);
+
+struct _thread_stack_info
+{
+  size_t size;
+};
+
+struct k_thread
+{
+  const char       *name;
+  k_thread_entry_t  entry;
+  void             *p1;
+  void             *p2;
+  void             *p3;
+  int               prio;
+  int               state;
+  int64_t           deadline_us;
+  int64_t           busy_until_us;  // k_busy_wait() 로 CPU 를 점유하는 시간
+  bool            (*cond)(void *arg);
+  void             *cond_arg;
+  bool              wake_ok;
+  void             *ctx;
+  void             *stack;
+  size_t            stack_size;
+  uint64_t          run_seq;
+  uint64_t          cpu_ns;
+  uint32_t          run_count;
+  struct _thread_stack_info stack_info;   // 호스트 스택 크기 (SIM_STACK_MIN 이상)
+};
+
+typedef struct k_thread *k_tid_t;
+
+typedef struct
+{
+  uint64_t execution_cycles;    // 호스트 CPU 시간을 사이클로 환산
+} k_thread_runtime_stats_t;
+
+typedef void (*k_thread_user_cb_t)(const struct k_thread *thread, void *user_data);
+
+#define K_THREAD_STACK_DEFINE(sym, size)    char sym[size]
+#define K_THREAD_STACK_SIZEOF(sym)          sizeof(sym)
+#define K_KERNEL_STACK_DEFINE(sym, size)    char sym[size]
+
+k_tid_t z_sim_thread_create(struct k_thread *new_thread, char *stack, size_t stack_size,
+                            k_thread_entry_t entry, const char *entry_name,
+                            void *p1, void *p2, void *p3,
+                            int prio, uint32_t options, k_timeout_t delay);
+
+// 리포트에서 스레드를 구분할 수 있도록 entry 함수 이름을 스레드 이름으로 사용
+#define k_thread_create(new_thread, stack, stack_size, entry, ...) \
+  z_sim_thread_create(new_thread, stack, stack_size, entry, #entry, __VA_ARGS__)
+
+k_tid_t k_current_get(void);
+int     k_thread_name_set(k_tid_t thread, const char *name);
+const char *k_thread_name_get(k_tid_t thread);
+int     k_thread_priority_get(k_tid_t thread);
+void    k_thread_priority_set(k_tid_t thread, int prio);
+void    k_thread_foreach(k_thread_user_cb_t user_cb, void *user_data);
+int     k_thread_runtime_stats_get(k_tid_t thread, k_thread_runtime_stats_t *stats);
+int     k_thread_stack_space_get(const struct k_thread *thread, size_t *unused_ptr);
+void    k_thread_suspend(k_tid_t thread);
+void    k_thread_resume(k_tid_t thread);
+void    k_yield(void);
+
+int32_t k_sleep(k_timeout_t timeout);
+int32_t k_msleep(int32_t ms);
+int32_t k_usleep(int32_t us);
+void    k_busy_wait(uint32_t usec_to_wait);
+
+int64_t  k_uptime_get(void);
+uint32_t k_uptime_get_32(void);
+uint32_t k_cycle_get_32(void);
+uint64_t k_cycle_get_64(void);
+
+
+//-- Mutex
+//
+struct k_mutex
+{
+  struct k_thread *owner;
+  uint32_t         lock_count;
+};
+
+#define K_MUTEX_DEFINE(name)    struct k_mutex name = { NULL, 0 }
+
+int k_mutex_init(struct k_mutex *mutex);
+int k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout);
+int k_mutex_unlock(struct k_mutex *mutex);
+
+
+//-- Semaphore
+//
+struct k_sem
+{
+  uint32_t count;
+  uint32_t limit;
+};
+
+#define K_SEM_DEFINE(name, initial_count, count_limit) \
+  struct k_sem name = { (initial_count), (count_limit) }
+
+int      k_sem_init(struct k_sem *sem, unsigned int initial_count, unsigned int limit);
+int      k_sem_take(struct k_sem *sem, k_timeout_t timeout);
+void     k_sem_give(struct k_sem *sem);
+void     k_sem_reset(struct k_sem *sem);
+unsigned k_sem_count_get(struct k_sem *sem);
+
+
+//-- Event
+//
+struct k_event
+{
+  uint32_t events;
+};
+
+#define K_EVENT_DEFINE(name)    struct k_event name = { 0 }
+
+void     k_event_init(struct k_event *event);
+uint32_t k_event_post(struct k_event *event, uint32_t events);
+uint32_t k_event_set(struct k_event *event, uint32_t events);
+uint32_t k_event_clear(struct k_event *event, uint32_t events);
+uint32_t k_event_test(struct k_event *event, uint32_t events_mask);
+uint32_t k_event_wait(struct k_event *event, uint32_t events, bool reset, k_timeout_t timeout);
+uint32_t k_event_wait_all(struct k_event *event, uint32_t events, bool reset, k_timeout_t timeout);
+
+
+//-- Work queue (system workqueue)
+//
+struct k_work;
+typedef void (*k_work_handler_t)(struct k_work *work);
+
+struct k_work
+{
+  k_work_handler_t handler;
+  struct k_work   *next;
+  bool             is_queued;
+};
+
+struct sim_timer
+{
+  int64_t            expire_us;
+  int64_t            period_us;
+  void             (*func)(void *arg);
+  void              *arg;
+  bool               is_active;
+  struct sim_timer  *next;
+};
+
+struct k_work_delayable
+{
+  struct k_work    work;
+  struct sim_timer timer;
+};
+
+void k_work_init(struct k_work *work, k_work_handler_t handler);
+int  k_work_submit(struct k_work *work);
+void k_work_init_delayable(struct k_work_delayable *dwork, k_work_handler_t handler);
+int  k_work_schedule(struct k_work_delayable *dwork, k_timeout_t delay);
+int  k_work_reschedule(struct k_work_delayable *dwork, k_timeout_t delay);
+int  k_work_cancel_delayable(struct k_work_delayable *dwork);
+bool k_work_delayable_is_pending(const struct k_work_delayable *dwork);
+
+static inline struct k_work_delayable *k_work_delayable_from_work(struct k_work *work)
+{
+  return CONTAINER_OF(work, struct k_work_delayable, work);
+}
+
+
+//-- Timer (만료 함수는 ISR 컨텍스트에서 호출)
+//
+struct k_timer;
+typedef void (*k_timer_expiry_t)(struct k_timer *timer);
+typedef void (*k_timer_stop_t)(struct k_timer *timer);
+
+struct k_timer
+{
+  struct sim_timer  timer;
+  k_timer_expiry_t  expiry_fn;
+  k_timer_stop_t    stop_fn;
+  void             *user_data;
+};
+
+void k_timer_init(struct k_timer *timer, k_timer_expiry_t expiry_fn, k_timer_stop_t stop_fn);
+void k_timer_start(struct k_timer *timer, k_timeout_t duration, k_timeout_t period);
+void k_timer_stop(struct k_timer *timer);
+
+static inline void k_timer_user_data_set(struct k_timer *timer, void *user_data) { timer->user_data = user_data; }
+static inline void *k_timer_user_data_get(const struct k_timer *timer)           { return timer->user_data; }
+
+
+//-- IRQ
+//
+static inline unsigned int irq_lock(void)         { return 0; }
+static inline void irq_unlock(unsigned int key)   { (void)key; }
+static inline bool k_is_in_isr(void)              { return k_current_get() == NULL; }
+
+#define printk    printf
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
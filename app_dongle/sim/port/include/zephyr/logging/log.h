@@ -0,0 +1,34 @@
+/*
+ * log.h (sim)
+ *
+ *  Zephyr LOG_xxx 매크로를 sim 로그 레벨에 따라 stdout 으로 출력
+ */
+#ifndef SIM_ZEPHYR_LOGGING_LOG_H_
+#define SIM_ZEPHYR_LOGGING_LOG_H_
+
+#include <stdint.h>
+
+#define LOG_LEVEL_NONE    0
+#define LOG_LEVEL_ERR     1
+#define LOG_LEVEL_WRN     2
+#define LOG_LEVEL_INF     3
+#define LOG_LEVEL_DBG     4
+
+void simLogPrintf(const char *module, int level, const char *fmt, ...) __attribute__((format(printf, 3, 4)));
+
+#define LOG_MODULE_REGISTER(name, ...) \
+  static const char *sim_log_module __attribute__((unused)) = #name
+
+#define LOG_MODULE_DECLARE(name, ...)   LOG_MODULE_REGISTER(name)
+
+#define LOG_ERR(fmt, ...)   simLogPrintf(sim_log_module, LOG_LEVEL_ERR, fmt, ##__VA_ARGS__)
+#define LOG_WRN(fmt, ...)   simLogPrintf(sim_log_module, LOG_LEVEL_WRN, fmt, ##__VA_ARGS__)
+#define LOG_INF(fmt, ...)   simLogPrintf(sim_log_module, LOG_LEVEL_INF, fmt, ##__VA_ARGS__)
+#define LOG_DBG(fmt, ...)   simLogPrintf(sim_log_module, LOG_LEVEL_DBG, fmt, ##__VA_ARGS__)
+
+#define LOG_HEXDUMP_ERR(data, length, str)  simLogPrintf(sim_log_module, LOG_LEVEL_ERR, "%s (%d bytes)", str, (int)(length))
+#define LOG_HEXDUMP_WRN(data, length, str)  simLogPrintf(sim_log_module, LOG_LEVEL_WRN, "%s (%d bytes)", str, (int)(length))
+#define LOG_HEXDUMP_INF(data, length, str)  simLogPrintf(sim_log_module, LOG_LEVEL_INF, "%s (%d bytes)", str, (int)(length))
+#define LOG_HEXDUMP_DBG(data, length, str)  simLogPrintf(sim_log_module, LOG_LEVEL_DBG, "%s (%d bytes)", str, (int)(length))
+
+#endif
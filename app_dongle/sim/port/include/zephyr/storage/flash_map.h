@@ -0,0 +1,13 @@
+/*
+ * flash_map.h (sim)
+ */
+#ifndef SIM_ZEPHYR_STORAGE_FLASH_MAP_H_
+#define SIM_ZEPHYR_STORAGE_FLASH_MAP_H_
+
+#include <zephyr/devicetree.h>
+
+#define FIXED_PARTITION_OFFSET(label)   SIM_DT_PARTITION_OFFSET_##label
+#define FIXED_PARTITION_SIZE(label)     SIM_DT_PARTITION_SIZE_##label
+#define FIXED_PARTITION_DEVICE(label)   (&sim_dev_flash0)
+
+#endif
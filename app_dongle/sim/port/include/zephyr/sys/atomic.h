@@ -0,0 +1,49 @@
+/*
+ * atomic.h (sim)
+ *
+ *  Zephyr atomic API 를 gcc __atomic 내장 함수로 대체
+ *  - 반환값은 Zephyr 와 같이 변경 전 값
+ */
+#ifndef SIM_ZEPHYR_SYS_ATOMIC_H_
+#define SIM_ZEPHYR_SYS_ATOMIC_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef long atomic_t;
+typedef atomic_t atomic_val_t;
+
+#define ATOMIC_INIT(i)    (i)
+
+static inline atomic_val_t atomic_get(const atomic_t *target)
+{
+  return __atomic_load_n(target, __ATOMIC_SEQ_CST);
+}
+
+static inline atomic_val_t atomic_set(atomic_t *target, atomic_val_t value)
+{
+  return __atomic_exchange_n(target, value, __ATOMIC_SEQ_CST);
+}
+
+static inline atomic_val_t atomic_add(atomic_t *target, atomic_val_t value)
+{
+  return __atomic_fetch_add(target, value, __ATOMIC_SEQ_CST);
+}
+
+static inline atomic_val_t atomic_inc(atomic_t *target)
+{
+  return atomic_add(target, 1);
+}
+
+static inline atomic_val_t atomic_clear(atomic_t *target)
+{
+  return atomic_set(target, 0);
+}
+
+static inline bool atomic_cas(atomic_t *target, atomic_val_t old_value, atomic_val_t new_value)
+{
+  return __atomic_compare_exchange_n(target, &old_value, new_value, false,
+                                     __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+#endif
@@ -0,0 +1,38 @@
+/*
+ * time_units.h (sim)
+ *
+ *  nRF52840 과 같이 64MHz 사이클 카운터로 가정
+ */
+#ifndef SIM_ZEPHYR_SYS_TIME_UNITS_H_
+#define SIM_ZEPHYR_SYS_TIME_UNITS_H_
+
+#include <stdint.h>
+
+#define SIM_CYCLES_PER_US     64
+
+static inline uint32_t sys_clock_hw_cycles_per_sec(void)
+{
+  return SIM_CYCLES_PER_US * 1000000U;
+}
+
+static inline uint32_t k_cyc_to_us_floor32(uint32_t cyc)
+{
+  return cyc / SIM_CYCLES_PER_US;
+}
+
+static inline uint64_t k_cyc_to_us_floor64(uint64_t cyc)
+{
+  return cyc / SIM_CYCLES_PER_US;
+}
+
+static inline uint32_t k_cyc_to_ns_floor32(uint32_t cyc)
+{
+  return (uint32_t)((uint64_t)cyc * 1000U / SIM_CYCLES_PER_US);
+}
+
+static inline uint32_t k_us_to_cyc_ceil32(uint32_t us)
+{
+  return us * SIM_CYCLES_PER_US;
+}
+
+#endif
@@ -0,0 +1,57 @@
+/*
+ * util.h (sim)
+ */
+#ifndef SIM_ZEPHYR_SYS_UTIL_H_
+#define SIM_ZEPHYR_SYS_UTIL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+#ifndef ARG_UNUSED
+#define ARG_UNUSED(x)           (void)(x)
+#endif
+
+#ifndef ARRAY_SIZE
+#define ARRAY_SIZE(array)       (sizeof(array) / sizeof((array)[0]))
+#endif
+
+#ifndef CONTAINER_OF
+#define CONTAINER_OF(ptr, type, field)  ((type *)(((char *)(ptr)) - offsetof(type, field)))
+#endif
+
+#ifndef BIT
+#define BIT(n)                  (1UL << (n))
+#endif
+
+#ifndef WRITE_BIT
+#define WRITE_BIT(var, bit, set) ((var) = (set) ? ((var) | BIT(bit)) : ((var) & ~BIT(bit)))
+#endif
+
+#ifndef MIN
+#define MIN(a, b)               (((a) < (b)) ? (a) : (b))
+#endif
+
+#ifndef MAX
+#define MAX(a, b)               (((a) > (b)) ? (a) : (b))
+#endif
+
+#ifndef IN_RANGE
+#define IN_RANGE(val, min, max) ((val) >= (min) && (val) <= (max))
+#endif
+
+// CONFIG_xxx 가 1 로 정의되어 있으면 1, 아니면 0
+#define Z_IS_ENABLED1(config_macro)           Z_IS_ENABLED2(_XXXX##config_macro)
+#define _XXXX1                                _YYYY,
+#define Z_IS_ENABLED2(one_or_two_args)        Z_IS_ENABLED3(one_or_two_args 1, 0)
+#define Z_IS_ENABLED3(ignore_this, val, ...)  val
+#define IS_ENABLED(config_macro)              Z_IS_ENABLED1(config_macro)
+
+static inline int32_t sign_extend(uint32_t value, uint8_t index)
+{
+  uint8_t shift = 31 - index;
+
+  return (int32_t)(value << shift) >> shift;
+}
+
+#endif
@@ -0,0 +1,10 @@
+/*
+ * types.h (sim)
+ */
+#ifndef SIM_ZEPHYR_TYPES_H_
+#define SIM_ZEPHYR_TYPES_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#endif
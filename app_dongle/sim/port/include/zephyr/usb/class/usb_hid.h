@@ -0,0 +1,41 @@
+/*
+ * usb_hid.h (sim)
+ */
+#ifndef SIM_ZEPHYR_USB_CLASS_USB_HID_H_
+#define SIM_ZEPHYR_USB_CLASS_USB_HID_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <zephyr/device.h>
+#include <zephyr/usb/usb_device.h>
+
+
+typedef int (*hid_cb_t)(const struct device *dev, struct usb_setup_packet *setup, int32_t *len, uint8_t **data);
+typedef void (*hid_int_ready_callback)(const struct device *dev);
+typedef void (*hid_protocol_cb_t)(const struct device *dev, uint8_t protocol);
+typedef void (*hid_idle_cb_t)(const struct device *dev, uint16_t report_id);
+
+struct hid_ops
+{
+  hid_cb_t               get_report;
+  hid_cb_t               set_report;
+  hid_protocol_cb_t      protocol_change;
+  hid_idle_cb_t          on_idle;
+  hid_int_ready_callback int_in_ready;
+  hid_int_ready_callback int_out_ready;
+};
+
+enum
+{
+  HID_KEY_A = 4,
+  HID_KEY_B,
+  HID_KEY_C,
+  HID_KEY_D,
+};
+
+void usb_hid_register_device(const struct device *dev, const uint8_t *desc, size_t size, const struct hid_ops *op);
+int  usb_hid_init(const struct device *dev);
+int  hid_int_ep_write(const struct device *dev, const uint8_t *data, uint32_t data_len, uint32_t *bytes_ret);
+int  hid_int_ep_read(const struct device *dev, uint8_t *data, uint32_t max_data_len, uint32_t *ret_bytes);
+
+#endif
@@ -0,0 +1,46 @@
+/*
+ * usb_device.h (sim)
+ *
+ *  legacy USB device stack 의 상태 콜백/엔드포인트 API.
+ *  호스트 동작(enumeration, SOF, suspend/resume)은 sim_usb.c 에서 만들어 낸다.
+ */
+#ifndef SIM_ZEPHYR_USB_USB_DEVICE_H_
+#define SIM_ZEPHYR_USB_USB_DEVICE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+
+enum usb_dc_status_code
+{
+  USB_DC_ERROR,
+  USB_DC_RESET,
+  USB_DC_CONNECTED,
+  USB_DC_CONFIGURED,
+  USB_DC_DISCONNECTED,
+  USB_DC_SUSPEND,
+  USB_DC_RESUME,
+  USB_DC_INTERFACE,
+  USB_DC_SET_HALT,
+  USB_DC_CLEAR_HALT,
+  USB_DC_SOF,
+  USB_DC_UNKNOWN
+};
+
+struct usb_setup_packet
+{
+  uint8_t  bmRequestType;
+  uint8_t  bRequest;
+  uint16_t wValue;
+  uint16_t wIndex;
+  uint16_t wLength;
+};
+
+typedef void (*usb_dc_status_callback)(enum usb_dc_status_code cb_status, const uint8_t *param);
+
+int usb_enable(usb_dc_status_callback status_cb);
+int usb_disable(void);
+int usb_wakeup_request(void);
+int usb_write(uint8_t ep, const uint8_t *data, uint32_t data_len, uint32_t *bytes_ret);
+
+#endif
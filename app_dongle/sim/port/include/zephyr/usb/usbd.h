@@ -0,0 +1,9 @@
+/*
+ * usbd.h (sim)
+ *
+ *  펌웨어는 legacy USB device stack(usb_device.h) 만 사용함
+ */
+#ifndef SIM_ZEPHYR_USB_USBD_H_
+#define SIM_ZEPHYR_USB_USBD_H_
+
+#endif
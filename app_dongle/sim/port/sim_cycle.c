@@ -0,0 +1,30 @@
+/*
+ * sim_cycle.c
+ *
+ *  cycle.h 흉내
+ *
+ *  - DWT CYCCNT 대신 호스트 CLOCK_MONOTONIC(ns) 를 사용하므로 1 cycle = 1ns (1000MHz)
+ *  - 가상 시간과 무관한 실제 실행 시간이라 qmk bench 의 변경 전/후 비교에 사용
+ */
+#include "hw.h"
+
+#include <time.h>
+
+
+bool cycleInit(void)
+{
+  return true;
+}
+
+uint32_t cycleGet(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+}
+
+uint32_t cycleGetFreqMhz(void)
+{
+  return 1000;
+}
@@ -0,0 +1,257 @@
+/*
+ * sim_esb.c
+ *
+ *  ESB PRX 흉내
+ *
+ *  - 하프(PTX)에서 보낸 프레임은 simEsbInject() 로 들어오며 ISR 컨텍스트에서 처리된다.
+ *  - 수신 off(듀티 사이클) 또는 RX FIFO full 이면 ACK 하지 않으므로 드롭으로 센다.
+ *  - 수신한 파이프에 ACK 페이로드가 있으면 ACK 에 실어 보낸 뒤 TX_SUCCESS 이벤트를 보낸다.
+ */
+#include "sim.h"
+#include <esb.h>
+
+
+typedef struct
+{
+  struct esb_payload buf[CONFIG_ESB_RX_FIFO_SIZE];
+  uint32_t           in;
+  uint32_t           out;
+  uint32_t           count;
+} esb_fifo_t;
+
+
+static struct esb_config esb_cfg;
+static bool        is_init  = false;
+static bool        is_rx_on = false;
+static esb_fifo_t  rx_fifo;
+static esb_fifo_t  tx_fifo;
+static sim_stats_t *p_stats = NULL;
+static FILE        *rf_log_fp = NULL;
+static struct esb_payload last_ack;      // 마지막으로 주입한 프레임의 ACK 에 실려 간 페이로드
+
+
+static bool fifoPush(esb_fifo_t *fifo, const struct esb_payload *payload)
+{
+  if (fifo->count >= CONFIG_ESB_RX_FIFO_SIZE)
+  {
+    return false;
+  }
+  fifo->buf[fifo->in] = *payload;
+  fifo->in = (fifo->in + 1) % CONFIG_ESB_RX_FIFO_SIZE;
+  fifo->count++;
+  return true;
+}
+
+static bool fifoPop(esb_fifo_t *fifo, struct esb_payload *payload)
+{
+  if (fifo->count == 0)
+  {
+    return false;
+  }
+  *payload = fifo->buf[fifo->out];
+  fifo->out = (fifo->out + 1) % CONFIG_ESB_RX_FIFO_SIZE;
+  fifo->count--;
+  return true;
+}
+
+static void sendEvent(enum esb_evt_id evt_id)
+{
+  struct esb_evt event = {evt_id, 1};
+
+  if (esb_cfg.event_handler != NULL)
+  {
+    esb_cfg.event_handler(&event);
+  }
+}
+
+void simEsbInit(sim_stats_t *stats)
+{
+  p_stats = stats;
+}
+
+void simEsbSetLog(FILE *fp)
+{
+  rf_log_fp = fp;
+}
+
+bool simEsbIsRxOn(void)
+{
+  return is_init && is_rx_on;
+}
+
+uint8_t simEsbGetAck(uint8_t *p_data)
+{
+  memcpy(p_data, last_ack.data, last_ack.length);
+  return last_ack.length;
+}
+
+bool simEsbInject(uint8_t pipe, const uint8_t *p_data, uint8_t length)
+{
+  struct esb_payload payload;
+  struct esb_payload ack;
+  bool is_ack = false;
+
+  p_stats->rf_injected++;
+  last_ack.length = 0;
+
+  // rf_replay 입력 형식 : <time_us> <hex bytes> (하프가 보낸 프레임 그대로, 드롭 포함)
+  if (rf_log_fp != NULL)
+  {
+    fprintf(rf_log_fp, "%lld", (long long)simTimeUs());
+    for (uint8_t i=0; i<length; i++)
+    {
+      fprintf(rf_log_fp, " %02X", p_data[i]);
+    }
+    fprintf(rf_log_fp, "\n");
+  }
+
+  if (!simEsbIsRxOn())
+  {
+    p_stats->rf_drop_rx_off++;
+    return false;
+  }
+  if (length > CONFIG_ESB_MAX_PAYLOAD_LENGTH)
+  {
+    length = CONFIG_ESB_MAX_PAYLOAD_LENGTH;
+  }
+
+  memset(&payload, 0, sizeof(payload));
+  payload.pipe   = pipe;
+  payload.length = length;
+  payload.rssi   = -50;
+  memcpy(payload.data, p_data, length);
+
+  if (!fifoPush(&rx_fifo, &payload))
+  {
+    p_stats->rf_drop_fifo_full++;
+    return false;
+  }
+  p_stats->rf_received++;
+
+  // 같은 파이프의 ACK 페이로드
+  if (tx_fifo.count > 0 && tx_fifo.buf[tx_fifo.out].pipe == pipe)
+  {
+    is_ack = fifoPop(&tx_fifo, &ack);
+    p_stats->rf_ack_payload++;
+    last_ack = ack;
+  }
+
+  sendEvent(ESB_EVENT_RX_RECEIVED);
+  if (is_ack)
+  {
+    sendEvent(ESB_EVENT_TX_SUCCESS);
+  }
+  return true;
+}
+
+
+//-- esb.h
+//
+int esb_init(const struct esb_config *config)
+{
+  esb_cfg  = *config;
+  is_init  = true;
+  is_rx_on = false;
+  memset(&rx_fifo, 0, sizeof(rx_fifo));
+  memset(&tx_fifo, 0, sizeof(tx_fifo));
+  return 0;
+}
+
+void esb_disable(void)
+{
+  is_init  = false;
+  is_rx_on = false;
+}
+
+bool esb_is_idle(void)
+{
+  return !is_rx_on;
+}
+
+int esb_write_payload(const struct esb_payload *payload)
+{
+  if (!is_init)
+  {
+    return -EACCES;
+  }
+  if (payload->length == 0 || payload->length > CONFIG_ESB_MAX_PAYLOAD_LENGTH)
+  {
+    return -EMSGSIZE;
+  }
+  if (!fifoPush(&tx_fifo, payload))
+  {
+    return -ENOMEM;
+  }
+  return 0;
+}
+
+int esb_read_rx_payload(struct esb_payload *payload)
+{
+  if (!is_init)
+  {
+    return -EACCES;
+  }
+  return fifoPop(&rx_fifo, payload) ? 0 : -ENODATA;
+}
+
+int esb_start_tx(void)
+{
+  return -EINVAL;
+}
+
+int esb_start_rx(void)
+{
+  if (!is_init)
+  {
+    return -EINVAL;
+  }
+  is_rx_on = true;
+  return 0;
+}
+
+int esb_stop_rx(void)
+{
+  if (!is_rx_on)
+  {
+    return -EINVAL;
+  }
+  is_rx_on = false;
+  return 0;
+}
+
+int esb_flush_tx(void)
+{
+  memset(&tx_fifo, 0, sizeof(tx_fifo));
+  return 0;
+}
+
+int esb_flush_rx(void)
+{
+  memset(&rx_fifo, 0, sizeof(rx_fifo));
+  return 0;
+}
+
+int esb_set_base_address_0(const uint8_t *addr)
+{
+  ARG_UNUSED(addr);
+  return 0;
+}
+
+int esb_set_base_address_1(const uint8_t *addr)
+{
+  ARG_UNUSED(addr);
+  return 0;
+}
+
+int esb_set_prefixes(const uint8_t *prefixes, uint8_t num_pipes)
+{
+  ARG_UNUSED(prefixes);
+  ARG_UNUSED(num_pipes);
+  return 0;
+}
+
+int esb_set_tx_power(int8_t tx_output_power)
+{
+  esb_cfg.tx_output_power = tx_output_power;
+  return 0;
+}
@@ -0,0 +1,919 @@
+/*
+ * sim_kernel.c
+ *
+ *  Zephyr 커널 API 를 호스트에서 실행하기 위한 협력형 스케줄러
+ *
+ *  - 스레드는 ucontext 로 전환하며, 블록(sleep/sem/mutex/event/SOF 대기)되는 지점에서만 전환된다.
+ *  - 시간은 가상 시간(us)이다. 스레드 실행에는 시간이 걸리지 않는 것으로 보고,
+ *    k_busy_wait() 만 CPU 를 점유한 채로 시간을 진행시킨다.
+ *  - 실행할 스레드가 없으면 가장 빠른 타이머/sleep 만료 시점으로 시간을 건너뛴다.
+ *  - 타이머 콜백, 시나리오 이벤트는 스레드가 아닌 스케줄러 컨텍스트(= ISR)에서 실행된다.
+ */
+#include "sim_kernel.h"
+
+#include <stdlib.h>
+#include <time.h>
+#include <ucontext.h>
+
+
+#define SIM_STACK_MIN           (256*1024)    // LVGL 등 호스트 빌드는 타겟보다 스택을 많이 사용
+#define SIM_WORKQ_PRIORITY      (-1)
+
+enum
+{
+  THREAD_READY,
+  THREAD_BLOCKED,
+  THREAD_SUSPENDED,
+  THREAD_DEAD,
+};
+
+#define SIM_MUTEX_OWNER_ISR     ((struct k_thread *)1)
+
+
+static int64_t          sim_time_us = 0;
+static struct k_thread *cur_thread  = NULL;
+static ucontext_t       sched_ctx;
+static uint64_t         run_seq     = 0;
+static uint64_t         isr_ns      = 0;
+
+static struct k_thread *thread_list[SIM_THREAD_MAX];
+static uint32_t         thread_count = 0;
+
+static struct sim_timer *timer_head = NULL;
+static sim_slice_hook_t  slice_hook = NULL;
+
+static struct k_work   *workq_head = NULL;
+static struct k_work   *workq_tail = NULL;
+static struct k_thread  workq_thread;
+static K_THREAD_STACK_DEFINE(workq_stack, 16);
+
+
+static uint64_t cpuNs(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void threadEntry(void)
+{
+  struct k_thread *thread = cur_thread;
+
+  thread->entry(thread->p1, thread->p2, thread->p3);
+
+  thread->state = THREAD_DEAD;
+  swapcontext((ucontext_t *)thread->ctx, &sched_ctx);
+}
+
+static void switchTo(struct k_thread *thread)
+{
+  uint64_t start_ns;
+  uint64_t used_ns;
+
+  cur_thread = thread;
+  thread->run_seq = ++run_seq;
+  thread->run_count++;
+
+  start_ns = cpuNs();
+  swapcontext(&sched_ctx, (ucontext_t *)thread->ctx);
+  used_ns = cpuNs() - start_ns;
+  cur_thread = NULL;
+
+  thread->cpu_ns += used_ns;
+  if (slice_hook != NULL)
+  {
+    slice_hook(thread, used_ns);
+  }
+}
+
+static void yieldToScheduler(void)
+{
+  struct k_thread *thread = cur_thread;
+
+  if (thread == NULL)
+  {
+    fprintf(stderr, "sim: blocking call from ISR context\n");
+    abort();
+  }
+  swapcontext((ucontext_t *)thread->ctx, &sched_ctx);
+}
+
+static bool isRunnable(struct k_thread *thread)
+{
+  if (thread->state == THREAD_READY)
+  {
+    return true;
+  }
+  if (thread->state == THREAD_BLOCKED)
+  {
+    if (thread->cond != NULL && thread->cond(thread->cond_arg))
+    {
+      return true;
+    }
+    if (thread->deadline_us <= sim_time_us)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+static struct k_thread *pickThread(void)
+{
+  struct k_thread *best = NULL;
+
+  for (uint32_t i=0; i<thread_count; i++)
+  {
+    struct k_thread *thread = thread_list[i];
+
+    if (isRunnable(thread) == false)
+      continue;
+
+    if (best == NULL ||
+        thread->prio < best->prio ||
+        (thread->prio == best->prio && thread->run_seq < best->run_seq))
+    {
+      best = thread;
+    }
+  }
+
+  return best;
+}
+
+static int64_t nextEventTime(void)
+{
+  int64_t next = SIM_TIME_FOREVER;
+
+  if (timer_head != NULL)
+  {
+    next = timer_head->expire_us;
+  }
+  for (uint32_t i=0; i<thread_count; i++)
+  {
+    struct k_thread *thread = thread_list[i];
+
+    // 이미 지난 deadline 은 실행 가능 상태이므로 제외 (우선순위에 밀려 대기 중)
+    if (thread->state == THREAD_BLOCKED && thread->deadline_us > sim_time_us && thread->deadline_us < next)
+    {
+      next = thread->deadline_us;
+    }
+    if (thread->state == THREAD_READY && thread->busy_until_us > sim_time_us && thread->busy_until_us < next)
+    {
+      next = thread->busy_until_us;
+    }
+  }
+
+  return next;
+}
+
+static void timerInsert(struct sim_timer *timer)
+{
+  struct sim_timer **pp = &timer_head;
+
+  while (*pp != NULL && (*pp)->expire_us <= timer->expire_us)
+  {
+    pp = &(*pp)->next;
+  }
+  timer->next = *pp;
+  *pp = timer;
+}
+
+static void timerRemove(struct sim_timer *timer)
+{
+  struct sim_timer **pp = &timer_head;
+
+  while (*pp != NULL)
+  {
+    if (*pp == timer)
+    {
+      *pp = timer->next;
+      timer->next = NULL;
+      return;
+    }
+    pp = &(*pp)->next;
+  }
+}
+
+static void fireTimers(void)
+{
+  uint64_t start_ns = cpuNs();
+
+  while (timer_head != NULL && timer_head->expire_us <= sim_time_us)
+  {
+    struct sim_timer *timer = timer_head;
+
+    timer_head = timer->next;
+    timer->next = NULL;
+
+    if (timer->period_us > 0)
+    {
+      timer->expire_us += timer->period_us;
+      timerInsert(timer);
+    }
+    else
+    {
+      timer->is_active = false;
+    }
+    timer->func(timer->arg);
+  }
+
+  isr_ns += cpuNs() - start_ns;
+}
+
+static void advanceTo(int64_t time_us)
+{
+  if (time_us > sim_time_us)
+  {
+    sim_time_us = time_us;
+  }
+  fireTimers();
+}
+
+
+//-- sim API
+//
+static void workqThread(void *p1, void *p2, void *p3);
+
+void simKernelInit(void)
+{
+  sim_time_us  = 0;
+  thread_count = 0;
+  timer_head   = NULL;
+
+  k_thread_create(&workq_thread, workq_stack, K_THREAD_STACK_SIZEOF(workq_stack),
+                  workqThread, NULL, NULL, NULL,
+                  SIM_WORKQ_PRIORITY, 0, K_NO_WAIT);
+}
+
+void simKernelRun(int64_t until_us)
+{
+  while (sim_time_us < until_us)
+  {
+    struct k_thread *thread;
+
+    thread = pickThread();
+    if (thread != NULL)
+    {
+      if (thread->state == THREAD_READY && thread->busy_until_us > sim_time_us)
+      {
+        // busy wait 중인 스레드가 CPU 를 점유 : 다음 이벤트까지 시간만 진행
+        int64_t next = nextEventTime();
+
+        advanceTo(next < until_us ? next : until_us);
+        continue;
+      }
+
+      if (thread->state == THREAD_BLOCKED)
+      {
+        thread->wake_ok = (thread->cond != NULL && thread->cond(thread->cond_arg));
+        thread->state   = THREAD_READY;
+        thread->cond    = NULL;
+      }
+      switchTo(thread);
+      continue;
+    }
+
+    int64_t next = nextEventTime();
+
+    if (next > until_us)
+    {
+      next = until_us;
+    }
+    advanceTo(next);
+  }
+}
+
+int64_t simTimeUs(void)
+{
+  return sim_time_us;
+}
+
+bool simWait(bool (*cond)(void *arg), void *arg, int64_t timeout_us)
+{
+  struct k_thread *thread = cur_thread;
+
+  if (cond != NULL && cond(arg))
+  {
+    return true;
+  }
+  if (timeout_us == 0)
+  {
+    return false;
+  }
+
+  thread->cond        = cond;
+  thread->cond_arg    = arg;
+  thread->deadline_us = timeout_us < 0 ? SIM_TIME_FOREVER : sim_time_us + timeout_us;
+  thread->wake_ok     = false;
+  thread->state       = THREAD_BLOCKED;
+  yieldToScheduler();
+
+  return thread->wake_ok;
+}
+
+void simTimerStart(struct sim_timer *timer, int64_t delay_us, int64_t period_us,
+                   void (*func)(void *arg), void *arg)
+{
+  if (timer->is_active)
+  {
+    timerRemove(timer);
+  }
+  timer->expire_us = sim_time_us + (delay_us > 0 ? delay_us : 0);
+  timer->period_us = period_us;
+  timer->func      = func;
+  timer->arg       = arg;
+  timer->is_active = true;
+  timerInsert(timer);
+}
+
+void simTimerStop(struct sim_timer *timer)
+{
+  if (timer->is_active)
+  {
+    timerRemove(timer);
+    timer->is_active = false;
+  }
+}
+
+void simKernelSetSliceHook(sim_slice_hook_t hook)
+{
+  slice_hook = hook;
+}
+
+uint32_t simKernelGetThreads(struct k_thread **p_list, uint32_t max)
+{
+  uint32_t count = thread_count < max ? thread_count : max;
+
+  for (uint32_t i=0; i<count; i++)
+  {
+    p_list[i] = thread_list[i];
+  }
+  return count;
+}
+
+uint64_t simKernelGetIsrNs(void)
+{
+  return isr_ns;
+}
+
+
+//-- Thread
+//
+k_tid_t z_sim_thread_create(struct k_thread *new_thread, char *stack, size_t stack_size,
+                            k_thread_entry_t entry, const char *entry_name,
+                            void *p1, void *p2, void *p3,
+                            int prio, uint32_t options, k_timeout_t delay)
+{
+  ucontext_t *ctx;
+
+  ARG_UNUSED(stack);
+  ARG_UNUSED(options);
+
+  if (thread_count >= SIM_THREAD_MAX)
+  {
+    fprintf(stderr, "sim: too many threads\n");
+    abort();
+  }
+
+  memset(new_thread, 0, sizeof(struct k_thread));
+  new_thread->name       = entry_name;
+  new_thread->entry      = entry;
+  new_thread->p1         = p1;
+  new_thread->p2         = p2;
+  new_thread->p3         = p3;
+  new_thread->prio       = prio;
+  new_thread->stack_size = stack_size < SIM_STACK_MIN ? SIM_STACK_MIN : stack_size;
+  new_thread->stack      = malloc(new_thread->stack_size);
+  new_thread->stack_info.size = new_thread->stack_size;
+  // 타겟의 CONFIG_INIT_STACKS 처럼 채워 두고 바뀐 곳까지를 사용량으로 본다
+  memset(new_thread->stack, 0xAA, new_thread->stack_size);
+
+  ctx = calloc(1, sizeof(ucontext_t));
+  getcontext(ctx);
+  ctx->uc_stack.ss_sp   = new_thread->stack;
+  ctx->uc_stack.ss_size = new_thread->stack_size;
+  ctx->uc_link          = &sched_ctx;
+  makecontext(ctx, threadEntry, 0);
+  new_thread->ctx = ctx;
+
+  if (K_TIMEOUT_EQ(delay, K_NO_WAIT))
+  {
+    new_thread->state = THREAD_READY;
+  }
+  else
+  {
+    new_thread->state       = THREAD_BLOCKED;
+    new_thread->deadline_us = delay.us < 0 ? SIM_TIME_FOREVER : sim_time_us + delay.us;
+  }
+
+  thread_list[thread_count++] = new_thread;
+
+  return new_thread;
+}
+
+k_tid_t k_current_get(void)
+{
+  return cur_thread;
+}
+
+int k_thread_name_set(k_tid_t thread, const char *name)
+{
+  if (thread == NULL)
+  {
+    thread = cur_thread;
+  }
+  thread->name = name;
+  return 0;
+}
+
+const char *k_thread_name_get(k_tid_t thread)
+{
+  return thread->name;
+}
+
+int k_thread_priority_get(k_tid_t thread)
+{
+  return thread->prio;
+}
+
+void k_thread_priority_set(k_tid_t thread, int prio)
+{
+  thread->prio = prio;
+}
+
+void k_thread_foreach(k_thread_user_cb_t user_cb, void *user_data)
+{
+  for (uint32_t i=0; i<thread_count; i++)
+  {
+    user_cb(thread_list[i], user_data);
+  }
+}
+
+int k_thread_runtime_stats_get(k_tid_t thread, k_thread_runtime_stats_t *stats)
+{
+  stats->execution_cycles = thread->cpu_ns * SIM_CYCLES_PER_US / 1000;
+  return 0;
+}
+
+int k_thread_stack_space_get(const struct k_thread *thread, size_t *unused_ptr)
+{
+  const uint8_t *p_stack = (const uint8_t *)thread->stack;
+  size_t unused = 0;
+
+  // 스택은 위에서 아래로 자라므로 아래쪽부터 채운 값이 남아 있는 만큼이 미사용
+  while (unused < thread->stack_size && p_stack[unused] == 0xAA)
+  {
+    unused++;
+  }
+  *unused_ptr = unused;
+  return 0;
+}
+
+void k_thread_suspend(k_tid_t thread)
+{
+  thread->state = THREAD_SUSPENDED;
+  if (thread == cur_thread)
+  {
+    yieldToScheduler();
+  }
+}
+
+void k_thread_resume(k_tid_t thread)
+{
+  if (thread->state == THREAD_SUSPENDED)
+  {
+    thread->state = THREAD_READY;
+  }
+}
+
+void k_yield(void)
+{
+  if (cur_thread == NULL)
+  {
+    return;
+  }
+  cur_thread->state = THREAD_READY;
+  yieldToScheduler();
+}
+
+int32_t k_sleep(k_timeout_t timeout)
+{
+  if (cur_thread == NULL)
+  {
+    return 0;
+  }
+  if (timeout.us == 0)
+  {
+    k_yield();
+    return 0;
+  }
+  simWait(NULL, NULL, timeout.us);
+  return 0;
+}
+
+int32_t k_msleep(int32_t ms)
+{
+  return k_sleep(K_MSEC(ms));
+}
+
+int32_t k_usleep(int32_t us)
+{
+  return k_sleep(K_USEC(us));
+}
+
+void k_busy_wait(uint32_t usec_to_wait)
+{
+  if (cur_thread == NULL)
+  {
+    // ISR 에서의 busy wait 는 시간만 진행 (타이머는 ISR 이 끝난 뒤 처리)
+    sim_time_us += usec_to_wait;
+    return;
+  }
+  cur_thread->busy_until_us = sim_time_us + usec_to_wait;
+  cur_thread->state = THREAD_READY;
+  yieldToScheduler();
+}
+
+int64_t k_uptime_get(void)
+{
+  return sim_time_us / 1000;
+}
+
+uint32_t k_uptime_get_32(void)
+{
+  return (uint32_t)k_uptime_get();
+}
+
+uint32_t k_cycle_get_32(void)
+{
+  return (uint32_t)(sim_time_us * SIM_CYCLES_PER_US);
+}
+
+uint64_t k_cycle_get_64(void)
+{
+  return (uint64_t)sim_time_us * SIM_CYCLES_PER_US;
+}
+
+
+//-- Mutex
+//
+static bool mutexIsFree(void *arg)
+{
+  struct k_mutex *mutex = (struct k_mutex *)arg;
+
+  return mutex->owner == NULL;
+}
+
+int k_mutex_init(struct k_mutex *mutex)
+{
+  mutex->owner      = NULL;
+  mutex->lock_count = 0;
+  return 0;
+}
+
+int k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
+{
+  struct k_thread *owner = cur_thread != NULL ? cur_thread : SIM_MUTEX_OWNER_ISR;
+
+  if (mutex->owner == owner)
+  {
+    mutex->lock_count++;
+    return 0;
+  }
+
+  if (mutex->owner != NULL)
+  {
+    if (cur_thread == NULL)
+    {
+      // 타겟에서는 ISR 에서 mutex 를 기다릴 수 없음 (스레드가 잡고 있는 동안 RX 인터럽트 등)
+      fprintf(stderr, "sim: mutex %p contended in ISR context (owner %s)\n",
+              (void *)mutex, mutex->owner->name);
+      abort();
+    }
+    if (simWait(mutexIsFree, mutex, timeout.us) == false)
+    {
+      return -EAGAIN;
+    }
+  }
+
+  mutex->owner      = owner;
+  mutex->lock_count = 1;
+  return 0;
+}
+
+int k_mutex_unlock(struct k_mutex *mutex)
+{
+  struct k_thread *owner = cur_thread != NULL ? cur_thread : SIM_MUTEX_OWNER_ISR;
+
+  if (mutex->owner != owner)
+  {
+    return -EPERM;
+  }
+  if (--mutex->lock_count == 0)
+  {
+    mutex->owner = NULL;
+  }
+  return 0;
+}
+
+
+//-- Semaphore
+//
+static bool semIsAvailable(void *arg)
+{
+  struct k_sem *sem = (struct k_sem *)arg;
+
+  return sem->count > 0;
+}
+
+int k_sem_init(struct k_sem *sem, unsigned int initial_count, unsigned int limit)
+{
+  sem->count = initial_count;
+  sem->limit = limit;
+  return 0;
+}
+
+int k_sem_take(struct k_sem *sem, k_timeout_t timeout)
+{
+  if (sem->count == 0)
+  {
+    if (cur_thread == NULL || simWait(semIsAvailable, sem, timeout.us) == false)
+    {
+      return timeout.us == 0 ? -EBUSY : -EAGAIN;
+    }
+  }
+  sem->count--;
+  return 0;
+}
+
+void k_sem_give(struct k_sem *sem)
+{
+  if (sem->count < sem->limit)
+  {
+    sem->count++;
+  }
+}
+
+void k_sem_reset(struct k_sem *sem)
+{
+  sem->count = 0;
+}
+
+unsigned k_sem_count_get(struct k_sem *sem)
+{
+  return sem->count;
+}
+
+
+//-- Event
+//
+typedef struct
+{
+  struct k_event *event;
+  uint32_t        mask;
+  bool            is_all;
+} event_wait_t;
+
+static bool eventIsSet(void *arg)
+{
+  event_wait_t *wait = (event_wait_t *)arg;
+  uint32_t match = wait->event->events & wait->mask;
+
+  return wait->is_all ? (match == wait->mask) : (match != 0);
+}
+
+static uint32_t eventWait(struct k_event *event, uint32_t events, bool reset, k_timeout_t timeout, bool is_all)
+{
+  event_wait_t wait = {event, events, is_all};
+
+  if (reset)
+  {
+    event->events = 0;
+  }
+  if (cur_thread == NULL)
+  {
+    return eventIsSet(&wait) ? (event->events & events) : 0;
+  }
+  if (simWait(eventIsSet, &wait, timeout.us) == false)
+  {
+    return 0;
+  }
+  return event->events & events;
+}
+
+void k_event_init(struct k_event *event)
+{
+  event->events = 0;
+}
+
+uint32_t k_event_post(struct k_event *event, uint32_t events)
+{
+  uint32_t pre_events = event->events;
+
+  event->events |= events;
+  return pre_events;
+}
+
+uint32_t k_event_set(struct k_event *event, uint32_t events)
+{
+  uint32_t pre_events = event->events;
+
+  event->events = events;
+  return pre_events;
+}
+
+uint32_t k_event_clear(struct k_event *event, uint32_t events)
+{
+  uint32_t pre_events = event->events;
+
+  event->events &= ~events;
+  return pre_events;
+}
+
+uint32_t k_event_test(struct k_event *event, uint32_t events_mask)
+{
+  return event->events & events_mask;
+}
+
+uint32_t k_event_wait(struct k_event *event, uint32_t events, bool reset, k_timeout_t timeout)
+{
+  return eventWait(event, events, reset, timeout, false);
+}
+
+uint32_t k_event_wait_all(struct k_event *event, uint32_t events, bool reset, k_timeout_t timeout)
+{
+  return eventWait(event, events, reset, timeout, true);
+}
+
+
+//-- Work queue
+//
+static bool workqIsPending(void *arg)
+{
+  ARG_UNUSED(arg);
+  return workq_head != NULL;
+}
+
+static void workqThread(void *p1, void *p2, void *p3)
+{
+  ARG_UNUSED(p1);
+  ARG_UNUSED(p2);
+  ARG_UNUSED(p3);
+
+  while (1)
+  {
+    struct k_work *work;
+
+    simWait(workqIsPending, NULL, -1);
+
+    work = workq_head;
+    workq_head = work->next;
+    if (workq_head == NULL)
+    {
+      workq_tail = NULL;
+    }
+    work->next      = NULL;
+    work->is_queued = false;
+
+    work->handler(work);
+  }
+}
+
+static void workqRemove(struct k_work *work)
+{
+  struct k_work **pp = &workq_head;
+
+  workq_tail = NULL;
+  while (*pp != NULL)
+  {
+    if (*pp == work)
+    {
+      *pp = work->next;
+      work->next = NULL;
+      work->is_queued = false;
+      continue;
+    }
+    workq_tail = *pp;
+    pp = &(*pp)->next;
+  }
+}
+
+static void delayableExpire(void *arg)
+{
+  k_work_submit((struct k_work *)arg);
+}
+
+void k_work_init(struct k_work *work, k_work_handler_t handler)
+{
+  memset(work, 0, sizeof(struct k_work));
+  work->handler = handler;
+}
+
+int k_work_submit(struct k_work *work)
+{
+  if (work->is_queued)
+  {
+    return 0;
+  }
+
+  work->next = NULL;
+  work->is_queued = true;
+  if (workq_tail != NULL)
+  {
+    workq_tail->next = work;
+  }
+  else
+  {
+    workq_head = work;
+  }
+  workq_tail = work;
+
+  return 1;
+}
+
+void k_work_init_delayable(struct k_work_delayable *dwork, k_work_handler_t handler)
+{
+  memset(dwork, 0, sizeof(struct k_work_delayable));
+  dwork->work.handler = handler;
+}
+
+int k_work_schedule(struct k_work_delayable *dwork, k_timeout_t delay)
+{
+  if (k_work_delayable_is_pending(dwork))
+  {
+    return 0;
+  }
+  return k_work_reschedule(dwork, delay);
+}
+
+int k_work_reschedule(struct k_work_delayable *dwork, k_timeout_t delay)
+{
+  simTimerStop(&dwork->timer);
+
+  if (delay.us == 0)
+  {
+    return k_work_submit(&dwork->work);
+  }
+  if (delay.us > 0)
+  {
+    simTimerStart(&dwork->timer, delay.us, 0, delayableExpire, &dwork->work);
+  }
+  return 1;
+}
+
+int k_work_cancel_delayable(struct k_work_delayable *dwork)
+{
+  simTimerStop(&dwork->timer);
+  if (dwork->work.is_queued)
+  {
+    workqRemove(&dwork->work);
+  }
+  return 0;
+}
+
+bool k_work_delayable_is_pending(const struct k_work_delayable *dwork)
+{
+  return dwork->timer.is_active || dwork->work.is_queued;
+}
+
+
+//-- Timer
+//
+static void timerExpire(void *arg)
+{
+  struct k_timer *timer = (struct k_timer *)arg;
+
+  if (timer->expiry_fn != NULL)
+  {
+    timer->expiry_fn(timer);
+  }
+}
+
+void k_timer_init(struct k_timer *timer, k_timer_expiry_t expiry_fn, k_timer_stop_t stop_fn)
+{
+  memset(timer, 0, sizeof(struct k_timer));
+  timer->expiry_fn = expiry_fn;
+  timer->stop_fn   = stop_fn;
+}
+
+void k_timer_start(struct k_timer *timer, k_timeout_t duration, k_timeout_t period)
+{
+  if (duration.us < 0)
+  {
+    simTimerStop(&timer->timer);
+    return;
+  }
+  simTimerStart(&timer->timer, duration.us, period.us > 0 ? period.us : 0, timerExpire, timer);
+}
+
+void k_timer_stop(struct k_timer *timer)
+{
+  bool is_active = timer->timer.is_active;
+
+  simTimerStop(&timer->timer);
+  if (is_active && timer->stop_fn != NULL)
+  {
+    timer->stop_fn(timer);
+  }
+}
@@ -0,0 +1,56 @@
+/*
+ * sim_kernel.h
+ *
+ *  호스트 시뮬레이션용 Zephyr 커널 흉내 (sim 전용 API)
+ */
+#ifndef SIM_KERNEL_H_
+#define SIM_KERNEL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <zephyr/kernel.h>
+
+
+#define SIM_THREAD_MAX          16
+#define SIM_TIME_FOREVER        INT64_MAX
+
+
+typedef void (*sim_slice_hook_t)(struct k_thread *thread, uint64_t cpu_ns);
+
+
+void     simKernelInit(void);
+
+/**
+ * @brief 가상 시간이 until_us 가 될 때까지 스레드/타이머를 실행
+ * @note  실행할 스레드가 없으면 다음 타이머(또는 sleep 만료) 시점으로 시간을 건너뛴다
+ */
+void     simKernelRun(int64_t until_us);
+int64_t  simTimeUs(void);
+
+/**
+ * @brief 현재 스레드를 cond(arg) 가 true 가 되거나 timeout 될 때까지 블록
+ * @return cond 가 만족되면 true, timeout 이면 false
+ */
+bool     simWait(bool (*cond)(void *arg), void *arg, int64_t timeout_us);
+
+/**
+ * @brief 가상 시간 타이머 (만료 시 ISR 컨텍스트에서 func 호출)
+ */
+void     simTimerStart(struct sim_timer *timer, int64_t delay_us, int64_t period_us,
+                       void (*func)(void *arg), void *arg);
+void     simTimerStop(struct sim_timer *timer);
+
+/**
+ * @brief 스레드가 한 번 실행되고 블록될 때마다 사용한 호스트 CPU 시간을 전달
+ */
+void     simKernelSetSliceHook(sim_slice_hook_t hook);
+uint32_t simKernelGetThreads(struct k_thread **p_list, uint32_t max);
+uint64_t simKernelGetIsrNs(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,496 @@
+/*
+ * sim_usb.c
+ *
+ *  legacy USB device stack + USB 호스트 흉내
+ *
+ *  - usb_enable() 후 SIM_USB_ENUM_US 가 지나면 CONFIGURED (호스트 enumeration)
+ *  - 1ms 마다 SOF. HID IN 엔드포인트(bInterval 1ms)는 SOF 마다 한 번 호스트가 가져간다.
+ *    가져가기 전에 다시 쓰면 -EAGAIN (실제 nrfx usbd 와 같이 엔드포인트 busy)
+ *  - 상태 콜백, HID IN 완료/OUT, CDC 수신 콜백은 nrfx usbd 드라이버와 같이 워크큐에서 호출된다.
+ *  - CDC ACM(cdc_acm_uart0) 은 stdout 으로 출력하고, 입력은 시나리오의 cli 명령으로 받는다.
+ */
+#include "sim.h"
+#include <zephyr/usb/usb_device.h>
+#include <zephyr/usb/class/usb_hid.h>
+#include <zephyr/drivers/uart.h>
+
+
+#define SIM_USB_SOF_US              1000
+#define SIM_USB_ENUM_US             (120*1000)    // 연결 후 CONFIGURED 까지
+#define SIM_USB_RESUME_US           (20*1000)     // remote wakeup 후 호스트 resume 까지
+#define SIM_USB_EVT_MAX             16
+#define SIM_USB_EP_SIZE             64
+#define SIM_USB_CDC_RX_MAX          1024
+
+
+typedef struct
+{
+  const struct device  *dev;
+  const struct hid_ops *ops;
+  bool                  is_in_busy;
+  bool                  is_in_done;     // 호스트가 가져감 -> int_in_ready 호출 대기
+  uint8_t               in_buf[SIM_USB_EP_SIZE];
+  uint32_t              in_len;
+  uint8_t               out_buf[SIM_USB_EP_SIZE];
+  uint32_t              out_len;
+  bool                  is_out_ready;
+} sim_hid_ep_t;
+
+extern const struct device sim_dev_hid0;
+extern const struct device sim_dev_hid1;
+
+
+static usb_dc_status_callback status_cb = NULL;
+static bool is_enabled    = false;
+static bool is_attached   = true;
+static bool is_configured = false;
+static bool is_suspended  = false;
+
+static enum usb_dc_status_code evt_q[SIM_USB_EVT_MAX];
+static uint32_t evt_in  = 0;
+static uint32_t evt_out = 0;
+
+static struct sim_timer sof_timer;
+static struct sim_timer enum_timer;
+static struct sim_timer resume_timer;
+static struct k_work    usb_work;
+
+static sim_hid_ep_t hid_ep[2] =
+{
+  {&sim_dev_hid0},
+  {&sim_dev_hid1},
+};
+
+static uart_irq_callback_user_data_t cdc_cb = NULL;
+static bool     cdc_rx_enable = false;
+static bool     cdc_echo      = true;
+static uint8_t  cdc_rx_buf[SIM_USB_CDC_RX_MAX];
+static uint32_t cdc_rx_len = 0;
+static bool     cdc_rx_pending = false;
+
+static sim_stats_t   *p_stats = NULL;
+static sim_hid_hook_t hid_hook = NULL;
+
+
+static void usbPutEvent(enum usb_dc_status_code code)
+{
+  if (evt_in - evt_out >= SIM_USB_EVT_MAX)
+  {
+    return;
+  }
+  evt_q[evt_in % SIM_USB_EVT_MAX] = code;
+  evt_in++;
+  k_work_submit(&usb_work);
+}
+
+static void usbWorkFunc(struct k_work *work)
+{
+  ARG_UNUSED(work);
+
+  while (evt_out != evt_in)
+  {
+    enum usb_dc_status_code code = evt_q[evt_out % SIM_USB_EVT_MAX];
+
+    evt_out++;
+    if (status_cb != NULL)
+    {
+      status_cb(code, NULL);
+    }
+  }
+
+  for (int i=0; i<2; i++)
+  {
+    if (hid_ep[i].is_in_done)
+    {
+      hid_ep[i].is_in_done = false;
+      if (hid_ep[i].ops != NULL && hid_ep[i].ops->int_in_ready != NULL)
+      {
+        hid_ep[i].ops->int_in_ready(hid_ep[i].dev);
+      }
+    }
+    if (hid_ep[i].is_out_ready)
+    {
+      hid_ep[i].is_out_ready = false;
+      if (hid_ep[i].ops != NULL && hid_ep[i].ops->int_out_ready != NULL)
+      {
+        hid_ep[i].ops->int_out_ready(hid_ep[i].dev);
+      }
+    }
+  }
+
+  if (cdc_rx_pending)
+  {
+    cdc_rx_pending = false;
+    if (cdc_cb != NULL && cdc_rx_enable)
+    {
+      cdc_cb(&sim_dev_cdc_acm_uart0, NULL);
+    }
+  }
+}
+
+static void sofTimerFunc(void *arg)
+{
+  ARG_UNUSED(arg);
+
+  if (!is_enabled || !is_configured || is_suspended)
+  {
+    return;
+  }
+
+  // 호스트가 IN 엔드포인트를 가져감 (interval 1ms)
+  for (int i=0; i<2; i++)
+  {
+    sim_hid_ep_t *p_ep = &hid_ep[i];
+
+    if (p_ep->is_in_busy)
+    {
+      p_ep->is_in_busy = false;
+      p_ep->is_in_done = true;
+      if (hid_hook != NULL)
+      {
+        sim_hid_t type;
+
+        if (i == 1)
+          type = SIM_HID_VIA;
+        else
+          type = p_ep->in_buf[0] == 0x02 ? SIM_HID_MOUSE : SIM_HID_KEYBOARD;
+
+        p_stats->hid_report[type]++;
+        hid_hook(type, p_ep->in_buf, p_ep->in_len);
+      }
+    }
+  }
+
+  p_stats->usb_sof++;
+  usbPutEvent(USB_DC_SOF);
+}
+
+static void enumTimerFunc(void *arg)
+{
+  ARG_UNUSED(arg);
+
+  if (!is_enabled || !is_attached)
+  {
+    return;
+  }
+  is_configured = true;
+  is_suspended  = false;
+  usbPutEvent(USB_DC_CONFIGURED);
+}
+
+static void resumeTimerFunc(void *arg)
+{
+  ARG_UNUSED(arg);
+  simUsbSuspend(false);
+}
+
+static sim_hid_ep_t *hidGetEp(const struct device *dev)
+{
+  for (int i=0; i<2; i++)
+  {
+    if (hid_ep[i].dev == dev)
+    {
+      return &hid_ep[i];
+    }
+  }
+  return NULL;
+}
+
+
+//-- sim API
+//
+void simUsbInit(sim_stats_t *stats, sim_hid_hook_t hook)
+{
+  p_stats  = stats;
+  hid_hook = hook;
+  k_work_init(&usb_work, usbWorkFunc);
+  simTimerStart(&sof_timer, SIM_USB_SOF_US, SIM_USB_SOF_US, sofTimerFunc, NULL);
+}
+
+void simUsbConnect(bool connect)
+{
+  if (connect == is_attached)
+  {
+    return;
+  }
+  is_attached = connect;
+
+  if (connect)
+  {
+    if (is_enabled)
+    {
+      usbPutEvent(USB_DC_CONNECTED);
+      usbPutEvent(USB_DC_RESET);
+      simTimerStart(&enum_timer, SIM_USB_ENUM_US, 0, enumTimerFunc, NULL);
+    }
+  }
+  else
+  {
+    is_configured = false;
+    is_suspended  = false;
+    hid_ep[0].is_in_busy = false;
+    hid_ep[1].is_in_busy = false;
+    simTimerStop(&enum_timer);
+    if (is_enabled)
+    {
+      usbPutEvent(USB_DC_DISCONNECTED);
+    }
+  }
+}
+
+void simUsbSuspend(bool suspend)
+{
+  if (!is_enabled || !is_configured || suspend == is_suspended)
+  {
+    return;
+  }
+  is_suspended = suspend;
+  usbPutEvent(suspend ? USB_DC_SUSPEND : USB_DC_RESUME);
+}
+
+bool simUsbIsConfigured(void)
+{
+  return is_configured;
+}
+
+bool simUsbIsWakeupWait(void)
+{
+  // suspend 중이고 아직 remote wakeup 요청을 받지 않음
+  return is_suspended && !resume_timer.is_active;
+}
+
+bool simUsbViaWrite(const uint8_t *p_data, uint32_t length)
+{
+  sim_hid_ep_t *p_ep = &hid_ep[1];
+
+  if (!is_configured || is_suspended)
+  {
+    return false;
+  }
+  memset(p_ep->out_buf, 0, sizeof(p_ep->out_buf));
+  memcpy(p_ep->out_buf, p_data, length < SIM_USB_EP_SIZE ? length : SIM_USB_EP_SIZE);
+  p_ep->out_len      = length;
+  p_ep->is_out_ready = true;
+  k_work_submit(&usb_work);
+  return true;
+}
+
+void simUsbCdcInput(const char *p_str)
+{
+  uint32_t length = strlen(p_str);
+
+  if (cdc_rx_len + length > SIM_USB_CDC_RX_MAX)
+  {
+    length = SIM_USB_CDC_RX_MAX - cdc_rx_len;
+  }
+  memcpy(&cdc_rx_buf[cdc_rx_len], p_str, length);
+  cdc_rx_len += length;
+  cdc_rx_pending = true;
+  k_work_submit(&usb_work);
+}
+
+void simUsbCdcEcho(bool enable)
+{
+  cdc_echo = enable;
+}
+
+
+//-- usb_device.h
+//
+int usb_enable(usb_dc_status_callback cb)
+{
+  status_cb  = cb;
+  is_enabled = true;
+
+  if (is_attached)
+  {
+    usbPutEvent(USB_DC_CONNECTED);
+    usbPutEvent(USB_DC_RESET);
+    simTimerStart(&enum_timer, SIM_USB_ENUM_US, 0, enumTimerFunc, NULL);
+  }
+  return 0;
+}
+
+int usb_disable(void)
+{
+  is_enabled    = false;
+  is_configured = false;
+  is_suspended  = false;
+  simTimerStop(&enum_timer);
+  return 0;
+}
+
+int usb_wakeup_request(void)
+{
+  if (!is_suspended)
+  {
+    return -EAGAIN;
+  }
+  p_stats->usb_wakeup++;
+  simMarkWakeup();
+  if (!resume_timer.is_active)
+  {
+    simTimerStart(&resume_timer, SIM_USB_RESUME_US, 0, resumeTimerFunc, NULL);
+  }
+  return 0;
+}
+
+int usb_write(uint8_t ep, const uint8_t *data, uint32_t data_len, uint32_t *bytes_ret)
+{
+  ARG_UNUSED(ep);
+  return hid_int_ep_write(&sim_dev_hid0, data, data_len, bytes_ret);
+}
+
+
+//-- usb_hid.h
+//
+void usb_hid_register_device(const struct device *dev, const uint8_t *desc, size_t size, const struct hid_ops *op)
+{
+  sim_hid_ep_t *p_ep = hidGetEp(dev);
+
+  ARG_UNUSED(desc);
+  ARG_UNUSED(size);
+  if (p_ep != NULL)
+  {
+    p_ep->ops = op;
+  }
+}
+
+int usb_hid_init(const struct device *dev)
+{
+  return hidGetEp(dev) != NULL ? 0 : -ENODEV;
+}
+
+int hid_int_ep_write(const struct device *dev, const uint8_t *data, uint32_t data_len, uint32_t *bytes_ret)
+{
+  sim_hid_ep_t *p_ep = hidGetEp(dev);
+
+  if (p_ep == NULL || data_len > SIM_USB_EP_SIZE)
+  {
+    return -EINVAL;
+  }
+  if (!is_configured || is_suspended)
+  {
+    p_stats->hid_not_ready++;
+    return -EAGAIN;
+  }
+  if (p_ep->is_in_busy)
+  {
+    p_stats->hid_busy++;
+    return -EAGAIN;
+  }
+
+  memcpy(p_ep->in_buf, data, data_len);
+  p_ep->in_len     = data_len;
+  p_ep->is_in_busy = true;
+  if (bytes_ret != NULL)
+  {
+    *bytes_ret = data_len;
+  }
+  return 0;
+}
+
+int hid_int_ep_read(const struct device *dev, uint8_t *data, uint32_t max_data_len, uint32_t *ret_bytes)
+{
+  sim_hid_ep_t *p_ep = hidGetEp(dev);
+  uint32_t length;
+
+  if (p_ep == NULL)
+  {
+    return -EINVAL;
+  }
+  length = p_ep->out_len < max_data_len ? p_ep->out_len : max_data_len;
+  memcpy(data, p_ep->out_buf, length);
+  if (ret_bytes != NULL)
+  {
+    *ret_bytes = length;
+  }
+  return 0;
+}
+
+
+//-- uart.h (cdc_acm_uart0)
+//
+int uart_line_ctrl_get(const struct device *dev, uint32_t ctrl, uint32_t *val)
+{
+  ARG_UNUSED(dev);
+
+  switch (ctrl)
+  {
+    case UART_LINE_CTRL_DTR:
+      *val = is_configured ? 1 : 0;   // 호스트 터미널이 포트를 열었다고 가정
+      break;
+    case UART_LINE_CTRL_BAUD_RATE:
+      *val = 115200;
+      break;
+    default:
+      *val = 0;
+      break;
+  }
+  return 0;
+}
+
+int uart_line_ctrl_set(const struct device *dev, uint32_t ctrl, uint32_t val)
+{
+  ARG_UNUSED(dev);
+  ARG_UNUSED(ctrl);
+  ARG_UNUSED(val);
+  return 0;
+}
+
+int uart_irq_callback_set(const struct device *dev, uart_irq_callback_user_data_t cb)
+{
+  ARG_UNUSED(dev);
+  cdc_cb = cb;
+  return 0;
+}
+
+void uart_irq_rx_enable(const struct device *dev)
+{
+  ARG_UNUSED(dev);
+  cdc_rx_enable = true;
+  if (cdc_rx_len > 0)
+  {
+    cdc_rx_pending = true;
+    k_work_submit(&usb_work);
+  }
+}
+
+int uart_irq_update(const struct device *dev)
+{
+  ARG_UNUSED(dev);
+  return 1;
+}
+
+int uart_irq_is_pending(const struct device *dev)
+{
+  ARG_UNUSED(dev);
+  return cdc_rx_len > 0;
+}
+
+int uart_irq_rx_ready(const struct device *dev)
+{
+  ARG_UNUSED(dev);
+  return cdc_rx_len > 0;
+}
+
+int uart_fifo_read(const struct device *dev, uint8_t *rx_data, const int size)
+{
+  uint32_t length = cdc_rx_len < (uint32_t)size ? cdc_rx_len : (uint32_t)size;
+
+  ARG_UNUSED(dev);
+  memcpy(rx_data, cdc_rx_buf, length);
+  memmove(cdc_rx_buf, &cdc_rx_buf[length], cdc_rx_len - length);
+  cdc_rx_len -= length;
+  return (int)length;
+}
+
+int uart_fifo_fill(const struct device *dev, const uint8_t *tx_data, int size)
+{
+  ARG_UNUSED(dev);
+  if (cdc_echo)
+  {
+    fwrite(tx_data, 1, size, stdout);
+  }
+  return size;
+}
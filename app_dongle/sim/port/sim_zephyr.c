@@ -0,0 +1,264 @@
+/*
+ * sim_zephyr.c
+ *
+ *  sim 에서 사용하는 Zephyr 디바이스 (gpio, flash, clock control, log)
+ */
+#include "sim.h"
+
+#include <stdarg.h>
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/drivers/clock_control/nrf_clock_control.h>
+#include <zephyr/storage/flash_map.h>
+
+
+#define SIM_GPIO_PIN_MAX        48
+#define SIM_FLASH_BASE          FIXED_PARTITION_OFFSET(keymap_partition)
+#define SIM_FLASH_SIZE          FIXED_PARTITION_SIZE(keymap_partition)
+#define SIM_FLASH_PAGE_SIZE     4096
+#define SIM_FLASH_ERASE_US      85000     // nRF52840 page erase (max)
+#define SIM_FLASH_WRITE_US      41        // word write (max)
+
+
+const struct device sim_dev_gpio0         = {"gpio0", NULL};
+const struct device sim_dev_flash0        = {"flash_controller", NULL};
+const struct device sim_dev_cdc_acm_uart0 = {"cdc_acm_uart0", NULL};
+const struct device sim_dev_hid0          = {"HID_0", NULL};
+const struct device sim_dev_hid1          = {"HID_1", NULL};
+
+static const struct device *device_list[] =
+{
+  &sim_dev_gpio0,
+  &sim_dev_flash0,
+  &sim_dev_cdc_acm_uart0,
+  &sim_dev_hid0,
+  &sim_dev_hid1,
+};
+
+static uint8_t gpio_state[SIM_GPIO_PIN_MAX];
+static gpio_flags_t gpio_int_flags[SIM_GPIO_PIN_MAX];
+static struct gpio_callback *gpio_cb_head = NULL;
+static uint8_t flash_mem[SIM_FLASH_SIZE];
+static struct onoff_manager hf_clock_mgr;
+static sim_stats_t *p_stats = NULL;
+
+int sim_log_level = LOG_LEVEL_WRN;
+
+
+void simZephyrInit(sim_stats_t *stats)
+{
+  p_stats = stats;
+  memset(flash_mem, 0xFF, sizeof(flash_mem));
+}
+
+const struct device *device_get_binding(const char *name)
+{
+  for (size_t i=0; i<ARRAY_SIZE(device_list); i++)
+  {
+    if (strcmp(device_list[i]->name, name) == 0)
+    {
+      return device_list[i];
+    }
+  }
+  return NULL;
+}
+
+void simLogPrintf(const char *module, int level, const char *fmt, ...)
+{
+  static const char *level_str[] = {"", "err", "wrn", "inf", "dbg"};
+  va_list args;
+
+  if (level > sim_log_level)
+  {
+    return;
+  }
+
+  printf("[%10.3f] <%s> %s: ", (double)simTimeUs() / 1000.0, level_str[level], module);
+  va_start(args, fmt);
+  vprintf(fmt, args);
+  va_end(args);
+  printf("\n");
+}
+
+
+//-- gpio
+//
+int gpio_pin_configure(const struct device *port, gpio_pin_t pin, gpio_flags_t flags)
+{
+  ARG_UNUSED(port);
+  ARG_UNUSED(flags);
+  return pin < SIM_GPIO_PIN_MAX ? 0 : -EINVAL;
+}
+
+int gpio_pin_set(const struct device *port, gpio_pin_t pin, int value)
+{
+  ARG_UNUSED(port);
+  if (pin >= SIM_GPIO_PIN_MAX)
+  {
+    return -EINVAL;
+  }
+  gpio_state[pin] = value ? 1 : 0;
+  return 0;
+}
+
+int gpio_pin_get(const struct device *port, gpio_pin_t pin)
+{
+  ARG_UNUSED(port);
+  if (pin >= SIM_GPIO_PIN_MAX)
+  {
+    return -EINVAL;
+  }
+  return gpio_state[pin];
+}
+
+int gpio_pin_toggle(const struct device *port, gpio_pin_t pin)
+{
+  ARG_UNUSED(port);
+  if (pin >= SIM_GPIO_PIN_MAX)
+  {
+    return -EINVAL;
+  }
+  gpio_state[pin] ^= 1;
+  return 0;
+}
+
+int simGpioGet(uint8_t pin)
+{
+  return pin < SIM_GPIO_PIN_MAX ? gpio_state[pin] : 0;
+}
+
+int gpio_add_callback(const struct device *port, struct gpio_callback *callback)
+{
+  ARG_UNUSED(port);
+  gpio_remove_callback(port, callback);
+  callback->next = gpio_cb_head;
+  gpio_cb_head   = callback;
+  return 0;
+}
+
+int gpio_remove_callback(const struct device *port, struct gpio_callback *callback)
+{
+  struct gpio_callback **pp = &gpio_cb_head;
+
+  ARG_UNUSED(port);
+  while (*pp != NULL)
+  {
+    if (*pp == callback)
+    {
+      *pp = callback->next;
+      callback->next = NULL;
+      return 0;
+    }
+    pp = &(*pp)->next;
+  }
+  return -EINVAL;
+}
+
+int gpio_pin_interrupt_configure(const struct device *port, gpio_pin_t pin, gpio_flags_t flags)
+{
+  ARG_UNUSED(port);
+  if (pin >= 32)
+  {
+    return -ENOTSUP;
+  }
+  gpio_int_flags[pin] = (flags & GPIO_INT_DISABLE) ? 0 : flags;
+  return 0;
+}
+
+// 입력 핀 레벨을 바꾸고 설정된 에지면 콜백 호출 (sim 타이머 ISR 에서 호출)
+void simGpioSetInput(uint8_t pin, int value)
+{
+  uint8_t pre;
+  gpio_flags_t edge;
+
+  if (pin >= SIM_GPIO_PIN_MAX)
+  {
+    return;
+  }
+  pre = gpio_state[pin];
+  gpio_state[pin] = value ? 1 : 0;
+  if (pre == gpio_state[pin])
+  {
+    return;
+  }
+
+  edge = gpio_state[pin] ? GPIO_INT_EDGE_RISING : GPIO_INT_EDGE_FALLING;
+  if ((gpio_int_flags[pin] & edge) == 0)
+  {
+    return;
+  }
+  for (struct gpio_callback *cb = gpio_cb_head, *next; cb != NULL; cb = next)
+  {
+    next = cb->next;
+    if (cb->pin_mask & BIT(pin))
+    {
+      cb->handler(&sim_dev_gpio0, cb, BIT(pin));
+    }
+  }
+}
+
+
+//-- flash (keymap_partition 영역만 존재)
+//
+static bool flashIsValid(off_t offset, size_t len)
+{
+  return offset >= SIM_FLASH_BASE && offset + (off_t)len <= SIM_FLASH_BASE + SIM_FLASH_SIZE;
+}
+
+int flash_read(const struct device *dev, off_t offset, void *data, size_t len)
+{
+  ARG_UNUSED(dev);
+  if (!flashIsValid(offset, len))
+  {
+    return -EINVAL;
+  }
+  memcpy(data, &flash_mem[offset - SIM_FLASH_BASE], len);
+  return 0;
+}
+
+int flash_write(const struct device *dev, off_t offset, const void *data, size_t len)
+{
+  const uint8_t *p_data = (const uint8_t *)data;
+
+  ARG_UNUSED(dev);
+  if (!flashIsValid(offset, len) || (offset % 4) != 0 || (len % 4) != 0)
+  {
+    return -EINVAL;
+  }
+  for (size_t i=0; i<len; i++)
+  {
+    // NOR flash : 1 -> 0 으로만 바뀐다
+    flash_mem[offset - SIM_FLASH_BASE + i] &= p_data[i];
+  }
+  if (p_stats != NULL)
+  {
+    p_stats->flash_write_bytes += len;
+  }
+  k_busy_wait(SIM_FLASH_WRITE_US * (len / 4));
+  return 0;
+}
+
+int flash_erase(const struct device *dev, off_t offset, size_t size)
+{
+  ARG_UNUSED(dev);
+  if (!flashIsValid(offset, size) || (offset % SIM_FLASH_PAGE_SIZE) != 0 || (size % SIM_FLASH_PAGE_SIZE) != 0)
+  {
+    return -EINVAL;
+  }
+  memset(&flash_mem[offset - SIM_FLASH_BASE], 0xFF, size);
+  if (p_stats != NULL)
+  {
+    p_stats->flash_erase_pages += size / SIM_FLASH_PAGE_SIZE;
+  }
+  k_busy_wait(SIM_FLASH_ERASE_US * (size / SIM_FLASH_PAGE_SIZE));
+  return 0;
+}
+
+
+//-- clock control
+//
+struct onoff_manager *z_nrf_clock_control_get_onoff(int subsys)
+{
+  ARG_UNUSED(subsys);
+  return &hf_clock_mgr;
+}
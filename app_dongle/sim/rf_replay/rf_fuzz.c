@@ -0,0 +1,250 @@
+/*
+ * rf_fuzz.c
+ *
+ *  my_key_protocol 수신 디코더 fuzz 타겟
+ *
+ *  - clang 이면 libFuzzer 로 빌드 (LLVMFuzzerTestOneInput)
+ *  - 그 외에는 아래 main() 이 corpus 파일 또는 난수/변형 입력으로 같은 함수를 호출
+ *
+ *  입력 첫 바이트는 ESB payload 크기(1~64), 나머지는 수신 바이트 스트림
+ */
+#include "rf_replay.h"
+#include "hw.h"
+#include "my_key_protocol.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#define FUZZ_INPUT_MAX          4096
+
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+  static bool is_init = false;
+  static uint64_t time_us = 0;
+  uint32_t chunk;
+  uint32_t used;
+  int32_t x;
+  int32_t y;
+
+  if (!is_init)
+  {
+    replayPortInit(256);
+    key_protocol_init();
+    is_init = true;
+  }
+  if (size < 1 || size > FUZZ_INPUT_MAX)
+  {
+    return 0;
+  }
+  chunk = data[0] % 64 + 1;
+  data++;
+  size--;
+
+  // 스트림 API 는 is_last 이면 모든 바이트를 소비해야 한다
+  used = key_protocol_rx_process(data, size, true);
+  if (used != size)
+  {
+    fprintf(stderr, "rx_process used %u of %u\n", used, (uint32_t)size);
+    abort();
+  }
+
+  // 실제 경로 : ISR 이 chunk 단위로 RX 버퍼에 쓰고 main 루프가 몇 개씩 모아 처리
+  for (size_t offset=0; offset<size; offset+=chunk)
+  {
+    uint32_t length = size - offset < chunk ? size - offset : chunk;
+
+    replayRxPush(&data[offset], length);
+    if ((offset / chunk) % 4 == 3)
+    {
+      time_us += 1000;
+      replayTimeSet(time_us);
+      key_protocol_update();
+    }
+  }
+  key_protocol_update();
+
+  if (rfAvailable() != 0)
+  {
+    fprintf(stderr, "rx buffer not drained (%u)\n", rfAvailable());
+    abort();
+  }
+  RfMotionRead(&x, &y);
+
+  return 0;
+}
+
+
+#ifndef RF_FUZZ_LIBFUZZER
+
+static uint32_t rand_state = 1;
+
+static uint32_t randNext(void)
+{
+  rand_state ^= rand_state << 13;
+  rand_state ^= rand_state >> 17;
+  rand_state ^= rand_state << 5;
+  return rand_state;
+}
+
+// 정상 프레임을 이어 붙인 뒤 일부 바이트를 바꾸거나 자르거나 끼워 넣는다
+static size_t genInput(uint8_t *p_buf)
+{
+  static const uint8_t type_tbl[] = {0x01, 0x02, 0x03, 0x04, 0x05, 0xF0, 0x7F};
+  size_t length = 1;
+  uint32_t frames = randNext() % 16;
+  uint32_t mutate;
+
+  p_buf[0] = (uint8_t)randNext();
+
+  if (randNext() % 8 == 0)
+  {
+    // 완전 난수
+    length += randNext() % 256;
+    for (size_t i=1; i<length; i++)
+    {
+      p_buf[i] = (uint8_t)randNext();
+    }
+    return length;
+  }
+
+  for (uint32_t f=0; f<frames; f++)
+  {
+    uint8_t payload_len = randNext() % 4 == 0 ? randNext() % 40 : randNext() % 14;
+    uint8_t checksum = 0;
+    uint8_t *p = &p_buf[length];
+
+    if (length + 6 + payload_len > FUZZ_INPUT_MAX)
+    {
+      break;
+    }
+    p[0] = 0xAA;
+    p[1] = randNext() % 4;
+    p[2] = 0x01;
+    p[3] = type_tbl[randNext() % sizeof(type_tbl)];
+    p[4] = payload_len;
+    for (uint32_t i=0; i<payload_len; i++)
+    {
+      p[5 + i] = randNext() % 3 == 0 ? 0xAA : (uint8_t)randNext();
+    }
+    if (p[3] == 0x01 && payload_len > 0)
+    {
+      p[5] = randNext() % (payload_len + 2);
+    }
+    for (uint32_t i=0; i<5u + payload_len; i++)
+    {
+      checksum ^= p[i];
+    }
+    p[5 + payload_len] = checksum;
+    length += 6 + payload_len;
+  }
+
+  mutate = randNext() % 4;
+  for (uint32_t i=0; i<mutate && length > 1; i++)
+  {
+    size_t pos = 1 + randNext() % (length - 1);
+
+    switch (randNext() % 3)
+    {
+      case 0:
+        p_buf[pos] ^= 1 << (randNext() % 8);
+        break;
+      case 1:
+        length = pos;
+        break;
+      default:
+        if (length < FUZZ_INPUT_MAX)
+        {
+          memmove(&p_buf[pos + 1], &p_buf[pos], length - pos);
+          p_buf[pos] = randNext() % 2 ? 0xAA : (uint8_t)randNext();
+          length++;
+        }
+        break;
+    }
+  }
+  return length;
+}
+
+static bool runFile(const char *path)
+{
+  static uint8_t buf[FUZZ_INPUT_MAX];
+  FILE *fp = fopen(path, "rb");
+  size_t length;
+
+  if (fp == NULL)
+  {
+    fprintf(stderr, "can't open %s\n", path);
+    return false;
+  }
+  length = fread(buf, 1, sizeof(buf), fp);
+  fclose(fp);
+
+  LLVMFuzzerTestOneInput(buf, length);
+  return true;
+}
+
+int main(int argc, char *argv[])
+{
+  static uint8_t buf[FUZZ_INPUT_MAX];
+  key_protocol_rx_stats_t stats;
+  uint32_t iter = 1000000;
+  int arg = 1;
+
+  // rf_fuzz [-runs=n] [-seed=n] [corpus files ..] (libFuzzer 와 같은 옵션 형식)
+  for (; arg < argc && argv[arg][0] == '-'; arg++)
+  {
+    if (strncmp(argv[arg], "-runs=", 6) == 0)
+    {
+      iter = strtoul(&argv[arg][6], NULL, 0);
+    }
+    else if (strncmp(argv[arg], "-seed=", 6) == 0)
+    {
+      rand_state = strtoul(&argv[arg][6], NULL, 0);
+      if (rand_state == 0)
+      {
+        rand_state = 1;
+      }
+    }
+    else
+    {
+      printf("usage : %s [-runs=n] [-seed=n] [corpus files ..]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  if (arg < argc)
+  {
+    for (; arg < argc; arg++)
+    {
+      if (!runFile(argv[arg]))
+      {
+        return 2;
+      }
+    }
+  }
+  else
+  {
+    for (uint32_t i=0; i<iter; i++)
+    {
+      size_t length = genInput(buf);
+
+      LLVMFuzzerTestOneInput(buf, length);
+    }
+  }
+
+  key_protocol_get_rx_stats(&stats);
+  printf("done : frames %u, drop bytes %u, start %u, length %u, truncated %u, checksum %u, type %u, payload %u, device %u\n",
+         stats.frames, stats.drop_bytes,
+         stats.errors[KEY_PROTOCOL_RX_ERR_START],
+         stats.errors[KEY_PROTOCOL_RX_ERR_LENGTH],
+         stats.errors[KEY_PROTOCOL_RX_ERR_TRUNCATED],
+         stats.errors[KEY_PROTOCOL_RX_ERR_CHECKSUM],
+         stats.errors[KEY_PROTOCOL_RX_ERR_TYPE],
+         stats.errors[KEY_PROTOCOL_RX_ERR_PAYLOAD],
+         stats.errors[KEY_PROTOCOL_RX_ERR_DEVICE]);
+  return 0;
+}
+
+#endif
@@ -0,0 +1,730 @@
+/*
+ * rf_replay.c
+ *
+ *  하프 RF 프레임 재생기
+ *
+ *  - 캡처 로그(keyproto capture, dongle_sim --rf-log) 또는 생성한 트래픽을
+ *    도착 시간에 맞춰 RX 버퍼에 넣고 key_protocol_update() 로 디코딩한다.
+ *  - 손실/중복/순서 바꿈/비트 오류/지터를 seed 로 재현 가능하게 넣을 수 있다.
+ *  - 디코딩된 키/움직임 스트림, 프레임당 디코딩 시간, 에러 종류별 개수를 출력한다.
+ */
+#include "rf_replay.h"
+#include "hw.h"
+#include "my_key_protocol.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+#include <getopt.h>
+
+
+#define REPLAY_FRAME_MAX        64      // 로그 한 줄의 최대 바이트
+#define REPLAY_LINE_MAX         512
+#define REPLAY_HB_PERIOD_US     (500*1000)
+#define REPLAY_BENCH_FRAMES     (4*1000*1000)
+
+
+typedef struct
+{
+  uint64_t time_us;
+  uint8_t  length;
+  uint8_t  data[REPLAY_FRAME_MAX];
+} frame_t;
+
+typedef struct
+{
+  frame_t  *p_buf;
+  uint32_t  count;
+  uint32_t  size;
+} frame_list_t;
+
+typedef struct
+{
+  uint64_t *p_buf;
+  uint32_t  count;
+  uint32_t  size;
+} sample_t;
+
+typedef struct
+{
+  const char *in_path;
+  const char *out_path;
+  const char *save_path;
+  uint32_t    gen_count;
+  uint32_t    seed;
+  double      loss;
+  double      dup;
+  double      reorder;
+  double      corrupt;
+  uint32_t    jitter_us;
+  uint32_t    poll_us;
+  uint32_t    rx_buf;
+  uint32_t    repeat;
+  bool        is_check;
+} replay_opt_t;
+
+typedef struct
+{
+  uint8_t  matrix[MATRIX_COLS];
+  int64_t  motion_x;
+  int64_t  motion_y;
+} replay_state_t;
+
+
+static replay_opt_t   opt;
+static uint32_t       rand_state;
+static frame_list_t   src;
+static frame_list_t   dst;
+static sample_t       decode_ns;
+static replay_state_t expect;
+static replay_state_t result;
+static uint32_t       cnt_lost;
+static uint32_t       cnt_dup;
+static uint32_t       cnt_reorder;
+static uint32_t       cnt_corrupt;
+static uint32_t       cnt_key;
+static uint32_t       cnt_motion;
+static FILE          *out_fp = NULL;
+
+
+static uint32_t randNext(void)
+{
+  // xorshift32 : 같은 seed 면 같은 손상 패턴
+  rand_state ^= rand_state << 13;
+  rand_state ^= rand_state >> 17;
+  rand_state ^= rand_state << 5;
+  return rand_state;
+}
+
+static bool randHit(double percent)
+{
+  return percent > 0 && (randNext() % 1000000) < (uint32_t)(percent * 10000);
+}
+
+static uint64_t nowNs(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void sampleAdd(sample_t *p_sample, uint64_t value)
+{
+  if (p_sample->count >= p_sample->size)
+  {
+    p_sample->size  = p_sample->size == 0 ? 1024 : p_sample->size * 2;
+    p_sample->p_buf = realloc(p_sample->p_buf, p_sample->size * sizeof(uint64_t));
+  }
+  p_sample->p_buf[p_sample->count++] = value;
+}
+
+static int sampleCompare(const void *a, const void *b)
+{
+  uint64_t v_a = *(const uint64_t *)a;
+  uint64_t v_b = *(const uint64_t *)b;
+
+  return v_a < v_b ? -1 : v_a > v_b ? 1 : 0;
+}
+
+static uint64_t samplePercentile(sample_t *p_sample, uint32_t percent)
+{
+  if (p_sample->count == 0)
+  {
+    return 0;
+  }
+  return p_sample->p_buf[((uint64_t)(p_sample->count - 1) * percent + 50) / 100];
+}
+
+static frame_t *frameAdd(frame_list_t *p_list)
+{
+  if (p_list->count >= p_list->size)
+  {
+    p_list->size  = p_list->size == 0 ? 1024 : p_list->size * 2;
+    p_list->p_buf = realloc(p_list->p_buf, p_list->size * sizeof(frame_t));
+  }
+  memset(&p_list->p_buf[p_list->count], 0, sizeof(frame_t));
+  return &p_list->p_buf[p_list->count++];
+}
+
+static int frameCompare(const void *a, const void *b)
+{
+  const frame_t *f_a = (const frame_t *)a;
+  const frame_t *f_b = (const frame_t *)b;
+
+  return f_a->time_us < f_b->time_us ? -1 : f_a->time_us > f_b->time_us ? 1 : 0;
+}
+
+static void frameBuild(frame_t *p_frame, uint64_t time_us, uint8_t dev, uint8_t type,
+                       const uint8_t *p_payload, uint8_t length)
+{
+  uint8_t checksum = 0;
+
+  p_frame->time_us = time_us;
+  p_frame->data[0] = 0xAA;
+  p_frame->data[1] = dev;
+  p_frame->data[2] = 0x01;
+  p_frame->data[3] = type;
+  p_frame->data[4] = length;
+  memcpy(&p_frame->data[5], p_payload, length);
+  for (uint32_t i=0; i<5u + length; i++)
+  {
+    checksum ^= p_frame->data[i];
+  }
+  p_frame->data[5 + length] = checksum;
+  p_frame->length = 6 + length;
+}
+
+
+//-- 입력
+//
+static bool loadLog(const char *path)
+{
+  FILE *fp = fopen(path, "r");
+  char line[REPLAY_LINE_MAX];
+  uint64_t time_us = 0;
+  uint32_t line_no = 0;
+
+  if (fp == NULL)
+  {
+    fprintf(stderr, "can't open %s\n", path);
+    return false;
+  }
+
+  while (fgets(line, sizeof(line), fp) != NULL)
+  {
+    frame_t frame;
+    char *tok;
+    char *end;
+    bool is_rel;
+    bool is_valid = true;
+    uint64_t t;
+
+    line_no++;
+
+    // 첫 토큰이 시간이 아닌 줄(CLI 프롬프트, 로그 등)은 무시
+    tok = strtok(line, " \t\r\n");
+    if (tok == NULL)
+    {
+      continue;
+    }
+    is_rel = tok[0] == '+';
+    if (!isdigit((unsigned char)tok[is_rel ? 1 : 0]))
+    {
+      continue;
+    }
+    t = strtoull(is_rel ? &tok[1] : tok, &end, 10);
+    if (*end != 0)
+    {
+      continue;
+    }
+
+    memset(&frame, 0, sizeof(frame));
+    while ((tok = strtok(NULL, " \t\r\n")) != NULL)
+    {
+      unsigned long value = strtoul(tok, &end, 16);
+
+      if (*end != 0 || strlen(tok) > 2 || frame.length >= REPLAY_FRAME_MAX)
+      {
+        is_valid = false;
+        break;
+      }
+      frame.data[frame.length++] = (uint8_t)value;
+    }
+    if (!is_valid || frame.length == 0)
+    {
+      fprintf(stderr, "%s:%u : skip\n", path, line_no);
+      continue;
+    }
+
+    time_us = is_rel ? time_us + t : t;
+    frame.time_us = time_us;
+    *frameAdd(&src) = frame;
+  }
+  fclose(fp);
+
+  // 캡처 로그는 시간 순이지만 직접 만든 로그도 받을 수 있도록 정렬 (같은 시간은 순서 유지가 안 되므로 주의)
+  for (uint32_t i=1; i<src.count; i++)
+  {
+    if (src.p_buf[i].time_us < src.p_buf[i-1].time_us)
+    {
+      qsort(src.p_buf, src.count, sizeof(frame_t), frameCompare);
+      break;
+    }
+  }
+  return true;
+}
+
+static void genTraffic(uint32_t count)
+{
+  uint8_t matrix[2][MATRIX_COLS];
+  uint64_t last_hb[2] = {0, 0};
+  uint64_t time_us = 0;
+  uint32_t i = 0;
+
+  memset(matrix, 0, sizeof(matrix));
+
+  while (i < count)
+  {
+    uint32_t side = randNext() % 2;
+    uint8_t  dev  = side == 0 ? DEVICE_ID_LEFT : DEVICE_ID_RIGHT;
+    uint8_t  cols = side == 0 ? LEFT_COLS : RIGHT_COLS;
+    uint32_t kind = randNext() % 100;
+    uint8_t  payload[MATRIX_COLS + 5];
+
+    time_us += 100 + randNext() % 1900;
+
+    // 하프와 같이 500ms 마다 heartbeat
+    if (time_us - last_hb[side] >= REPLAY_HB_PERIOD_US)
+    {
+      payload[0] = 0;
+      payload[1] = 80 + side;
+      frameBuild(frameAdd(&src), time_us, dev, 0x05, payload, 2);
+      last_hb[side] = time_us;
+      i++;
+      continue;
+    }
+
+    if (kind < 70)
+    {
+      uint32_t col = randNext() % cols;
+
+      matrix[side][col] ^= 1 << (randNext() % MATRIX_ROWS);
+      payload[0] = cols;
+      memcpy(&payload[1], matrix[side], cols);
+      // 스캔 시간 (하프 micros, 여기서는 전송 시간과 같게 둔다)
+      payload[cols + 1] = (uint8_t)(time_us >> 0);
+      payload[cols + 2] = (uint8_t)(time_us >> 8);
+      payload[cols + 3] = (uint8_t)(time_us >> 16);
+      payload[cols + 4] = (uint8_t)(time_us >> 24);
+      frameBuild(frameAdd(&src), time_us, dev, 0x01, payload, cols + 5);
+    }
+    else
+    {
+      int16_t dx = (int16_t)(randNext() % 61) - 30;
+      int16_t dy = (int16_t)(randNext() % 61) - 30;
+
+      payload[0] = (uint8_t)dx;
+      payload[1] = (uint8_t)((uint16_t)dx >> 8);
+      payload[2] = (uint8_t)dy;
+      payload[3] = (uint8_t)((uint16_t)dy >> 8);
+      frameBuild(frameAdd(&src), time_us, dev, 0x02, payload, 4);
+    }
+    i++;
+  }
+}
+
+// 손상 없이 전달됐을 때의 최종 매트릭스와 움직임 합
+static void buildExpect(void)
+{
+  memset(&expect, 0, sizeof(expect));
+
+  for (uint32_t i=0; i<src.count; i++)
+  {
+    const uint8_t *p = src.p_buf[i].data;
+    const uint8_t *payload = &p[5];
+
+    if (src.p_buf[i].length < 6 || p[0] != 0xAA || p[4] + 6u != src.p_buf[i].length)
+    {
+      continue;
+    }
+    if (p[3] == 0x01 && p[4] >= 1 && payload[0] <= p[4] - 1)
+    {
+      uint8_t cols = payload[0];
+
+      if (p[1] == DEVICE_ID_LEFT)
+      {
+        memcpy(&expect.matrix[0], &payload[1], cols < LEFT_COLS ? cols : LEFT_COLS);
+      }
+      else if (p[1] == DEVICE_ID_RIGHT)
+      {
+        memcpy(&expect.matrix[LEFT_COLS], &payload[1], cols < RIGHT_COLS ? cols : RIGHT_COLS);
+      }
+    }
+    else if (p[3] == 0x02 && p[4] >= 4 && (p[1] == DEVICE_ID_LEFT || p[1] == DEVICE_ID_RIGHT))
+    {
+      expect.motion_x += (int16_t)((payload[1] << 8) | payload[0]);
+      expect.motion_y += (int16_t)((payload[3] << 8) | payload[2]);
+    }
+  }
+}
+
+// 무선 구간의 손상 : 손실, 재전송에 의한 중복, 순서 바꿈, 비트 오류, 도착 지터
+static void applyImpairment(void)
+{
+  for (uint32_t i=0; i<src.count; i++)
+  {
+    frame_t *p_frame;
+
+    if (randHit(opt.loss))
+    {
+      cnt_lost++;
+      continue;
+    }
+
+    p_frame  = frameAdd(&dst);
+    *p_frame = src.p_buf[i];
+    if (opt.jitter_us > 0)
+    {
+      p_frame->time_us += randNext() % (opt.jitter_us + 1);
+    }
+    if (randHit(opt.corrupt))
+    {
+      p_frame->data[randNext() % p_frame->length] ^= 1 << (randNext() % 8);
+      cnt_corrupt++;
+    }
+    if (randHit(opt.dup))
+    {
+      frame_t *p_dup = frameAdd(&dst);
+
+      p_frame  = &dst.p_buf[dst.count - 2];
+      *p_dup   = *p_frame;
+      p_dup->time_us += 250;     // ACK 유실 후 재전송 간격
+      cnt_dup++;
+    }
+  }
+
+  qsort(dst.p_buf, dst.count, sizeof(frame_t), frameCompare);
+
+  for (uint32_t i=0; i+1<dst.count; i++)
+  {
+    if (randHit(opt.reorder))
+    {
+      frame_t tmp = dst.p_buf[i];
+      uint64_t t_a = dst.p_buf[i].time_us;
+      uint64_t t_b = dst.p_buf[i+1].time_us;
+
+      dst.p_buf[i] = dst.p_buf[i+1];
+      dst.p_buf[i+1] = tmp;
+      dst.p_buf[i].time_us   = t_a;
+      dst.p_buf[i+1].time_us = t_b;
+      cnt_reorder++;
+      i++;
+    }
+  }
+}
+
+static bool saveLog(const char *path)
+{
+  FILE *fp = fopen(path, "w");
+
+  if (fp == NULL)
+  {
+    fprintf(stderr, "can't open %s\n", path);
+    return false;
+  }
+  for (uint32_t i=0; i<dst.count; i++)
+  {
+    fprintf(fp, "%llu", (unsigned long long)dst.p_buf[i].time_us);
+    for (uint32_t j=0; j<dst.p_buf[i].length; j++)
+    {
+      fprintf(fp, " %02X", dst.p_buf[i].data[j]);
+    }
+    fprintf(fp, "\n");
+  }
+  fclose(fp);
+  return true;
+}
+
+
+//-- 재생
+//
+static void readOutput(uint64_t time_us)
+{
+  uint8_t matrix[MATRIX_COLS];
+  int32_t x;
+  int32_t y;
+
+  RfKeysReadBuf(matrix, MATRIX_COLS);
+  if (memcmp(matrix, result.matrix, MATRIX_COLS) != 0)
+  {
+    memcpy(result.matrix, matrix, MATRIX_COLS);
+    cnt_key++;
+    if (out_fp != NULL)
+    {
+      fprintf(out_fp, "%llu key ", (unsigned long long)time_us);
+      for (uint32_t i=0; i<MATRIX_COLS; i++)
+      {
+        fprintf(out_fp, "%02X", matrix[i]);
+      }
+      fprintf(out_fp, "\n");
+    }
+  }
+
+  if (RfMotionRead(&x, &y))
+  {
+    result.motion_x += x;
+    result.motion_y += y;
+    cnt_motion++;
+    if (out_fp != NULL)
+    {
+      fprintf(out_fp, "%llu motion %d %d\n", (unsigned long long)time_us, x, y);
+    }
+  }
+}
+
+// 펌웨어 main 루프와 같이 poll 주기마다 key_protocol_update() 호출
+// 그 사이 도착한 프레임은 ESB ISR 처럼 RX 버퍼에 이어 붙인다
+static void runReplay(void)
+{
+  uint32_t index = 0;
+  uint64_t time_us;
+
+  if (dst.count == 0)
+  {
+    return;
+  }
+  time_us = (dst.p_buf[0].time_us / opt.poll_us + 1) * opt.poll_us;
+
+  while (index < dst.count)
+  {
+    uint32_t pushed = 0;
+    uint64_t pre_ns;
+    uint64_t post_ns;
+
+    while (index < dst.count && dst.p_buf[index].time_us <= time_us)
+    {
+      replayRxPush(dst.p_buf[index].data, dst.p_buf[index].length);
+      index++;
+      pushed++;
+    }
+
+    replayTimeSet(time_us);
+    pre_ns = nowNs();
+    key_protocol_update();
+    post_ns = nowNs();
+
+    if (pushed > 0)
+    {
+      sampleAdd(&decode_ns, (post_ns - pre_ns) / pushed);
+    }
+    readOutput(time_us);
+
+    // 프레임이 없는 구간은 건너뜀 (heartbeat timeout 은 다음 호출에서 판정)
+    time_us += opt.poll_us;
+    if (index < dst.count && dst.p_buf[index].time_us > time_us)
+    {
+      time_us = (dst.p_buf[index].time_us / opt.poll_us + 1) * opt.poll_us;
+    }
+  }
+}
+
+// 전달된 프레임을 한 버퍼에 이어 붙여 key_protocol_rx_process() 처리량 측정
+static double runBench(uint32_t *p_frames)
+{
+  uint8_t *p_stream;
+  uint32_t length = 0;
+  uint32_t repeat = opt.repeat;
+  uint64_t pre_ns;
+  uint64_t post_ns;
+
+  *p_frames = 0;
+  if (dst.count == 0)
+  {
+    return 0;
+  }
+
+  p_stream = malloc(dst.count * REPLAY_FRAME_MAX);
+  for (uint32_t i=0; i<dst.count; i++)
+  {
+    memcpy(&p_stream[length], dst.p_buf[i].data, dst.p_buf[i].length);
+    length += dst.p_buf[i].length;
+  }
+  if (repeat == 0)
+  {
+    repeat = REPLAY_BENCH_FRAMES / dst.count + 1;
+  }
+
+  pre_ns = nowNs();
+  for (uint32_t i=0; i<repeat; i++)
+  {
+    key_protocol_rx_process(p_stream, length, true);
+    RfMotionRead(&(int32_t){0}, &(int32_t){0});
+  }
+  post_ns = nowNs();
+  free(p_stream);
+
+  *p_frames = dst.count * repeat;
+  return (double)(post_ns - pre_ns) / 1e9;
+}
+
+
+//-- 리포트
+//
+static bool printReport(void)
+{
+  static const char *err_name[KEY_PROTOCOL_RX_MAX] =
+    {"ok", "start", "length", "truncated", "checksum", "type", "payload", "device"};
+  key_protocol_rx_stats_t stats;
+  bool is_matrix_ok;
+  bool is_motion_ok;
+  uint32_t bench_frames;
+  double bench_sec;
+
+  key_protocol_get_rx_stats(&stats);
+
+  printf("== rf replay : %u frames, %.3f s ==\n", src.count,
+         src.count > 0 ? (double)src.p_buf[src.count - 1].time_us / 1e6 : 0.0);
+  printf("input          : delivered %u, lost %u, dup %u, reorder %u, corrupt %u, rx overflow %u\n",
+         dst.count, cnt_lost, cnt_dup, cnt_reorder, cnt_corrupt, replayRxOverflow());
+  printf("decode         : frames %u, drop bytes %u\n", stats.frames, stats.drop_bytes);
+  printf("errors         :");
+  for (uint32_t i=1; i<KEY_PROTOCOL_RX_MAX; i++)
+  {
+    printf(" %s %u%s", err_name[i], stats.errors[i], i + 1 < KEY_PROTOCOL_RX_MAX ? "," : "\n");
+  }
+  printf("output         : key changes %u, motion reads %u\n", cnt_key, cnt_motion);
+
+  if (decode_ns.count > 0)
+  {
+    qsort(decode_ns.p_buf, decode_ns.count, sizeof(uint64_t), sampleCompare);
+  }
+  printf("decode ns/frame: n %u, min %llu, median %llu, p99 %llu, max %llu\n",
+         decode_ns.count,
+         (unsigned long long)samplePercentile(&decode_ns, 0),
+         (unsigned long long)samplePercentile(&decode_ns, 50),
+         (unsigned long long)samplePercentile(&decode_ns, 99),
+         (unsigned long long)samplePercentile(&decode_ns, 100));
+
+  is_matrix_ok = memcmp(expect.matrix, result.matrix, MATRIX_COLS) == 0;
+  is_motion_ok = expect.motion_x == result.motion_x && expect.motion_y == result.motion_y;
+  printf("check          : matrix %s, motion x %lld/%lld y %lld/%lld %s\n",
+         is_matrix_ok ? "ok" : "MISMATCH",
+         (long long)result.motion_x, (long long)expect.motion_x,
+         (long long)result.motion_y, (long long)expect.motion_y,
+         is_motion_ok ? "ok" : "MISMATCH");
+
+  // 처리량은 상태를 바꾸므로 마지막에 측정
+  bench_sec = runBench(&bench_frames);
+  if (bench_sec > 0)
+  {
+    printf("throughput     : %.2f M frames/s (%u frames, %.1f ns/frame)\n",
+           bench_frames / bench_sec / 1e6, bench_frames, bench_sec * 1e9 / bench_frames);
+  }
+
+  return is_matrix_ok && is_motion_ok;
+}
+
+static void printUsage(const char *name)
+{
+  printf("usage : %s [options] [capture.log]\n", name);
+  printf("  --gen n          capture.log 대신 n 프레임 생성 (key 70%%, motion 30%%, heartbeat 500ms)\n");
+  printf("  --seed n         생성/손상 난수 seed (기본 1)\n");
+  printf("  --loss pct       프레임 손실\n");
+  printf("  --dup pct        프레임 중복 (250us 뒤 재전송)\n");
+  printf("  --reorder pct    이웃 프레임과 순서 바꿈\n");
+  printf("  --corrupt pct    1비트 오류\n");
+  printf("  --jitter us      도착 시간 지터 (0~us)\n");
+  printf("  --poll us        key_protocol_update() 호출 주기 (기본 1000)\n");
+  printf("  --rx-buf n       RF RX 버퍼 크기 (기본 256, RF_RX_BUF_LENGTH)\n");
+  printf("  --repeat n       처리량 측정 반복 횟수 (기본 약 %u 프레임)\n", REPLAY_BENCH_FRAMES);
+  printf("  --out file       디코딩된 키/움직임 스트림 (- 는 stdout)\n");
+  printf("  --save file      손상 적용 후 프레임을 로그 형식으로 저장\n");
+  printf("  --check          최종 매트릭스/움직임 합이 원본과 다르면 종료 코드 1\n");
+}
+
+int main(int argc, char *argv[])
+{
+  static const struct option long_opt[] =
+  {
+    {"gen",     required_argument, NULL, 'g'},
+    {"seed",    required_argument, NULL, 's'},
+    {"loss",    required_argument, NULL, 'l'},
+    {"dup",     required_argument, NULL, 'd'},
+    {"reorder", required_argument, NULL, 'r'},
+    {"corrupt", required_argument, NULL, 'c'},
+    {"jitter",  required_argument, NULL, 'j'},
+    {"poll",    required_argument, NULL, 'p'},
+    {"rx-buf",  required_argument, NULL, 'b'},
+    {"repeat",  required_argument, NULL, 'n'},
+    {"out",     required_argument, NULL, 'o'},
+    {"save",    required_argument, NULL, 'S'},
+    {"check",   no_argument,       NULL, 'C'},
+    {"help",    no_argument,       NULL, 'h'},
+    {NULL, 0, NULL, 0},
+  };
+  bool is_ok;
+  int c;
+
+  memset(&opt, 0, sizeof(opt));
+  opt.seed    = 1;
+  opt.poll_us = 1000;
+  opt.rx_buf  = 256;
+
+  while ((c = getopt_long(argc, argv, "g:s:l:d:r:c:j:p:b:n:o:S:Ch", long_opt, NULL)) != -1)
+  {
+    switch (c)
+    {
+      case 'g': opt.gen_count = strtoul(optarg, NULL, 0); break;
+      case 's': opt.seed      = strtoul(optarg, NULL, 0); break;
+      case 'l': opt.loss      = atof(optarg);             break;
+      case 'd': opt.dup       = atof(optarg);             break;
+      case 'r': opt.reorder   = atof(optarg);             break;
+      case 'c': opt.corrupt   = atof(optarg);             break;
+      case 'j': opt.jitter_us = strtoul(optarg, NULL, 0); break;
+      case 'p': opt.poll_us   = strtoul(optarg, NULL, 0); break;
+      case 'b': opt.rx_buf    = strtoul(optarg, NULL, 0); break;
+      case 'n': opt.repeat    = strtoul(optarg, NULL, 0); break;
+      case 'o': opt.out_path  = optarg;                   break;
+      case 'S': opt.save_path = optarg;                   break;
+      case 'C': opt.is_check  = true;                     break;
+      default:
+        printUsage(argv[0]);
+        return c == 'h' ? 0 : 2;
+    }
+  }
+  if (optind < argc)
+  {
+    opt.in_path = argv[optind];
+  }
+  if ((opt.in_path == NULL) == (opt.gen_count == 0) || opt.poll_us == 0 ||
+      opt.rx_buf < 2 || opt.rx_buf > RF_REPLAY_RX_BUF_MAX)
+  {
+    printUsage(argv[0]);
+    return 2;
+  }
+  rand_state = opt.seed != 0 ? opt.seed : 1;
+
+  if (opt.in_path != NULL)
+  {
+    if (!loadLog(opt.in_path))
+    {
+      return 2;
+    }
+  }
+  else
+  {
+    genTraffic(opt.gen_count);
+  }
+  buildExpect();
+  applyImpairment();
+
+  if (opt.save_path != NULL && !saveLog(opt.save_path))
+  {
+    return 2;
+  }
+  if (opt.out_path != NULL)
+  {
+    out_fp = strcmp(opt.out_path, "-") == 0 ? stdout : fopen(opt.out_path, "w");
+    if (out_fp == NULL)
+    {
+      fprintf(stderr, "can't open %s\n", opt.out_path);
+      return 2;
+    }
+  }
+
+  replayPortInit(opt.rx_buf);
+  key_protocol_init();
+  runReplay();
+
+  if (out_fp != NULL && out_fp != stdout)
+  {
+    fclose(out_fp);
+  }
+
+  is_ok = printReport();
+
+  return (opt.is_check && !is_ok) ? 1 : 0;
+}
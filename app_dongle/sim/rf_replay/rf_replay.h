@@ -0,0 +1,29 @@
+/*
+ * rf_replay.h
+ *
+ *  my_key_protocol 단독 실행용 포트 (rf_replay, rf_fuzz 공용)
+ *
+ *  - rfAvailable()/rfRead() 는 myrf.c 의 qbuffer 와 같이 동작하는 바이트 버퍼를 사용
+ *  - millis()/micros() 는 replayTimeSet() 으로 정한 시간을 반환
+ */
+#ifndef RF_REPLAY_H_
+#define RF_REPLAY_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+
+#define RF_REPLAY_RX_BUF_MAX    4096
+
+
+void     replayPortInit(uint32_t rx_buf_size);
+void     replayTimeSet(uint64_t time_us);
+
+/**
+ * @brief ESB 수신 ISR 흉내 : payload 를 RX 버퍼 뒤에 붙인다
+ * @return 버퍼가 모자라 일부만 쓴 경우 false (myrf.c 의 qbufferWrite() 와 동일하게 들어간 만큼은 남음)
+ */
+bool     replayRxPush(const uint8_t *p_data, uint32_t length);
+uint32_t replayRxOverflow(void);
+
+#endif
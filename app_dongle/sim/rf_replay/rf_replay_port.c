@@ -0,0 +1,173 @@
+/*
+ * rf_replay_port.c
+ *
+ *  my_key_protocol.c 가 사용하는 hw/kernel API 를 단일 스레드로 대체
+ */
+#include "rf_replay.h"
+#include "hw.h"
+
+#include <string.h>
+
+
+static uint8_t  rx_buf[RF_REPLAY_RX_BUF_MAX];
+static uint32_t rx_buf_size  = 256;
+static uint32_t rx_len       = 0;
+static uint32_t rx_overflow  = 0;
+static uint64_t time_us      = 0;
+static uint32_t rx_time      = 0;
+static uint32_t rx_count     = 0;
+
+
+void replayPortInit(uint32_t size)
+{
+  // qbuffer 는 1바이트를 비워 두므로 실제로 담을 수 있는 크기는 size - 1
+  rx_buf_size = size - 1;
+  if (rx_buf_size > RF_REPLAY_RX_BUF_MAX)
+  {
+    rx_buf_size = RF_REPLAY_RX_BUF_MAX;
+  }
+  rx_len      = 0;
+  rx_overflow = 0;
+  time_us     = 0;
+  rx_time     = 0;
+  rx_count    = 0;
+}
+
+void replayTimeSet(uint64_t t_us)
+{
+  time_us = t_us;
+}
+
+bool replayRxPush(const uint8_t *p_data, uint32_t length)
+{
+  uint32_t space = rx_buf_size - rx_len;
+  bool ret = true;
+
+  if (length > space)
+  {
+    length = space;
+    rx_overflow++;
+    ret = false;
+  }
+  memcpy(&rx_buf[rx_len], p_data, length);
+  rx_len += length;
+  rx_time = (uint32_t)time_us;
+  rx_count++;
+
+  return ret;
+}
+
+uint32_t replayRxOverflow(void)
+{
+  return rx_overflow;
+}
+
+
+//-- myrf.h
+//
+bool rfInit(void)
+{
+  return true;
+}
+
+uint32_t rfAvailable(void)
+{
+  return rx_len;
+}
+
+uint32_t rfGetRxTime(uint32_t *p_count)
+{
+  *p_count = rx_count;
+  return rx_time;
+}
+
+uint32_t rfRead(uint8_t *p_data, uint32_t length)
+{
+  if (length > rx_len)
+  {
+    return false;
+  }
+  memcpy(p_data, rx_buf, length);
+  memmove(rx_buf, &rx_buf[length], rx_len - length);
+  rx_len -= length;
+  return true;
+}
+
+bool rfBufferFlush(void)
+{
+  rx_len = 0;
+  return true;
+}
+
+uint32_t rfWrite(uint8_t *p_data, uint32_t length)
+{
+  (void)p_data;
+  return length;
+}
+
+bool rfSetAckPayload(uint8_t *p_data, uint32_t length)
+{
+  (void)p_data;
+  (void)length;
+  return true;
+}
+
+
+//-- bsp.h
+//
+uint32_t millis(void)
+{
+  return (uint32_t)(time_us / 1000);
+}
+
+uint32_t micros(void)
+{
+  return (uint32_t)time_us;
+}
+
+
+//-- cli.h
+//
+bool cliAdd(const char *cmd_str, void (*p_func)(cli_args_t *))
+{
+  (void)cmd_str;
+  (void)p_func;
+  return true;
+}
+
+void cliPrintf(const char *fmt, ...)
+{
+  (void)fmt;
+}
+
+
+//-- evtlog.h
+//
+void evtlogWrite(uint16_t id, uint16_t a0, uint32_t a1)
+{
+  (void)id;
+  (void)a0;
+  (void)a1;
+}
+
+
+//-- kernel.h
+//
+int k_mutex_init(struct k_mutex *mutex)
+{
+  (void)mutex;
+  return 0;
+}
+
+int k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
+{
+  (void)mutex;
+  (void)timeout;
+  return 0;
+}
+
+int k_mutex_unlock(struct k_mutex *mutex)
+{
+  (void)mutex;
+  return 0;
+}
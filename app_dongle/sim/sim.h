@@ -0,0 +1,122 @@
+/*
+ * sim.h
+ *
+ *  동글 펌웨어 호스트 시뮬레이션 공용 정의
+ *
+ *  - 무선(ESB), USB 호스트, LCD 패널을 흉내내는 가짜 하드웨어와
+ *    시나리오 실행/통계 수집 API
+ */
+#ifndef SIM_H_
+#define SIM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "sim_kernel.h"
+#include <zephyr/logging/log.h>
+
+
+#define SIM_LCD_WIDTH           240
+#define SIM_LCD_HEIGHT          240
+#define SIM_HID_DATA_MAX        64      // HID 리포트 최대 길이 (엔드포인트 크기)
+
+
+typedef enum
+{
+  SIM_HID_KEYBOARD,
+  SIM_HID_MOUSE,
+  SIM_HID_VIA,
+  SIM_HID_MAX,
+} sim_hid_t;
+
+typedef struct
+{
+  // RF (ESB PRX)
+  uint32_t rf_injected;
+  uint32_t rf_received;           // RX FIFO 에 들어간 프레임
+  uint32_t rf_drop_rx_off;        // 수신 off (듀티 사이클) 중에 보낸 프레임
+  uint32_t rf_drop_fifo_full;
+  uint32_t rf_ack_payload;        // ACK 에 실려 하프로 간 페이로드
+
+  // USB
+  uint32_t usb_sof;
+  uint32_t hid_report[SIM_HID_MAX];
+  uint32_t hid_busy;              // 이전 리포트가 아직 호스트로 가지 않아 실패
+  uint32_t hid_not_ready;         // 미연결/suspend 중 전송 시도
+  uint32_t usb_wakeup;
+
+  // LCD
+  uint32_t lcd_cmd;
+  uint32_t lcd_ramwr;
+  uint64_t lcd_pixels;
+  uint32_t lcd_te;                // TE 펄스 수
+  uint32_t lcd_tear;              // 스캔이 쓰는 위치를 지나간 픽셀 전송
+  uint64_t spi_bytes;
+  uint64_t spi_busy_us;
+
+  // Flash
+  uint32_t flash_erase_pages;
+  uint64_t flash_write_bytes;
+} sim_stats_t;
+
+typedef enum
+{
+  SIM_INPUT_KEY,
+  SIM_INPUT_MOTION,
+  SIM_INPUT_WAKEUP,               // suspend 중 키 -> remote wakeup 요청
+  SIM_INPUT_MAX,
+} sim_input_t;
+
+typedef void (*sim_hid_hook_t)(sim_hid_t type, const uint8_t *p_data, uint32_t length);
+
+
+extern int sim_log_level;
+
+
+//-- sim_zephyr.c
+void simZephyrInit(sim_stats_t *stats);
+int  simGpioGet(uint8_t pin);
+void simGpioSetInput(uint8_t pin, int value);
+
+//-- sim_esb.c
+void simEsbInit(sim_stats_t *stats);
+bool simEsbInject(uint8_t pipe, const uint8_t *p_data, uint8_t length);
+uint8_t simEsbGetAck(uint8_t *p_data);
+bool simEsbIsRxOn(void);
+void simEsbSetLog(FILE *fp);
+
+//-- sim_usb.c
+void simUsbInit(sim_stats_t *stats, sim_hid_hook_t hook);
+void simUsbConnect(bool connect);
+void simUsbSuspend(bool suspend);
+bool simUsbIsConfigured(void);
+bool simUsbIsWakeupWait(void);
+bool simUsbViaWrite(const uint8_t *p_data, uint32_t length);
+void simUsbCdcInput(const char *p_str);
+void simUsbCdcEcho(bool enable);
+
+//-- sim_panel.c (spi.h + ST7789 패널 모델)
+void simPanelInit(sim_stats_t *stats);
+bool simPanelSavePpm(const char *path);
+
+//-- sim_main.c
+void simMarkInput(sim_input_t type);
+void simMarkWakeup(void);
+void simExpectHid(uint32_t line, sim_hid_t type, const uint8_t *p_data, uint32_t length, int64_t window_us);
+
+//-- sim_scenario.c
+bool    simScenarioLoad(const char *path);
+void    simScenarioStart(void);
+int64_t simScenarioGetEndUs(void);
+void    simScenarioPrintTimeSync(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
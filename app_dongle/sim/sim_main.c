@@ -0,0 +1,630 @@
+/*
+ * sim_main.c
+ *
+ *  동글 펌웨어 호스트 시뮬레이션 실행기
+ *
+ *  - 펌웨어의 main() 은 app_main() 으로 이름을 바꿔 "main" 스레드에서 실행한다.
+ *  - 시나리오 파일의 이벤트를 가상 시간에 맞춰 주입하고, 종료 후 통계를 출력한다.
+ *  - 지연/드롭 기준을 넘거나, HID 리포트가 기대값(--expect-hid 골든 로그, 시나리오 expect)과 다르거나,
+ *    HID 엔드포인트 busy 로 리포트 전송이 실패하면 종료 코드 1 을 반환한다. (ctest 회귀 검사)
+ */
+#include "sim.h"
+#include "hw.h"
+
+#include <stdlib.h>
+#include <getopt.h>
+
+
+#define SIM_MAIN_PRIORITY       0
+#define SIM_MAIN_STACK_SIZE     8192
+#define SIM_MARK_MAX            256
+#define SIM_MARK_TIMEOUT_US     (100*1000)   // 이 시간 안에 리포트가 없으면 "no report"
+#define SIM_SAMPLE_INIT         1024
+#define SIM_EXPECT_MAX          256
+#define SIM_HID_LINE_MAX        160
+
+
+typedef struct
+{
+  uint64_t *p_buf;
+  uint32_t  count;
+  uint32_t  size;
+} sample_t;
+
+typedef struct
+{
+  int64_t   time_us[SIM_MARK_MAX];
+  uint32_t  in;
+  uint32_t  out;
+  sample_t  latency;
+  uint32_t  no_report;
+} mark_t;
+
+typedef struct
+{
+  uint32_t  line;               // 시나리오 줄 번호
+  sim_hid_t type;
+  uint8_t   data[SIM_HID_DATA_MAX];
+  uint32_t  length;
+  int64_t   deadline_us;
+  bool      is_done;
+} expect_t;
+
+typedef struct
+{
+  const char *scenario;
+  const char *hid_log;
+  const char *expect_hid;
+  const char *rf_log;
+  const char *fb_path;
+  int64_t     duration_ms;
+  bool        is_quiet;
+  int64_t     max_latency_us;
+  int64_t     max_drop;
+  int64_t     max_cpu_us;
+  int64_t     max_wakeup_us;
+} sim_opt_t;
+
+
+extern int app_main(void);
+
+static sim_stats_t     stats;
+static sim_opt_t       opt;
+static mark_t          marks[SIM_INPUT_MAX];
+static sample_t        slice_ns[SIM_THREAD_MAX];
+static struct k_thread *slice_thread[SIM_THREAD_MAX];
+static FILE           *hid_log_fp = NULL;
+static FILE           *rf_log_fp  = NULL;
+static const char     *hid_iface_name[SIM_HID_MAX] = {"keyboard", "mouse", "via"};
+static FILE           *expect_fp  = NULL;
+static uint32_t        expect_line = 1;         // 골든 로그의 헤더 다음 줄부터 비교
+static uint32_t        expect_fail = 0;
+static expect_t        expect_list[SIM_EXPECT_MAX];
+static uint32_t        expect_cnt = 0;
+static int64_t         boot_ready_us = -1;
+static struct sim_timer ready_timer;
+
+static struct k_thread main_thread;
+static K_THREAD_STACK_DEFINE(main_stack, SIM_MAIN_STACK_SIZE);
+
+
+static void sampleAdd(sample_t *p_sample, uint64_t value)
+{
+  if (p_sample->count >= p_sample->size)
+  {
+    p_sample->size  = p_sample->size == 0 ? SIM_SAMPLE_INIT : p_sample->size * 2;
+    p_sample->p_buf = realloc(p_sample->p_buf, p_sample->size * sizeof(uint64_t));
+  }
+  p_sample->p_buf[p_sample->count++] = value;
+}
+
+static int sampleCompare(const void *a, const void *b)
+{
+  uint64_t v_a = *(const uint64_t *)a;
+  uint64_t v_b = *(const uint64_t *)b;
+
+  return v_a < v_b ? -1 : v_a > v_b ? 1 : 0;
+}
+
+static uint64_t samplePercentile(sample_t *p_sample, uint32_t percent)
+{
+  uint32_t index;
+
+  if (p_sample->count == 0)
+  {
+    return 0;
+  }
+  index = (uint32_t)(((uint64_t)(p_sample->count - 1) * percent + 50) / 100);
+  return p_sample->p_buf[index];
+}
+
+static void sampleSort(sample_t *p_sample)
+{
+  if (p_sample->count > 0)
+  {
+    qsort(p_sample->p_buf, p_sample->count, sizeof(uint64_t), sampleCompare);
+  }
+}
+
+static void markExpire(mark_t *p_mark, int64_t now_us)
+{
+  while (p_mark->out != p_mark->in &&
+         now_us - p_mark->time_us[p_mark->out % SIM_MARK_MAX] > SIM_MARK_TIMEOUT_US)
+  {
+    p_mark->no_report++;
+    p_mark->out++;
+  }
+}
+
+static void markResolve(mark_t *p_mark, int64_t now_us)
+{
+  markExpire(p_mark, now_us);
+
+  while (p_mark->out != p_mark->in)
+  {
+    sampleAdd(&p_mark->latency, now_us - p_mark->time_us[p_mark->out % SIM_MARK_MAX]);
+    p_mark->out++;
+  }
+}
+
+void simMarkInput(sim_input_t type)
+{
+  mark_t *p_mark = &marks[type];
+
+  markExpire(p_mark, simTimeUs());
+  if (p_mark->in - p_mark->out >= SIM_MARK_MAX)
+  {
+    p_mark->no_report++;
+    p_mark->out++;
+  }
+  p_mark->time_us[p_mark->in % SIM_MARK_MAX] = simTimeUs();
+  p_mark->in++;
+}
+
+void simMarkWakeup(void)
+{
+  markResolve(&marks[SIM_INPUT_WAKEUP], simTimeUs());
+}
+
+void simExpectHid(uint32_t line, sim_hid_t type, const uint8_t *p_data, uint32_t length, int64_t window_us)
+{
+  expect_t *p_expect;
+
+  if (expect_cnt >= SIM_EXPECT_MAX || length > SIM_HID_DATA_MAX)
+  {
+    printf("FAIL : scenario:%u expect not registered\n", line);
+    expect_fail++;
+    return;
+  }
+  p_expect = &expect_list[expect_cnt++];
+  p_expect->line        = line;
+  p_expect->type        = type;
+  p_expect->length      = length;
+  p_expect->deadline_us = simTimeUs() + window_us;
+  p_expect->is_done     = false;
+  memcpy(p_expect->data, p_data, length);
+}
+
+static void expectCheck(sim_hid_t type, const uint8_t *p_data, uint32_t length)
+{
+  for (uint32_t i=0; i<expect_cnt; i++)
+  {
+    expect_t *p_expect = &expect_list[i];
+
+    if (p_expect->is_done == false &&
+        p_expect->type == type &&
+        p_expect->length == length &&
+        simTimeUs() <= p_expect->deadline_us &&
+        memcmp(p_expect->data, p_data, length) == 0)
+    {
+      p_expect->is_done = true;
+      break;
+    }
+  }
+}
+
+// 골든 로그와 한 줄씩 비교, 처음 다른 줄만 출력
+static void expectGolden(const char *p_line)
+{
+  char golden[SIM_HID_LINE_MAX];
+
+  if (expect_fp == NULL)
+  {
+    return;
+  }
+  expect_line++;
+  if (fgets(golden, sizeof(golden), expect_fp) == NULL)
+  {
+    if (expect_fail == 0)
+    {
+      printf("FAIL : hid log line %u : unexpected '%s'\n", expect_line, p_line);
+    }
+    expect_fail++;
+    return;
+  }
+  golden[strcspn(golden, "\r\n")] = 0;
+
+  if (strcmp(golden, p_line) != 0)
+  {
+    if (expect_fail == 0)
+    {
+      printf("FAIL : hid log line %u : expected '%s', got '%s'\n", expect_line, golden, p_line);
+    }
+    expect_fail++;
+  }
+}
+
+static void hidHook(sim_hid_t type, const uint8_t *p_data, uint32_t length)
+{
+  char line[SIM_HID_LINE_MAX];
+  int  index;
+
+  // 키 입력은 키보드/마우스(버튼) 리포트 어느 쪽으로도 나갈 수 있다
+  if (type == SIM_HID_KEYBOARD || type == SIM_HID_MOUSE)
+  {
+    markResolve(&marks[SIM_INPUT_KEY], simTimeUs());
+  }
+  if (type == SIM_HID_MOUSE)
+  {
+    markResolve(&marks[SIM_INPUT_MOTION], simTimeUs());
+  }
+
+  index = snprintf(line, sizeof(line), "%lld,%s,", (long long)simTimeUs(), hid_iface_name[type]);
+  for (uint32_t i=0; i<length && index + 3 < (int)sizeof(line); i++)
+  {
+    index += snprintf(&line[index], sizeof(line) - index, "%02X", p_data[i]);
+  }
+
+  if (hid_log_fp != NULL)
+  {
+    fprintf(hid_log_fp, "%s\n", line);
+  }
+  expectGolden(line);
+  expectCheck(type, p_data, length);
+}
+
+static void sliceHook(struct k_thread *thread, uint64_t cpu_ns)
+{
+  for (int i=0; i<SIM_THREAD_MAX; i++)
+  {
+    if (slice_thread[i] == NULL)
+    {
+      slice_thread[i] = thread;
+    }
+    if (slice_thread[i] == thread)
+    {
+      sampleAdd(&slice_ns[i], cpu_ns);
+      break;
+    }
+  }
+}
+
+static void readyTimerFunc(void *arg)
+{
+  ARG_UNUSED(arg);
+
+  if ((hwGetReady() & HW_BOOT_READY_MASK) == HW_BOOT_READY_MASK)
+  {
+    boot_ready_us = simTimeUs();
+    simTimerStop(&ready_timer);
+  }
+}
+
+static void mainThread(void *p1, void *p2, void *p3)
+{
+  ARG_UNUSED(p1);
+  ARG_UNUSED(p2);
+  ARG_UNUSED(p3);
+
+  app_main();
+}
+
+static void printLatency(const char *name, mark_t *p_mark)
+{
+  sample_t *p_sample = &p_mark->latency;
+
+  markExpire(p_mark, SIM_TIME_FOREVER);
+  sampleSort(p_sample);
+  printf("%-14s : n %u, min %llu, median %llu, p99 %llu, max %llu us, no report %u\n",
+         name,
+         p_sample->count,
+         (unsigned long long)samplePercentile(p_sample, 0),
+         (unsigned long long)samplePercentile(p_sample, 50),
+         (unsigned long long)samplePercentile(p_sample, 99),
+         (unsigned long long)samplePercentile(p_sample, 100),
+         p_mark->no_report);
+}
+
+static void printReport(int64_t end_us)
+{
+  struct k_thread *thread_list[SIM_THREAD_MAX];
+  uint32_t thread_cnt;
+
+  printf("\n");
+  printf("== sim report : %lld.%03lld ms ==\n", (long long)(end_us / 1000), (long long)(end_us % 1000));
+  if (boot_ready_us >= 0)
+    printf("boot ready     : %lld.%03lld ms\n", (long long)(boot_ready_us / 1000), (long long)(boot_ready_us % 1000));
+  else
+    printf("boot ready     : not ready (0x%02X)\n", hwGetReady());
+
+  printf("rf             : injected %u, received %u, drop rx-off %u, drop fifo-full %u, ack payload %u\n",
+         stats.rf_injected, stats.rf_received, stats.rf_drop_rx_off, stats.rf_drop_fifo_full, stats.rf_ack_payload);
+  printf("hid            : keyboard %u, mouse %u, via %u, busy %u, not ready %u\n",
+         stats.hid_report[SIM_HID_KEYBOARD], stats.hid_report[SIM_HID_MOUSE], stats.hid_report[SIM_HID_VIA],
+         stats.hid_busy, stats.hid_not_ready);
+  printf("usb            : sof %u, remote wakeup %u\n", stats.usb_sof, stats.usb_wakeup);
+  printLatency("latency key", &marks[SIM_INPUT_KEY]);
+  printLatency("latency motion", &marks[SIM_INPUT_MOTION]);
+  if (marks[SIM_INPUT_WAKEUP].in > 0)
+    printLatency("latency wakeup", &marks[SIM_INPUT_WAKEUP]);
+  simScenarioPrintTimeSync();
+  printf("lcd            : cmd %u, ramwr %u, pixels %llu, te %u, tear %u\n",
+         stats.lcd_cmd, stats.lcd_ramwr, (unsigned long long)stats.lcd_pixels, stats.lcd_te, stats.lcd_tear);
+  printf("spi            : %llu bytes, busy %llu us (%.1f%%)\n",
+         (unsigned long long)stats.spi_bytes, (unsigned long long)stats.spi_busy_us,
+         end_us > 0 ? (double)stats.spi_busy_us * 100.0 / (double)end_us : 0.0);
+  printf("flash          : erase %u pages, write %llu bytes\n",
+         stats.flash_erase_pages, (unsigned long long)stats.flash_write_bytes);
+
+  // 호스트 CPU 시간이므로 절대값보다 변경 전/후 비교에 사용
+  printf("cpu (host ns)  : %-24s %4s %8s %10s %10s %10s\n", "thread", "prio", "runs", "median", "p99", "total_us");
+  thread_cnt = simKernelGetThreads(thread_list, SIM_THREAD_MAX);
+  for (uint32_t i=0; i<thread_cnt; i++)
+  {
+    sample_t *p_sample = NULL;
+    uint64_t total_ns = 0;
+
+    for (int j=0; j<SIM_THREAD_MAX; j++)
+    {
+      if (slice_thread[j] == thread_list[i])
+      {
+        p_sample = &slice_ns[j];
+        break;
+      }
+    }
+    if (p_sample == NULL)
+    {
+      continue;
+    }
+    for (uint32_t j=0; j<p_sample->count; j++)
+    {
+      total_ns += p_sample->p_buf[j];
+    }
+    sampleSort(p_sample);
+    printf("                 %-24s %4d %8u %10llu %10llu %10llu\n",
+           thread_list[i]->name, thread_list[i]->prio, p_sample->count,
+           (unsigned long long)samplePercentile(p_sample, 50),
+           (unsigned long long)samplePercentile(p_sample, 99),
+           (unsigned long long)(total_ns / 1000));
+  }
+  printf("                 %-24s %4s %8s %10s %10s %10llu\n", "isr", "-", "-", "-", "-",
+         (unsigned long long)(simKernelGetIsrNs() / 1000));
+}
+
+static int checkThreshold(void)
+{
+  int ret = 0;
+  uint32_t drop = stats.rf_drop_rx_off + stats.rf_drop_fifo_full;
+
+  if (opt.max_latency_us >= 0)
+  {
+    uint64_t p99 = samplePercentile(&marks[SIM_INPUT_KEY].latency, 99);
+
+    if (p99 > (uint64_t)opt.max_latency_us || marks[SIM_INPUT_KEY].latency.count == 0)
+    {
+      printf("FAIL : key latency p99 %llu us > %lld us\n", (unsigned long long)p99, (long long)opt.max_latency_us);
+      ret = 1;
+    }
+  }
+  if (opt.max_wakeup_us >= 0)
+  {
+    mark_t  *p_mark = &marks[SIM_INPUT_WAKEUP];
+    uint64_t max = samplePercentile(&p_mark->latency, 100);
+
+    if (max > (uint64_t)opt.max_wakeup_us || p_mark->latency.count == 0 || p_mark->no_report > 0)
+    {
+      printf("FAIL : key to wakeup max %llu us > %lld us (no wakeup %u)\n",
+             (unsigned long long)max, (long long)opt.max_wakeup_us, p_mark->no_report);
+      ret = 1;
+    }
+  }
+  if (stats.hid_busy > 0)
+  {
+    printf("FAIL : hid busy %u\n", stats.hid_busy);
+    ret = 1;
+  }
+  if (expect_fp != NULL)
+  {
+    char golden[SIM_HID_LINE_MAX];
+
+    // 골든 로그에 남은 리포트 (나가지 않은 리포트)
+    while (fgets(golden, sizeof(golden), expect_fp) != NULL)
+    {
+      golden[strcspn(golden, "\r\n")] = 0;
+      expect_line++;
+      if (expect_fail == 0)
+      {
+        printf("FAIL : hid log line %u : expected '%s', got none\n", expect_line, golden);
+      }
+      expect_fail++;
+    }
+  }
+  for (uint32_t i=0; i<expect_cnt; i++)
+  {
+    expect_t *p_expect = &expect_list[i];
+
+    if (p_expect->is_done == false)
+    {
+      printf("FAIL : scenario:%u expect %s ", p_expect->line, hid_iface_name[p_expect->type]);
+      for (uint32_t j=0; j<p_expect->length; j++)
+      {
+        printf("%02X", p_expect->data[j]);
+      }
+      printf(" not seen\n");
+      expect_fail++;
+    }
+  }
+  if (expect_fail > 0)
+  {
+    printf("FAIL : hid expect %u mismatch\n", expect_fail);
+    ret = 1;
+  }
+  if (opt.max_drop >= 0 && drop > opt.max_drop)
+  {
+    printf("FAIL : rf drop %u > %lld\n", drop, (long long)opt.max_drop);
+    ret = 1;
+  }
+  if (opt.max_cpu_us >= 0)
+  {
+    for (int i=0; i<SIM_THREAD_MAX; i++)
+    {
+      if (slice_thread[i] == &main_thread)
+      {
+        uint64_t p99 = samplePercentile(&slice_ns[i], 99);
+
+        if (p99 > (uint64_t)opt.max_cpu_us * 1000)
+        {
+          printf("FAIL : main loop cpu p99 %llu ns > %lld us\n", (unsigned long long)p99, (long long)opt.max_cpu_us);
+          ret = 1;
+        }
+        break;
+      }
+    }
+  }
+
+  return ret;
+}
+
+static void printUsage(const char *name)
+{
+  printf("usage : %s [options] scenario.txt\n", name);
+  printf("  --duration ms        시뮬레이션 시간 (기본: 시나리오 end)\n");
+  printf("  --hid-log file.csv   호스트로 나간 HID 리포트 기록 (time_us,iface,data)\n");
+  printf("  --expect-hid file.csv HID 리포트를 골든 로그(--hid-log 형식)와 비교\n");
+  printf("  --rf-log file.log    하프가 보낸 RF 프레임 기록 (rf_replay 입력 형식)\n");
+  printf("  --fb file.ppm        종료 시 화면 덤프\n");
+  printf("  --log-level n        Zephyr LOG 레벨 (0~4, 기본 2)\n");
+  printf("  --quiet              CDC(CLI/log) 출력 끄기\n");
+  printf("  --max-latency-us n   키 지연 p99 기준\n");
+  printf("  --max-drop n         RF 드롭 기준\n");
+  printf("  --max-cpu-us n       main 루프 1회 CPU p99 기준\n");
+  printf("  --max-wakeup-us n    suspend 중 키 -> remote wakeup 요청 최대 지연 기준\n");
+}
+
+int main(int argc, char *argv[])
+{
+  static const struct option long_opt[] =
+  {
+    {"duration",       required_argument, NULL, 'd'},
+    {"hid-log",        required_argument, NULL, 'H'},
+    {"expect-hid",     required_argument, NULL, 'E'},
+    {"rf-log",         required_argument, NULL, 'R'},
+    {"fb",             required_argument, NULL, 'f'},
+    {"log-level",      required_argument, NULL, 'l'},
+    {"quiet",          no_argument,       NULL, 'q'},
+    {"max-latency-us", required_argument, NULL, 'L'},
+    {"max-drop",       required_argument, NULL, 'D'},
+    {"max-cpu-us",     required_argument, NULL, 'C'},
+    {"max-wakeup-us",  required_argument, NULL, 'W'},
+    {"help",           no_argument,       NULL, 'h'},
+    {NULL, 0, NULL, 0},
+  };
+  int64_t end_us;
+  int c;
+  int ret;
+
+  memset(&opt, 0, sizeof(opt));
+  opt.duration_ms    = -1;
+  opt.max_latency_us = -1;
+  opt.max_drop       = -1;
+  opt.max_cpu_us     = -1;
+  opt.max_wakeup_us  = -1;
+
+  while ((c = getopt_long(argc, argv, "d:H:E:R:f:l:qL:D:C:W:h", long_opt, NULL)) != -1)
+  {
+    switch (c)
+    {
+      case 'd': opt.duration_ms    = atoll(optarg); break;
+      case 'H': opt.hid_log        = optarg;        break;
+      case 'E': opt.expect_hid     = optarg;        break;
+      case 'R': opt.rf_log         = optarg;        break;
+      case 'f': opt.fb_path        = optarg;        break;
+      case 'l': sim_log_level      = atoi(optarg);  break;
+      case 'q': opt.is_quiet       = true;          break;
+      case 'L': opt.max_latency_us = atoll(optarg); break;
+      case 'D': opt.max_drop       = atoll(optarg); break;
+      case 'C': opt.max_cpu_us     = atoll(optarg); break;
+      case 'W': opt.max_wakeup_us  = atoll(optarg); break;
+      default:
+        printUsage(argv[0]);
+        return c == 'h' ? 0 : 2;
+    }
+  }
+  if (optind >= argc)
+  {
+    printUsage(argv[0]);
+    return 2;
+  }
+  opt.scenario = argv[optind];
+
+  // CLI 출력과 리포트가 파이프에서도 순서대로 보이도록
+  setvbuf(stdout, NULL, _IOLBF, 0);
+
+  if (opt.hid_log != NULL)
+  {
+    hid_log_fp = fopen(opt.hid_log, "w");
+    if (hid_log_fp == NULL)
+    {
+      fprintf(stderr, "can't open %s\n", opt.hid_log);
+      return 2;
+    }
+    fprintf(hid_log_fp, "time_us,iface,data\n");
+  }
+  if (opt.expect_hid != NULL)
+  {
+    char header[SIM_HID_LINE_MAX];
+
+    expect_fp = fopen(opt.expect_hid, "r");
+    if (expect_fp == NULL || fgets(header, sizeof(header), expect_fp) == NULL)
+    {
+      fprintf(stderr, "can't read %s\n", opt.expect_hid);
+      return 2;
+    }
+  }
+  if (opt.rf_log != NULL)
+  {
+    rf_log_fp = fopen(opt.rf_log, "w");
+    if (rf_log_fp == NULL)
+    {
+      fprintf(stderr, "can't open %s\n", opt.rf_log);
+      return 2;
+    }
+  }
+
+  simKernelInit();
+  simZephyrInit(&stats);
+  simEsbInit(&stats);
+  simEsbSetLog(rf_log_fp);
+  simUsbInit(&stats, hidHook);
+  simUsbCdcEcho(!opt.is_quiet);
+  simPanelInit(&stats);
+  simKernelSetSliceHook(sliceHook);
+
+  if (!simScenarioLoad(opt.scenario))
+  {
+    return 2;
+  }
+
+  k_thread_create(&main_thread, main_stack, K_THREAD_STACK_SIZEOF(main_stack),
+                  mainThread, NULL, NULL, NULL,
+                  SIM_MAIN_PRIORITY, 0, K_NO_WAIT);
+  k_thread_name_set(&main_thread, "main");
+
+  simScenarioStart();
+  simTimerStart(&ready_timer, 1000, 1000, readyTimerFunc, NULL);
+
+  end_us = opt.duration_ms >= 0 ? opt.duration_ms * 1000 : simScenarioGetEndUs();
+  simKernelRun(end_us);
+
+  if (opt.fb_path != NULL && !simPanelSavePpm(opt.fb_path))
+  {
+    fprintf(stderr, "can't write %s\n", opt.fb_path);
+  }
+  if (hid_log_fp != NULL)
+  {
+    fclose(hid_log_fp);
+  }
+  if (rf_log_fp != NULL)
+  {
+    fclose(rf_log_fp);
+  }
+
+  printReport(end_us);
+
+  ret = checkThreshold();
+  if (expect_fp != NULL)
+  {
+    fclose(expect_fp);
+  }
+  return ret;
+}
@@ -0,0 +1,741 @@
+/*
+ * sim_scenario.c
+ *
+ *  시나리오 파일 실행
+ *
+ *  한 줄에 이벤트 하나, '#' 이후는 주석
+ *
+ *    <time> <command> [args...]
+ *
+ *    time : 부팅(t=0) 기준 절대 ms, 또는 "+ms" (앞 이벤트 기준 상대 시간). 소수점 허용
+ *
+ *    key     L|R <c0> .. <c5>    KEY 프레임 (컬럼별 row 비트, hex), 하프 시계로 스캔 시간을 붙인다
+ *    press   L|R <row> <col>     매트릭스 상태 변경 후 KEY 프레임 전송
+ *    release L|R <row> <col>
+ *    tap     L|R <row> <col> [hold_ms]
+ *    motion  L|R <dx> <dy>       TRACKBALL 프레임
+ *    hb      L|R [battery]       HEARTBEAT 프레임 (seq, 전송 시간, 왕복 시간 포함)
+ *    lag     L|R <ms>            이후 KEY/HEARTBEAT 프레임의 하프 시간을 ms 만큼 앞당김 (RF 재전송 지연 흉내)
+ *    clock   L|R <ppm>           하프 시계를 동글보다 ppm 만큼 빠르게(+)/느리게(-)
+ *    raw     <hex bytes..>       임의의 ESB 페이로드 (pipe 0)
+ *    usb     connect|disconnect|suspend|resume
+ *    cli     <text>              CDC 로 명령 입력 (개행 추가)
+ *    via     <hex bytes..>       VIA raw HID OUT 리포트
+ *    fb      <file.ppm>          화면 덤프
+ *    expect  keyboard|mouse|via <hex> [ms]
+ *                                이 시간부터 ms(기본 50) 안에 같은 HID 리포트가 호스트로 나가야 함
+ *                                (hex 는 --hid-log 의 data 와 같은 형식, 없으면 종료 코드 1)
+ *    end                         시뮬레이션 종료 시간
+ *
+ *    호스트 suspend 중(ACK 페이로드의 전원 상태) 수신 off 로 KEY 프레임이 실패하면
+ *    하프와 같이 HALF_RETRANSMIT_US 간격으로 HALF_SUSPEND_RETRANSMIT 번 다시 보낸다.
+ */
+#include "sim.h"
+#include <esb.h>
+#include <stdlib.h>
+#include <ctype.h>
+
+
+#define SCENARIO_EVENT_MAX      4096
+#define SCENARIO_ARG_MAX        64
+#define SCENARIO_TEXT_MAX       128
+#define SCENARIO_TAP_HOLD_MS    30
+#define SCENARIO_EXPECT_MS      50
+
+#define FRAME_HEADER            0xAA
+#define FRAME_VERSION           0x01
+#define FRAME_TYPE_KEY          0x01
+#define FRAME_TYPE_TRACKBALL    0x02
+#define FRAME_TYPE_HEARTBEAT    0x05
+#define FRAME_TYPE_POWER_STATE  0xF0
+#define FRAME_TYPE_TIME_SYNC    0xF1
+#define FRAME_DEV_LEFT          0x01
+#define FRAME_DEV_RIGHT         0x02
+
+#define HALF_COLS               6
+#define HALF_ROWS               4
+#define HALF_AIR_US             150     // 하프 -> 동글 전송, ACK 가 돌아오는 데 걸리는 시간 (편도)
+#define HALF_SYNC_HISTORY       4
+#define HALF_RETRANSMIT_US      600     // 하프 ESB retransmit_delay
+#define HALF_SUSPEND_RETRANSMIT 15      // 호스트 suspend 중 하프 ESB 재전송 횟수 (app_keyboard ap_power.c)
+
+
+typedef enum
+{
+  EVT_KEY,
+  EVT_PRESS,
+  EVT_RELEASE,
+  EVT_MOTION,
+  EVT_HEARTBEAT,
+  EVT_LAG,
+  EVT_CLOCK,
+  EVT_RAW,
+  EVT_USB,
+  EVT_CLI,
+  EVT_VIA,
+  EVT_FB,
+  EVT_EXPECT,
+  EVT_END,
+} evt_type_t;
+
+typedef struct
+{
+  int64_t    time_us;
+  uint32_t   line;
+  evt_type_t type;
+  uint8_t    half;
+  int32_t    arg[SCENARIO_ARG_MAX];
+  uint32_t   arg_cnt;
+  char       text[SCENARIO_TEXT_MAX];
+} scenario_evt_t;
+
+
+static scenario_evt_t   *evt_list  = NULL;
+static uint32_t          evt_count = 0;
+static uint32_t          evt_index = 0;
+static int64_t           end_us    = -1;
+static struct sim_timer  evt_timer;
+static uint8_t           half_cols[2][HALF_COLS];
+static int64_t           half_lag_us[2];
+static int32_t           half_ppm[2];
+static bool              half_host_suspend[2];      // ACK 페이로드로 받은 호스트 전원 상태
+
+// 호스트 suspend 중 동글이 수신을 쉬면 하프는 같은 KEY 프레임을 ESB 재전송한다
+static struct sim_timer  half_retry_timer[2];
+static uint8_t           half_retry_payload[2][1 + HALF_COLS + 4];
+static uint32_t          half_retry_cnt[2];
+
+// 하프마다 동글과 다른 시계를 쓴다
+static const uint32_t    half_clock_us[2] = {123456789, 3000000000u};
+
+// 하프의 시간 동기 : heartbeat 의 전송/ACK 시간을 seq 별로 두고, ACK 페이로드의 동글 수신 시간과 맞춘다
+typedef struct
+{
+  uint8_t  seq;
+  uint32_t tx_time[HALF_SYNC_HISTORY];
+  uint32_t ack_time[HALF_SYNC_HISTORY];
+  bool     is_pending[HALF_SYNC_HISTORY];
+  uint32_t rtt_us;
+  uint32_t samples;
+  int64_t  offset_err_sum;
+  int32_t  offset_err_max;
+} half_sync_t;
+
+static half_sync_t       half_sync[2];
+
+
+static bool scenarioAdd(const scenario_evt_t *p_evt)
+{
+  if (evt_count >= SCENARIO_EVENT_MAX)
+  {
+    fprintf(stderr, "scenario: too many events\n");
+    return false;
+  }
+  evt_list[evt_count++] = *p_evt;
+  return true;
+}
+
+// arg[0] : 인터페이스, arg[1] : 기다리는 시간(ms), arg[2..] : "010000000D00000000" 형식 hex 의 바이트
+static bool parseExpect(scenario_evt_t *p_evt, char **p_save)
+{
+  static const char *iface_name[SIM_HID_MAX] = {"keyboard", "mouse", "via"};
+  char *tok;
+  size_t length;
+
+  tok = strtok_r(NULL, " \t", p_save);
+  if (tok == NULL)
+  {
+    return false;
+  }
+  p_evt->arg[0] = -1;
+  for (int i=0; i<SIM_HID_MAX; i++)
+  {
+    if (strcmp(tok, iface_name[i]) == 0)
+    {
+      p_evt->arg[0] = i;
+    }
+  }
+
+  tok = strtok_r(NULL, " \t", p_save);
+  if (p_evt->arg[0] < 0 || tok == NULL)
+  {
+    return false;
+  }
+  length = strlen(tok);
+  if (length == 0 || length % 2 != 0 || length / 2 > SCENARIO_ARG_MAX - 2 || length / 2 > SIM_HID_DATA_MAX)
+  {
+    return false;
+  }
+  for (size_t i=0; i<length / 2; i++)
+  {
+    char byte[3] = {tok[i*2], tok[i*2 + 1], 0};
+    char *p_end;
+
+    p_evt->arg[2 + i] = (int32_t)strtol(byte, &p_end, 16);
+    if (*p_end != 0)
+    {
+      return false;
+    }
+  }
+  p_evt->arg_cnt = 2 + length / 2;
+
+  tok = strtok_r(NULL, " \t", p_save);
+  p_evt->arg[1] = tok != NULL ? atoi(tok) : SCENARIO_EXPECT_MS;
+  return p_evt->arg[1] > 0 && strtok_r(NULL, " \t", p_save) == NULL;
+}
+
+static int scenarioCompare(const void *a, const void *b)
+{
+  const scenario_evt_t *p_a = a;
+  const scenario_evt_t *p_b = b;
+
+  if (p_a->time_us != p_b->time_us)
+  {
+    return p_a->time_us < p_b->time_us ? -1 : 1;
+  }
+  // 같은 시간이면 파일 순서
+  return (int)p_a->line - (int)p_b->line;
+}
+
+static bool parseHalf(const char *tok, uint8_t *p_half)
+{
+  if (tok == NULL)
+  {
+    return false;
+  }
+  if (toupper((unsigned char)tok[0]) == 'L')
+  {
+    *p_half = 0;
+    return true;
+  }
+  if (toupper((unsigned char)tok[0]) == 'R')
+  {
+    *p_half = 1;
+    return true;
+  }
+  return false;
+}
+
+static bool parseArgs(scenario_evt_t *p_evt, char **p_save, int base, uint32_t min_cnt)
+{
+  char *tok;
+
+  while ((tok = strtok_r(NULL, " \t", p_save)) != NULL)
+  {
+    char *p_end;
+
+    if (p_evt->arg_cnt >= SCENARIO_ARG_MAX)
+    {
+      return false;
+    }
+    p_evt->arg[p_evt->arg_cnt++] = (int32_t)strtol(tok, &p_end, base);
+    if (*p_end != 0)
+    {
+      return false;
+    }
+  }
+  return p_evt->arg_cnt >= min_cnt;
+}
+
+static bool scenarioParseLine(char *line, uint32_t line_no, int64_t *p_time_us)
+{
+  scenario_evt_t evt;
+  char *p_save = NULL;
+  char *tok;
+  char *cmd;
+  char *p_end;
+  double time_ms;
+  bool ret = true;
+
+  tok = strchr(line, '#');
+  if (tok != NULL)
+  {
+    *tok = 0;
+  }
+  line[strcspn(line, "\r\n")] = 0;
+
+  tok = strtok_r(line, " \t", &p_save);
+  if (tok == NULL)
+  {
+    return true;
+  }
+
+  time_ms = strtod(tok[0] == '+' ? &tok[1] : tok, &p_end);
+  if (*p_end != 0 || time_ms < 0)
+  {
+    fprintf(stderr, "scenario:%u: bad time '%s'\n", line_no, tok);
+    return false;
+  }
+  if (tok[0] == '+')
+  {
+    *p_time_us += (int64_t)(time_ms * 1000);
+  }
+  else
+  {
+    *p_time_us = (int64_t)(time_ms * 1000);
+  }
+
+  cmd = strtok_r(NULL, " \t", &p_save);
+  if (cmd == NULL)
+  {
+    fprintf(stderr, "scenario:%u: missing command\n", line_no);
+    return false;
+  }
+
+  memset(&evt, 0, sizeof(evt));
+  evt.time_us = *p_time_us;
+  evt.line    = line_no;
+
+  if (strcmp(cmd, "key") == 0)
+  {
+    evt.type = EVT_KEY;
+    ret = parseHalf(strtok_r(NULL, " \t", &p_save), &evt.half)
+       && parseArgs(&evt, &p_save, 16, HALF_COLS);
+  }
+  else if (strcmp(cmd, "press") == 0 || strcmp(cmd, "release") == 0 || strcmp(cmd, "tap") == 0)
+  {
+    evt.type = cmd[0] == 'r' ? EVT_RELEASE : EVT_PRESS;
+    ret = parseHalf(strtok_r(NULL, " \t", &p_save), &evt.half)
+       && parseArgs(&evt, &p_save, 10, 2)
+       && evt.arg[0] >= 0 && evt.arg[0] < HALF_ROWS
+       && evt.arg[1] >= 0 && evt.arg[1] < HALF_COLS;
+
+    if (ret && cmd[0] == 't')
+    {
+      int32_t hold_ms = evt.arg_cnt > 2 ? evt.arg[2] : SCENARIO_TAP_HOLD_MS;
+
+      ret = scenarioAdd(&evt);
+      evt.type     = EVT_RELEASE;
+      evt.time_us += (int64_t)hold_ms * 1000;
+    }
+  }
+  else if (strcmp(cmd, "motion") == 0)
+  {
+    evt.type = EVT_MOTION;
+    ret = parseHalf(strtok_r(NULL, " \t", &p_save), &evt.half)
+       && parseArgs(&evt, &p_save, 10, 2);
+  }
+  else if (strcmp(cmd, "hb") == 0)
+  {
+    evt.type = EVT_HEARTBEAT;
+    ret = parseHalf(strtok_r(NULL, " \t", &p_save), &evt.half)
+       && parseArgs(&evt, &p_save, 10, 0);
+    if (evt.arg_cnt == 0)
+    {
+      evt.arg[0] = 100;
+    }
+  }
+  else if (strcmp(cmd, "lag") == 0 || strcmp(cmd, "clock") == 0)
+  {
+    evt.type = cmd[0] == 'l' ? EVT_LAG : EVT_CLOCK;
+    ret = parseHalf(strtok_r(NULL, " \t", &p_save), &evt.half)
+       && parseArgs(&evt, &p_save, 10, 1)
+       && (evt.type == EVT_CLOCK || evt.arg[0] >= 0);
+  }
+  else if (strcmp(cmd, "raw") == 0 || strcmp(cmd, "via") == 0)
+  {
+    evt.type = cmd[0] == 'r' ? EVT_RAW : EVT_VIA;
+    ret = parseArgs(&evt, &p_save, 16, 1);
+  }
+  else if (strcmp(cmd, "usb") == 0 || strcmp(cmd, "cli") == 0 || strcmp(cmd, "fb") == 0)
+  {
+    char *p_text = strtok_r(NULL, "", &p_save);
+
+    evt.type = cmd[0] == 'u' ? EVT_USB : cmd[0] == 'c' ? EVT_CLI : EVT_FB;
+    if (p_text == NULL)
+    {
+      ret = false;
+    }
+    else
+    {
+      snprintf(evt.text, sizeof(evt.text), "%s", p_text);
+    }
+    if (ret && evt.type == EVT_USB)
+    {
+      ret = strcmp(evt.text, "connect") == 0 || strcmp(evt.text, "disconnect") == 0
+         || strcmp(evt.text, "suspend") == 0 || strcmp(evt.text, "resume") == 0;
+    }
+  }
+  else if (strcmp(cmd, "expect") == 0)
+  {
+    evt.type = EVT_EXPECT;
+    ret = parseExpect(&evt, &p_save);
+  }
+  else if (strcmp(cmd, "end") == 0)
+  {
+    evt.type = EVT_END;
+  }
+  else
+  {
+    fprintf(stderr, "scenario:%u: unknown command '%s'\n", line_no, cmd);
+    return false;
+  }
+
+  if (ret == false)
+  {
+    fprintf(stderr, "scenario:%u: bad arguments for '%s'\n", line_no, cmd);
+    return false;
+  }
+  return scenarioAdd(&evt);
+}
+
+static uint32_t halfClock(uint8_t half, int64_t time_us)
+{
+  return (uint32_t)(time_us + time_us * half_ppm[half] / 1000000) + half_clock_us[half];
+}
+
+// ACK 페이로드 [POWER_STATE][TIME_SYNC] 중 TIME_SYNC 의 자기 몫 [seq, 동글 수신 시간] 으로 offset 을 구한다
+static void halfAckProcess(uint8_t half)
+{
+  uint8_t ack[CONFIG_ESB_MAX_PAYLOAD_LENGTH];
+  uint8_t length = simEsbGetAck(ack);
+  uint8_t index = 0;
+
+  while (index + 6 <= length)
+  {
+    uint8_t frame_len = 5 + ack[index + 4] + 1;
+
+    if (ack[index] != FRAME_HEADER || index + frame_len > length)
+    {
+      break;
+    }
+    if (ack[index + 3] == FRAME_TYPE_POWER_STATE && ack[index + 4] >= 1)
+    {
+      half_host_suspend[half] = (ack[index + 5] == 0x01);
+    }
+    if (ack[index + 3] == FRAME_TYPE_TIME_SYNC && ack[index + 4] >= 10)
+    {
+      half_sync_t *p_sync = &half_sync[half];
+      const uint8_t *p = &ack[index + 5 + half * 5];
+      uint8_t  slot = p[0] % HALF_SYNC_HISTORY;
+      uint32_t rx_time = (uint32_t)p[1] | ((uint32_t)p[2] << 8) | ((uint32_t)p[3] << 16) | ((uint32_t)p[4] << 24);
+
+      if (p_sync->is_pending[slot] && (uint8_t)(p_sync->seq - p[0]) < HALF_SYNC_HISTORY)
+      {
+        uint32_t rtt = p_sync->ack_time[slot] - p_sync->tx_time[slot];
+        int32_t  offset = (int32_t)(rx_time - p_sync->tx_time[slot] - rtt / 2);
+        int32_t  offset_true = (int32_t)((uint32_t)simTimeUs() - halfClock(half, simTimeUs()));
+        int32_t  err = offset - offset_true;
+
+        p_sync->is_pending[slot] = false;
+        p_sync->rtt_us = rtt;
+        p_sync->samples++;
+        p_sync->offset_err_sum += err < 0 ? -err : err;
+        if ((err < 0 ? -err : err) > p_sync->offset_err_max)
+        {
+          p_sync->offset_err_max = err < 0 ? -err : err;
+        }
+      }
+    }
+    index += frame_len;
+  }
+}
+
+static bool sendFrame(uint8_t half, uint8_t type, const uint8_t *p_payload, uint8_t length)
+{
+  uint8_t frame[CONFIG_ESB_MAX_PAYLOAD_LENGTH];
+  uint8_t index = 0;
+  uint8_t checksum = 0;
+
+  frame[index++] = FRAME_HEADER;
+  frame[index++] = half == 0 ? FRAME_DEV_LEFT : FRAME_DEV_RIGHT;
+  frame[index++] = FRAME_VERSION;
+  frame[index++] = type;
+  frame[index++] = length;
+  memcpy(&frame[index], p_payload, length);
+  index += length;
+
+  for (int i=0; i<index; i++)
+  {
+    checksum ^= frame[i];
+  }
+  frame[index++] = checksum;
+
+  // 두 하프 모두 pipe 0 으로 보낸다 (ACK 페이로드를 같이 받음)
+  if (!simEsbInject(0, frame, index))
+  {
+    return false;
+  }
+  halfAckProcess(half);
+  return true;
+}
+
+static void halfRetryTimerFunc(void *arg)
+{
+  uint8_t half = (uint8_t)(intptr_t)arg;
+
+  if (sendFrame(half, FRAME_TYPE_KEY, half_retry_payload[half], sizeof(half_retry_payload[half])))
+  {
+    simMarkInput(SIM_INPUT_KEY);
+    return;
+  }
+  if (--half_retry_cnt[half] > 0)
+  {
+    simTimerStart(&half_retry_timer[half], HALF_RETRANSMIT_US, 0, halfRetryTimerFunc, arg);
+  }
+}
+
+static void sendKeyFrame(uint8_t half)
+{
+  uint8_t payload[1 + HALF_COLS + 4];
+  uint32_t scan_time = halfClock(half, simTimeUs() - half_lag_us[half]);
+
+  payload[0] = HALF_COLS;
+  memcpy(&payload[1], half_cols[half], HALF_COLS);
+  payload[1 + HALF_COLS + 0] = (uint8_t)(scan_time >> 0);
+  payload[1 + HALF_COLS + 1] = (uint8_t)(scan_time >> 8);
+  payload[1 + HALF_COLS + 2] = (uint8_t)(scan_time >> 16);
+  payload[1 + HALF_COLS + 3] = (uint8_t)(scan_time >> 24);
+
+  if (simUsbIsWakeupWait())
+  {
+    simMarkInput(SIM_INPUT_WAKEUP);
+  }
+
+  // 새 매트릭스 상태가 재전송 중인 이전 상태를 대신한다
+  simTimerStop(&half_retry_timer[half]);
+  if (sendFrame(half, FRAME_TYPE_KEY, payload, sizeof(payload)))
+  {
+    simMarkInput(SIM_INPUT_KEY);
+  }
+  else if (half_host_suspend[half])
+  {
+    memcpy(half_retry_payload[half], payload, sizeof(payload));
+    half_retry_cnt[half] = HALF_SUSPEND_RETRANSMIT;
+    simTimerStart(&half_retry_timer[half], HALF_RETRANSMIT_US, 0, halfRetryTimerFunc, (void *)(intptr_t)half);
+  }
+}
+
+static void scenarioExecute(const scenario_evt_t *p_evt)
+{
+  uint8_t buf[SCENARIO_ARG_MAX];
+
+  switch (p_evt->type)
+  {
+    case EVT_KEY:
+      for (int i=0; i<HALF_COLS; i++)
+      {
+        half_cols[p_evt->half][i] = (uint8_t)p_evt->arg[i];
+      }
+      sendKeyFrame(p_evt->half);
+      break;
+
+    case EVT_PRESS:
+      half_cols[p_evt->half][p_evt->arg[1]] |= (1 << p_evt->arg[0]);
+      sendKeyFrame(p_evt->half);
+      break;
+
+    case EVT_RELEASE:
+      half_cols[p_evt->half][p_evt->arg[1]] &= ~(1 << p_evt->arg[0]);
+      sendKeyFrame(p_evt->half);
+      break;
+
+    case EVT_MOTION:
+      {
+        int16_t dx = (int16_t)p_evt->arg[0];
+        int16_t dy = (int16_t)p_evt->arg[1];
+
+        buf[0] = (uint8_t)(dx >> 0);
+        buf[1] = (uint8_t)(dx >> 8);
+        buf[2] = (uint8_t)(dy >> 0);
+        buf[3] = (uint8_t)(dy >> 8);
+        if (sendFrame(p_evt->half, FRAME_TYPE_TRACKBALL, buf, 4))
+        {
+          simMarkInput(SIM_INPUT_MOTION);
+        }
+      }
+      break;
+
+    case EVT_HEARTBEAT:
+      {
+        half_sync_t *p_sync = &half_sync[p_evt->half];
+        uint8_t  slot;
+        uint32_t tx_time;
+        uint16_t rtt = p_sync->samples > 0 ? (uint16_t)p_sync->rtt_us : 0xFFFF;
+
+        // lag 만큼 재전송 후 동글에 도착, ACK 는 HALF_AIR_US 뒤에 하프에 도착
+        p_sync->seq++;
+        slot    = p_sync->seq % HALF_SYNC_HISTORY;
+        tx_time = halfClock(p_evt->half, simTimeUs() - half_lag_us[p_evt->half] - HALF_AIR_US);
+        p_sync->tx_time[slot]    = tx_time;
+        p_sync->ack_time[slot]   = halfClock(p_evt->half, simTimeUs() + HALF_AIR_US);
+        p_sync->is_pending[slot] = true;
+
+        buf[0] = 0;
+        buf[1] = (uint8_t)p_evt->arg[0];
+        buf[2] = p_sync->seq;
+        buf[3] = (uint8_t)(tx_time >> 0);
+        buf[4] = (uint8_t)(tx_time >> 8);
+        buf[5] = (uint8_t)(tx_time >> 16);
+        buf[6] = (uint8_t)(tx_time >> 24);
+        buf[7] = (uint8_t)(rtt >> 0);
+        buf[8] = (uint8_t)(rtt >> 8);
+        sendFrame(p_evt->half, FRAME_TYPE_HEARTBEAT, buf, 9);
+      }
+      break;
+
+    case EVT_LAG:
+      half_lag_us[p_evt->half] = (int64_t)p_evt->arg[0] * 1000;
+      break;
+
+    case EVT_CLOCK:
+      half_ppm[p_evt->half] = p_evt->arg[0];
+      break;
+
+    case EVT_RAW:
+      for (uint32_t i=0; i<p_evt->arg_cnt; i++)
+      {
+        buf[i] = (uint8_t)p_evt->arg[i];
+      }
+      simEsbInject(0, buf, (uint8_t)p_evt->arg_cnt);
+      break;
+
+    case EVT_VIA:
+      memset(buf, 0, 32);
+      for (uint32_t i=0; i<p_evt->arg_cnt && i<32; i++)
+      {
+        buf[i] = (uint8_t)p_evt->arg[i];
+      }
+      simUsbViaWrite(buf, 32);
+      break;
+
+    case EVT_USB:
+      if (strcmp(p_evt->text, "connect") == 0)    simUsbConnect(true);
+      if (strcmp(p_evt->text, "disconnect") == 0) simUsbConnect(false);
+      if (strcmp(p_evt->text, "suspend") == 0)    simUsbSuspend(true);
+      if (strcmp(p_evt->text, "resume") == 0)     simUsbSuspend(false);
+      break;
+
+    case EVT_CLI:
+      {
+        char line[SCENARIO_TEXT_MAX + 2];
+
+        snprintf(line, sizeof(line), "%s\r\n", p_evt->text);
+        simUsbCdcInput(line);
+      }
+      break;
+
+    case EVT_FB:
+      if (!simPanelSavePpm(p_evt->text))
+      {
+        fprintf(stderr, "scenario: can't write %s\n", p_evt->text);
+      }
+      break;
+
+    case EVT_EXPECT:
+      for (uint32_t i=2; i<p_evt->arg_cnt; i++)
+      {
+        buf[i - 2] = (uint8_t)p_evt->arg[i];
+      }
+      simExpectHid(p_evt->line, (sim_hid_t)p_evt->arg[0], buf, p_evt->arg_cnt - 2,
+                   (int64_t)p_evt->arg[1] * 1000);
+      break;
+
+    case EVT_END:
+      break;
+  }
+}
+
+static void scenarioTimerFunc(void *arg)
+{
+  ARG_UNUSED(arg);
+
+  while (evt_index < evt_count && evt_list[evt_index].time_us <= simTimeUs())
+  {
+    scenarioExecute(&evt_list[evt_index]);
+    evt_index++;
+  }
+
+  if (evt_index < evt_count)
+  {
+    simTimerStart(&evt_timer, evt_list[evt_index].time_us - simTimeUs(), 0, scenarioTimerFunc, NULL);
+  }
+}
+
+bool simScenarioLoad(const char *path)
+{
+  FILE *fp;
+  char line[512];
+  uint32_t line_no = 0;
+  int64_t time_us = 0;
+  bool ret = true;
+
+  fp = fopen(path, "r");
+  if (fp == NULL)
+  {
+    fprintf(stderr, "scenario: can't open %s\n", path);
+    return false;
+  }
+
+  if (evt_list == NULL)
+  {
+    evt_list = calloc(SCENARIO_EVENT_MAX, sizeof(scenario_evt_t));
+  }
+  evt_count = 0;
+  evt_index = 0;
+  end_us    = -1;
+  memset(half_cols, 0, sizeof(half_cols));
+
+  while (ret && fgets(line, sizeof(line), fp) != NULL)
+  {
+    line_no++;
+    ret = scenarioParseLine(line, line_no, &time_us);
+  }
+  fclose(fp);
+
+  if (ret == false)
+  {
+    return false;
+  }
+
+  qsort(evt_list, evt_count, sizeof(scenario_evt_t), scenarioCompare);
+
+  for (uint32_t i=0; i<evt_count; i++)
+  {
+    if (evt_list[i].type == EVT_END)
+    {
+      end_us = evt_list[i].time_us;
+      break;
+    }
+  }
+  if (end_us < 0)
+  {
+    end_us = (evt_count > 0 ? evt_list[evt_count - 1].time_us : 0) + 100*1000;
+  }
+
+  return true;
+}
+
+void simScenarioStart(void)
+{
+  if (evt_count > 0)
+  {
+    simTimerStart(&evt_timer, evt_list[0].time_us - simTimeUs(), 0, scenarioTimerFunc, NULL);
+  }
+}
+
+int64_t simScenarioGetEndUs(void)
+{
+  return end_us;
+}
+
+void simScenarioPrintTimeSync(void)
+{
+  if (half_sync[0].samples == 0 && half_sync[1].samples == 0)
+  {
+    return;
+  }
+  printf("timesync       :");
+  for (int i=0; i<2; i++)
+  {
+    half_sync_t *p_sync = &half_sync[i];
+
+    printf(" %s n %u, rtt %u us, offset err avg %lld max %d us%s",
+           i == 0 ? "L" : "R",
+           p_sync->samples,
+           p_sync->rtt_us,
+           p_sync->samples > 0 ? (long long)(p_sync->offset_err_sum / p_sync->samples) : 0LL,
+           p_sync->offset_err_max,
+           i == 0 ? "," : "\n");
+  }
+}
@@ -6,36 +6,86 @@
 #define CLI_THREAD_STACK_SIZE 4096
 #define CLI_THREAD_PRIORITY 5
 
+// QMK 입력 처리(RF 수신 → 리포트 전송)는 main 스레드에서 가장 높은 우선순위로 실행
+// EEPROM 쓰기, suspend 처리 등은 관리 스레드에서 낮은 우선순위로 실행
+#define QMK_THREAD_PRIORITY       0
+#define QMK_IDLE_THREAD_STACK_SIZE 2048
+#define QMK_IDLE_THREAD_PRIORITY  7
+#define QMK_IDLE_PERIOD_MS        1
+
+// RF 수신이나 SOF 가 없을 때(미연결/Suspend) QMK 루프 주기
+// 커널 tick 보다 짧으면 tick 단위로 올림되므로 prj.conf 의 CONFIG_SYS_CLOCK_TICKS_PER_SEC 와 맞춘다
+#define QMK_LOOP_PERIOD_US  1000
+
+#define THREAD_INFO_MAX     16
+
 static K_THREAD_STACK_DEFINE(cli_thread_stack, CLI_THREAD_STACK_SIZE);
+static K_THREAD_STACK_DEFINE(qmk_idle_thread_stack, QMK_IDLE_THREAD_STACK_SIZE);
 
 // 스레드 데이터 구조체
 static struct k_thread cli_thread_data;
+static struct k_thread qmk_idle_thread_data;
 
 // 스레드 ID
 static k_tid_t cli_thread_id = NULL;
+static k_tid_t qmk_idle_thread_id = NULL;
+
+// RF 수신, USB SOF 에서 QMK 입력 스레드를 깨운다
+K_SEM_DEFINE(qmk_wake_sema, 0, 1);
+
+typedef struct
+{
+  k_tid_t  tid;
+  uint64_t cycles;
+} thread_cpu_t;
+
+// 스레드별 이전 `thread info` 때의 실행 사이클 (그 사이의 CPU 사용률 계산용)
+static thread_cpu_t thread_cpu[THREAD_INFO_MAX];
 
 // 스레드 함수 프로토타입
 static void cli_thread_func(void *arg1, void *arg2, void *arg3);
+static void qmk_idle_thread_func(void *arg1, void *arg2, void *arg3);
+static void qmkWakeup(void);
+static void cliThread(cli_args_t *args);
 
 void apInit(void)
-{ 
+{
   // LVGL 스레드 생성
   apLvglStart();
-  
+
   // 스레드 생성
   cli_thread_id = k_thread_create(&cli_thread_data, cli_thread_stack,
                                   K_THREAD_STACK_SIZEOF(cli_thread_stack),
                                   cli_thread_func, NULL, NULL, NULL,
                                   CLI_THREAD_PRIORITY, 0, K_NO_WAIT);
+  k_thread_name_set(cli_thread_id, "cli");
+
+  cliAdd("thread", cliThread);
 }
 
 void apMain(void)
 {
   // uint32_t pre_time;
   uint8_t index = 0;
+  uint32_t loop_time;
+
+  k_thread_priority_set(k_current_get(), QMK_THREAD_PRIORITY);
+  k_thread_name_set(k_current_get(), "qmk");
+
   qmkInit();
-  delay(100);
+
+  qmk_idle_thread_id = k_thread_create(&qmk_idle_thread_data, qmk_idle_thread_stack,
+                                       K_THREAD_STACK_SIZEOF(qmk_idle_thread_stack),
+                                       qmk_idle_thread_func, NULL, NULL, NULL,
+                                       QMK_IDLE_THREAD_PRIORITY, 0, K_NO_WAIT);
+  k_thread_name_set(qmk_idle_thread_id, "qmk_idle");
+
+  rfSetRxCallBack(qmkWakeup);
+  usbSetSofCallBack(qmkWakeup);
+
+  hwSetReady(HW_READY_AP);
   // pre_time = millis();
+  loop_time = micros();
   while (1)
   {
     // if (millis() - pre_time >= 2000)
@@ -45,10 +95,30 @@ void apMain(void)
     //   index++;
     // }
     qmkUpdate();
-    delay(1);
+
+    // RF 패킷을 받으면 바로, 아니면 USB SOF(1ms 프레임 시작)에 맞춰 다음 처리를 시작한다.
+    // 둘 다 없으면 지난 주기 시작으로부터 QMK_LOOP_PERIOD_US 까지만 기다린다
+    // (처리 시간만큼 주기가 늘어나지 않도록 timeout 을 남은 시간으로 줄임)
+    uint32_t elapsed = micros() - loop_time;
+    uint32_t timeout = elapsed < QMK_LOOP_PERIOD_US ? QMK_LOOP_PERIOD_US - elapsed : 0;
+
+    if (k_sem_take(&qmk_wake_sema, K_USEC(timeout)) == 0 || elapsed >= 2 * QMK_LOOP_PERIOD_US)
+    {
+      loop_time = micros();
+    }
+    else
+    {
+      loop_time += QMK_LOOP_PERIOD_US;
+    }
   }
 }
 
+// ISR 에서 호출
+static void qmkWakeup(void)
+{
+  k_sem_give(&qmk_wake_sema);
+}
+
 // 스레드 함수
 static void cli_thread_func(void *arg1, void *arg2, void *arg3)
 {
@@ -58,6 +128,108 @@ static void cli_thread_func(void *arg1, void *arg2, void *arg3)
   {
     cliOpen(HW_UART_CH_CLI, 115200);
     cliMain();
-    delay(2);
+    delay(usbIsSuspended() ? 100 : 2);
+  }
+}
+
+static void qmk_idle_thread_func(void *arg1, void *arg2, void *arg3)
+{
+  ARG_UNUSED(arg1);
+  ARG_UNUSED(arg2);
+  ARG_UNUSED(arg3);
+  while (1)
+  {
+    qmkUpdateIdle();
+    delay(QMK_IDLE_PERIOD_MS);
+  }
+}
+
+typedef struct
+{
+  uint32_t count;
+  k_tid_t  tid[THREAD_INFO_MAX];
+} thread_list_t;
+
+static void threadListAdd(const struct k_thread *thread, void *user_data)
+{
+  thread_list_t *p_list = (thread_list_t *)user_data;
+
+  if (p_list->count < THREAD_INFO_MAX)
+  {
+    p_list->tid[p_list->count++] = (k_tid_t)thread;
   }
-}
\ No newline at end of file
+}
+
+static uint64_t threadGetCycles(k_tid_t tid)
+{
+#ifdef CONFIG_THREAD_RUNTIME_STATS
+  k_thread_runtime_stats_t stats;
+
+  if (k_thread_runtime_stats_get(tid, &stats) == 0)
+  {
+    return stats.execution_cycles;
+  }
+#endif
+  return 0;
+}
+
+static void cliThread(cli_args_t *args)
+{
+  bool ret = false;
+
+
+  if (args->argc == 1 && args->isStr(0, "info"))
+  {
+    thread_list_t list;
+    uint64_t cycles[THREAD_INFO_MAX];
+    uint64_t delta[THREAD_INFO_MAX];
+    uint64_t total = 0;
+
+    // 목록을 만드는 동안은 스케줄러가 잠기므로 출력은 목록을 만든 뒤에 한다
+    list.count = 0;
+    k_thread_foreach(threadListAdd, &list);
+
+    for (uint32_t i=0; i<list.count; i++)
+    {
+      cycles[i] = threadGetCycles(list.tid[i]);
+      delta[i]  = cycles[i];
+      for (int j=0; j<THREAD_INFO_MAX; j++)
+      {
+        if (thread_cpu[j].tid == list.tid[i] && cycles[i] >= thread_cpu[j].cycles)
+        {
+          delta[i] = cycles[i] - thread_cpu[j].cycles;
+          break;
+        }
+      }
+      total += delta[i];
+    }
+
+    cliPrintf("%-16s %4s %7s %13s\n", "name", "prio", "cpu", "stack used");
+    for (uint32_t i=0; i<list.count; i++)
+    {
+      const char *name = k_thread_name_get(list.tid[i]);
+      size_t unused = 0;
+      size_t size = list.tid[i]->stack_info.size;
+      uint32_t cpu_x10 = total > 0 ? (uint32_t)(delta[i] * 1000 / total) : 0;
+
+      k_thread_stack_space_get(list.tid[i], &unused);
+      cliPrintf("%-16s %4d %3d.%d %% %6d/%-6d\n",
+                name != NULL && name[0] != 0 ? name : "-",
+                k_thread_priority_get(list.tid[i]),
+                cpu_x10 / 10,
+                cpu_x10 % 10,
+                (int)(size - unused),
+                (int)size);
+
+      thread_cpu[i].tid    = list.tid[i];
+      thread_cpu[i].cycles = cycles[i];
+    }
+    cliPrintf("cpu : since the last 'thread info'\n");
+    ret = true;
+  }
+
+  if (ret == false)
+  {
+    cliPrintf("thread info\n");
+  }
+}
@@ -1,5 +1,6 @@
 #include "ap_lvgl.h"
 #include "ap_status_bar.h"
+#include "ap_qgf.h"
 #include "ap.h"
 #include "lvgl/lvgl.h"
 #include <zephyr/kernel.h>
@@ -59,7 +60,7 @@ static lv_obj_t *key_buttons[MATRIX_ROWS][MATRIX_COLS];
 static lv_timer_t *update_timer = NULL;
 
 // 레이어 상태 관리 (멀티스레드 안전)
-static struct k_mutex layer_mutex;
+static K_MUTEX_DEFINE(layer_mutex);   // LVGL 초기화 전에도 QMK 에서 사용될 수 있어 정적 초기화
 static volatile uint8_t current_layer = 0;
 static volatile uint8_t pending_layer = 0;
 static volatile bool layer_update_pending = false;
@@ -67,6 +68,11 @@ static volatile bool layer_update_pending = false;
 // Modifier 상태 관리
 static uint8_t last_mods = 0;
 
+// USB suspend 상태 (QMK 스레드에서 요청, LVGL 스레드에서 처리)
+static volatile bool is_suspend_req = false;
+static bool is_suspended = false;
+static K_SEM_DEFINE(lvgl_resume_sema, 0, 1);
+
 // 함수 프로토타입
 static void lvgl_thread_func(void *arg1, void *arg2, void *arg3);
 static void create_main_screen(void);
@@ -75,6 +81,7 @@ static void create_key_button(uint8_t row, uint8_t col, int16_t x, int16_t y);
 static const char* keycode_to_string(uint16_t keycode);
 static void process_layer_update(void);
 static void update_key_label(lv_obj_t *label, const char *text);
+static void process_suspend(void);
 
 /**
  * @brief 키 라벨 업데이트 (텍스트 길이에 따라 폰트 크기 조정)
@@ -101,9 +108,9 @@ static void update_key_label(lv_obj_t *label, const char *text)
   
   // 2글자인 경우 폰트 크기를 10으로, 그 외는 14로 설정
   if (strlen(display_text) == 2) {
-    lv_obj_set_style_text_font(label, &lv_font_montserrat_10, 0);
+    lv_obj_set_style_text_font(label, &font_ui_10, 0);
   } else {
-    lv_obj_set_style_text_font(label, &lv_font_montserrat_14, 0);
+    lv_obj_set_style_text_font(label, &font_ui_14, 0);
   }
 }
 
@@ -238,7 +245,7 @@ static void create_main_screen(void)
   layer_label = lv_label_create(main_screen);
   lv_label_set_text(layer_label, "Layer 0");
   lv_obj_set_style_text_color(layer_label, lv_color_hex(COLOR_LAYER_TEXT), 0);
-  lv_obj_set_style_text_font(layer_label, &lv_font_montserrat_14, 0);
+  lv_obj_set_style_text_font(layer_label, &font_ui_14, 0);
   lv_obj_set_pos(layer_label, 5, 2);
   
   // 버튼 배열 초기화
@@ -286,30 +293,6 @@ static void create_main_screen(void)
   }
 }
 
-/**
- * @brief 활성화된 레이어에서 실제 키코드 찾기
- * @param layer_state 현재 레이어 상태 (비트마스크)
- * @param row 행 번호
- * @param col 열 번호
- * @return 실제 키코드 (KC_TRANSPARENT가 아닌 첫 번째 키코드)
- */
-static uint16_t get_keycode_from_active_layers(layer_state_t layer_state, uint8_t row, uint8_t col)
-{
-  // 최상위 레이어부터 확인 (MAX_LAYERS-1 -> 0)
-  for (int8_t layer = MAX_LAYERS - 1; layer >= 0; layer--) {
-    // 해당 레이어가 활성화되어 있는지 확인
-    // Layer 0은 항상 활성화되어 있는 것으로 간주
-    if (layer == 0 || (layer_state & ((layer_state_t)1 << layer))) {
-      uint16_t keycode = dynamic_keymap_get_keycode(layer, row, col);
-      if (keycode != KC_TRANSPARENT) {
-        return keycode;
-      }
-    }
-  }
-  
-  return KC_NO;
-}
-
 /**
  * @brief 레이어 업데이트 처리 (LVGL 스레드에서만 호출)
  */
@@ -332,15 +315,12 @@ static void process_layer_update(void)
     lv_label_set_text(layer_label, layer_text);
   }
   
-  // 현재 활성화된 레이어 상태 가져오기
-  layer_state_t current_layer_state = layer_state;
-  
-  // 모든 키 업데이트 (활성화된 레이어만 고려)
+  // 모든 키 업데이트 (QMK 스레드가 레이어 변경 시 만들어 둔 유효 키맵 테이블 사용)
   for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
     for (uint8_t col = 0; col < MATRIX_COLS; col++) {
       if (key_buttons[row][col] != NULL) {
         // 활성화된 레이어에서 실제 키코드 가져오기
-        uint16_t keycode = get_keycode_from_active_layers(current_layer_state, row, col);
+        uint16_t keycode = dynamic_keymap_get_effective_keycode(row, col);
         
         // 키 라벨 업데이트
         lv_obj_t *label = lv_obj_get_child(key_buttons[row][col], 0);
@@ -377,15 +357,12 @@ static void update_display(lv_timer_t *timer)
     bool current_shift = (current_mods & MOD_MASK_SHIFT) != 0;
     
     if (last_shift != current_shift) {
-      // 현재 활성화된 레이어 상태 가져오기
-      layer_state_t current_layer_state = layer_state;
-      
       // 현재 레이어의 모든 키 업데이트
       for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
         for (uint8_t col = 0; col < MATRIX_COLS; col++) {
           if (key_buttons[row][col] != NULL) {
             // 활성화된 레이어에서 실제 키코드 가져오기
-            uint16_t keycode = get_keycode_from_active_layers(current_layer_state, row, col);
+            uint16_t keycode = dynamic_keymap_get_effective_keycode(row, col);
             
             // 키 라벨 업데이트
             lv_obj_t *label = lv_obj_get_child(key_buttons[row][col], 0);
@@ -407,9 +384,9 @@ static void update_display(lv_timer_t *timer)
 static void lvgl_main_init(void)
 {
   lv_init();
-  
-  // Mutex 초기화
-  k_mutex_init(&layer_mutex);
+
+  // QGF 이미지 디코더 등록
+  apQgfInit();
   
   // 메인 스크린 배경 설정
   lv_obj_t *scr = lv_scr_act();
@@ -425,6 +402,52 @@ static void lvgl_main_init(void)
   update_timer = lv_timer_create(update_display, 100, NULL);
 }
 
+/**
+ * @brief USB suspend 처리 (LVGL 스레드에서 호출)
+ * suspend 중에는 패널/백라이트를 끄고 resume 요청이 올 때까지 스레드를 재운다.
+ */
+static void process_suspend(void)
+{
+  if (is_suspend_req == is_suspended)
+  {
+    return;
+  }
+
+  if (is_suspend_req)
+  {
+    lv_timer_pause(update_timer);
+    gpioPinWrite(HW_GPIO_PIN_LCD_BLK, _DEF_LOW);
+
+    // 프레임 DMA 전송 중에는 sleep 명령이 거절되므로 전송 완료(ISR)를 기다렸다가 다시 시도
+    while (st7789SetSleep(true) == false)
+    {
+      if (is_suspend_req == false)
+      {
+        break;
+      }
+      k_sleep(K_MSEC(1));
+    }
+
+    if (is_suspend_req)
+    {
+      is_suspended = true;
+
+      // resume 요청이 올 때까지 대기
+      k_sem_reset(&lvgl_resume_sema);
+      while (is_suspend_req)
+      {
+        k_sem_take(&lvgl_resume_sema, K_FOREVER);
+      }
+    }
+  }
+
+  st7789SetSleep(false);
+  gpioPinWrite(HW_GPIO_PIN_LCD_BLK, _DEF_HIGH);
+  lv_timer_resume(update_timer);
+  lv_obj_invalidate(lv_scr_act());
+  is_suspended = false;
+}
+
 /**
  * @brief LVGL 스레드 함수
  */
@@ -434,11 +457,18 @@ static void lvgl_thread_func(void *arg1, void *arg2, void *arg3)
   ARG_UNUSED(arg2);
   ARG_UNUSED(arg3);
   
+  // 패널 리셋/초기화 대기는 이 스레드에서 처리 (QMK/RF 부팅과 병렬)
+  hwDisplayInit();
+
+  // 화면 구성에 키맵(EEPROM)이 필요하므로 QMK 초기화 완료까지 대기
+  hwWaitReady(HW_READY_AP, HW_WAIT_FOREVER);
+
   // LVGL 초기화
   lvgl_main_init();
   
   while (1)
   {
+    process_suspend();
     lv_timer_handler();
     k_sleep(K_MSEC(5)); // 5ms 간격으로 LVGL 타이머 처리
   }
@@ -483,6 +513,19 @@ void apLvglUpdateLayer(uint8_t layer)
   k_mutex_unlock(&layer_mutex);
 }
 
+/**
+ * @brief USB suspend/resume 알림 (QMK에서 호출)
+ * @note 실제 패널 제어는 LVGL 스레드에서 처리
+ */
+void apLvglSetSuspend(bool suspend)
+{
+  is_suspend_req = suspend;
+  if (suspend == false)
+  {
+    k_sem_give(&lvgl_resume_sema);
+  }
+}
+
 /**
  * @brief 왼쪽 키보드 연결 상태 업데이트
  */
@@ -23,6 +23,12 @@ void apLvglStart(void);
  */
 void apLvglUpdateLayer(uint8_t layer);
 
+/**
+ * @brief USB suspend/resume 알림 (QMK에서 호출)
+ * @param suspend true: 패널/백라이트 끄고 LVGL 처리 중지, false: 복귀
+ */
+void apLvglSetSuspend(bool suspend);
+
 /**
  * @brief 왼쪽 키보드 연결 상태 업데이트
  * @param connected 연결 상태 (true: 연결, false: 연결 안됨)
@@ -0,0 +1,460 @@
+#include "ap_qgf.h"
+#include "ap.h"
+
+
+#ifdef QGF_ENABLE
+#include "qgf.h"
+#include "qp_draw.h"
+#include "color.h"
+
+
+#define QGF_SHOW_PERIOD_MS  50
+
+
+typedef struct
+{
+  const char         *name;
+  const lv_img_dsc_t *p_img;
+} qgf_asset_t;
+
+// 디코더 세션 (LVGL 이미지 캐시에 열린 채로 남아 있으므로 10줄씩 나눠 그려도 이어서 푼다)
+typedef struct
+{
+  qp_memory_stream_t             stream;
+  qp_internal_byte_input_state_t input;
+  painter_compression_t          compression;
+  uint8_t     bpp;
+  uint32_t    data_pos;     // frame data 시작 위치 (앞 줄을 다시 그릴 때 여기부터 다시 푼다)
+  uint16_t    width;
+  uint16_t    height;
+  uint16_t    row;          // 다음에 풀 줄, p_line 에는 row - 1 번째 줄이 있다
+  uint8_t     bit_buf;      // 1/2/4bpp 에서 아직 쓰지 않은 비트 (LSB 부터, 줄 경계와 상관없이 이어짐)
+  uint8_t     bit_cnt;
+  lv_color_t *p_palette;    // 1 << bpp 개 (grayscale 은 밝기 단계)
+  lv_color_t *p_line;
+} qgf_dec_t;
+
+typedef struct
+{
+  uint32_t open_cnt;
+  uint32_t rows;
+  uint32_t restarts;
+  uint32_t decode_us;
+  uint32_t decode_max_us;   // 한 번 열어서 닫을 때까지 (첫 그리기 시간)
+  uint32_t error_cnt;
+} qgf_stats_t;
+
+
+LV_IMG_DECLARE(img_logo);
+
+static const qgf_asset_t qgf_assets[] =
+{
+  {"logo", &img_logo},
+};
+
+static qgf_stats_t qgf_stats;
+static uint32_t    qgf_session_us;
+
+// CLI 는 요청만 바꾸고 이미지 객체는 LVGL 스레드에서 만들고 지운다
+static volatile int8_t show_req = -1;
+static int8_t          show_cur = -1;
+static lv_obj_t       *show_img = NULL;
+
+
+static void cliQgf(cli_args_t *args);
+
+
+
+
+static bool qgf_is_qgf(const void *src)
+{
+  const lv_img_dsc_t *p_img = (const lv_img_dsc_t *)src;
+
+  if (lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE) return false;
+  if (p_img->header.cf != LV_IMG_CF_RAW) return false;
+  if (p_img->data_size < sizeof(qgf_graphics_descriptor_v1_t)) return false;
+
+  // graphics descriptor 의 magic ("QGF", 24bit little endian)
+  const uint8_t *p_data = p_img->data + sizeof(qgf_block_header_v1_t);
+  return (p_data[0] | (p_data[1] << 8) | (p_data[2] << 16)) == QGF_MAGIC;
+}
+
+// qp_draw_codec.c 의 qp_drawimage_byte_rle_decoder 와 같은 형식
+static int16_t qgf_get_byte(qgf_dec_t *p_dec)
+{
+  qp_internal_byte_input_state_t *state = &p_dec->input;
+
+  if (p_dec->compression == IMAGE_UNCOMPRESSED)
+  {
+    return qp_stream_get(state->src_stream);
+  }
+
+  if (state->rle.mode == MARKER_BYTE)
+  {
+    int16_t c = qp_stream_get(state->src_stream);
+
+    if (c < 0) return c;
+    if (c >= 128)
+    {
+      state->rle.mode   = NON_REPEATING_RUN;
+      state->rle.remain = c - 127;
+    }
+    else
+    {
+      state->rle.mode   = REPEATING_RUN;
+      state->rle.remain = c;
+    }
+    state->curr = qp_stream_get(state->src_stream);
+  }
+
+  int16_t c = state->curr;
+
+  state->rle.remain--;
+  if (state->rle.remain > 0)
+  {
+    if (state->rle.mode == NON_REPEATING_RUN)
+    {
+      state->curr = qp_stream_get(state->src_stream);
+    }
+  }
+  else
+  {
+    state->rle.mode = MARKER_BYTE;
+  }
+  return c;
+}
+
+static void qgf_rewind(qgf_dec_t *p_dec)
+{
+  qp_stream_setpos(&p_dec->stream, p_dec->data_pos);
+  p_dec->input.rle.mode = MARKER_BYTE;
+  p_dec->input.curr     = 0;
+  p_dec->row     = 0;
+  p_dec->bit_buf = 0;
+  p_dec->bit_cnt = 0;
+}
+
+static bool qgf_decode_row(qgf_dec_t *p_dec)
+{
+  lv_color_t *p_line = p_dec->p_line;
+
+  if (p_dec->bpp <= 8)
+  {
+    uint8_t mask = (1 << p_dec->bpp) - 1;
+
+    for (uint16_t x=0; x<p_dec->width; x++)
+    {
+      if (p_dec->bit_cnt == 0)
+      {
+        int16_t c = qgf_get_byte(p_dec);
+
+        if (c < 0) return false;
+        p_dec->bit_buf = c;
+        p_dec->bit_cnt = 8;
+      }
+      p_line[x] = p_dec->p_palette[p_dec->bit_buf & mask];
+      p_dec->bit_buf >>= p_dec->bpp;
+      p_dec->bit_cnt -= p_dec->bpp;
+    }
+  }
+  else
+  {
+    for (uint16_t x=0; x<p_dec->width; x++)
+    {
+      int16_t c[3] = {0, 0, 0};
+
+      for (int i=0; i<p_dec->bpp/8; i++)
+      {
+        c[i] = qgf_get_byte(p_dec);
+        if (c[i] < 0) return false;
+      }
+
+      if (p_dec->bpp == 16)
+      {
+        // RGB565 panel native (big endian)
+        uint16_t v = (c[0] << 8) | c[1];
+        p_line[x] = lv_color_make((v >> 8) & 0xF8, (v >> 3) & 0xFC, (v << 3) & 0xF8);
+      }
+      else
+      {
+        p_line[x] = lv_color_make(c[0], c[1], c[2]);
+      }
+    }
+  }
+
+  p_dec->row++;
+  qgf_stats.rows++;
+  return true;
+}
+
+static bool qgf_load_palette(qgf_dec_t *p_dec, bool has_palette)
+{
+  uint16_t count = 1 << p_dec->bpp;
+
+  p_dec->p_palette = lv_mem_alloc(sizeof(lv_color_t) * count);
+  if (p_dec->p_palette == NULL) return false;
+
+  if (has_palette == false)
+  {
+    for (uint16_t i=0; i<count; i++)
+    {
+      uint8_t v = i * 255 / (count - 1);
+      p_dec->p_palette[i] = lv_color_make(v, v, v);
+    }
+    return true;
+  }
+
+  qgf_palette_v1_t palette_descriptor;
+  if (qp_stream_read(&palette_descriptor, sizeof(qgf_palette_v1_t), 1, &p_dec->stream) != 1) return false;
+  if (!qgf_validate_block_header(&palette_descriptor.header, QGF_FRAME_PALETTE_DESCRIPTOR_TYPEID, count * 3)) return false;
+
+  for (uint16_t i=0; i<count; i++)
+  {
+    qgf_palette_entry_v1_t entry;
+    RGB rgb;
+
+    if (qp_stream_read(&entry, sizeof(entry), 1, &p_dec->stream) != 1) return false;
+    rgb = hsv_to_rgb_nocie((HSV){.h = entry.h, .s = entry.s, .v = entry.v});
+    p_dec->p_palette[i] = lv_color_make(rgb.r, rgb.g, rgb.b);
+  }
+  return true;
+}
+
+static void qgf_close_dec(qgf_dec_t *p_dec)
+{
+  if (p_dec == NULL) return;
+
+  if (p_dec->p_palette != NULL) lv_mem_free(p_dec->p_palette);
+  if (p_dec->p_line != NULL) lv_mem_free(p_dec->p_line);
+  lv_mem_free(p_dec);
+}
+
+static lv_res_t qgf_info(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header)
+{
+  LV_UNUSED(decoder);
+
+  if (qgf_is_qgf(src) == false) return LV_RES_INV;
+
+  const lv_img_dsc_t *p_img = (const lv_img_dsc_t *)src;
+
+  header->always_zero = 0;
+  header->w  = p_img->header.w;
+  header->h  = p_img->header.h;
+  header->cf = LV_IMG_CF_TRUE_COLOR;
+  return LV_RES_OK;
+}
+
+static lv_res_t qgf_open(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc)
+{
+  LV_UNUSED(decoder);
+
+  if (qgf_is_qgf(dsc->src) == false) return LV_RES_INV;
+
+  const lv_img_dsc_t *p_img = (const lv_img_dsc_t *)dsc->src;
+  qgf_dec_t *p_dec;
+  uint16_t frame_count;
+  uint16_t delay;
+  bool has_palette;
+  bool is_panel_native;
+  bool is_delta;
+
+  p_dec = lv_mem_alloc(sizeof(qgf_dec_t));
+  if (p_dec == NULL) return LV_RES_INV;
+  lv_memset_00(p_dec, sizeof(qgf_dec_t));
+
+  p_dec->stream = qp_make_memory_stream((void *)p_img->data, p_img->data_size);
+  p_dec->input.src_stream = (qp_stream_t *)&p_dec->stream;
+
+  // 블록 구조는 painter 의 검증 코드를 그대로 쓴다 (첫 frame 만 그림)
+  if (!qgf_validate_stream((qp_stream_t *)&p_dec->stream) ||
+      !qgf_read_graphics_descriptor((qp_stream_t *)&p_dec->stream, &p_dec->width, &p_dec->height, &frame_count, NULL))
+  {
+    goto error;
+  }
+
+  qgf_frame_v1_t frame_descriptor;
+  qgf_seek_to_frame_descriptor((qp_stream_t *)&p_dec->stream, 0);
+  if (qp_stream_read(&frame_descriptor, sizeof(qgf_frame_v1_t), 1, &p_dec->stream) != 1 ||
+      !qgf_parse_frame_descriptor(&frame_descriptor, &p_dec->bpp, &has_palette, &is_panel_native, &is_delta, &p_dec->compression, &delay))
+  {
+    goto error;
+  }
+  if (is_delta || p_dec->compression > IMAGE_COMPRESSED_RLE) goto error;
+
+  if (p_dec->bpp <= 8 && !qgf_load_palette(p_dec, has_palette)) goto error;
+
+  qgf_data_v1_t data_descriptor;
+  if (qp_stream_read(&data_descriptor, sizeof(qgf_data_v1_t), 1, &p_dec->stream) != 1 ||
+      !qgf_validate_block_header(&data_descriptor.header, QGF_FRAME_DATA_DESCRIPTOR_TYPEID, -1))
+  {
+    goto error;
+  }
+  p_dec->data_pos = qp_stream_tell(&p_dec->stream);
+
+  p_dec->p_line = lv_mem_alloc(sizeof(lv_color_t) * p_dec->width);
+  if (p_dec->p_line == NULL) goto error;
+
+  qgf_rewind(p_dec);
+
+  dsc->user_data = p_dec;
+  dsc->img_data  = NULL;      // 전체 이미지를 RAM 에 풀지 않고 read_line 으로 한 줄씩
+  qgf_stats.open_cnt++;
+  qgf_session_us = 0;
+  return LV_RES_OK;
+
+error:
+  qgf_stats.error_cnt++;
+  qgf_close_dec(p_dec);
+  return LV_RES_INV;
+}
+
+static lv_res_t qgf_read_line(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc,
+                              lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t *buf)
+{
+  LV_UNUSED(decoder);
+
+  qgf_dec_t *p_dec = (qgf_dec_t *)dsc->user_data;
+  uint32_t pre_time = micros();
+
+  if (p_dec == NULL || y >= p_dec->height || x + len > p_dec->width) return LV_RES_INV;
+
+  // 이미 지나간 줄이면 처음부터 다시 (RLE 는 거꾸로 찾아갈 수 없음)
+  if (y + 1 < p_dec->row)
+  {
+    qgf_rewind(p_dec);
+    qgf_stats.restarts++;
+  }
+  while (p_dec->row <= y)
+  {
+    if (!qgf_decode_row(p_dec))
+    {
+      qgf_stats.error_cnt++;
+      qgf_rewind(p_dec);
+      return LV_RES_INV;
+    }
+  }
+  lv_memcpy(buf, &p_dec->p_line[x], sizeof(lv_color_t) * len);
+
+  uint32_t exe_time = micros() - pre_time;
+  qgf_stats.decode_us += exe_time;
+  qgf_session_us += exe_time;
+  if (qgf_session_us > qgf_stats.decode_max_us)
+  {
+    qgf_stats.decode_max_us = qgf_session_us;
+  }
+  return LV_RES_OK;
+}
+
+static void qgf_close(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc)
+{
+  LV_UNUSED(decoder);
+
+  qgf_close_dec((qgf_dec_t *)dsc->user_data);
+  dsc->user_data = NULL;
+}
+
+static void qgf_show_update(lv_timer_t *timer)
+{
+  LV_UNUSED(timer);
+
+  int8_t req = show_req;
+
+  if (req == show_cur) return;
+
+  if (show_img != NULL)
+  {
+    lv_obj_del(show_img);
+    show_img = NULL;
+  }
+  if (req >= 0)
+  {
+    show_img = lv_img_create(lv_layer_top());
+    lv_img_set_src(show_img, qgf_assets[req].p_img);
+    lv_obj_center(show_img);
+  }
+  show_cur = req;
+}
+
+void apQgfInit(void)
+{
+  lv_img_decoder_t *decoder = lv_img_decoder_create();
+
+  lv_img_decoder_set_info_cb(decoder, qgf_info);
+  lv_img_decoder_set_open_cb(decoder, qgf_open);
+  lv_img_decoder_set_read_line_cb(decoder, qgf_read_line);
+  lv_img_decoder_set_close_cb(decoder, qgf_close);
+
+  lv_timer_create(qgf_show_update, QGF_SHOW_PERIOD_MS, NULL);
+
+  cliAdd("qgf", cliQgf);
+}
+
+static void cliQgf(cli_args_t *args)
+{
+  bool ret = false;
+  int  asset_cnt = sizeof(qgf_assets) / sizeof(qgf_assets[0]);
+
+
+  if (args->argc == 1 && args->isStr(0, "info"))
+  {
+    cliPrintf("%-8s %9s %8s %8s\n", "name", "size", "qgf", "rgb565");
+    for (int i=0; i<asset_cnt; i++)
+    {
+      const lv_img_dsc_t *p_img = qgf_assets[i].p_img;
+
+      cliPrintf("%-8s %4dx%-4d %8d %8d\n",
+                qgf_assets[i].name,
+                p_img->header.w,
+                p_img->header.h,
+                p_img->data_size,
+                p_img->header.w * p_img->header.h * 2);
+    }
+    cliPrintf("\nopen %d, rows %d, restart %d, error %d\n",
+              qgf_stats.open_cnt,
+              qgf_stats.rows,
+              qgf_stats.restarts,
+              qgf_stats.error_cnt);
+    cliPrintf("decode %d us (max %d us per open)\n",
+              qgf_stats.decode_us,
+              qgf_stats.decode_max_us);
+    ret = true;
+  }
+
+  if (args->argc == 2 && args->isStr(0, "show"))
+  {
+    for (int i=0; i<asset_cnt; i++)
+    {
+      if (args->isStr(1, (char *)qgf_assets[i].name))
+      {
+        show_req = i;
+        ret = true;
+      }
+    }
+  }
+
+  if (args->argc == 1 && args->isStr(0, "hide"))
+  {
+    show_req = -1;
+    ret = true;
+  }
+
+  if (ret == false)
+  {
+    cliPrintf("qgf info\n");
+    cliPrintf("qgf show ");
+    for (int i=0; i<asset_cnt; i++)
+    {
+      cliPrintf("%s%s", i > 0 ? ":" : "", qgf_assets[i].name);
+    }
+    cliPrintf("\n");
+    cliPrintf("qgf hide\n");
+  }
+}
+
+#else
+
+void apQgfInit(void)
+{
+}
+
+#endif
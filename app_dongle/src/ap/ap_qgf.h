@@ -0,0 +1,21 @@
+#ifndef AP_QGF_H_
+#define AP_QGF_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <zephyr/kernel.h>
+#include "lvgl/lvgl.h"
+
+/**
+ * @brief QGF 이미지 디코더 등록 (lv_init 이후 LVGL 스레드에서 호출)
+ * @note tool/lv_asset.py 로 만든 LV_IMG_CF_RAW 이미지(QGF, RLE) 를 한 줄씩 풀어서 그린다
+ */
+void apQgfInit(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AP_QGF_H_ */
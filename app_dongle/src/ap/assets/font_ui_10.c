@@ -0,0 +1,922 @@
+/*******************************************************************************
+ * Size: 10 px
+ * Bpp: 4
+ * Source: lv_font_montserrat_10.c
+ * Opts: python tool/lv_asset.py font app_dongle/src/lib/lvgl/src/font/lv_font_montserrat_10.c --name font_ui_10 --range 0x20-0x7E --compress
+ * 이 파일은 tool/lv_asset.py 로 생성됨 (직접 수정하지 말 것)
+ ******************************************************************************/
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+#if !LV_USE_FONT_COMPRESSED
+    #error "LV_USE_FONT_COMPRESSED must be enabled in lv_conf.h"
+#endif
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+0021 "!" */
+    0x3e, 0x13, 0x01, 0x30, 0x19, 0x04, 0x2c,
+
+    /* U+0022 "\"" */
+    0x57, 0x84, 0x01, 0x07, 0x72, 0xe1, 0x00,
+
+    /* U+0023 "#" */
+    0x00, 0x58, 0x14, 0x00, 0x73, 0x70, 0x25, 0x2d, 0x4d, 0x42, 0x43, 0x52, 0xf4, 0x43, 0x96, 0xda,
+    0x52, 0x2a, 0x6d, 0x6d, 0x03, 0x9c, 0x03,
+
+    /* U+0024 "$" */
+    0x00, 0x09, 0x80, 0x51, 0x9b, 0x86, 0xa7, 0xf3, 0xa4, 0x2c, 0xe0, 0x22, 0x4b, 0x99, 0x40, 0x01,
+    0xb9, 0xc6, 0x8c, 0x83, 0xb0, 0x43, 0xbe, 0x7a, 0x4f, 0x3e, 0x6c, 0x80,
+
+    /* U+0025 "%" */
+    0x29, 0x91, 0x01, 0x48, 0x02, 0xe2, 0x16, 0x11, 0x00, 0x00, 0x99, 0x85, 0xf8, 0x40, 0x13, 0x54,
+    0xce, 0x28, 0x40, 0x18, 0x87, 0xdf, 0xc7, 0x00, 0x51, 0x00, 0x10, 0x0c, 0x60, 0x64, 0x11, 0xa0,
+
+    /* U+0026 "&" */
+    0x03, 0xcb, 0x70, 0x0a, 0x62, 0xe8, 0x02, 0xff, 0x55, 0x80, 0x44, 0xec, 0xc1, 0x05, 0xdc, 0xbb,
+    0x51, 0x91, 0x01, 0xc5, 0x4d, 0xcb, 0x30, 0x72, 0xe1, 0x59, 0x89, 0x77,
+
+    /* U+0027 "'" */
+    0x57, 0x01, 0x75,
+
+    /* U+0028 "(" */
+    0x02, 0xc0, 0x05, 0xd0, 0x01, 0x1c, 0x00, 0x62, 0x01, 0xfe, 0x31, 0x00, 0x23, 0x80, 0x2e, 0x80,
+
+    /* U+0029 ")" */
+    0x68, 0x06, 0x60, 0x01, 0x4c, 0x09, 0x80, 0x4c, 0x04, 0xc0, 0x98, 0x14, 0xd9, 0x80,
+
+    /* U+002A "*" */
+    0x24, 0x41, 0x34, 0xc9, 0x8d, 0x10, 0x6f, 0x76, 0x70,
+
+    /* U+002B "+" */
+    0x00, 0xfd, 0x0a, 0x00, 0x3b, 0x59, 0xb1, 0x3b, 0x59, 0xb1, 0x00, 0xf0,
+
+    /* U+002C "," */
+    0x35, 0x7f, 0x1f,
+
+    /* U+002D "-" */
+    0x5c, 0xc1, 0x80,
+
+    /* U+002E "." */
+    0x02, 0x68,
+
+    /* U+002F "/" */
+    0x00, 0x8a, 0xc0, 0x2a, 0xe0, 0x09, 0x54, 0x00, 0x44, 0x00, 0x5d, 0x40, 0x13, 0x98, 0x01, 0x54,
+    0x01, 0x75, 0x00, 0x05, 0xc8, 0x00,
+
+    /* U+0030 "0" */
+    0x04, 0xdd, 0x58, 0x80, 0xd7, 0xee, 0xa8, 0x1d, 0xc4, 0x0c, 0xa2, 0x30, 0x04, 0x66, 0x11, 0x00,
+    0x46, 0x67, 0x71, 0x03, 0x28, 0x8a, 0xbf, 0x75, 0x40,
+
+    /* U+0031 "1" */
+    0xbe, 0xab, 0xb0, 0x07, 0xff, 0x10,
+
+    /* U+0032 "2" */
+    0x4c, 0xdd, 0x28, 0x03, 0xb7, 0x28, 0x10, 0x80, 0x40, 0x3a, 0x9c, 0x02, 0xa3, 0x80, 0x05, 0x94,
+    0x80, 0x21, 0x17, 0x74, 0xa0,
+
+    /* U+0033 "3" */
+    0x8d, 0xd7, 0x70, 0x23, 0x74, 0x54, 0x01, 0x4a, 0x20, 0x02, 0x25, 0x90, 0x0a, 0xf5, 0x0d, 0x44,
+    0x04, 0xc4, 0xf3, 0x72, 0x08,
+
+    /* U+0034 "4" */
+    0x00, 0x9e, 0x80, 0x32, 0xdd, 0x00, 0x47, 0x1a, 0x62, 0x03, 0xde, 0x30, 0x41, 0x21, 0xd8, 0x9c,
+    0xf1, 0xb9, 0x84, 0xe7, 0x00, 0xf8,
+
+    /* U+0035 "5" */
+    0x0f, 0xdd, 0x80, 0x4b, 0x76, 0x03, 0x10, 0x0c, 0x25, 0xb8, 0xc0, 0x7d, 0xba, 0xb4, 0x31, 0x01,
+    0x10, 0x36, 0xec, 0x88,
+
+    /* U+0036 "6" */
+    0x02, 0xbd, 0xd2, 0x0e, 0x7e, 0xe9, 0x1d, 0x10, 0x01, 0x08, 0x55, 0xd0, 0x89, 0x2e, 0xdf, 0xae,
+    0x62, 0x0c, 0x03, 0x39, 0x88, 0xe0,
+
+    /* U+0037 "7" */
+    0xbd, 0xdb, 0xa0, 0x27, 0x74, 0x77, 0x64, 0x04, 0x13, 0x00, 0xa2, 0x00, 0x11, 0x8a, 0x00, 0x53,
+    0x60, 0x10, 0xa3, 0x00, 0x00,
+
+    /* U+0038 "8" */
+    0x07, 0xcc, 0x59, 0x1d, 0x66, 0x36, 0x04, 0x02, 0x13, 0x26, 0xec, 0x8b, 0x61, 0xec, 0xbf, 0x13,
+    0x00, 0x39, 0xb8, 0x65, 0xfd, 0x00,
+
+    /* U+0039 "9" */
+    0x1a, 0xcc, 0x30, 0x46, 0x65, 0xa6, 0x02, 0x00, 0x7a, 0x9e, 0xbb, 0x21, 0x84, 0xdd, 0x80, 0x80,
+    0x22, 0x6a, 0x2d, 0xd7, 0x51, 0x00,
+
+    /* U+003A ":" */
+    0x6a, 0x6b, 0x01, 0x02, 0x68,
+
+    /* U+003B ";" */
+    0x6a, 0x6b, 0x01, 0x00, 0x35, 0x29, 0x05, 0x00,
+
+    /* U+003C "<" */
+    0x00, 0xc2, 0x01, 0x2d, 0x58, 0x9f, 0x1d, 0xd0, 0x9c, 0x6c, 0x18, 0x01, 0xae, 0xe1,
+
+    /* U+003D "=" */
+    0x3b, 0xbc, 0x27, 0x77, 0x84, 0xee, 0xf0, 0x80,
+
+    /* U+003E ">" */
+    0x10, 0x0e, 0x3b, 0xa4, 0x00, 0x15, 0xdb, 0x38, 0x41, 0x2c, 0xec, 0x4c, 0xd7, 0x65, 0x00,
+
+    /* U+003F "?" */
+    0x3c, 0xdd, 0x28, 0x37, 0x6e, 0x50, 0x29, 0x01, 0x10, 0x02, 0x3e, 0xf0, 0x0a, 0xe0, 0x80, 0x29,
+    0x50, 0x0d, 0x48, 0x00,
+
+    /* U+0040 "@" */
+    0x00, 0x25, 0x4c, 0xa9, 0xc0, 0x26, 0xda, 0x99, 0x52, 0x50, 0x0e, 0xcb, 0xe5, 0xcc, 0x73, 0xbb,
+    0x93, 0x31, 0x62, 0x09, 0xa2, 0xc7, 0x80, 0x0b, 0x00, 0x85, 0x93, 0x00, 0x16, 0x01, 0x3f, 0x1e,
+    0xe5, 0xf3, 0xdc, 0x8e, 0xcb, 0x65, 0xb6, 0x59, 0x83, 0x6d, 0x4d, 0x50, 0x80, 0x00,
+
+    /* U+0041 "A" */
+    0x00, 0x87, 0xd8, 0x03, 0xd2, 0xf4, 0x01, 0xe5, 0x85, 0x40, 0x0c, 0xd4, 0x17, 0xe0, 0x1a, 0xed,
+    0x9c, 0xa6, 0x00, 0x54, 0xcc, 0xaa, 0x40, 0x13, 0x40, 0x12, 0x38, 0x80,
+
+    /* U+0042 "B" */
+    0xfc, 0xca, 0xc8, 0x01, 0x99, 0xa0, 0x03, 0xbc, 0x80, 0x19, 0x8d, 0x7b, 0x00, 0x66, 0x37, 0x60,
+    0x0e, 0x31, 0x00, 0x66, 0x5b, 0x40,
+
+    /* U+0043 "C" */
+    0x01, 0x9d, 0xd6, 0x18, 0x67, 0xee, 0xbd, 0x95, 0x98, 0x00, 0x35, 0x23, 0x00, 0xe2, 0x30, 0x0e,
+    0x56, 0x60, 0x00, 0xd4, 0x33, 0xf7, 0x5e, 0xc0,
+
+    /* U+0044 "D" */
+    0xfd, 0xda, 0xcc, 0x01, 0xbb, 0x46, 0x90, 0x06, 0x38, 0xb0, 0x0e, 0x22, 0x00, 0x71, 0x10, 0x03,
+    0x1c, 0x58, 0x6e, 0xd1, 0xa4,
+
+    /* U+0045 "E" */
+    0xfd, 0xdb, 0x00, 0x1b, 0xb6, 0x00, 0x7e, 0xcc, 0x9c, 0x01, 0x99, 0x38, 0x07, 0xed, 0xdc, 0x20,
+
+    /* U+0046 "F" */
+    0xfd, 0xdb, 0x03, 0x76, 0xc0, 0x0f, 0x6e, 0xce, 0x1b, 0xb3, 0x80, 0x7f, 0x80,
+
+    /* U+0047 "G" */
+    0x01, 0x9d, 0xd6, 0x20, 0x67, 0x6e, 0xb8, 0x55, 0x9c, 0x00, 0x4a, 0x46, 0x01, 0x9c, 0x8c, 0x02,
+    0x1a, 0x56, 0x60, 0x00, 0x80, 0x19, 0xfb, 0xaf, 0x80,
+
+    /* U+0048 "H" */
+    0xf0, 0x0d, 0xe2, 0x01, 0xff, 0xc3, 0xdd, 0xc0, 0x16, 0xee, 0x00, 0xff, 0xe2, 0x00,
+
+    /* U+0049 "I" */
+    0xf0, 0x0f, 0xfe, 0x08,
+
+    /* U+004A "J" */
+    0x04, 0xdd, 0x79, 0x02, 0x6e, 0x88, 0x03, 0xff, 0x90, 0xc0, 0x26, 0x41, 0xdb, 0x90, 0x00,
+
+    /* U+004B "K" */
+    0xf0, 0x0a, 0xa0, 0x03, 0x49, 0xc0, 0x05, 0x21, 0x20, 0x14, 0xb6, 0x80, 0x62, 0xba, 0x20, 0x0a,
+    0x92, 0xfc, 0x40, 0x02, 0x0b, 0x74, 0x00,
+
+    /* U+004C "L" */
+    0xf0, 0x0f, 0xfe, 0x96, 0xed, 0x40,
+
+    /* U+004D "M" */
+    0xf2, 0x00, 0xd2, 0xe1, 0xc0, 0x11, 0xb0, 0x01, 0x94, 0x01, 0xea, 0x00, 0xb8, 0x06, 0x5d, 0x00,
+    0x0d, 0x4d, 0xc0, 0x06, 0x74, 0xb1, 0x00, 0xec, 0x60, 0x08,
+
+    /* U+004E "N" */
+    0xf4, 0x00, 0xbc, 0x42, 0x88, 0x03, 0xa3, 0xc0, 0x39, 0x92, 0x80, 0x3a, 0x45, 0xc0, 0x3a, 0xa8,
+    0x01, 0xc3, 0xc0, 0x00,
+
+    /* U+004F "O" */
+    0x01, 0x9d, 0xd6, 0x20, 0x03, 0x3f, 0x75, 0xd2, 0x8a, 0xcc, 0x00, 0x14, 0xf9, 0x18, 0x06, 0x55,
+    0x11, 0x80, 0x65, 0x59, 0x98, 0x00, 0x29, 0xf0, 0xcf, 0xdd, 0x74, 0xa0,
+
+    /* U+0050 "P" */
+    0xfd, 0xda, 0x40, 0x1b, 0xb1, 0xb8, 0x06, 0xfd, 0x00, 0xdd, 0x81, 0xba, 0xcc, 0x30, 0x6e, 0xb1,
+    0xc0, 0x3e,
+
+    /* U+0051 "Q" */
+    0x01, 0x9d, 0xd6, 0x20, 0x05, 0xbd, 0xba, 0xf9, 0x40, 0x57, 0x70, 0x00, 0xe7, 0xc0, 0x8c, 0x03,
+    0x2a, 0x80, 0x88, 0x01, 0x94, 0x81, 0x5d, 0x80, 0x05, 0x30, 0x00, 0xcc, 0x6e, 0xbe, 0x50, 0x00,
+    0x35, 0xb2, 0xff, 0x40,
+
+    /* U+0052 "R" */
+    0xfd, 0xda, 0x40, 0x1b, 0xb1, 0xb8, 0x06, 0xfd, 0x00, 0xdd, 0xa1, 0x98, 0xf2, 0x70, 0xcc, 0x51,
+    0x00, 0x65, 0x27,
+
+    /* U+0053 "S" */
+    0x08, 0xdc, 0xc1, 0xa9, 0xee, 0x69, 0x0b, 0x10, 0x08, 0x92, 0xff, 0xa4, 0x00, 0xdb, 0xe1, 0x46,
+    0x60, 0x1c, 0x10, 0x8c, 0xc7, 0x48,
+
+    /* U+0054 "T" */
+    0xcd, 0xee, 0x6d, 0x66, 0xbc, 0xed, 0x00, 0x7f, 0xf4, 0x80,
+
+    /* U+0055 "U" */
+    0x0f, 0x00, 0x87, 0x80, 0x3f, 0xf9, 0x42, 0x01, 0x19, 0x81, 0x1c, 0x01, 0x6a, 0x17, 0xbb, 0x04,
+    0x00,
+
+    /* U+0056 "V" */
+    0x0c, 0x40, 0x08, 0x74, 0x01, 0x3e, 0x01, 0x4d, 0x00, 0x15, 0x44, 0x00, 0x66, 0x00, 0x53, 0x60,
+    0xce, 0x20, 0x13, 0x38, 0xdd, 0x80, 0x30, 0xbe, 0xb1, 0x00, 0x75, 0x9f, 0x80, 0x40,
+
+    /* U+0057 "W" */
+    0x88, 0x00, 0x5e, 0x80, 0x02, 0xcb, 0x50, 0x02, 0x8f, 0x00, 0x2a, 0x86, 0x04, 0x1f, 0x48, 0x00,
+    0x57, 0x05, 0xa0, 0x74, 0x48, 0xc4, 0x41, 0x4a, 0xa4, 0x0e, 0xe5, 0xd0, 0x00, 0x82, 0x28, 0x11,
+    0x0a, 0xe0, 0x12, 0x99, 0x80, 0x08, 0x22, 0x00,
+
+    /* U+0058 "X" */
+    0x5c, 0x00, 0x0e, 0x8a, 0xaa, 0x02, 0xa0, 0x42, 0x56, 0x89, 0x40, 0x2b, 0x5b, 0x00, 0x86, 0xe3,
+    0x80, 0x2d, 0x87, 0x68, 0x08, 0x65, 0x0a, 0x53,
+
+    /* U+0059 "Y" */
+    0x0b, 0x50, 0x0b, 0x0c, 0x26, 0x00, 0x0c, 0xa6, 0x04, 0xb0, 0x37, 0x00, 0x14, 0x2d, 0x58, 0x80,
+    0x68, 0x66, 0x00, 0x70, 0xb0, 0x07, 0xfc,
+
+    /* U+005A "Z" */
+    0x6d, 0xdd, 0xe2, 0xdb, 0xb3, 0x40, 0x80, 0x50, 0x2e, 0x01, 0x22, 0xd0, 0x04, 0x55, 0xe0, 0x1b,
+    0xe8, 0x80, 0x28, 0x29, 0xdd, 0x8c,
+
+    /* U+005B "[" */
+    0xfb, 0x10, 0xb1, 0x00, 0xff, 0xe3, 0xd8, 0x80,
+
+    /* U+005C "\\" */
+    0x3a, 0x00, 0x8d, 0x84, 0x02, 0xb7, 0x00, 0x9a, 0x80, 0x21, 0x72, 0x00, 0xba, 0x80, 0x25, 0x50,
+    0x06, 0x73, 0x00, 0xba, 0x80,
+
+    /* U+005D "]" */
+    0x9e, 0x49, 0x50, 0x0f, 0xfe, 0x3c, 0xa8, 0x00,
+
+    /* U+005E "^" */
+    0x00, 0x54, 0x00, 0x44, 0x66, 0x00, 0xae, 0xdc, 0xc0, 0x24, 0x45, 0xd0,
+
+    /* U+005F "_" */
+    0x99, 0xe0,
+
+    /* U+0060 "`" */
+    0x3a, 0x30,
+
+    /* U+0061 "a" */
+    0x1b, 0xcd, 0x60, 0x1a, 0xcd, 0x80, 0x1b, 0xaa, 0x08, 0x98, 0xaa, 0x82, 0x0a, 0x95, 0x40, 0x00,
+
+    /* U+0062 "b" */
+    0x1e, 0x00, 0xff, 0xe1, 0x56, 0x6b, 0x00, 0x06, 0x73, 0x10, 0x40, 0x26, 0x02, 0x8e, 0x02, 0x80,
+    0x28, 0xe0, 0x5b, 0x98, 0xb2,
+
+    /* U+0063 "c" */
+    0x07, 0xdd, 0x50, 0x2d, 0xee, 0xb8, 0x36, 0xc0, 0x08, 0x1b, 0x60, 0x04, 0x15, 0xbd, 0xd7, 0x08,
+
+    /* U+0064 "d" */
+    0x00, 0xee, 0x00, 0xfa, 0x37, 0x24, 0x15, 0x37, 0x38, 0x36, 0xc0, 0x0c, 0x1b, 0x80, 0x07, 0x05,
+    0x3d, 0xbe, 0x00,
+
+    /* U+0065 "e" */
+    0x08, 0xcc, 0x48, 0x29, 0x66, 0x05, 0xf5, 0xaa, 0x85, 0xfa, 0xf5, 0x48, 0x82, 0xe6, 0xe4, 0x88,
+
+    /* U+0066 "f" */
+    0x07, 0xc9, 0x09, 0xc9, 0x90, 0xdb, 0x48, 0x5b, 0x00, 0x7f, 0xe0,
+
+    /* U+0067 "g" */
+    0x08, 0xdc, 0x9e, 0x53, 0xdc, 0xc0, 0xee, 0x00, 0x14, 0x36, 0xc0, 0x0c, 0x0b, 0x7b, 0x9e, 0x00,
+    0x4d, 0xcd, 0x31, 0x9c, 0xc7, 0xf0,
+
+    /* U+0068 "h" */
+    0x1e, 0x00, 0xff, 0xd5, 0x9a, 0x80, 0x33, 0x9d, 0x20, 0x26, 0x06, 0x60, 0x0e, 0x10, 0x0f,
+
+    /* U+0069 "i" */
+    0x2d, 0x02, 0xc0, 0x1f, 0x00, 0xff, 0xe0, 0x80,
+
+    /* U+006A "j" */
+    0x01, 0xe0, 0x00, 0xf8, 0x05, 0xe0, 0x1f, 0xfc, 0x61, 0x00, 0x56, 0x40, 0x00,
+
+    /* U+006B "k" */
+    0x1e, 0x00, 0xff, 0xe1, 0x8d, 0xb0, 0x04, 0x59, 0xcc, 0x00, 0x1f, 0x37, 0x00, 0xdf, 0x7e, 0x01,
+    0x09, 0x2d, 0x58, 0x00,
+
+    /* U+006C "l" */
+    0x1e, 0x00, 0xff, 0xc0,
+
+    /* U+006D "m" */
+    0x1e, 0xab, 0xc5, 0xbb, 0x61, 0x00, 0xc5, 0xcd, 0x52, 0xea, 0xc0, 0x48, 0x1c, 0xc4, 0x08, 0x80,
+    0x1f, 0xfc, 0x80,
+
+    /* U+006E "n" */
+    0x1e, 0xab, 0xc4, 0x01, 0x8b, 0xf9, 0x01, 0x20, 0x33, 0x00, 0x70, 0x80, 0x78,
+
+    /* U+006F "o" */
+    0x07, 0xdd, 0x58, 0xad, 0xee, 0xb2, 0xb6, 0xc0, 0x0c, 0xbb, 0x60, 0x06, 0x55, 0x5e, 0xeb, 0x28,
+
+    /* U+0070 "p" */
+    0x1e, 0xab, 0xd6, 0x00, 0x0c, 0xde, 0x59, 0x00, 0x98, 0x0b, 0xb8, 0x05, 0x00, 0x51, 0xc0, 0x7b,
+    0x31, 0x64, 0x00, 0xac, 0xd5, 0x00, 0xfc,
+
+    /* U+0071 "q" */
+    0x08, 0xdc, 0x8e, 0x54, 0xdc, 0xf0, 0xdb, 0x00, 0x30, 0x6d, 0x80, 0x18, 0x15, 0x37, 0x3c, 0x01,
+    0x1b, 0x90, 0x01, 0xf0,
+
+    /* U+0072 "r" */
+    0x1d, 0xaa, 0x01, 0x4d, 0x00, 0x98, 0x07, 0xf0,
+
+    /* U+0073 "s" */
+    0x2c, 0xc9, 0x29, 0x33, 0x09, 0x45, 0x94, 0x47, 0x59, 0x88, 0x7c, 0xc5, 0x48,
+
+    /* U+0074 "t" */
+    0x0f, 0x00, 0x48, 0x5b, 0x48, 0x5b, 0x00, 0x70, 0x88, 0x01, 0x39, 0x20,
+
+    /* U+0075 "u" */
+    0x2d, 0x00, 0x0e, 0x80, 0x7f, 0xe2, 0x31, 0x07, 0x00, 0x46, 0x5f, 0x80,
+
+    /* U+0076 "v" */
+    0x0c, 0x30, 0x04, 0xa8, 0x4c, 0x80, 0x51, 0x41, 0x5c, 0xa6, 0xc0, 0x2b, 0xb2, 0xb0, 0x04, 0xce,
+    0xa0, 0x00,
+
+    /* U+0077 "w" */
+    0xb2, 0x01, 0xf1, 0x02, 0xbe, 0xa0, 0x64, 0x90, 0xae, 0x55, 0x05, 0x51, 0x41, 0x54, 0x0b, 0x28,
+    0x29, 0x2a, 0x00, 0xa6, 0xb0, 0xb6, 0xa0,
+
+    /* U+0078 "x" */
+    0x5b, 0x03, 0xc0, 0x53, 0x9f, 0xd0, 0x04, 0x3d, 0x88, 0x02, 0xa6, 0xc8, 0x1c, 0xdf, 0xbc, 0x40,
+
+    /* U+0079 "y" */
+    0x0c, 0x30, 0x04, 0xa8, 0x4c, 0x80, 0x51, 0x41, 0x5c, 0x9a, 0x80, 0x2b, 0xb5, 0x38, 0x04, 0xce,
+    0xa0, 0x1c, 0x72, 0x01, 0x66, 0xd8, 0x80, 0x00,
+
+    /* U+007A "z" */
+    0x6b, 0xb7, 0x5b, 0x5c, 0x9d, 0x00, 0xff, 0x84, 0x36, 0x48, 0x20, 0xbe, 0xe4,
+
+    /* U+007B "{" */
+    0x04, 0xd3, 0x0d, 0x83, 0x03, 0x00, 0xc2, 0x0a, 0xb0, 0x2a, 0xc0, 0x10, 0x80, 0x0c, 0x02, 0xd8,
+    0x30,
+
+    /* U+007C "|" */
+    0xe0, 0x0f, 0xc0,
+
+    /* U+007D "}" */
+    0xab, 0x0a, 0x62, 0x00, 0xc2, 0x00, 0x5e, 0x05, 0xe0, 0x10, 0x0d, 0x4c, 0x40,
+
+    /* U+007E "~" */
+    0x1a, 0x91, 0x62, 0x5e, 0xb8, 0xf2,
+
+    /* RLE 디코더가 마지막 글리프 뒤 1 byte 를 더 읽음 */
+    0x00
+};
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 43, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 43, .box_w = 2, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7, .adv_w = 63, .box_w = 4, .box_h = 3, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 14, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 37, .adv_w = 99, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 65, .adv_w = 135, .box_w = 9, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 97, .adv_w = 110, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 125, .adv_w = 34, .box_w = 2, .box_h = 3, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 128, .adv_w = 54, .box_w = 4, .box_h = 9, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 144, .adv_w = 54, .box_w = 3, .box_h = 9, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 158, .adv_w = 64, .box_w = 4, .box_h = 4, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 167, .adv_w = 93, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 179, .adv_w = 36, .box_w = 2, .box_h = 3, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 182, .adv_w = 61, .box_w = 4, .box_h = 1, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 185, .adv_w = 36, .box_w = 2, .box_h = 2, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 187, .adv_w = 56, .box_w = 5, .box_h = 9, .ofs_x = -1, .ofs_y = -1},
+    {.bitmap_index = 209, .adv_w = 107, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 234, .adv_w = 59, .box_w = 3, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 240, .adv_w = 92, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 261, .adv_w = 92, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 282, .adv_w = 107, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 304, .adv_w = 92, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 324, .adv_w = 99, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 346, .adv_w = 96, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 367, .adv_w = 103, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 389, .adv_w = 99, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 411, .adv_w = 36, .box_w = 2, .box_h = 5, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 416, .adv_w = 36, .box_w = 2, .box_h = 7, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 424, .adv_w = 93, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 438, .adv_w = 93, .box_w = 6, .box_h = 3, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 446, .adv_w = 93, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 461, .adv_w = 92, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 481, .adv_w = 165, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 527, .adv_w = 117, .box_w = 9, .box_h = 7, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 555, .adv_w = 121, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 577, .adv_w = 116, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 601, .adv_w = 132, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 622, .adv_w = 107, .box_w = 6, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 638, .adv_w = 102, .box_w = 5, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 651, .adv_w = 124, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 676, .adv_w = 130, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 690, .adv_w = 50, .box_w = 2, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 694, .adv_w = 82, .box_w = 6, .box_h = 7, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 709, .adv_w = 115, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 732, .adv_w = 95, .box_w = 5, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 738, .adv_w = 153, .box_w = 8, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 764, .adv_w = 130, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 784, .adv_w = 134, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 812, .adv_w = 116, .box_w = 6, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 830, .adv_w = 134, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 866, .adv_w = 116, .box_w = 6, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 885, .adv_w = 99, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 907, .adv_w = 94, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 917, .adv_w = 127, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 934, .adv_w = 114, .box_w = 9, .box_h = 7, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 964, .adv_w = 180, .box_w = 11, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1004, .adv_w = 108, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1028, .adv_w = 104, .box_w = 8, .box_h = 7, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 1051, .adv_w = 105, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1073, .adv_w = 53, .box_w = 3, .box_h = 9, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 1081, .adv_w = 56, .box_w = 5, .box_h = 9, .ofs_x = -1, .ofs_y = -1},
+    {.bitmap_index = 1102, .adv_w = 53, .box_w = 3, .box_h = 9, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1110, .adv_w = 93, .box_w = 6, .box_h = 4, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 1122, .adv_w = 80, .box_w = 5, .box_h = 1, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1124, .adv_w = 96, .box_w = 3, .box_h = 1, .ofs_x = 1, .ofs_y = 6},
+    {.bitmap_index = 1126, .adv_w = 96, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1142, .adv_w = 109, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1163, .adv_w = 91, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1179, .adv_w = 109, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1198, .adv_w = 98, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1214, .adv_w = 56, .box_w = 4, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1225, .adv_w = 110, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1247, .adv_w = 109, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1262, .adv_w = 45, .box_w = 3, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1270, .adv_w = 45, .box_w = 4, .box_h = 9, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 1283, .adv_w = 99, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1303, .adv_w = 45, .box_w = 2, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1307, .adv_w = 169, .box_w = 10, .box_h = 5, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1326, .adv_w = 109, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1339, .adv_w = 102, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1355, .adv_w = 109, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1378, .adv_w = 109, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1398, .adv_w = 66, .box_w = 4, .box_h = 5, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1406, .adv_w = 80, .box_w = 5, .box_h = 5, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1419, .adv_w = 66, .box_w = 4, .box_h = 6, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1431, .adv_w = 108, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1443, .adv_w = 89, .box_w = 7, .box_h = 5, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 1461, .adv_w = 144, .box_w = 9, .box_h = 5, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1484, .adv_w = 88, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1500, .adv_w = 89, .box_w = 7, .box_h = 7, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 1524, .adv_w = 83, .box_w = 5, .box_h = 5, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1537, .adv_w = 56, .box_w = 4, .box_h = 9, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1554, .adv_w = 48, .box_w = 1, .box_h = 9, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 1557, .adv_w = 56, .box_w = 3, .box_h = 9, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1570, .adv_w = 93, .box_w = 6, .box_h = 2, .ofs_x = 0, .ofs_y = 2}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] = {
+    0, 0, 1, 2, 0, 3, 4, 5,
+    2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 0, 13, 14, 15, 16, 17,
+    18, 19, 12, 20, 20, 0, 0, 0,
+    21, 22, 23, 24, 25, 22, 26, 27,
+    28, 29, 29, 30, 31, 32, 29, 29,
+    22, 33, 34, 35, 3, 36, 30, 37,
+    37, 38, 39, 40, 41, 42, 43, 0,
+    44, 0, 45, 46, 47, 48, 49, 50,
+    51, 45, 52, 52, 53, 48, 45, 45,
+    46, 46, 54, 55, 56, 57, 51, 58,
+    58, 59, 58, 60, 41, 0, 0, 9
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] = {
+    0, 0, 1, 2, 0, 3, 4, 5,
+    2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 13, 14, 15, 16, 17, 12,
+    18, 19, 20, 21, 21, 0, 0, 0,
+    22, 23, 24, 25, 23, 25, 25, 25,
+    23, 25, 25, 26, 25, 25, 25, 25,
+    23, 25, 23, 25, 3, 27, 28, 29,
+    29, 30, 31, 32, 33, 34, 35, 0,
+    36, 0, 37, 38, 39, 39, 39, 0,
+    39, 38, 40, 41, 38, 38, 42, 42,
+    39, 42, 39, 42, 43, 44, 45, 46,
+    46, 47, 46, 48, 0, 0, 35, 9
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] = {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 7, 0, 4, -4, 0, 0, 0,
+    0, -9, -10, 1, 8, 4, 3, -6,
+    1, 8, 0, 7, 2, 5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 10, 1, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -5, 0, 0, 0, 0, 0, -3,
+    3, 3, 0, 0, -2, 0, -1, 2,
+    0, -2, 0, -2, -1, -3, 0, 0,
+    0, 0, -2, 0, 0, -2, -2, 0,
+    0, -2, 0, -3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, -2, 0,
+    0, -4, 0, -19, 0, 0, -3, 0,
+    3, 5, 0, 0, -3, 2, 2, 5,
+    3, -3, 3, 0, 0, -9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -6, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -2, -8, 0, -6, -1, 0, 0, 0,
+    0, 0, 6, 0, -5, -1, 0, 0,
+    0, -3, 0, 0, -1, -12, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -13, -1, 6, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 5, 0, 2, 0, 0, -3,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 6, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -6, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 3, 2, 5, -2, 0, 0, 3,
+    -2, -5, -22, 1, 4, 3, 0, -2,
+    0, 6, 0, 5, 0, 5, 0, -15,
+    0, -2, 5, 0, 5, -2, 3, 2,
+    0, 0, 0, -2, 0, 0, -3, 13,
+    0, 13, 0, 5, 0, 7, 2, 3,
+    0, 0, 0, -6, 0, 0, 0, 0,
+    0, -1, 0, 1, -3, -2, -3, 1,
+    0, -2, 0, 0, 0, -6, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -10, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -9, 0, -10, 0, 0, 0, 0,
+    -1, 0, 16, -2, -2, 2, 2, -1,
+    0, -2, 2, 0, 0, -8, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -16, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 10, 0, 0, -6, 0, 5, 0,
+    -11, -16, -11, -3, 5, 0, 0, -11,
+    0, 2, -4, 0, -2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 5, -20, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 1,
+    1, -2, -3, 0, 0, 0, -2, 0,
+    0, -1, 0, 0, 0, -3, 0, -1,
+    0, -4, -3, 0, -4, -5, -5, -3,
+    0, -3, 0, -3, 0, 0, 0, 0,
+    -1, 0, 0, 2, 0, 1, -2, 0,
+    0, 0, 0, 2, -1, 0, 0, 0,
+    -1, 2, 2, 0, 0, 0, 0, -3,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, -1, 0, -2, 0, -3, 0,
+    0, -1, 0, 5, 0, 0, -2, 0,
+    0, 0, 0, 0, 0, 0, -1, -1,
+    0, -2, 0, -2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -1, 0,
+    -2, -2, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -2, -2, -2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -1, 0, 0, 0, 0, -1, -2, 0,
+    0, -5, -1, -5, 3, 0, 0, -3,
+    2, 3, 4, 0, -4, 0, -2, 0,
+    0, -8, 2, -1, 1, -8, 2, 0,
+    0, 0, -8, 0, -8, -1, -14, -1,
+    0, -8, 0, 3, 4, 0, 2, 0,
+    0, 0, 0, 0, 0, -3, -2, 0,
+    0, 0, 0, -2, 0, 0, 0, -2,
+    0, 0, 0, 0, 0, -1, -1, 0,
+    -1, -2, 0, 0, 0, 0, 0, 0,
+    0, -2, -2, 0, -1, -2, -1, 0,
+    0, -2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -1, 0,
+    0, -1, 0, -3, 2, 0, 0, -2,
+    1, 2, 2, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 1,
+    0, 0, -2, 0, -2, -1, -2, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    -1, 0, 0, 0, 0, -2, -2, 0,
+    0, 5, -1, 0, -5, 0, 0, 4,
+    -8, -8, -7, -3, 2, 0, -1, -10,
+    -3, 0, -3, 0, -3, 2, -3, -10,
+    0, -4, 0, 0, 1, 0, 1, -1,
+    0, 2, 0, -5, -6, 0, -8, -4,
+    -3, -4, -5, -2, -4, 0, -3, -4,
+    0, 0, 0, -2, 0, 0, 0, 1,
+    0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 0, -1,
+    0, 0, -2, 0, -3, -4, -4, 0,
+    0, -5, 0, 0, 0, 0, 0, 0,
+    -1, 0, 0, 0, 0, 1, -1, 0,
+    0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 8, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, -2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -1, 0, 0, 0, -3, 0, 0, 0,
+    0, -8, -5, 0, 0, 0, -2, -8,
+    0, 0, -2, 2, 0, -4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -3, 0, 0, -3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, 0, 0, 0, 0, 2, 0,
+    1, -3, -3, 0, -2, -2, -2, 0,
+    0, 0, 0, 0, 0, -5, 0, -2,
+    0, -2, -2, 0, -4, -4, -5, -1,
+    0, -3, 0, -5, 0, 0, 0, 0,
+    13, 0, 0, 1, 0, 0, -2, 0,
+    0, -7, 0, 0, 0, 0, 0, -15,
+    -3, 5, 5, -1, -7, 0, 2, -2,
+    0, -8, -1, -2, 2, -11, -2, 2,
+    0, 2, -6, -2, -6, -5, -7, 0,
+    0, -10, 0, 9, 0, 0, -1, 0,
+    0, 0, -1, -1, -2, -4, -5, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, -1, -2, -2, 0,
+    0, -3, 0, -2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -3, 0, 0, 3,
+    0, 2, 0, -4, 2, -1, 0, -4,
+    -2, 0, -2, -2, -1, 0, -2, -3,
+    0, 0, -1, 0, -1, -3, -2, 0,
+    0, -2, 0, 2, -1, 0, -4, 0,
+    0, 0, -3, 0, -3, 0, -3, -3,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -3, 2, 0, -2, 0, -1, -2, -5,
+    -1, -1, -1, 0, -1, -2, 0, 0,
+    0, 0, 0, 0, -2, -1, -1, 0,
+    0, 0, 0, 2, -1, 0, -1, 0,
+    0, 0, -1, -2, -1, -1, -2, -1,
+    1, 6, 0, 0, -4, 0, -1, 3,
+    0, -2, -7, -2, 2, 0, 0, -8,
+    -3, 2, -3, 1, 0, -1, -1, -5,
+    0, -2, 1, 0, 0, -3, 0, 0,
+    0, 2, 2, -3, -3, 0, -3, -2,
+    -2, -2, -2, 0, -3, 1, -3, -3,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -2,
+    0, 0, -2, 0, 0, -2, -2, 0,
+    0, 0, 0, -2, 0, 0, 0, 0,
+    -1, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, -2, 0, -3, 0, 0, 0,
+    -5, 0, 1, -4, 3, 0, -1, -8,
+    0, 0, -4, -2, 0, -6, -4, -4,
+    0, 0, -7, -2, -6, -6, -8, 0,
+    -4, 0, 1, 11, -2, 0, -4, -2,
+    0, -2, -3, -4, -3, -6, -7, -4,
+    0, 0, -1, 0, 0, 0, 0, -11,
+    -1, 5, 4, -4, -6, 0, 0, -5,
+    0, -8, -1, -2, 3, -15, -2, 0,
+    0, 0, -10, -2, -8, -2, -12, 0,
+    0, -11, 0, 9, 0, 0, -1, 0,
+    0, 0, 0, -1, -1, -6, -1, 0,
+    0, 0, 0, 0, -5, 0, -1, 0,
+    0, -4, -8, 0, 0, -1, -2, -5,
+    -2, 0, -1, 0, 0, 0, 0, -7,
+    -2, -5, -5, -1, -3, -4, -2, -3,
+    0, -3, -1, -5, -2, 0, -2, -3,
+    -2, -3, 0, 1, 0, -1, -5, 0,
+    0, -3, 0, 0, 0, 0, 2, 0,
+    1, -3, 7, 0, -2, -2, -2, 0,
+    0, 0, 0, 0, 0, -5, 0, -2,
+    0, -2, -2, 0, -4, -4, -5, -1,
+    0, -3, 1, 6, 0, 0, 0, 0,
+    13, 0, 0, 1, 0, 0, -2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -3,
+    0, 0, 0, 0, 0, -1, 0, 0,
+    0, -2, -2, 0, 0, -3, -2, 0,
+    0, -3, 0, 3, -1, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0,
+    3, 1, -1, 0, -5, -3, 0, 5,
+    -5, -5, -3, -3, 6, 3, 2, -14,
+    -1, 3, -2, 0, -2, 2, -2, -6,
+    0, -2, 2, -2, -1, -5, -1, 0,
+    0, 5, 3, 0, -4, 0, -9, -2,
+    5, -2, -6, 0, -2, -5, -5, -2,
+    2, 0, -2, 0, -4, 0, 1, 5,
+    -4, -6, -6, -4, 5, 0, 0, -12,
+    -1, 2, -3, -1, -4, 0, -4, -6,
+    -2, -2, -1, 0, 0, -4, -3, -2,
+    0, 5, 4, -2, -9, 0, -9, -2,
+    0, -6, -9, 0, -5, -3, -5, -4,
+    0, 0, -2, 0, -3, -1, 0, -2,
+    -3, 0, 3, -5, 2, 0, 0, -8,
+    0, -2, -4, -3, -1, -5, -4, -5,
+    -4, 0, -5, -2, -4, -3, -5, -2,
+    0, 0, 0, 8, -3, 0, -5, -2,
+    0, -2, -3, -4, -4, -4, -6, -2,
+    3, 0, -2, 0, -8, -2, 1, 3,
+    -5, -6, -3, -5, 5, -2, 1, -15,
+    -3, 3, -4, -3, -6, 0, -5, -7,
+    -2, -2, -1, -2, -3, -5, 0, 0,
+    0, 5, 4, -1, -10, 0, -10, -4,
+    4, -6, -11, -3, -6, -7, -8, -5,
+    0, 0, 0, 0, -2, 0, 0, 2,
+    -2, 3, 1, -3, 3, 0, 0, -5,
+    0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, -2, 0, 0,
+    0, 0, 1, 5, 0, 0, -2, 0,
+    0, 0, 0, -1, -1, -2, 0, 0,
+    0, 1, 0, 0, 0, 0, 1, 0,
+    -1, 0, 6, 0, 3, 0, 0, -2,
+    0, 3, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 0, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -10, 0, -2, 3, 0, 5, 0,
+    0, 16, 2, -3, -3, 2, 2, -1,
+    0, -8, 0, 0, 8, -10, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -11, 6, 22, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, 0, -3, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -4, 0, 0, 0, 0,
+    0, 2, 21, -3, -1, 5, 4, -4,
+    2, 0, 0, 2, 2, -2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -21, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -4, 0, 0, 0, -4,
+    0, 0, 0, 0, -4, -1, 0, 0,
+    0, -4, 0, -2, 0, -8, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -11, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 0, 0,
+    0, -2, 0, -4, 0, 0, 0, -3,
+    2, -2, 0, 0, -4, -2, -4, 0,
+    0, -4, 0, -2, 0, -8, 0, -2,
+    0, 0, -13, -3, -6, -2, -6, 0,
+    0, -11, 0, -4, -1, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, -3, -1,
+    0, 0, 0, 0, -4, 0, -4, 2,
+    -2, 3, 0, -1, -4, -1, -3, -3,
+    0, -2, -1, -1, 1, -4, 0, 0,
+    0, 0, -14, -1, -2, 0, -4, 0,
+    -1, -8, -1, 0, 0, -1, -1, 0,
+    0, 0, 0, 1, 0, -1, -3, -1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 0, 0, 0, 0,
+    0, -4, 0, -1, 0, 0, 0, -3,
+    2, 0, 0, 0, -4, -2, -3, 0,
+    0, -4, 0, -2, 0, -8, 0, 0,
+    0, 0, -16, 0, -3, -6, -8, 0,
+    0, -11, 0, -1, -2, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, -2, -1,
+    0, 0, 0, 3, -2, 0, 5, 8,
+    -2, -2, -5, 2, 8, 3, 4, -4,
+    2, 7, 2, 5, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 10, 8, -3, -2, 0, -1, 13,
+    7, 13, 0, 0, 0, 2, 0, 0,
+    0, 0, -3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, -13, -2, -1, -7, -8, 0,
+    0, -11, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, -13, -2, -1, -7, -8, 0,
+    0, -6, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0,
+    -4, 2, 0, -2, 1, 3, 2, -5,
+    0, 0, -1, 2, 0, 1, 0, 0,
+    0, 0, -4, 0, -1, -1, -3, 0,
+    -1, -6, 0, 10, -2, 0, -4, -1,
+    0, -1, -3, 0, -2, -4, -3, -2,
+    0, 0, -3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, -13, -2, -1, -7, -8, 0,
+    0, -11, 0, 0, 0, 0, 0, 0,
+    8, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, -5, -2, -1, 5,
+    -1, -2, -6, 0, -1, 0, -1, -4,
+    0, 4, 0, 1, 0, 1, -4, -6,
+    -2, 0, -6, -3, -4, -7, -6, 0,
+    -3, -3, -2, -2, -1, -1, -2, -1,
+    0, -1, 0, 2, 0, 2, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -2, -2, 0,
+    0, -4, 0, -1, 0, -3, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -10, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, -2, 0,
+    0, 0, 0, 0, -1, 0, 0, -3,
+    -2, 2, 0, -3, -3, -1, 0, -5,
+    -1, -4, -1, -2, 0, -3, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -11, 0, 5, 0, 0, -3, 0,
+    0, 0, 0, -2, 0, -2, 0, 0,
+    0, 0, -1, 0, -4, 0, 0, 7,
+    -2, -5, -5, 1, 2, 2, 0, -4,
+    1, 2, 1, 5, 1, 5, -1, -4,
+    0, 0, -6, 0, 0, -5, -4, 0,
+    0, -3, 0, -2, -3, 0, -2, 0,
+    -2, 0, -1, 2, 0, -1, -5, -2,
+    0, 0, -1, 0, -3, 0, 0, 2,
+    -4, 0, 2, -2, 1, 0, 0, -5,
+    0, -1, 0, 0, -2, 2, -1, 0,
+    0, 0, -7, -2, -4, 0, -5, 0,
+    0, -8, 0, 6, -2, 0, -3, 0,
+    1, 0, -2, 0, -2, -5, 0, -2,
+    0, 0, 0, 0, -1, 0, 0, 2,
+    -2, 0, 0, 0, -2, -1, 0, -2,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -10, 0, 4, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, -2, -2, 0
+};
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 60,
+    .right_class_cnt     = 48,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+/*Store all the custom data of the font*/
+static lv_font_fmt_txt_glyph_cache_t cache;
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 1,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = 1,
+    .cache = &cache
+};
+
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+const lv_font_t font_ui_10 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 11,          /*The maximum line height required by the font*/
+    .base_line = 2,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -1,
+    .underline_thickness = 1,
+    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+};
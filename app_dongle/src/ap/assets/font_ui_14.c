@@ -0,0 +1,772 @@
+/*******************************************************************************
+ * Size: 14 px
+ * Bpp: 4
+ * Source: lv_font_montserrat_14.c
+ * Opts: python tool/lv_asset.py font app_dongle/src/lib/lvgl/src/font/lv_font_montserrat_14.c --name font_ui_14 --range 0x20-0x60,0x7B-0x7E --chars 'ayer' --compress
+ * 이 파일은 tool/lv_asset.py 로 생성됨 (직접 수정하지 말 것)
+ ******************************************************************************/
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+#if !LV_USE_FONT_COMPRESSED
+    #error "LV_USE_FONT_COMPRESSED must be enabled in lv_conf.h"
+#endif
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+0021 "!" */
+    0x0e, 0xa0, 0x33, 0x00, 0x61, 0x10, 0x06, 0x7f, 0x01, 0x10, 0x5b, 0x85, 0x48, 0x30, 0x80,
+
+    /* U+0022 "\"" */
+    0x1f, 0x09, 0x90, 0x04, 0x22, 0x00, 0xe1, 0x00, 0xef, 0x08, 0x80,
+
+    /* U+0023 "#" */
+    0x00, 0xb4, 0x80, 0xf0, 0x03, 0x88, 0x80, 0xaa, 0x00, 0x17, 0xf8, 0x3f, 0xd2, 0xde, 0xe5, 0xd4,
+    0x7d, 0xc5, 0x9e, 0x70, 0x13, 0x51, 0x13, 0x28, 0x80, 0x5c, 0x20, 0x01, 0x10, 0x02, 0x7d, 0xdd,
+    0xfe, 0x2d, 0xf0, 0x8d, 0x3a, 0xdc, 0x1d, 0xd0, 0x09, 0x0b, 0x90, 0x11, 0x40, 0x11, 0x10, 0x1d,
+    0xc0, 0x10,
+
+    /* U+0024 "$" */
+    0x00, 0xce, 0x01, 0xfa, 0x40, 0x3f, 0xf8, 0x43, 0x3c, 0x3d, 0x46, 0x00, 0xd4, 0x81, 0x80, 0x40,
+    0x23, 0x96, 0x06, 0xa7, 0x03, 0x0c, 0x00, 0xf0, 0xcb, 0xf0, 0xa8, 0x06, 0x6e, 0x80, 0xae, 0x50,
+    0x08, 0x58, 0x7d, 0x28, 0x00, 0x20, 0x1b, 0xc0, 0x4f, 0xa1, 0x41, 0xad, 0x04, 0xe9, 0x28, 0x61,
+    0xe8, 0x00, 0xb9, 0xe3, 0xd2, 0x20, 0x1d, 0x20, 0x18,
+
+    /* U+0025 "%" */
+    0x08, 0xdd, 0x18, 0x05, 0x4e, 0x00, 0x43, 0xdf, 0xe0, 0x02, 0x33, 0x80, 0x0f, 0x00, 0x80, 0x03,
+    0x3c, 0x01, 0x1e, 0x01, 0x80, 0x2e, 0x88, 0x02, 0x4c, 0xdf, 0xe4, 0x63, 0xcc, 0x18, 0x01, 0xf7,
+    0x0a, 0x7a, 0x7b, 0xa0, 0x0e, 0xbb, 0x0b, 0x11, 0x18, 0xc0, 0x25, 0x66, 0x00, 0x80, 0x04, 0x02,
+    0x18, 0xe0, 0x37, 0x00, 0x39, 0x80, 0x2e, 0xc4, 0x00, 0x9c, 0xc4, 0x80,
+
+    /* U+0026 "&" */
+    0x00, 0x26, 0xfe, 0x18, 0x07, 0x5d, 0x72, 0x78, 0x06, 0x10, 0x51, 0xd1, 0x00, 0xc2, 0x92, 0xd7,
+    0x20, 0x1d, 0xc9, 0x3a, 0x80, 0x19, 0xee, 0x4a, 0x00, 0xe0, 0x0a, 0x35, 0xb1, 0xae, 0x48, 0x1c,
+    0x0c, 0x07, 0x19, 0x78, 0x10, 0x2d, 0x11, 0x24, 0x30, 0x03, 0x81, 0x76, 0x4b, 0xe7, 0x20, 0x3b,
+    0xff, 0x62, 0x05, 0x90,
+
+    /* U+0027 "'" */
+    0x1f, 0x00, 0xf8, 0x40, 0x2f, 0x00,
+
+    /* U+0028 "(" */
+    0x03, 0xf1, 0x08, 0x61, 0x04, 0xd0, 0x40, 0x40, 0x32, 0x00, 0x73, 0x00, 0x0c, 0x40, 0x3c, 0x62,
+    0x00, 0xe6, 0x00, 0x19, 0x00, 0x10, 0x10, 0x00, 0x9a, 0x00, 0x86, 0x10,
+
+    /* U+0029 ")" */
+    0x5e, 0x00, 0x28, 0x30, 0x01, 0xa8, 0x01, 0x86, 0x00, 0x50, 0x30, 0x10, 0x60, 0x00, 0x98, 0x07,
+    0x84, 0xc0, 0x41, 0x81, 0x40, 0xc3, 0x0c, 0x00, 0xd4, 0x0a, 0x0c, 0x00,
+
+    /* U+002A "*" */
+    0x00, 0x49, 0x80, 0x22, 0x06, 0xb8, 0x50, 0x2b, 0x10, 0x24, 0x41, 0x1f, 0x88, 0x7a, 0x77, 0x05,
+    0x0b, 0x05, 0x40,
+
+    /* U+002B "+" */
+    0x00, 0x91, 0x40, 0x3d, 0x9e, 0x01, 0xff, 0x0f, 0xf9, 0xd7, 0xfc, 0x63, 0x98, 0x64, 0xcc, 0x18,
+    0x19, 0x84, 0x46, 0x60, 0x0f, 0xe0,
+
+    /* U+002C "," */
+    0x01, 0x03, 0xe6, 0x21, 0x01, 0x07, 0x22, 0x08,
+
+    /* U+002D "-" */
+    0x00, 0xe3, 0xff, 0xa4, 0xf3, 0x28,
+
+    /* U+002E "." */
+    0x00, 0x8f, 0xd4, 0x46,
+
+    /* U+002F "/" */
+    0x00, 0xee, 0x40, 0x0c, 0x80, 0x80, 0x1b, 0x50, 0x03, 0x9f, 0x80, 0x32, 0x0a, 0x00, 0x6d, 0x50,
+    0x0e, 0x7e, 0x00, 0xc6, 0x28, 0x01, 0xa9, 0x40, 0x39, 0xfc, 0x03, 0x18, 0xa8, 0x06, 0xa5, 0x00,
+    0xe7, 0xf0, 0x0c, 0x62, 0xa0, 0x18,
+
+    /* U+0030 "0" */
+    0x00, 0x26, 0x7f, 0x38, 0x04, 0x96, 0xf2, 0xd1, 0x20, 0x09, 0x4b, 0x68, 0xa6, 0x32, 0x27, 0x80,
+    0x4a, 0x28, 0xc0, 0xc0, 0x18, 0xb4, 0x03, 0xf9, 0x81, 0x80, 0x31, 0x69, 0x13, 0xc0, 0x25, 0x15,
+    0x09, 0x4b, 0x68, 0xa6, 0x20, 0x4b, 0x79, 0x68, 0x90,
+
+    /* U+0031 "1" */
+    0xef, 0xf5, 0xd5, 0x98, 0x22, 0x18, 0x03, 0xff, 0xa2,
+
+    /* U+0032 "2" */
+    0x07, 0xdf, 0xea, 0x10, 0x89, 0x5a, 0x94, 0xd0, 0x8f, 0x85, 0x78, 0x31, 0x01, 0x00, 0xe1, 0x00,
+    0xeb, 0x60, 0x0e, 0xc1, 0x90, 0x08, 0x70, 0x30, 0x02, 0x1c, 0x7c, 0x00, 0x87, 0x0f, 0x91, 0x22,
+    0x62, 0x1a, 0xbb, 0xc0,
+
+    /* U+0033 "3" */
+    0x7f, 0xff, 0x02, 0xdd, 0xd4, 0x0c, 0x04, 0x89, 0x71, 0xc8, 0x06, 0x95, 0xd0, 0x0c, 0x6c, 0x72,
+    0x20, 0x11, 0xdd, 0x97, 0x00, 0x32, 0x37, 0x92, 0x08, 0x07, 0xd5, 0xae, 0xaf, 0xe4, 0x94, 0x95,
+    0x49, 0x7c, 0x00,
+
+    /* U+0034 "4" */
+    0x00, 0xed, 0xa0, 0x0f, 0xa8, 0x68, 0x03, 0xce, 0x9a, 0x01, 0xe4, 0x8a, 0x11, 0x00, 0x62, 0xb9,
+    0x40, 0xe5, 0x00, 0x0f, 0xab, 0x00, 0x79, 0x89, 0x7f, 0xe0, 0xaf, 0x36, 0xcc, 0xe0, 0x8c, 0x31,
+    0x33, 0xe0, 0x23, 0x00, 0xff, 0x80,
+
+    /* U+0035 "5" */
+    0x09, 0xff, 0xe0, 0x01, 0xa5, 0xde, 0x00, 0x31, 0xa2, 0x60, 0x01, 0x78, 0x07, 0x86, 0x3f, 0xd8,
+    0x80, 0x0c, 0xc5, 0xd0, 0x59, 0x01, 0x99, 0x17, 0x01, 0x44, 0x03, 0xe9, 0xe8, 0x56, 0xc0, 0x68,
+    0x65, 0xa9, 0x7c, 0x10,
+
+    /* U+0036 "6" */
+    0x00, 0x15, 0x77, 0xea, 0x80, 0x0f, 0x5e, 0x2a, 0x82, 0x00, 0xf3, 0xd6, 0x57, 0x40, 0x23, 0x80,
+    0x0f, 0x30, 0x0d, 0xff, 0xa8, 0x40, 0x2b, 0x3b, 0xa7, 0xc0, 0x70, 0x68, 0x45, 0xe2, 0x33, 0x08,
+    0x07, 0x84, 0x21, 0xe1, 0x17, 0x8c, 0x81, 0xa9, 0x6e, 0xc9, 0xa0,
+
+    /* U+0037 "7" */
+    0x9f, 0xff, 0x68, 0x15, 0xde, 0x14, 0x01, 0x44, 0x80, 0x6e, 0x70, 0x02, 0xf4, 0x20, 0x0c, 0x49,
+    0xe0, 0x1d, 0x04, 0x80, 0x18, 0x56, 0xc0, 0x3a, 0x45, 0x80, 0x39, 0x98, 0x01, 0xcc, 0x32, 0x01,
+
+    /* U+0038 "8" */
+    0x01, 0x9e, 0xfe, 0x91, 0x00, 0x53, 0xc6, 0x43, 0xe8, 0x01, 0x21, 0x8d, 0xa0, 0xc0, 0x07, 0x44,
+    0x05, 0xa6, 0x00, 0xe2, 0xdf, 0xd5, 0xe0, 0x07, 0x95, 0xed, 0x97, 0x82, 0x97, 0x21, 0x26, 0x92,
+    0x80, 0x78, 0xc0, 0x0a, 0x3e, 0xa6, 0xbe, 0x2a, 0x1e, 0xf7, 0x96, 0xfe, 0x00,
+
+    /* U+0039 "9" */
+    0x03, 0xbf, 0xea, 0x20, 0x2c, 0x1b, 0xa1, 0xc1, 0xa1, 0xa4, 0x45, 0x84, 0x09, 0x80, 0x63, 0x4d,
+    0x27, 0x12, 0x92, 0x22, 0x44, 0x3b, 0x55, 0x84, 0x1f, 0xf7, 0xb0, 0xc8, 0x02, 0x21, 0x25, 0xa0,
+    0x76, 0x58, 0xd4, 0x60, 0xd8, 0xa5, 0x8b, 0x00,
+
+    /* U+003A ":" */
+    0x2e, 0x51, 0x10, 0x1f, 0xa8, 0x07, 0xf1, 0xfa, 0x88, 0xc0,
+
+    /* U+003B ";" */
+    0x2e, 0x51, 0x10, 0x1f, 0xa8, 0x07, 0xf1, 0x72, 0x80, 0x99, 0x11, 0x04, 0x08, 0x70, 0x00,
+
+    /* U+003C "<" */
+    0x00, 0xf1, 0x88, 0x06, 0x6c, 0xc1, 0x80, 0xc7, 0x5d, 0x79, 0x07, 0x26, 0xe9, 0x80, 0x25, 0x38,
+    0x40, 0x0d, 0x5d, 0x95, 0xce, 0x01, 0x0b, 0xf5, 0xd8, 0xc0, 0x39, 0x70, 0xc0,
+
+    /* U+003D "=" */
+    0x1f, 0xff, 0x18, 0xe6, 0x78, 0xc0, 0xcf, 0xc0, 0x1f, 0xc3, 0xff, 0xe3, 0x1c, 0xcf, 0x18,
+
+    /* U+003E ">" */
+    0x04, 0x00, 0xfa, 0xb5, 0xc4, 0x03, 0x74, 0x5f, 0x49, 0x00, 0x4b, 0x9a, 0x7a, 0x40, 0x11, 0xc2,
+    0xa1, 0x83, 0x6e, 0x8b, 0x6c, 0x45, 0x57, 0xd0, 0x40, 0x01, 0xc6, 0x00, 0xe0,
+
+    /* U+003F "?" */
+    0x07, 0xdf, 0xea, 0x10, 0x99, 0x55, 0xc2, 0x68, 0x4f, 0xba, 0x34, 0x18, 0x00, 0x40, 0x2f, 0x30,
+    0x0e, 0x87, 0xe0, 0x0c, 0xcf, 0x84, 0x01, 0xba, 0x08, 0x03, 0xa1, 0xc0, 0x3d, 0x70, 0x01, 0xe7,
+    0x10, 0x08,
+
+    /* U+0040 "@" */
+    0x00, 0xcd, 0x9d, 0xfb, 0x48, 0x01, 0xc7, 0xb9, 0x1f, 0xec, 0xc4, 0xc8, 0x02, 0x1d, 0x8a, 0xdf,
+    0xe8, 0xe1, 0x39, 0x00, 0x5b, 0x2d, 0xa5, 0x69, 0xb8, 0x52, 0x18, 0x2c, 0x9a, 0x7a, 0x1d, 0x18,
+    0x02, 0xe8, 0xcc, 0x2a, 0x44, 0x00, 0xac, 0x00, 0xa4, 0xee, 0x00, 0xff, 0x0b, 0xbc, 0x0a, 0x44,
+    0x00, 0xac, 0x00, 0xcc, 0x33, 0x09, 0xa7, 0xa1, 0xc9, 0x10, 0xe3, 0xc1, 0x64, 0x2d, 0x2b, 0x43,
+    0xcb, 0x15, 0x41, 0x6c, 0xa1, 0x3d, 0xc9, 0x1c, 0xf9, 0x00, 0x0e, 0xc5, 0x20, 0x81, 0x40, 0x07,
+    0x8f, 0x75, 0x1f, 0xf0, 0x88, 0x02,
+
+    /* U+0041 "A" */
+    0x00, 0xec, 0xf1, 0x00, 0xfc, 0x66, 0x26, 0x00, 0xfd, 0x0d, 0x72, 0x01, 0xf1, 0x25, 0xb0, 0x28,
+    0x07, 0xad, 0x48, 0x26, 0x00, 0x38, 0x5a, 0x40, 0x0e, 0x48, 0x01, 0x98, 0x33, 0xfe, 0x0f, 0x00,
+    0xd3, 0x19, 0x9a, 0xd0, 0x80, 0x0a, 0x2e, 0x67, 0x90, 0xec, 0x01, 0x2c, 0x01, 0xea, 0x61,
+
+    /* U+0042 "B" */
+    0x8f, 0xfd, 0xd8, 0x80, 0x01, 0xcc, 0xa9, 0xec, 0x80, 0x06, 0x72, 0x50, 0x38, 0x07, 0x0c, 0x82,
+    0x00, 0xff, 0xdc, 0xee, 0x10, 0x1c, 0xcd, 0x0e, 0xc0, 0x03, 0x3c, 0xed, 0x40, 0x1f, 0x84, 0x00,
+    0x67, 0x23, 0xb5, 0x00, 0xe6, 0x57, 0x50, 0xe0,
+
+    /* U+0043 "C" */
+    0x00, 0x9f, 0x3f, 0xd6, 0x80, 0x16, 0x42, 0xcc, 0x86, 0xd4, 0x28, 0xb6, 0x59, 0x95, 0x8a, 0x2b,
+    0x04, 0x01, 0x8c, 0x14, 0x10, 0x03, 0xff, 0x8a, 0xa0, 0x80, 0x1f, 0x0a, 0xc1, 0x00, 0x63, 0x00,
+    0x59, 0x6c, 0xb3, 0x2b, 0x14, 0x07, 0x21, 0x26, 0x43, 0x6a,
+
+    /* U+0044 "D" */
+    0x8f, 0xfd, 0xd4, 0x80, 0x10, 0xdd, 0xd0, 0xd6, 0xe0, 0x12, 0x24, 0xd9, 0x10, 0x30, 0x0f, 0x9c,
+    0xa4, 0x03, 0xf2, 0x38, 0x07, 0xff, 0x19, 0x1c, 0x03, 0xe7, 0x29, 0x00, 0x22, 0x4d, 0x71, 0x03,
+    0x01, 0xbb, 0xa0, 0x6d, 0xc0,
+
+    /* U+0045 "E" */
+    0x8f, 0xff, 0x30, 0x0d, 0xdf, 0x38, 0x01, 0x13, 0x84, 0x03, 0xf8, 0x7f, 0xf6, 0x00, 0x07, 0x33,
+    0x70, 0x04, 0x67, 0x88, 0x03, 0xfe, 0x44, 0xe2, 0x01, 0xbb, 0xf0,
+
+    /* U+0046 "F" */
+    0x8f, 0xff, 0x30, 0x0d, 0xdf, 0x38, 0x01, 0x13, 0x84, 0x03, 0xff, 0x8a, 0x3f, 0xfb, 0x00, 0x03,
+    0x99, 0xb8, 0x02, 0x33, 0xc4, 0x01, 0xff, 0xc5,
+
+    /* U+0047 "G" */
+    0x00, 0x9f, 0x3f, 0xd8, 0xa0, 0x16, 0x42, 0xcc, 0x9a, 0x98, 0x28, 0xb6, 0x59, 0x95, 0xac, 0x2b,
+    0x04, 0x01, 0x88, 0x14, 0x10, 0x03, 0xff, 0x87, 0x72, 0xa0, 0x80, 0x1f, 0x0a, 0xc1, 0x80, 0x7d,
+    0x45, 0x92, 0xcc, 0xa4, 0x10, 0x06, 0x42, 0x4c, 0x9a, 0x60,
+
+    /* U+0048 "H" */
+    0x8e, 0x00, 0xe8, 0xe0, 0x0f, 0xfe, 0x80, 0xff, 0xf3, 0x80, 0x07, 0x33, 0x98, 0x02, 0x33, 0xe1,
+    0x00, 0xff, 0xe8, 0x00,
+
+    /* U+0049 "I" */
+    0x8e, 0x00, 0xff, 0xe3, 0x00,
+
+    /* U+004A "J" */
+    0x02, 0xff, 0xd8, 0x05, 0x77, 0x20, 0x04, 0x89, 0x10, 0x07, 0xff, 0x48, 0x80, 0x22, 0x60, 0xcb,
+    0x58, 0x4c, 0x0d, 0x7a, 0x67, 0x60,
+
+    /* U+004B "K" */
+    0x8e, 0x00, 0xc9, 0xea, 0x01, 0xe4, 0xb9, 0x50, 0x0e, 0x3b, 0x86, 0x00, 0xe3, 0xc7, 0x70, 0x07,
+    0x16, 0x9c, 0x00, 0x7b, 0x08, 0xd8, 0x03, 0x85, 0x72, 0x24, 0xc0, 0x30, 0xd8, 0x3a, 0xe8, 0x80,
+    0x7d, 0x45, 0xa0, 0x1f, 0xb4, 0xa8, 0x00,
+
+    /* U+004C "L" */
+    0x8e, 0x00, 0xff, 0xfa, 0x22, 0x70, 0x00, 0x6e, 0xf8, 0x80,
+
+    /* U+004D "M" */
+    0x8e, 0x00, 0xfa, 0x38, 0x05, 0xc0, 0x38, 0x9c, 0x02, 0x81, 0x00, 0xd2, 0x01, 0x11, 0xd8, 0x04,
+    0x88, 0x60, 0x0b, 0x94, 0xc0, 0x12, 0xfc, 0x01, 0x13, 0x78, 0x31, 0xc0, 0x07, 0x41, 0x3c, 0x58,
+    0x07, 0x86, 0x20, 0x4a, 0x01, 0xf3, 0x2f, 0x00, 0x7f, 0x51, 0x00, 0x60,
+
+    /* U+004E "N" */
+    0x8e, 0x10, 0x0d, 0x1c, 0x03, 0xa0, 0x1f, 0x8e, 0x40, 0x3c, 0x32, 0xcc, 0x00, 0xf3, 0x32, 0x4c,
+    0x03, 0xd2, 0x7a, 0x20, 0x1e, 0xd0, 0xa0, 0x0f, 0x0e, 0xa3, 0x00, 0x78, 0xe4, 0x40, 0x3e, 0x65,
+    0x00,
+
+    /* U+004F "O" */
+    0x00, 0x9f, 0x3f, 0xad, 0x40, 0x3b, 0x21, 0x66, 0x02, 0xa4, 0x02, 0xa2, 0xd9, 0x66, 0x5d, 0x33,
+    0x00, 0x56, 0x08, 0x03, 0x2a, 0xac, 0x14, 0x10, 0x03, 0xd8, 0x40, 0x1f, 0xfc, 0x15, 0x04, 0x00,
+    0xf6, 0x10, 0x0a, 0xc1, 0x00, 0x65, 0x55, 0x80, 0x28, 0xb6, 0x59, 0x97, 0x4a, 0xc0, 0x16, 0x42,
+    0x4c, 0x05, 0x50, 0x00,
+
+    /* U+0050 "P" */
+    0x8f, 0xfd, 0xae, 0x01, 0x0d, 0xda, 0x96, 0x2c, 0x02, 0x44, 0x2c, 0x52, 0x18, 0x07, 0x90, 0x18,
+    0x03, 0xc4, 0x02, 0x01, 0x85, 0x38, 0x90, 0x07, 0xfd, 0xd6, 0xde, 0x00, 0x1c, 0xcb, 0xac, 0x80,
+    0x23, 0x38, 0x40, 0x3f, 0xf0,
+
+    /* U+0051 "Q" */
+    0x00, 0x9f, 0x3f, 0xad, 0x40, 0x3b, 0x21, 0x66, 0x02, 0xa4, 0x02, 0xa2, 0xd9, 0x66, 0x5d, 0x33,
+    0x00, 0x56, 0x08, 0x03, 0x2a, 0xac, 0x14, 0x10, 0x03, 0xd8, 0x40, 0x1f, 0xe3, 0x00, 0x28, 0x20,
+    0x07, 0xbc, 0x80, 0x56, 0x08, 0x03, 0x2a, 0xac, 0x01, 0x67, 0xb0, 0xaa, 0xaa, 0x2b, 0x00, 0x07,
+    0x5d, 0x6a, 0x8d, 0x54, 0x00, 0xe8, 0xde, 0x10, 0x71, 0x94, 0x00, 0xe1, 0xf7, 0xde, 0x55, 0x00,
+    0x78, 0x6f, 0xb7, 0x04,
+
+    /* U+0052 "R" */
+    0x8f, 0xfd, 0xae, 0x01, 0x0d, 0xda, 0x96, 0x2c, 0x02, 0x44, 0x2c, 0x52, 0x18, 0x07, 0x90, 0x18,
+    0x03, 0xc4, 0x0c, 0x01, 0x85, 0x38, 0x8c, 0x07, 0xfd, 0xd6, 0x3e, 0x00, 0x1c, 0xc8, 0x98, 0x80,
+    0x23, 0x3b, 0xd5, 0x80, 0x3c, 0x55, 0x26,
+
+    /* U+0053 "S" */
+    0x01, 0x9e, 0xfd, 0xa2, 0x00, 0x6b, 0xc5, 0xd8, 0x54, 0x08, 0xe9, 0x91, 0xad, 0xc0, 0xc3, 0x00,
+    0x3c, 0x32, 0xfb, 0x2a, 0x01, 0x9b, 0xac, 0xef, 0x94, 0x02, 0x16, 0xae, 0x7a, 0x00, 0x10, 0x06,
+    0xc0, 0x13, 0xda, 0x54, 0x7b, 0x41, 0x3b, 0x1b, 0xb4, 0xbd, 0x00,
+
+    /* U+0054 "T" */
+    0xff, 0xfc, 0x57, 0x72, 0x15, 0xdc, 0x48, 0x91, 0x0a, 0x24, 0x01, 0xff, 0xf4,
+
+    /* U+0055 "U" */
+    0x9c, 0x00, 0xeb, 0xa0, 0x0f, 0xff, 0x08, 0x90, 0x07, 0x31, 0xe0, 0xa0, 0x04, 0x65, 0x88, 0x77,
+    0x0d, 0x18, 0x4a, 0x18, 0xcc, 0x96, 0x66, 0x00,
+
+    /* U+0056 "V" */
+    0x0c, 0xb0, 0x0f, 0x56, 0x04, 0xa1, 0x00, 0x61, 0x59, 0x05, 0x1b, 0x00, 0xd2, 0x2a, 0x00, 0x66,
+    0x00, 0x66, 0x90, 0x0a, 0x41, 0x80, 0x0a, 0x2c, 0x01, 0x0a, 0xd8, 0x02, 0x58, 0x40, 0x34, 0x92,
+    0x19, 0xa8, 0x03, 0x8c, 0xdf, 0x26, 0x60, 0x0f, 0x4a, 0x2c, 0x80, 0x7c, 0xa2, 0x25, 0x00, 0x80,
+
+    /* U+0057 "W" */
+    0x6f, 0x10, 0x0d, 0xb6, 0x01, 0x8b, 0xc9, 0xc1, 0xc0, 0x23, 0x24, 0x10, 0x0a, 0x88, 0x82, 0x9a,
+    0x01, 0x5a, 0x0b, 0x80, 0x4b, 0x40, 0x0d, 0x40, 0x09, 0xb5, 0xf4, 0x00, 0x44, 0x50, 0x03, 0x82,
+    0x81, 0x8b, 0xea, 0x08, 0x51, 0x10, 0x00, 0x27, 0xe1, 0x48, 0x28, 0x2e, 0x0a, 0xa0, 0x0d, 0x4a,
+    0x0f, 0xa0, 0x07, 0xd2, 0x25, 0x80, 0x67, 0x09, 0x17, 0x00, 0x6a, 0x59, 0x18, 0x06, 0x13, 0x64,
+    0x10, 0x02, 0x0b, 0x28, 0x07, 0xac, 0x34, 0x03, 0x38, 0x58, 0x04,
+
+    /* U+0058 "X" */
+    0x3f, 0x50, 0x0d, 0xb4, 0x06, 0xf4, 0x40, 0x09, 0x0a, 0x00, 0x41, 0xf0, 0x23, 0x70, 0x06, 0xe3,
+    0x9a, 0x83, 0x00, 0xc5, 0x2c, 0x4e, 0x01, 0xef, 0x02, 0x10, 0x0e, 0x46, 0xb3, 0xa0, 0x0c, 0x34,
+    0xe9, 0xe8, 0xe0, 0x15, 0x1c, 0x01, 0x44, 0x08, 0x1d, 0x3c, 0x02, 0x74, 0xf0,
+
+    /* U+0059 "Y" */
+    0x0c, 0xb0, 0x0e, 0x9c, 0x00, 0x72, 0x28, 0x04, 0x4d, 0xe0, 0x02, 0x6b, 0x00, 0xb9, 0x8c, 0x02,
+    0x90, 0x80, 0x53, 0x80, 0x0e, 0xb7, 0x3b, 0x91, 0x00, 0xe5, 0x3c, 0x36, 0x00, 0xfb, 0xc2, 0x40,
+    0x3f, 0x08, 0x38, 0x07, 0xff, 0x38,
+
+    /* U+005A "Z" */
+    0x4f, 0xff, 0xa5, 0x6e, 0xf9, 0x42, 0x85, 0x13, 0x3a, 0xc9, 0x80, 0x61, 0xd5, 0x60, 0x0e, 0xd2,
+    0xa0, 0x0e, 0x92, 0xd0, 0x0e, 0x66, 0x50, 0x80, 0x63, 0x98, 0x40, 0x0c, 0x3a, 0x46, 0x89, 0x8d,
+    0xc4, 0xae, 0xfb, 0xc0,
+
+    /* U+005B "[" */
+    0x8f, 0xf3, 0x01, 0x63, 0x80, 0x0c, 0x40, 0x3f, 0xfb, 0x46, 0x20, 0x58, 0xe0,
+
+    /* U+005C "\\" */
+    0x5d, 0x00, 0xe5, 0x22, 0x00, 0x72, 0x50, 0x07, 0x6a, 0x80, 0x73, 0x91, 0x00, 0x30, 0xa5, 0x00,
+    0x76, 0xa8, 0x07, 0x39, 0x10, 0x03, 0x0a, 0x28, 0x07, 0x6d, 0x00, 0x73, 0x91, 0x00, 0x30, 0xa2,
+    0x80, 0x76, 0xd0, 0x07, 0x39, 0x10,
+
+    /* U+005D "]" */
+    0xbf, 0xf1, 0xcd, 0x00, 0x09, 0xc0, 0x3f, 0xfb, 0x44, 0xe0, 0x09, 0xa0, 0x00,
+
+    /* U+005E "^" */
+    0x00, 0x56, 0x80, 0x61, 0x41, 0x40, 0x0a, 0x5a, 0x78, 0x02, 0x6a, 0x54, 0x10, 0x55, 0x10, 0x3b,
+    0x07, 0x70, 0x01, 0x72, 0x00,
+
+    /* U+005F "_" */
+    0xee, 0xf8,
+
+    /* U+0060 "`" */
+    0x0b, 0xc0, 0x0a, 0xd6, 0xc0,
+
+    /* U+0061 "a" */
+    0x04, 0xcf, 0xea, 0x10, 0x07, 0xdd, 0xcf, 0x40, 0x0b, 0x74, 0x59, 0x40, 0x02, 0x67, 0x72, 0x80,
+    0x86, 0xd3, 0x3e, 0x80, 0x0a, 0x12, 0x42, 0x01, 0x28, 0x30, 0x1c, 0x80, 0x06, 0xeb, 0xfa, 0x80,
+    0x00,
+
+    /* U+007B "{" */
+    0x00, 0x37, 0x50, 0x02, 0x5e, 0x00, 0x43, 0x48, 0x03, 0xfe, 0x20, 0x70, 0x3c, 0x33, 0x01, 0xc9,
+    0x98, 0x00, 0xe0, 0xe0, 0x1f, 0xfc, 0x51, 0x0e, 0x20, 0x05, 0x24, 0x00,
+
+    /* U+007C "|" */
+    0x8b, 0x00, 0xff, 0xe7, 0x00,
+
+    /* U+007D "}" */
+    0xbe, 0x50, 0x04, 0xa5, 0x80, 0x0b, 0xc4, 0x03, 0xff, 0x82, 0x20, 0x20, 0x04, 0x2e, 0x10, 0x42,
+    0xa1, 0x01, 0x05, 0x00, 0xff, 0xe2, 0x17, 0x88, 0x02, 0x52, 0x80, 0x00,
+
+    /* U+007E "~" */
+    0x07, 0xec, 0x40, 0xb4, 0x19, 0xc9, 0x97, 0xba, 0x0f, 0x92, 0xef, 0xe0, 0x00,
+
+    /* U+0065 "e" */
+    0x00, 0x47, 0x7e, 0x20, 0x02, 0x96, 0xf1, 0x2d, 0x09, 0x7d, 0x4e, 0x1e, 0x1c, 0x33, 0xba, 0x73,
+    0x00, 0x67, 0xfd, 0xdc, 0x70, 0x51, 0x18, 0x04, 0x9a, 0x20, 0x8d, 0xe8, 0x13, 0x0b, 0x70, 0xc8,
+
+    /* U+0072 "r" */
+    0xb9, 0x8e, 0x40, 0x65, 0x95, 0x01, 0xc7, 0x10, 0x51, 0x00, 0x84, 0x03, 0xff, 0x8c,
+
+    /* U+0079 "y" */
+    0x0d, 0x90, 0x0d, 0x54, 0x0b, 0x60, 0x08, 0x56, 0x41, 0x81, 0x80, 0x0c, 0x46, 0x00, 0x6a, 0x00,
+    0x55, 0x80, 0x56, 0x66, 0x42, 0x60, 0x08, 0x8e, 0xb9, 0x80, 0x3a, 0x59, 0x6c, 0x03, 0x94, 0x4c,
+    0x80, 0x3e, 0x90, 0x0d, 0x29, 0x46, 0xa0, 0x10, 0x95, 0xb7, 0x80, 0x60,
+
+    /* RLE 디코더가 마지막 글리프 뒤 1 byte 를 더 읽음 */
+    0x00
+};
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 60, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 60, .box_w = 3, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 15, .adv_w = 88, .box_w = 5, .box_h = 5, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 26, .adv_w = 157, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 76, .adv_w = 139, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 133, .adv_w = 189, .box_w = 12, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 193, .adv_w = 154, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 245, .adv_w = 47, .box_w = 3, .box_h = 5, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 251, .adv_w = 75, .box_w = 4, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 279, .adv_w = 76, .box_w = 4, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 307, .adv_w = 90, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 326, .adv_w = 130, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 348, .adv_w = 51, .box_w = 3, .box_h = 5, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 356, .adv_w = 86, .box_w = 5, .box_h = 3, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 362, .adv_w = 51, .box_w = 3, .box_h = 3, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 366, .adv_w = 79, .box_w = 7, .box_h = 14, .ofs_x = -1, .ofs_y = -1},
+    {.bitmap_index = 404, .adv_w = 149, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 445, .adv_w = 83, .box_w = 4, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 454, .adv_w = 129, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 490, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 525, .adv_w = 150, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 563, .adv_w = 129, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 599, .adv_w = 138, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 642, .adv_w = 134, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 674, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 719, .adv_w = 138, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 759, .adv_w = 51, .box_w = 3, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 769, .adv_w = 51, .box_w = 3, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 784, .adv_w = 130, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 813, .adv_w = 130, .box_w = 8, .box_h = 6, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 828, .adv_w = 130, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 857, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 891, .adv_w = 232, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 977, .adv_w = 164, .box_w = 12, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 1024, .adv_w = 170, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1064, .adv_w = 162, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1106, .adv_w = 185, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1143, .adv_w = 150, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1170, .adv_w = 142, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1194, .adv_w = 173, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1236, .adv_w = 182, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1256, .adv_w = 69, .box_w = 2, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1261, .adv_w = 115, .box_w = 7, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 1283, .adv_w = 161, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1322, .adv_w = 133, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1332, .adv_w = 214, .box_w = 11, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1376, .adv_w = 182, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1409, .adv_w = 188, .box_w = 12, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1461, .adv_w = 162, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1498, .adv_w = 188, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 1566, .adv_w = 163, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1605, .adv_w = 139, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1648, .adv_w = 131, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1661, .adv_w = 177, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1685, .adv_w = 159, .box_w = 11, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 1733, .adv_w = 252, .box_w = 16, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1808, .adv_w = 151, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1853, .adv_w = 145, .box_w = 11, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 1891, .adv_w = 147, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1927, .adv_w = 75, .box_w = 4, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 1940, .adv_w = 79, .box_w = 7, .box_h = 14, .ofs_x = -1, .ofs_y = -1},
+    {.bitmap_index = 1978, .adv_w = 75, .box_w = 4, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 1991, .adv_w = 131, .box_w = 7, .box_h = 6, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 2012, .adv_w = 112, .box_w = 7, .box_h = 1, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 2014, .adv_w = 134, .box_w = 5, .box_h = 2, .ofs_x = 1, .ofs_y = 9},
+    {.bitmap_index = 2019, .adv_w = 134, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2052, .adv_w = 79, .box_w = 5, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2080, .adv_w = 67, .box_w = 2, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 2085, .adv_w = 79, .box_w = 5, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2113, .adv_w = 130, .box_w = 8, .box_h = 3, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 2126, .adv_w = 137, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2158, .adv_w = 92, .box_w = 5, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2172, .adv_w = 125, .box_w = 9, .box_h = 11, .ofs_x = -1, .ofs_y = -3}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+static const uint16_t unicode_list_2[] = {
+    0x0, 0xd, 0x14
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 32, .range_length = 66, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 123, .range_length = 4, .glyph_id_start = 67,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 101, .range_length = 21, .glyph_id_start = 71,
+        .unicode_list = unicode_list_2, .glyph_id_ofs_list = NULL, .list_length = 3, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] = {
+    0, 0, 1, 2, 0, 3, 4, 5,
+    2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 0, 13, 14, 15, 16, 17,
+    18, 19, 12, 20, 20, 0, 0, 0,
+    21, 22, 23, 24, 25, 22, 26, 27,
+    28, 29, 29, 30, 31, 32, 29, 29,
+    22, 33, 34, 35, 3, 36, 30, 37,
+    37, 38, 39, 40, 41, 42, 43, 0,
+    44, 0, 45, 41, 0, 0, 9, 46,
+    47, 48
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] = {
+    0, 0, 1, 2, 0, 3, 4, 5,
+    2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 13, 14, 15, 16, 17, 12,
+    18, 19, 20, 21, 21, 0, 0, 0,
+    22, 23, 24, 25, 23, 25, 25, 25,
+    23, 25, 25, 26, 25, 25, 25, 25,
+    23, 25, 23, 25, 3, 27, 28, 29,
+    29, 30, 31, 32, 33, 34, 35, 0,
+    36, 0, 37, 0, 0, 35, 9, 38,
+    39, 40
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] = {
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 2, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    1, 10, 0, 6, -5, 0, 0, 0,
+    0, -12, -13, 2, 11, 5, 4, -9,
+    2, 11, 1, 9, 2, 7, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 13, 2, -2, 0, 0, 0, 0,
+    0, -7, 0, 0, 0, 0, 0, -4,
+    4, 4, 0, 0, -2, 0, -2, 2,
+    0, -2, 0, -2, -1, -4, 0, 0,
+    0, 0, -2, 0, 0, -3, -3, 0,
+    0, -2, 0, -4, 0, 0, 0, -2,
+    0, -6, 0, -27, 0, 0, -4, 0,
+    4, 7, 0, 0, -4, 2, 2, 7,
+    4, -4, 4, 0, 0, -13, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -8, 0, 0, 0, 0, 0, 0,
+    -3, -11, 0, -9, -2, 0, 0, 0,
+    0, 0, 9, 0, -7, -2, -1, 1,
+    0, -4, 0, 0, -2, -17, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -18, -2, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 7, 0, 2, 0, 0, -4,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 9, 2, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -8, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2, 4, 2, 7, -2, 0, 0, 4,
+    -2, -7, -31, 2, 6, 4, 0, -3,
+    0, 8, 0, 7, 0, 7, 0, -21,
+    0, -3, 7, 0, 7, -2, 4, 2,
+    0, 0, 1, -2, 0, -4, 18, 9,
+    0, 0, 0, -8, 0, 0, 0, 0,
+    1, -2, 0, 2, -4, -3, -4, 2,
+    0, -2, 0, 0, 0, -9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -15, 0, 0, 0, 0, 0, 0,
+    1, -12, 0, -14, 0, 0, 0, 0,
+    -2, 0, 22, -3, -3, 2, 2, -2,
+    0, -3, 2, 0, 0, -12, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -22, 0, 2, 0, 0, 0, 0,
+    0, 13, 0, 0, -8, 0, 7, 0,
+    -15, -22, -15, -4, 7, 0, 0, -15,
+    0, 3, -5, 0, -3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 6, 7, -27, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 2,
+    2, -3, -4, 0, -1, -1, -2, 0,
+    0, -2, 0, 0, 0, -4, 0, -2,
+    0, -5, -4, 0, -6, -7, -7, -4,
+    0, -4, 0, -4, 0, 0, 0, 2,
+    0, 0, 0, 2, -2, 0, 0, 0,
+    -2, 2, 2, -1, 0, 0, 0, -4,
+    0, -1, 0, 0, 0, 0, 0, 1,
+    0, 3, -2, 0, -3, 0, -4, 0,
+    0, -2, 0, 7, 0, -2, 0, 1,
+    0, -2, 0, -2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -1, 0,
+    -2, -3, 0, 0, 0, 0, 0, 1,
+    0, 0, -2, 0, -2, -2, -2, 0,
+    0, 0, 0, 0, 0, 0, 0, -2,
+    0, -7, -2, -7, 4, 0, 0, -4,
+    2, 4, 6, 0, -6, -1, -3, 0,
+    -1, -11, 2, -2, 2, -12, 2, 0,
+    0, 1, -12, 0, -12, -2, -19, -2,
+    0, -11, 0, 4, 6, 3, 0, -4,
+    0, 0, 0, -2, 0, 0, 0, -2,
+    0, 0, 0, 0, 0, -1, -1, 0,
+    -1, -3, 0, 0, 0, 0, 0, 0,
+    0, -2, -2, 0, -2, -3, -2, 0,
+    0, -2, 0, 0, 0, 0, 0, -2,
+    0, -2, 0, -4, 2, 0, 0, -3,
+    1, 2, 2, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, 2,
+    0, 0, -2, 0, -2, -2, -3, 0,
+    0, 0, 0, 0, 0, 2, 0, -2,
+    0, 7, -2, 1, -7, 0, 0, 6,
+    -11, -12, -9, -4, 2, 0, -2, -15,
+    -4, 0, -4, 0, -4, 3, -4, -14,
+    0, -6, 0, 0, 1, -1, 2, -2,
+    0, 2, 0, -7, -9, -11, -5, 0,
+    0, 1, 0, -2, 0, 0, 0, 2,
+    0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 0, -1,
+    0, -1, -2, 0, -4, -5, -5, -1,
+    0, -7, 0, 0, 0, 0, 0, 1,
+    0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 11, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, -2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -4, 0, 2, 0, 0, 0, 0,
+    -2, 0, 0, 0, -4, 0, 0, 0,
+    0, -11, -7, 0, 0, 0, -3, -11,
+    0, 0, -2, 2, 0, -6, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -4, 0, 0, -4, 0, 0, 0, 0,
+    0, -4, 0, 0, 0, 0, 3, 0,
+    2, -4, -4, 0, -2, -2, -3, 0,
+    0, 0, 0, 0, 0, -7, 0, -2,
+    0, -3, -2, 0, -5, -6, -7, -2,
+    0, -4, 0, -7, 0, 0, 0, 0,
+    0, -10, 0, 0, 0, 0, 0, -21,
+    -4, 7, 7, -2, -9, 0, 2, -3,
+    0, -11, -1, -3, 2, -16, -2, 3,
+    0, 3, -8, -3, -8, -7, -9, 0,
+    0, -13, 0, 13, 0, -1, 0, -6,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, -1, -2, -3, 0,
+    0, -4, 0, -2, 0, 0, 0, 0,
+    0, 0, -1, 0, -4, 0, 0, 4,
+    -1, 3, 0, -5, 2, -2, -1, -6,
+    -2, 0, -3, -2, -2, 0, -3, -4,
+    0, 0, -2, -1, -2, -4, -3, 0,
+    0, -2, 0, 2, -2, -5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -4, 2, 0, -3, 0, -2, -3, -7,
+    -2, -2, -2, -1, -2, -3, -1, 0,
+    0, 0, 0, 0, -2, -2, -2, 0,
+    0, 0, 0, 3, -2, -2, 0, -2,
+    2, 9, -1, 0, -6, 0, -2, 4,
+    0, -2, -9, -3, 3, 0, 0, -11,
+    -4, 2, -4, 2, 0, -2, -2, -7,
+    0, -3, 1, 0, 0, -4, 0, 0,
+    0, 2, 2, -4, -4, -4, -2, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -3,
+    0, 0, -3, 0, 0, -2, -2, 0,
+    0, 0, 0, -2, 0, 0, 0, 0,
+    0, 0, -3, 0, -4, 0, 0, 0,
+    -7, 0, 2, -5, 4, 0, -2, -11,
+    0, 0, -5, -2, 0, -9, -6, -6,
+    0, 0, -10, -2, -9, -9, -11, 0,
+    -6, 0, 2, 15, -3, -5, -2, -8,
+    0, 0, -2, 0, 1, 0, 0, -16,
+    -2, 7, 5, -5, -8, 0, 1, -7,
+    0, -11, -2, -2, 4, -21, -3, 1,
+    0, 0, -15, -3, -12, -2, -16, 0,
+    0, -16, 0, 13, 1, -2, 0, -9,
+    0, 0, 0, 0, -7, 0, -2, 0,
+    -1, -6, -11, 0, 0, -1, -3, -7,
+    -2, 0, -2, 0, 0, 0, 0, -10,
+    -2, -7, -7, -2, -4, -6, -2, -4,
+    0, -4, -2, -7, -3, -3, -4, -2,
+    0, -4, 0, 0, 0, 0, 3, 0,
+    2, -4, 9, 0, -2, -2, -3, 0,
+    0, 0, 0, 0, 0, -7, 0, -2,
+    0, -3, -2, 0, -5, -6, -7, -2,
+    0, -4, 2, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, -4,
+    0, 0, 0, 0, 0, -1, 0, 0,
+    0, -2, -2, 0, 0, -4, -2, 0,
+    0, -4, 0, 4, -1, 0, 0, 0,
+    4, 2, -2, 0, -7, -4, 0, 7,
+    -7, -7, -4, -4, 9, 4, 2, -19,
+    -2, 4, -2, 0, -2, 2, -2, -8,
+    0, -2, 2, -3, -2, -7, -2, 0,
+    0, 7, 4, 0, -6, -12, -3, -7,
+    2, 0, -3, 0, -6, 0, 2, 7,
+    -5, -8, -9, -6, 7, 0, 1, -16,
+    -2, 2, -4, -2, -5, 0, -5, -8,
+    -3, -3, -2, 0, 0, -5, -5, -2,
+    0, 7, 5, -2, -12, -12, -8, -4,
+    0, 0, -3, 0, -4, -2, 0, -2,
+    -4, 0, 4, -7, 2, 0, 0, -12,
+    0, -2, -5, -4, -2, -7, -6, -7,
+    -5, 0, -7, -2, -5, -4, -7, -2,
+    0, 0, 1, 11, -4, -7, -2, -6,
+    4, 0, -3, 0, -11, -3, 1, 4,
+    -7, -8, -4, -7, 7, -2, 1, -21,
+    -4, 4, -5, -4, -8, 0, -7, -9,
+    -3, -2, -2, -2, -5, -7, -1, 0,
+    0, 7, 6, -2, -15, -13, -9, -9,
+    0, 0, 0, 0, -3, 0, 0, 2,
+    -3, 4, 2, -4, 4, 0, 0, -7,
+    -1, 0, -1, 0, 1, 1, -2, 0,
+    0, 0, 0, 0, 0, -2, 0, 0,
+    0, 0, 2, 7, 0, -3, 0, -3,
+    1, 2, 0, 0, 0, 0, 2, 0,
+    -2, 0, 9, 0, 4, 1, 1, -3,
+    0, 4, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 7, 0, 6, 0, 0, 0, 0,
+    0, -13, 0, -2, 4, 0, 7, 0,
+    0, 22, 3, -4, -4, 2, 2, -2,
+    1, -11, 0, 0, 11, -13, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -15, 9, 31, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, 0, 0, -4, -2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, -6, 0, 0, 1, 0,
+    0, 2, 29, -4, -2, 7, 6, -6,
+    2, 0, 0, 2, 2, -3, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -29, 6, 0, 0, 0, 0, 0,
+    0, 0, 0, -6, 0, 0, 0, -6,
+    0, 0, 0, 0, -5, -1, 0, 0,
+    0, -5, 0, -3, 0, -11, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -15, 0, 0, 0, 1, 0, -2,
+    0, -5, 0, -2, 0, 0, 0, -4,
+    2, 0, 0, 0, -6, -2, -4, 0,
+    0, -6, 0, -2, 0, -11, 0, 0,
+    0, 0, -22, 0, -4, -8, -11, 0,
+    0, -15, 0, -2, -3, 0, 0, -2,
+    0, 0, -4, 0, -7, -3, -2, 7,
+    -2, -2, -9, 1, -1, 1, -2, -6,
+    0, 5, 0, 2, 1, 2, -5, -9,
+    -3, 0, -9, -4, -6, -9, -9, 0,
+    -4, -4, -3, -3, -2, -3, -2, 3,
+    0, 0, -2, 0, -5, 0, 0, 9,
+    -3, -7, -7, 2, 2, 2, 0, -6,
+    2, 3, 2, 7, 2, 7, -2, -6,
+    0, 0, -9, 0, 0, -7, -6, 0,
+    0, -4, 0, -3, -4, -3, 0, -2
+};
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 48,
+    .right_class_cnt     = 40,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+/*Store all the custom data of the font*/
+static lv_font_fmt_txt_glyph_cache_t cache;
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 3,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = 1,
+    .cache = &cache
+};
+
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+const lv_font_t font_ui_14 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 16,          /*The maximum line height required by the font*/
+    .base_line = 3,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -1,
+    .underline_thickness = 1,
+    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+};
@@ -0,0 +1,155 @@
+/*******************************************************************************
+ * Size: 172 x 40, palette 8bpp, rle
+ * Source: logo_img.c
+ * Opts: python tool/lv_asset.py img app_dongle/src/hw/driver/lcd/logo_img.c --name img_logo
+ * 이 파일은 tool/lv_asset.py 로 생성됨 (직접 수정하지 말 것)
+ * QGF 형식 : ap_qgf.c 의 디코더가 LV_IMG_CF_RAW 로 등록된 이미지를 한 줄씩 풀어서 그린다
+ ******************************************************************************/
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t img_logo_qgf[] = {
+    0x00, 0xff, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0x07, 0x08, 0x00, 0x00, 0xf8, 0xf7, 0xff,
+    0xff, 0xac, 0x00, 0x28, 0x00, 0x01, 0x00, 0x01, 0xfe, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xfd, 0x06, 0x00, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x03, 0x00,
+    0xfe, 0x00, 0x00, 0x53, 0xfd, 0x01, 0x6a, 0xfd, 0x02, 0xfe, 0xfd, 0x01, 0xbf, 0xfd, 0x02, 0xfe,
+    0x00, 0x01, 0xe8, 0xfd, 0x02, 0xc7, 0xfd, 0x03, 0xfe, 0xfd, 0x03, 0xe1, 0xfd, 0x03, 0xc7, 0xbd,
+    0x04, 0xfe, 0x00, 0x03, 0xf2, 0xfd, 0x04, 0xcc, 0xfd, 0x05, 0xfe, 0x00, 0x04, 0xc7, 0x7e, 0x06,
+    0xe1, 0xfd, 0x06, 0xdb, 0xd2, 0x06, 0xdb, 0x04, 0xf9, 0xc4, 0x02, 0xfb, 0xdb, 0x04, 0xfb, 0xdb,
+    0x04, 0xff, 0xd2, 0x02, 0xff, 0xd2, 0x01, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xfe, 0x00,
+    0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00,
+    0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe,
+    0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00,
+    0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00,
+    0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe,
+    0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00,
+    0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00,
+    0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe,
+    0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00,
+    0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00,
+    0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe,
+    0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00,
+    0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00,
+    0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe,
+    0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00,
+    0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00,
+    0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe,
+    0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00,
+    0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00,
+    0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe,
+    0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00,
+    0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00,
+    0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe,
+    0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00,
+    0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00,
+    0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe,
+    0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00,
+    0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00,
+    0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe,
+    0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00,
+    0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00,
+    0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe,
+    0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00,
+    0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00,
+    0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe,
+    0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00,
+    0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00,
+    0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe,
+    0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00,
+    0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00,
+    0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe,
+    0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00,
+    0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00,
+    0x05, 0xfa, 0xd2, 0x04, 0x00, 0x09, 0x04, 0x11, 0x18, 0x85, 0x04, 0x01, 0x04, 0x01, 0x04, 0x02,
+    0x04, 0x04, 0x7f, 0x00, 0x09, 0x00, 0x80, 0x03, 0x08, 0x04, 0x11, 0x18, 0x0a, 0x04, 0x7f, 0x00,
+    0x09, 0x00, 0x09, 0x04, 0x11, 0x18, 0x0a, 0x04, 0x7f, 0x00, 0x09, 0x00, 0x80, 0x03, 0x08, 0x04,
+    0x11, 0x18, 0x89, 0x10, 0x04, 0x0c, 0x04, 0x0c, 0x04, 0x0a, 0x04, 0x0a, 0x04, 0x7f, 0x00, 0x09,
+    0x00, 0x24, 0x18, 0x7f, 0x00, 0x09, 0x00, 0x12, 0x18, 0x10, 0x04, 0x81, 0x0d, 0x18, 0x7f, 0x00,
+    0x09, 0x00, 0x12, 0x18, 0x08, 0x04, 0x81, 0x15, 0x12, 0x03, 0x16, 0x80, 0x08, 0x03, 0x04, 0x80,
+    0x18, 0x7f, 0x00, 0x09, 0x00, 0x12, 0x18, 0x08, 0x04, 0x80, 0x15, 0x03, 0x00, 0x80, 0x16, 0x04,
+    0x04, 0x80, 0x18, 0x7f, 0x00, 0x09, 0x00, 0x12, 0x18, 0x08, 0x04, 0x80, 0x15, 0x03, 0x00, 0x81,
+    0x16, 0x08, 0x03, 0x04, 0x80, 0x18, 0x7f, 0x00, 0x09, 0x00, 0x12, 0x18, 0x08, 0x04, 0x80, 0x17,
+    0x03, 0x00, 0x80, 0x14, 0x03, 0x04, 0x81, 0x0a, 0x18, 0x7f, 0x00, 0x09, 0x00, 0x91, 0x18, 0x09,
+    0x04, 0x09, 0x04, 0x06, 0x04, 0x06, 0x04, 0x00, 0x04, 0x04, 0x05, 0x0e, 0x04, 0x00, 0x04, 0x0b,
+    0x08, 0x04, 0x81, 0x13, 0x13, 0x03, 0x17, 0x04, 0x04, 0x80, 0x18, 0x7f, 0x00, 0x09, 0x00, 0x80,
+    0x18, 0x08, 0x04, 0x82, 0x05, 0x04, 0x00, 0x17, 0x04, 0x80, 0x18, 0x7f, 0x00, 0x09, 0x00, 0x80,
+    0x18, 0x19, 0x04, 0x80, 0x0f, 0x08, 0x04, 0x80, 0x18, 0x7f, 0x00, 0x09, 0x00, 0x85, 0x18, 0x04,
+    0x04, 0x11, 0x04, 0x00, 0x1d, 0x04, 0x80, 0x18, 0x7f, 0x00, 0x09, 0x00, 0x81, 0x18, 0x07, 0x21,
+    0x04, 0x80, 0x18, 0x7f, 0x00, 0x09, 0x00, 0x24, 0x18, 0x7f, 0x00, 0x0a, 0x00, 0x0b, 0x04, 0x80,
+    0x00, 0x0a, 0x18, 0x0c, 0x04, 0x0c, 0x00, 0x13, 0x18, 0x0d, 0x00, 0x0a, 0x18, 0x09, 0x00, 0x13,
+    0x18, 0x0d, 0x00, 0x0a, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x0d, 0x04, 0x0a,
+    0x18, 0x80, 0x00, 0x0b, 0x04, 0x0c, 0x00, 0x13, 0x18, 0x0d, 0x00, 0x0a, 0x18, 0x09, 0x00, 0x13,
+    0x18, 0x0d, 0x00, 0x0a, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x80, 0x05, 0x0c,
+    0x04, 0x0a, 0x18, 0x0c, 0x04, 0x0c, 0x00, 0x13, 0x18, 0x0d, 0x00, 0x0a, 0x18, 0x09, 0x00, 0x13,
+    0x18, 0x0d, 0x00, 0x0a, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x0d, 0x04, 0x0a,
+    0x18, 0x0c, 0x04, 0x0c, 0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x07, 0x00, 0x06, 0x18, 0x04,
+    0x00, 0x06, 0x18, 0x06, 0x00, 0x06, 0x18, 0x0b, 0x00, 0x06, 0x18, 0x06, 0x00, 0x06, 0x18, 0x04,
+    0x00, 0x06, 0x18, 0x07, 0x00, 0x09, 0x18, 0x04, 0x00, 0x09, 0x18, 0x80, 0x00, 0x22, 0x18, 0x0c,
+    0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x07, 0x00, 0x06, 0x18, 0x04, 0x00, 0x06, 0x18, 0x06,
+    0x00, 0x06, 0x18, 0x0b, 0x00, 0x06, 0x18, 0x06, 0x00, 0x06, 0x18, 0x04, 0x00, 0x06, 0x18, 0x07,
+    0x00, 0x09, 0x18, 0x04, 0x00, 0x09, 0x18, 0x80, 0x00, 0x04, 0x18, 0x0c, 0x00, 0x05, 0x18, 0x09,
+    0x00, 0x04, 0x18, 0x0c, 0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x07, 0x00, 0x06, 0x18, 0x04,
+    0x00, 0x06, 0x18, 0x06, 0x00, 0x06, 0x18, 0x0b, 0x00, 0x06, 0x18, 0x06, 0x00, 0x06, 0x18, 0x04,
+    0x00, 0x06, 0x18, 0x07, 0x00, 0x09, 0x18, 0x04, 0x00, 0x09, 0x18, 0x80, 0x00, 0x04, 0x18, 0x0c,
+    0x00, 0x05, 0x18, 0x09, 0x00, 0x04, 0x18, 0x0c, 0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x07,
+    0x00, 0x06, 0x18, 0x04, 0x00, 0x06, 0x18, 0x06, 0x00, 0x06, 0x18, 0x0b, 0x00, 0x06, 0x18, 0x06,
+    0x00, 0x06, 0x18, 0x04, 0x00, 0x06, 0x18, 0x07, 0x00, 0x09, 0x18, 0x04, 0x00, 0x09, 0x18, 0x80,
+    0x00, 0x04, 0x18, 0x0c, 0x00, 0x05, 0x18, 0x09, 0x00, 0x04, 0x18, 0x0c, 0x00, 0x06, 0x18, 0x0a,
+    0x00, 0x06, 0x18, 0x04, 0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x03, 0x00, 0x06, 0x18, 0x0b,
+    0x00, 0x06, 0x18, 0x03, 0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x04, 0x00, 0x16, 0x18, 0x80,
+    0x00, 0x04, 0x18, 0x0c, 0x00, 0x05, 0x18, 0x09, 0x00, 0x04, 0x18, 0x0c, 0x00, 0x06, 0x18, 0x0a,
+    0x00, 0x06, 0x18, 0x04, 0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x03, 0x00, 0x06, 0x18, 0x0b,
+    0x00, 0x06, 0x18, 0x03, 0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x04, 0x00, 0x16, 0x18, 0x11,
+    0x00, 0x05, 0x18, 0x19, 0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x04, 0x00, 0x06, 0x18, 0x0a,
+    0x00, 0x06, 0x18, 0x03, 0x00, 0x06, 0x18, 0x0b, 0x00, 0x06, 0x18, 0x03, 0x00, 0x06, 0x18, 0x0a,
+    0x00, 0x06, 0x18, 0x04, 0x00, 0x16, 0x18, 0x11, 0x00, 0x05, 0x18, 0x19, 0x00, 0x13, 0x18, 0x07,
+    0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x03, 0x00, 0x13, 0x18, 0x07, 0x00, 0x06, 0x18, 0x0a,
+    0x00, 0x06, 0x18, 0x04, 0x00, 0x06, 0x18, 0x03, 0x00, 0x04, 0x18, 0x03, 0x00, 0x06, 0x18, 0x11,
+    0x00, 0x05, 0x18, 0x19, 0x00, 0x13, 0x18, 0x07, 0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x03,
+    0x00, 0x13, 0x18, 0x07, 0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x04, 0x00, 0x06, 0x18, 0x03,
+    0x00, 0x04, 0x18, 0x03, 0x00, 0x06, 0x18, 0x11, 0x00, 0x05, 0x18, 0x19, 0x00, 0x13, 0x18, 0x07,
+    0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x03, 0x00, 0x13, 0x18, 0x07, 0x00, 0x06, 0x18, 0x0a,
+    0x00, 0x06, 0x18, 0x04, 0x00, 0x06, 0x18, 0x03, 0x00, 0x04, 0x18, 0x03, 0x00, 0x06, 0x18, 0x11,
+    0x00, 0x05, 0x18, 0x19, 0x00, 0x13, 0x18, 0x07, 0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x03,
+    0x00, 0x13, 0x18, 0x07, 0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x04, 0x00, 0x06, 0x18, 0x03,
+    0x00, 0x04, 0x18, 0x03, 0x00, 0x06, 0x18, 0x11, 0x00, 0x05, 0x18, 0x19, 0x00, 0x06, 0x18, 0x0a,
+    0x00, 0x06, 0x18, 0x04, 0x00, 0x16, 0x18, 0x03, 0x00, 0x06, 0x18, 0x0b, 0x00, 0x06, 0x18, 0x03,
+    0x00, 0x16, 0x18, 0x04, 0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x11, 0x00, 0x05, 0x18, 0x19,
+    0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x04, 0x00, 0x16, 0x18, 0x03, 0x00, 0x06, 0x18, 0x0b,
+    0x00, 0x06, 0x18, 0x03, 0x00, 0x16, 0x18, 0x04, 0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x11,
+    0x00, 0x05, 0x18, 0x19, 0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x04, 0x00, 0x16, 0x18, 0x03,
+    0x00, 0x06, 0x18, 0x0b, 0x00, 0x06, 0x18, 0x03, 0x00, 0x16, 0x18, 0x04, 0x00, 0x06, 0x18, 0x0a,
+    0x00, 0x06, 0x18, 0x11, 0x00, 0x05, 0x18, 0x19, 0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x04,
+    0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x03, 0x00, 0x06, 0x18, 0x0b, 0x00, 0x06, 0x18, 0x03,
+    0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x04, 0x00, 0x06, 0x18, 0x0a, 0x00, 0x2a, 0x18, 0x0b,
+    0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x04, 0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x03,
+    0x00, 0x06, 0x18, 0x0b, 0x00, 0x06, 0x18, 0x03, 0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x04,
+    0x00, 0x06, 0x18, 0x0a, 0x00, 0x0a, 0x18, 0x1c, 0x00, 0x04, 0x18, 0x0b, 0x00, 0x06, 0x18, 0x0a,
+    0x00, 0x06, 0x18, 0x04, 0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x03, 0x00, 0x06, 0x18, 0x0b,
+    0x00, 0x06, 0x18, 0x03, 0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x04, 0x00, 0x06, 0x18, 0x0a,
+    0x00, 0x0a, 0x18, 0x1c, 0x00, 0x04, 0x18, 0x0b, 0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x04,
+    0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x03, 0x00, 0x06, 0x18, 0x0b, 0x00, 0x06, 0x18, 0x03,
+    0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x04, 0x00, 0x06, 0x18, 0x0a, 0x00, 0x0a, 0x18, 0x1c,
+    0x00, 0x04, 0x18, 0x0b, 0x00, 0x13, 0x18, 0x07, 0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x03,
+    0x00, 0x06, 0x18, 0x0b, 0x00, 0x06, 0x18, 0x03, 0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x04,
+    0x00, 0x06, 0x18, 0x0a, 0x00, 0x0a, 0x18, 0x1c, 0x00, 0x04, 0x18, 0x0b, 0x00, 0x13, 0x18, 0x07,
+    0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x03, 0x00, 0x06, 0x18, 0x0b, 0x00, 0x06, 0x18, 0x03,
+    0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x04, 0x00, 0x06, 0x18, 0x0a, 0x00, 0x0a, 0x18, 0x1c,
+    0x00, 0x04, 0x18, 0x0b, 0x00, 0x13, 0x18, 0x07, 0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x03,
+    0x00, 0x06, 0x18, 0x0b, 0x00, 0x06, 0x18, 0x03, 0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18, 0x04,
+    0x00, 0x06, 0x18, 0x0a, 0x00, 0x06, 0x18,
+};
+
+const lv_img_dsc_t img_logo = {
+    .header.cf = LV_IMG_CF_RAW,
+    .header.always_zero = 0,
+    .header.reserved = 0,
+    .header.w = 172,
+    .header.h = 40,
+    .data_size = 2055,
+    .data = img_logo_qgf,
+};
@@ -4,4 +4,7 @@ cmake_minimum_required(VERSION 3.13)
 
 
 # set(DEBOUNCE_TYPE sym_eager_pk)
-set(DEBOUNCE_TYPE asym_eager_defer_pk)
\ No newline at end of file
+set(DEBOUNCE_TYPE asym_eager_defer_pk)
+
+# LVGL 이미지를 QGF(RLE) 로 저장하고 그릴 때 푼다 (ap_qgf.c, tool/lv_asset.py)
+set(QGF_ENABLE true)
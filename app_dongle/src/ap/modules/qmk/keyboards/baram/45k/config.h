@@ -23,6 +23,9 @@
 
 #define MATRIX_COLS (LEFT_COLS + RIGHT_COLS)
 #define MATRIX_ROWS (LEFT_ROWS > RIGHT_ROWS ? LEFT_ROWS : RIGHT_ROWS)
+
+// 키 이벤트 시간은 하프의 스캔 시간 (my_key_protocol 에서 동글 시계로 변환)
+#define MATRIX_EVENT_TIME
 #else
 
 #define MATRIX_ROWS                 3
@@ -32,4 +35,48 @@
 
 #define DEBOUNCE                    5
 
-// #define DEBUG_MATRIX_SCAN_RATE
\ No newline at end of file
+// QMK fast timer 를 us 단위로 (ms 경계에 맞춰 잘리지 않고 마지막 변화로부터 DEBOUNCE 만큼 기다림)
+#define FAST_TIMER_US
+// tap/hold 판단을 us 단위 이벤트 시간으로 (TAPPING_TERM 양 끝이 ms 로 잘리지 않음)
+#define EVENT_TIME_US
+// debounce 를 us 단위로 지정할 때 (DEBOUNCE 대신 사용, 100us 단위, 최대 12.7ms)
+// #define DEBOUNCE_US                 5000
+
+// #define DEBUG_MATRIX_SCAN_RATE
+
+// EEPROM 끝에서부터 combo, key override, trackball 설정을 두고(VIA/CLI 에서 편집) 그만큼 macro 영역을 줄인다
+#ifdef COMBO_ENABLE
+#define DYNAMIC_COMBO_COUNT                 64
+#define DYNAMIC_COMBO_KEYS                  4
+#define DYNAMIC_COMBO_EEPROM_SIZE           (4 + DYNAMIC_COMBO_COUNT * (DYNAMIC_COMBO_KEYS + 1) * 2)
+
+#define COMBO_KEY_INDEX
+#define COMBO_KEY_INDEX_MAX                 DYNAMIC_COMBO_COUNT
+#define COMBO_TERM_PER_COMBO
+#else
+#define DYNAMIC_COMBO_EEPROM_SIZE           0
+#endif
+
+#ifdef KEY_OVERRIDE_ENABLE
+#define DYNAMIC_KEY_OVERRIDE_COUNT          32
+#define DYNAMIC_KEY_OVERRIDE_EEPROM_SIZE    (4 + DYNAMIC_KEY_OVERRIDE_COUNT * 10)
+
+#define KEY_OVERRIDE_INDEX
+#define KEY_OVERRIDE_INDEX_MAX              DYNAMIC_KEY_OVERRIDE_COUNT
+#else
+#define DYNAMIC_KEY_OVERRIDE_EEPROM_SIZE    0
+#endif
+
+#ifdef POINTING_DEVICE_ENABLE
+#define TRACKBALL_CONFIG_EEPROM_SIZE        10
+#define MOTION_PIPELINE_EEPROM_SIZE         48
+#else
+#define TRACKBALL_CONFIG_EEPROM_SIZE        0
+#define MOTION_PIPELINE_EEPROM_SIZE         0
+#endif
+
+#define DYNAMIC_COMBO_EEPROM_ADDR           (TOTAL_EEPROM_BYTE_COUNT - DYNAMIC_COMBO_EEPROM_SIZE)
+#define DYNAMIC_KEY_OVERRIDE_EEPROM_ADDR    (DYNAMIC_COMBO_EEPROM_ADDR - DYNAMIC_KEY_OVERRIDE_EEPROM_SIZE)
+#define TRACKBALL_CONFIG_EEPROM_ADDR        (DYNAMIC_KEY_OVERRIDE_EEPROM_ADDR - TRACKBALL_CONFIG_EEPROM_SIZE)
+#define MOTION_PIPELINE_EEPROM_ADDR         (TRACKBALL_CONFIG_EEPROM_ADDR - MOTION_PIPELINE_EEPROM_SIZE)
+#define DYNAMIC_KEYMAP_EEPROM_MAX_ADDR      (MOTION_PIPELINE_EEPROM_ADDR - 1)
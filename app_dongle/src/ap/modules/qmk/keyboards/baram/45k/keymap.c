@@ -33,3 +33,12 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
     
 };
 
+
+#ifdef COMBO_ENABLE
+// combo 는 VIA/CLI(combo set) 로 편집한다 (기본값 없음)
+// EEPROM 초기화 시 기본 combo 가 필요하면 여기서 정의 (dynamic_combo.c 의 weak 함수 대체)
+// 예) const uint16_t PROGMEM combo_jk[] = {KC_J, KC_K, COMBO_END};
+//     combo_t key_combos[] = { COMBO(combo_jk, KC_ESC) };
+//     uint16_t combo_count_raw(void) { return ARRAY_SIZE(key_combos); }
+//     combo_t *combo_get_raw(uint16_t combo_idx) { return &key_combos[combo_idx]; }
+#endif
@@ -0,0 +1,408 @@
+#include "dynamic_combo.h"
+#include "hw.h"
+#include "keymap_introspection.h"
+#include "qmk.h"
+
+#ifdef COMBO_ENABLE
+
+
+#define DYNAMIC_COMBO_MAGIC         0xC0B1
+
+// EEPROM : [magic(2), term(2)] + 슬롯마다 [keys(2 x DYNAMIC_COMBO_KEYS), keycode(2)], big endian
+#define DYNAMIC_COMBO_SLOT_SIZE     ((DYNAMIC_COMBO_KEYS + 1) * 2)
+#define DYNAMIC_COMBO_SLOT_ADDR(i)  (DYNAMIC_COMBO_EEPROM_ADDR + 4 + (i) * DYNAMIC_COMBO_SLOT_SIZE)
+
+_Static_assert(DYNAMIC_COMBO_EEPROM_SIZE >= 4 + DYNAMIC_COMBO_COUNT * DYNAMIC_COMBO_SLOT_SIZE, "DYNAMIC_COMBO_EEPROM_SIZE too small");
+_Static_assert(DYNAMIC_COMBO_KEYS <= MAX_COMBO_LENGTH, "DYNAMIC_COMBO_KEYS > MAX_COMBO_LENGTH");
+_Static_assert(DYNAMIC_COMBO_COUNT <= COMBO_KEY_INDEX_MAX, "DYNAMIC_COMBO_COUNT > COMBO_KEY_INDEX_MAX");
+
+
+enum via_qmk_combo_value {
+    id_qmk_combo_count = 1,   // [count, max, keys]
+    id_qmk_combo_term  = 2,   // [term_hi, term_lo]
+    id_qmk_combo_entry = 3,   // [index, key0_hi, key0_lo, .. key3_hi, key3_lo, keycode_hi, keycode_lo]
+};
+
+
+static void via_qmk_combo_get_value(uint8_t *data);
+static void via_qmk_combo_set_value(uint8_t *data);
+static void cliCombo(cli_args_t *args);
+
+
+// 마지막 항목은 항상 COMBO_END
+static uint16_t combo_keys[DYNAMIC_COMBO_COUNT][DYNAMIC_COMBO_KEYS + 1];
+static combo_t  combo_list[DYNAMIC_COMBO_COUNT];
+static uint16_t combo_used = 0;
+static uint16_t combo_term = COMBO_TERM;
+
+
+
+
+static uint16_t eeprom_read_word_be(uint32_t addr)
+{
+  uint16_t data;
+
+  data  = eeprom_read_byte((const uint8_t *)addr) << 8;
+  data |= eeprom_read_byte((const uint8_t *)(addr + 1));
+  return data;
+}
+
+static void eeprom_update_word_be(uint32_t addr, uint16_t data)
+{
+  eeprom_update_byte((uint8_t *)addr, (uint8_t)(data >> 8));
+  eeprom_update_byte((uint8_t *)(addr + 1), (uint8_t)(data & 0xFF));
+}
+
+static void dynamic_combo_update_used(void)
+{
+  uint16_t used = 0;
+
+  for (uint16_t i=0; i<DYNAMIC_COMBO_COUNT; i++)
+  {
+    if (combo_keys[i][0] != COMBO_END)
+    {
+      used = i + 1;
+    }
+  }
+  combo_used = used;
+}
+
+static void dynamic_combo_load(void)
+{
+  combo_term = eeprom_read_word_be(DYNAMIC_COMBO_EEPROM_ADDR + 2);
+
+  for (uint16_t i=0; i<DYNAMIC_COMBO_COUNT; i++)
+  {
+    uint32_t addr = DYNAMIC_COMBO_SLOT_ADDR(i);
+
+    for (uint16_t k=0; k<DYNAMIC_COMBO_KEYS; k++)
+    {
+      combo_keys[i][k] = eeprom_read_word_be(addr + k * 2);
+    }
+    combo_keys[i][DYNAMIC_COMBO_KEYS] = COMBO_END;
+
+    combo_list[i] = (combo_t){.keys = combo_keys[i], .keycode = eeprom_read_word_be(addr + DYNAMIC_COMBO_KEYS * 2)};
+  }
+  dynamic_combo_update_used();
+  combo_index_invalidate();
+}
+
+void dynamic_combo_init(void)
+{
+  if (eeprom_read_word_be(DYNAMIC_COMBO_EEPROM_ADDR) != DYNAMIC_COMBO_MAGIC)
+  {
+    dynamic_combo_reset();
+  }
+  dynamic_combo_load();
+
+  cliAdd("combo", cliCombo);
+
+  logPrintf("[ON] COMBO (%d/%d)\n", combo_used, DYNAMIC_COMBO_COUNT);
+}
+
+// EEPROM 초기화 시 기본 combo. keymap.c 에 기본값이 있으면 keymap.c 에서 다시 정의한다
+__attribute__((weak)) uint16_t combo_count_raw(void)
+{
+  return 0;
+}
+
+__attribute__((weak)) combo_t *combo_get_raw(uint16_t combo_idx)
+{
+  return NULL;
+}
+
+// combo_get_raw() 의 기본 combo 로 초기화
+void dynamic_combo_reset(void)
+{
+  uint16_t raw_count = combo_count_raw();
+
+  for (uint16_t i=0; i<DYNAMIC_COMBO_COUNT; i++)
+  {
+    uint16_t keys[DYNAMIC_COMBO_KEYS] = {COMBO_END, };
+    uint16_t keycode = KC_NO;
+
+    if (i < raw_count)
+    {
+      combo_t *combo = combo_get_raw(i);
+
+      for (uint16_t k=0; k<DYNAMIC_COMBO_KEYS; k++)
+      {
+        keys[k] = pgm_read_word(&combo->keys[k]);
+        if (keys[k] == COMBO_END)
+          break;
+      }
+      keycode = combo->keycode;
+    }
+    dynamic_combo_set(i, keys, keycode);
+  }
+
+  eeprom_update_word_be(DYNAMIC_COMBO_EEPROM_ADDR + 2, COMBO_TERM);
+  eeprom_update_word_be(DYNAMIC_COMBO_EEPROM_ADDR, DYNAMIC_COMBO_MAGIC);
+  combo_term = COMBO_TERM;
+}
+
+bool dynamic_combo_get(uint16_t index, uint16_t *keys, uint16_t *keycode)
+{
+  if (index >= DYNAMIC_COMBO_COUNT)
+  {
+    return false;
+  }
+
+  for (uint16_t k=0; k<DYNAMIC_COMBO_KEYS; k++)
+  {
+    keys[k] = combo_keys[index][k];
+  }
+  *keycode = combo_list[index].keycode;
+  return true;
+}
+
+// keys 는 DYNAMIC_COMBO_KEYS 개, 중간의 COMBO_END 이후는 무시. keys[0] 이 COMBO_END 이면 삭제
+bool dynamic_combo_set(uint16_t index, const uint16_t *keys, uint16_t keycode)
+{
+  uint32_t addr;
+  bool     is_end = false;
+
+  if (index >= DYNAMIC_COMBO_COUNT)
+  {
+    return false;
+  }
+
+  // VIA(USB) / CLI 스레드에서 호출되므로 콤보 처리(qmkUpdate)와 겹치지 않게 lock
+  qmkLock();
+  addr = DYNAMIC_COMBO_SLOT_ADDR(index);
+  for (uint16_t k=0; k<DYNAMIC_COMBO_KEYS; k++)
+  {
+    if (keys[k] == COMBO_END)
+    {
+      is_end = true;
+    }
+    combo_keys[index][k] = is_end ? COMBO_END : keys[k];
+    eeprom_update_word_be(addr + k * 2, combo_keys[index][k]);
+  }
+  combo_list[index].keys    = combo_keys[index];
+  combo_list[index].keycode = keycode;
+  eeprom_update_word_be(addr + DYNAMIC_COMBO_KEYS * 2, keycode);
+
+  dynamic_combo_update_used();
+  combo_index_invalidate();
+  qmkUnlock();
+  return true;
+}
+
+static void dynamic_combo_set_term(uint16_t term)
+{
+  qmkLock();
+  combo_term = term;
+  eeprom_update_word_be(DYNAMIC_COMBO_EEPROM_ADDR + 2, term);
+  qmkUnlock();
+}
+
+uint16_t combo_count(void)
+{
+  return combo_used;
+}
+
+combo_t *combo_get(uint16_t combo_idx)
+{
+  return &combo_list[combo_idx];
+}
+
+uint16_t get_combo_term(uint16_t index, combo_t *combo)
+{
+  return combo_term;
+}
+
+void via_qmk_combo_command(uint8_t *data, uint8_t length)
+{
+  // data = [ command_id, channel_id, value_id, value_data ]
+  uint8_t *command_id        = &(data[0]);
+  uint8_t *value_id_and_data = &(data[2]);
+
+  switch (*command_id)
+  {
+    case id_custom_set_value:
+      {
+        via_qmk_combo_set_value(value_id_and_data);
+        break;
+      }
+    case id_custom_get_value:
+      {
+        via_qmk_combo_get_value(value_id_and_data);
+        break;
+      }
+    case id_custom_save:
+      {
+        // set 할 때 바로 EEPROM 에 반영된다
+        break;
+      }
+    default:
+      {
+        *command_id = id_unhandled;
+        break;
+      }
+  }
+}
+
+void via_qmk_combo_get_value(uint8_t *data)
+{
+  // data = [ value_id, value_data ]
+  uint8_t *value_id   = &(data[0]);
+  uint8_t *value_data = &(data[1]);
+
+  switch (*value_id)
+  {
+    case id_qmk_combo_count:
+      {
+        value_data[0] = combo_used;
+        value_data[1] = DYNAMIC_COMBO_COUNT;
+        value_data[2] = DYNAMIC_COMBO_KEYS;
+        break;
+      }
+    case id_qmk_combo_term:
+      {
+        value_data[0] = combo_term >> 8;
+        value_data[1] = combo_term & 0xFF;
+        break;
+      }
+    case id_qmk_combo_entry:
+      {
+        uint16_t keys[DYNAMIC_COMBO_KEYS];
+        uint16_t keycode;
+
+        if (!dynamic_combo_get(value_data[0], keys, &keycode))
+        {
+          *value_id = id_unhandled;
+          break;
+        }
+        for (uint16_t k=0; k<DYNAMIC_COMBO_KEYS; k++)
+        {
+          value_data[1 + k*2] = keys[k] >> 8;
+          value_data[2 + k*2] = keys[k] & 0xFF;
+        }
+        value_data[1 + DYNAMIC_COMBO_KEYS*2] = keycode >> 8;
+        value_data[2 + DYNAMIC_COMBO_KEYS*2] = keycode & 0xFF;
+        break;
+      }
+  }
+}
+
+void via_qmk_combo_set_value(uint8_t *data)
+{
+  // data = [ value_id, value_data ]
+  uint8_t *value_id   = &(data[0]);
+  uint8_t *value_data = &(data[1]);
+
+  switch (*value_id)
+  {
+    case id_qmk_combo_term:
+      {
+        dynamic_combo_set_term((value_data[0] << 8) | value_data[1]);
+        break;
+      }
+    case id_qmk_combo_entry:
+      {
+        uint16_t keys[DYNAMIC_COMBO_KEYS];
+        uint16_t keycode;
+
+        for (uint16_t k=0; k<DYNAMIC_COMBO_KEYS; k++)
+        {
+          keys[k] = (value_data[1 + k*2] << 8) | value_data[2 + k*2];
+        }
+        keycode = (value_data[1 + DYNAMIC_COMBO_KEYS*2] << 8) | value_data[2 + DYNAMIC_COMBO_KEYS*2];
+
+        if (!dynamic_combo_set(value_data[0], keys, keycode))
+        {
+          *value_id = id_unhandled;
+        }
+        break;
+      }
+  }
+}
+
+void cliCombo(cli_args_t *args)
+{
+  bool ret = false;
+
+
+  if (args->argc == 1 && args->isStr(0, "info"))
+  {
+    cliPrintf("enable : %s\n", is_combo_enabled() ? "on" : "off");
+    cliPrintf("term   : %d ms\n", combo_term);
+    cliPrintf("used   : %d/%d\n", combo_used, DYNAMIC_COMBO_COUNT);
+    cliPrintf("keys   : %d\n", DYNAMIC_COMBO_KEYS);
+    ret = true;
+  }
+
+  if (args->argc == 1 && args->isStr(0, "list"))
+  {
+    for (uint16_t i=0; i<combo_used; i++)
+    {
+      if (combo_keys[i][0] == COMBO_END)
+        continue;
+
+      cliPrintf("%2d : 0x%04X <-", i, combo_list[i].keycode);
+      for (uint16_t k=0; k<DYNAMIC_COMBO_KEYS && combo_keys[i][k] != COMBO_END; k++)
+      {
+        cliPrintf(" 0x%04X", combo_keys[i][k]);
+      }
+      cliPrintf("\n");
+    }
+    ret = true;
+  }
+
+  if (args->argc >= 5 && args->argc <= 3 + DYNAMIC_COMBO_KEYS && args->isStr(0, "set"))
+  {
+    uint16_t index = args->getData(1);
+    uint16_t keycode = args->getData(2);
+    uint16_t keys[DYNAMIC_COMBO_KEYS] = {COMBO_END, };
+
+    for (uint16_t k=0; k<args->argc - 3; k++)
+    {
+      keys[k] = args->getData(3 + k);
+    }
+    if (dynamic_combo_set(index, keys, keycode))
+      cliPrintf("combo %d set\n", index);
+    else
+      cliPrintf("combo index 0~%d\n", DYNAMIC_COMBO_COUNT - 1);
+    ret = true;
+  }
+
+  if (args->argc == 2 && args->isStr(0, "del"))
+  {
+    uint16_t index = args->getData(1);
+    uint16_t keys[DYNAMIC_COMBO_KEYS] = {COMBO_END, };
+
+    if (dynamic_combo_set(index, keys, KC_NO))
+      cliPrintf("combo %d deleted\n", index);
+    else
+      cliPrintf("combo index 0~%d\n", DYNAMIC_COMBO_COUNT - 1);
+    ret = true;
+  }
+
+  if (args->argc == 2 && args->isStr(0, "term"))
+  {
+    dynamic_combo_set_term(args->getData(1));
+    cliPrintf("term : %d ms\n", combo_term);
+    ret = true;
+  }
+
+  if (args->argc == 1 && args->isStr(0, "reset"))
+  {
+    dynamic_combo_reset();
+    dynamic_combo_load();
+    cliPrintf("combo reset\n");
+    ret = true;
+  }
+
+  if (ret == false)
+  {
+    cliPrintf("combo info\n");
+    cliPrintf("combo list\n");
+    cliPrintf("combo set idx keycode key0 key1 [key2 key3]\n");
+    cliPrintf("combo del idx\n");
+    cliPrintf("combo term ms\n");
+    cliPrintf("combo reset\n");
+  }
+}
+
+#endif
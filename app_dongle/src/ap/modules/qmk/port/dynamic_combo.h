@@ -0,0 +1,12 @@
+#pragma once
+
+#include "quantum.h"
+
+
+
+// EEPROM 에 저장된 combo (VIA/CLI 에서 편집)
+void dynamic_combo_init(void);
+void dynamic_combo_reset(void);
+bool dynamic_combo_get(uint16_t index, uint16_t *keys, uint16_t *keycode);
+bool dynamic_combo_set(uint16_t index, const uint16_t *keys, uint16_t keycode);
+void via_qmk_combo_command(uint8_t *data, uint8_t length);
@@ -0,0 +1,374 @@
+#include "dynamic_key_override.h"
+#include "hw.h"
+#include "qmk.h"
+
+#ifdef KEY_OVERRIDE_ENABLE
+
+
+#define DYNAMIC_KO_MAGIC            0x4B4F
+
+// EEPROM : [magic(2), reserved(2)] + 슬롯마다 [enable, trigger(2), mods, layers, negative, suppressed, replacement(2), options]
+#define DYNAMIC_KO_SLOT_SIZE        10
+#define DYNAMIC_KO_SLOT_ADDR(i)     (DYNAMIC_KEY_OVERRIDE_EEPROM_ADDR + 4 + (i) * DYNAMIC_KO_SLOT_SIZE)
+
+_Static_assert(DYNAMIC_KEY_OVERRIDE_EEPROM_SIZE >= 4 + DYNAMIC_KEY_OVERRIDE_COUNT * DYNAMIC_KO_SLOT_SIZE, "DYNAMIC_KEY_OVERRIDE_EEPROM_SIZE too small");
+_Static_assert(DYNAMIC_KEY_OVERRIDE_COUNT <= KEY_OVERRIDE_INDEX_MAX, "DYNAMIC_KEY_OVERRIDE_COUNT > KEY_OVERRIDE_INDEX_MAX");
+_Static_assert(DYNAMIC_KEYMAP_LAYER_COUNT <= 8, "layers are stored in 8 bits");
+
+
+enum via_qmk_key_override_value {
+    id_qmk_key_override_enable = 1,   // [enable]
+    id_qmk_key_override_count  = 2,   // [count, max]
+    id_qmk_key_override_entry  = 3,   // [index, enable, trigger(2), mods, layers, negative, suppressed, replacement(2), options]
+};
+
+
+static void via_qmk_key_override_get_value(uint8_t *data);
+static void via_qmk_key_override_set_value(uint8_t *data);
+static void cliKeyOverride(cli_args_t *args);
+
+
+static dynamic_key_override_t ko_cfg[DYNAMIC_KEY_OVERRIDE_COUNT];
+static key_override_t         ko_list[DYNAMIC_KEY_OVERRIDE_COUNT];
+
+// 슬롯 위치가 바뀌지 않도록 비어 있는 슬롯도 목록에 두고 layers 를 0 으로 해서 걸리지 않게 한다
+static const key_override_t  *ko_ptrs[DYNAMIC_KEY_OVERRIDE_COUNT + 1];
+
+const key_override_t **key_overrides = ko_ptrs;
+
+
+
+
+static void dynamic_key_override_apply(uint8_t index)
+{
+  dynamic_key_override_t *p_cfg = &ko_cfg[index];
+  key_override_t *p_ko = &ko_list[index];
+
+  p_ko->trigger           = p_cfg->trigger;
+  p_ko->trigger_mods      = p_cfg->trigger_mods;
+  p_ko->layers            = p_cfg->enable ? p_cfg->layers : 0;
+  p_ko->negative_mod_mask = p_cfg->negative_mods;
+  p_ko->suppressed_mods   = p_cfg->suppressed_mods;
+  p_ko->replacement       = p_cfg->replacement;
+  p_ko->options           = (ko_option_t)p_cfg->options;
+  p_ko->custom_action     = NULL;
+  p_ko->context           = NULL;
+  p_ko->enabled           = NULL;
+
+  ko_ptrs[index] = p_ko;
+}
+
+static void dynamic_key_override_load(void)
+{
+  for (uint8_t i=0; i<DYNAMIC_KEY_OVERRIDE_COUNT; i++)
+  {
+    uint8_t buf[DYNAMIC_KO_SLOT_SIZE];
+
+    eeprom_read_block(buf, (const void *)DYNAMIC_KO_SLOT_ADDR(i), sizeof(buf));
+
+    ko_cfg[i].enable          = buf[0] & 0x01;
+    ko_cfg[i].trigger         = (buf[1] << 8) | buf[2];
+    ko_cfg[i].trigger_mods    = buf[3];
+    ko_cfg[i].layers          = buf[4];
+    ko_cfg[i].negative_mods   = buf[5];
+    ko_cfg[i].suppressed_mods = buf[6];
+    ko_cfg[i].replacement     = (buf[7] << 8) | buf[8];
+    ko_cfg[i].options         = buf[9];
+    dynamic_key_override_apply(i);
+  }
+  ko_ptrs[DYNAMIC_KEY_OVERRIDE_COUNT] = NULL;
+  key_override_index_invalidate();
+}
+
+void dynamic_key_override_init(void)
+{
+  uint16_t magic;
+
+  magic  = eeprom_read_byte((const uint8_t *)DYNAMIC_KEY_OVERRIDE_EEPROM_ADDR) << 8;
+  magic |= eeprom_read_byte((const uint8_t *)(DYNAMIC_KEY_OVERRIDE_EEPROM_ADDR + 1));
+  if (magic != DYNAMIC_KO_MAGIC)
+  {
+    dynamic_key_override_reset();
+  }
+  dynamic_key_override_load();
+
+  cliAdd("ko", cliKeyOverride);
+
+  logPrintf("[ON] KEY OVERRIDE\n");
+}
+
+void dynamic_key_override_reset(void)
+{
+  dynamic_key_override_t ko = {0, };
+
+  qmkLock();
+  for (uint8_t i=0; i<DYNAMIC_KEY_OVERRIDE_COUNT; i++)
+  {
+    dynamic_key_override_set(i, &ko);
+  }
+  eeprom_update_byte((uint8_t *)DYNAMIC_KEY_OVERRIDE_EEPROM_ADDR, DYNAMIC_KO_MAGIC >> 8);
+  eeprom_update_byte((uint8_t *)(DYNAMIC_KEY_OVERRIDE_EEPROM_ADDR + 1), DYNAMIC_KO_MAGIC & 0xFF);
+  qmkUnlock();
+}
+
+bool dynamic_key_override_get(uint8_t index, dynamic_key_override_t *p_ko)
+{
+  if (index >= DYNAMIC_KEY_OVERRIDE_COUNT)
+  {
+    return false;
+  }
+  *p_ko = ko_cfg[index];
+  return true;
+}
+
+bool dynamic_key_override_set(uint8_t index, const dynamic_key_override_t *p_ko)
+{
+  uint8_t buf[DYNAMIC_KO_SLOT_SIZE];
+
+  if (index >= DYNAMIC_KEY_OVERRIDE_COUNT)
+  {
+    return false;
+  }
+
+  // VIA(USB) / CLI 스레드에서 호출되므로 override 처리(qmkUpdate)와 겹치지 않게 lock
+  // 눌려 있는 슬롯이면 먼저 해제 (replacement 가 바뀌면 release 때 다른 키를 해제하게 됨)
+  qmkLock();
+  key_override_deactivate(&ko_list[index]);
+  ko_cfg[index] = *p_ko;
+  dynamic_key_override_apply(index);
+  key_override_index_invalidate();
+  qmkUnlock();
+
+  buf[0] = p_ko->enable ? 0x01 : 0x00;
+  buf[1] = p_ko->trigger >> 8;
+  buf[2] = p_ko->trigger & 0xFF;
+  buf[3] = p_ko->trigger_mods;
+  buf[4] = p_ko->layers;
+  buf[5] = p_ko->negative_mods;
+  buf[6] = p_ko->suppressed_mods;
+  buf[7] = p_ko->replacement >> 8;
+  buf[8] = p_ko->replacement & 0xFF;
+  buf[9] = p_ko->options;
+  eeprom_update_block(buf, (void *)DYNAMIC_KO_SLOT_ADDR(index), sizeof(buf));
+  return true;
+}
+
+// off 는 눌려 있는 override 를 해제하므로 QMK 스레드와 겹치지 않게 lock
+static void dynamic_key_override_enable(bool enable)
+{
+  qmkLock();
+  if (enable)
+    key_override_on();
+  else
+    key_override_off();
+  qmkUnlock();
+}
+
+static uint8_t dynamic_key_override_used(void)
+{
+  uint8_t used = 0;
+
+  for (uint8_t i=0; i<DYNAMIC_KEY_OVERRIDE_COUNT; i++)
+  {
+    if (ko_cfg[i].enable)
+      used++;
+  }
+  return used;
+}
+
+void via_qmk_key_override_command(uint8_t *data, uint8_t length)
+{
+  // data = [ command_id, channel_id, value_id, value_data ]
+  uint8_t *command_id        = &(data[0]);
+  uint8_t *value_id_and_data = &(data[2]);
+
+  switch (*command_id)
+  {
+    case id_custom_set_value:
+      {
+        via_qmk_key_override_set_value(value_id_and_data);
+        break;
+      }
+    case id_custom_get_value:
+      {
+        via_qmk_key_override_get_value(value_id_and_data);
+        break;
+      }
+    case id_custom_save:
+      {
+        // set 할 때 바로 EEPROM 에 반영된다
+        break;
+      }
+    default:
+      {
+        *command_id = id_unhandled;
+        break;
+      }
+  }
+}
+
+void via_qmk_key_override_get_value(uint8_t *data)
+{
+  // data = [ value_id, value_data ]
+  uint8_t *value_id   = &(data[0]);
+  uint8_t *value_data = &(data[1]);
+
+  switch (*value_id)
+  {
+    case id_qmk_key_override_enable:
+      {
+        value_data[0] = key_override_is_enabled();
+        break;
+      }
+    case id_qmk_key_override_count:
+      {
+        value_data[0] = dynamic_key_override_used();
+        value_data[1] = DYNAMIC_KEY_OVERRIDE_COUNT;
+        break;
+      }
+    case id_qmk_key_override_entry:
+      {
+        dynamic_key_override_t ko;
+
+        if (!dynamic_key_override_get(value_data[0], &ko))
+        {
+          *value_id = id_unhandled;
+          break;
+        }
+        value_data[1]  = ko.enable;
+        value_data[2]  = ko.trigger >> 8;
+        value_data[3]  = ko.trigger & 0xFF;
+        value_data[4]  = ko.trigger_mods;
+        value_data[5]  = ko.layers;
+        value_data[6]  = ko.negative_mods;
+        value_data[7]  = ko.suppressed_mods;
+        value_data[8]  = ko.replacement >> 8;
+        value_data[9]  = ko.replacement & 0xFF;
+        value_data[10] = ko.options;
+        break;
+      }
+  }
+}
+
+void via_qmk_key_override_set_value(uint8_t *data)
+{
+  // data = [ value_id, value_data ]
+  uint8_t *value_id   = &(data[0]);
+  uint8_t *value_data = &(data[1]);
+
+  switch (*value_id)
+  {
+    case id_qmk_key_override_enable:
+      {
+        dynamic_key_override_enable(value_data[0]);
+        break;
+      }
+    case id_qmk_key_override_entry:
+      {
+        dynamic_key_override_t ko;
+
+        ko.enable          = value_data[1] & 0x01;
+        ko.trigger         = (value_data[2] << 8) | value_data[3];
+        ko.trigger_mods    = value_data[4];
+        ko.layers          = value_data[5];
+        ko.negative_mods   = value_data[6];
+        ko.suppressed_mods = value_data[7];
+        ko.replacement     = (value_data[8] << 8) | value_data[9];
+        ko.options         = value_data[10];
+
+        if (!dynamic_key_override_set(value_data[0], &ko))
+        {
+          *value_id = id_unhandled;
+        }
+        break;
+      }
+  }
+}
+
+void cliKeyOverride(cli_args_t *args)
+{
+  bool ret = false;
+
+
+  if (args->argc == 1 && args->isStr(0, "info"))
+  {
+    cliPrintf("enable : %s\n", key_override_is_enabled() ? "on" : "off");
+    cliPrintf("used   : %d/%d\n", dynamic_key_override_used(), DYNAMIC_KEY_OVERRIDE_COUNT);
+    ret = true;
+  }
+
+  if (args->argc == 1 && args->isStr(0, "list"))
+  {
+    for (uint8_t i=0; i<DYNAMIC_KEY_OVERRIDE_COUNT; i++)
+    {
+      dynamic_key_override_t *p_ko = &ko_cfg[i];
+
+      if (!p_ko->enable)
+        continue;
+
+      cliPrintf("%2d : 0x%02X+0x%04X -> 0x%04X, layers 0x%02X, neg 0x%02X, supp 0x%02X, opt 0x%02X\n",
+                i, p_ko->trigger_mods, p_ko->trigger, p_ko->replacement,
+                p_ko->layers, p_ko->negative_mods, p_ko->suppressed_mods, p_ko->options);
+    }
+    ret = true;
+  }
+
+  if (args->argc >= 5 && args->argc <= 9 && args->isStr(0, "set"))
+  {
+    uint8_t index = args->getData(1);
+    dynamic_key_override_t ko;
+
+    ko.enable          = true;
+    ko.trigger         = args->getData(2);
+    ko.replacement     = args->getData(3);
+    ko.trigger_mods    = args->getData(4);
+    ko.layers          = args->argc > 5 ? args->getData(5) : 0xFF;
+    ko.negative_mods   = args->argc > 6 ? args->getData(6) : 0;
+    ko.suppressed_mods = args->argc > 7 ? args->getData(7) : ko.trigger_mods;
+    ko.options         = args->argc > 8 ? args->getData(8) : ko_options_default;
+
+    if (dynamic_key_override_set(index, &ko))
+      cliPrintf("ko %d set\n", index);
+    else
+      cliPrintf("ko index 0~%d\n", DYNAMIC_KEY_OVERRIDE_COUNT - 1);
+    ret = true;
+  }
+
+  if (args->argc == 2 && args->isStr(0, "del"))
+  {
+    uint8_t index = args->getData(1);
+    dynamic_key_override_t ko = {0, };
+
+    if (dynamic_key_override_set(index, &ko))
+      cliPrintf("ko %d deleted\n", index);
+    else
+      cliPrintf("ko index 0~%d\n", DYNAMIC_KEY_OVERRIDE_COUNT - 1);
+    ret = true;
+  }
+
+  if (args->argc == 1 && (args->isStr(0, "on") || args->isStr(0, "off")))
+  {
+    dynamic_key_override_enable(args->isStr(0, "on"));
+    cliPrintf("enable : %s\n", key_override_is_enabled() ? "on" : "off");
+    ret = true;
+  }
+
+  if (args->argc == 1 && args->isStr(0, "reset"))
+  {
+    dynamic_key_override_reset();
+    cliPrintf("ko reset\n");
+    ret = true;
+  }
+
+  if (ret == false)
+  {
+    cliPrintf("ko info\n");
+    cliPrintf("ko list\n");
+    cliPrintf("ko set idx trigger replacement mods [layers negmods suppressed options]\n");
+    cliPrintf("ko del idx\n");
+    cliPrintf("ko on|off\n");
+    cliPrintf("ko reset\n");
+  }
+}
+
+#endif
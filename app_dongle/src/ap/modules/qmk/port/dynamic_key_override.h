@@ -0,0 +1,25 @@
+#pragma once
+
+#include "quantum.h"
+
+
+
+// EEPROM 에 저장된 key override (VIA/CLI 에서 편집)
+typedef struct
+{
+  bool     enable;
+  uint16_t trigger;
+  uint8_t  trigger_mods;
+  uint8_t  layers;
+  uint8_t  negative_mods;
+  uint8_t  suppressed_mods;
+  uint16_t replacement;
+  uint8_t  options;
+} dynamic_key_override_t;
+
+
+void dynamic_key_override_init(void);
+void dynamic_key_override_reset(void);
+bool dynamic_key_override_get(uint8_t index, dynamic_key_override_t *p_ko);
+bool dynamic_key_override_set(uint8_t index, const dynamic_key_override_t *p_ko);
+void via_qmk_key_override_command(uint8_t *data, uint8_t length);
@@ -52,6 +52,21 @@ matrix_row_t matrix_get_row(uint8_t row)
   return matrix[row];
 }
 
+#ifdef MATRIX_EVENT_TIME
+// RF 지연과 debounce 로 늦게 처리되어도 하프가 스캔한 시간으로 tap/hold 를 판단한다
+uint16_t matrix_event_time(uint8_t row, uint8_t col)
+{
+  return (uint16_t)key_protocol_get_key_time(row, col);
+}
+
+#ifdef EVENT_TIME_US
+fast_timer_t matrix_event_time_us(uint8_t row, uint8_t col)
+{
+  return key_protocol_get_key_time_us(row, col);
+}
+#endif
+#endif
+
 uint8_t matrix_scan(void)
 {
   matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
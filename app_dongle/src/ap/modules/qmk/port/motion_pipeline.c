@@ -0,0 +1,746 @@
+#include "motion_pipeline.h"
+#include "my_key_protocol.h"
+#include "hw.h"
+#include "qmk.h"
+#include <stdlib.h>
+
+#ifdef POINTING_DEVICE_ENABLE
+
+
+#define MOTION_CONFIG_MAGIC             0x4D51
+
+// EEPROM : [magic(2), curve x(12), curve y(12), smoothing, div(4), scroll snap, layer mode(8)]
+#define MOTION_CONFIG_DATA_SIZE         (2 + 2 * MOTION_CURVE_POINTS * 2 + 1 + MOTION_MODE_MAX + 1 + MOTION_LAYER_MAX)
+
+#define MOTION_GAIN_MAX                 2048      // 8.0 (Q8 곱셈이 int32 를 넘지 않는 범위)
+#define MOTION_SMOOTHING_MAX            224
+#define MOTION_DIV_MIN                  1
+#define MOTION_DIV_MAX                  100
+#define MOTION_DELTA_MAX                2047      // PMW3610 delta 는 12bit
+#define MOTION_IDLE_RESET_MS            100       // 프레임이 이만큼 끊기면 EMA/나머지를 비운다
+#define MOTION_CARET_PENDING_MAX        8         // 보내지 못하고 쌓아두는 축별 방향키 수
+
+_Static_assert(MOTION_PIPELINE_EEPROM_SIZE >= MOTION_CONFIG_DATA_SIZE, "MOTION_PIPELINE_EEPROM_SIZE too small");
+
+
+enum via_qmk_motion_value {
+    id_qmk_motion_curve       = 1,   // [axis(0 : x, 1 : y), point 0~5, gain(2)] (get 은 axis, point 를 주면 gain 을 채움)
+    id_qmk_motion_smoothing   = 2,   // [0~224, 0 : off]
+    id_qmk_motion_div         = 3,   // [mode, 1~100] (get 은 mode 를 주면 div 를 채움)
+    id_qmk_motion_scroll_snap = 4,   // [0 : off, 1 : on]
+    id_qmk_motion_layer_mode  = 5,   // [layer, mode] (get 은 layer 를 주면 mode 를 채움)
+    id_qmk_motion_mode        = 6,   // [mode] (get, 현재 모드)
+};
+
+enum
+{
+  SNAP_AXIS_NONE = 0,
+  SNAP_AXIS_X,
+  SNAP_AXIS_Y,
+};
+
+typedef struct
+{
+  uint32_t frames;
+  uint32_t cycle_last;
+  uint32_t cycle_min;
+  uint32_t cycle_max;
+  uint32_t cycle_sum;
+} motion_stats_t;
+
+
+static void via_qmk_motion_get_value(uint8_t *data);
+static void via_qmk_motion_set_value(uint8_t *data);
+static void cliMotion(cli_args_t *args);
+
+
+static const motion_config_t motion_default =
+{
+  .curve       = {{256, 256, 256, 256, 256, 256},
+                  {256, 256, 256, 256, 256, 256}},
+  .smoothing   = 0,
+  .div         = {1, 4, 10, 20},
+  .scroll_snap = 1,
+  .layer_mode  = {MOTION_MODE_NORMAL},
+};
+
+static const char *mode_name[MOTION_MODE_MAX] = {"normal", "precision", "scroll", "caret"};
+
+// 모드 키 : 뒤에 있는 키가 우선 (KC_MS_BTN8 은 호스트에도 버튼 8 로 보냄)
+static const uint16_t mode_key[]      = {KC_MS_BTN8,         MOTION_KEY_PRECISION,    MOTION_KEY_SCROLL,  MOTION_KEY_CARET};
+static const uint8_t  mode_key_mode[] = {MOTION_MODE_SCROLL, MOTION_MODE_PRECISION,   MOTION_MODE_SCROLL, MOTION_MODE_CARET};
+
+// 방향키 : [x, y][음, 양]
+static const uint8_t caret_key[2][2] = {{KC_LEFT, KC_RIGHT}, {KC_UP, KC_DOWN}};
+
+// gain 커브의 속도 구간 (count/frame, Q8) 과 구간 폭의 shift (폭이 2의 거듭제곱이라 나눗셈 없이 보간)
+static const int32_t curve_speed[MOTION_CURVE_POINTS]     = {0 << 8, 2 << 8, 4 << 8, 8 << 8, 16 << 8, 32 << 8};
+static const uint8_t curve_shift[MOTION_CURVE_POINTS - 1] = {9, 9, 10, 11, 12};
+
+static motion_config_t motion_cfg;
+static motion_stats_t  motion_stats;
+
+static uint8_t  mode        = MOTION_MODE_NORMAL;
+static uint8_t  mode_layer  = 0;        // 가장 위에 켜진 레이어
+static uint8_t  mode_keys   = 0;        // 누르고 있는 모드 키 (mode_key[] 의 bit)
+static uint32_t frame_time  = 0;
+static int32_t  ema[2];                         // 부드럽게 만든 delta (Q8)
+static int32_t  remain[MOTION_MODE_MAX][2];     // 모드별로 내보내지 못한 나머지 (Q8)
+static uint8_t  snap_axis   = SNAP_AXIS_NONE;
+
+static bool     is_out = false;
+static int32_t  out_xy[2];
+static int32_t  out_hv[2];
+static int32_t  out_caret[2];
+static uint8_t  caret_pressed = KC_NO;
+
+
+
+
+static void motion_state_clear(void)
+{
+  ema[0] = 0;
+  ema[1] = 0;
+  memset(remain, 0, sizeof(remain));
+  snap_axis = SNAP_AXIS_NONE;
+}
+
+static void motion_stats_clear(void)
+{
+  memset(&motion_stats, 0, sizeof(motion_stats));
+  motion_stats.cycle_min = UINT32_MAX;
+}
+
+static void motion_mode_update(void)
+{
+  uint8_t mode_next = motion_cfg.layer_mode[mode_layer];
+
+  for (int i=0; i<(int)ARRAY_SIZE(mode_key); i++)
+  {
+    if (mode_keys & (1 << i))
+      mode_next = mode_key_mode[i];
+  }
+
+  // 나머지는 모드별로 남겨두고, 축 고정만 새로 잡는다
+  if (mode_next != mode)
+  {
+    snap_axis = SNAP_AXIS_NONE;
+  }
+  mode = mode_next;
+}
+
+static int32_t motion_curve_gain(const uint16_t *curve, int32_t speed)
+{
+  int32_t gain = curve[MOTION_CURVE_POINTS - 1];
+
+  // 속도와 관계없이 모든 구간을 거꾸로 훑어서 처리 시간을 일정하게 유지
+  for (int i = MOTION_CURVE_POINTS - 2; i >= 0; i--)
+  {
+    if (speed < curve_speed[i + 1])
+    {
+      gain = curve[i] + ((((int32_t)curve[i + 1] - curve[i]) * (speed - curve_speed[i])) >> curve_shift[i]);
+    }
+  }
+  return gain;
+}
+
+static void motion_process(int32_t dx, int32_t dy)
+{
+  int32_t  in[2];
+  int32_t  acc[2];
+  int32_t  alpha    = MOTION_GAIN_ONE - motion_cfg.smoothing;
+  int32_t  step     = motion_cfg.div[mode] * MOTION_GAIN_ONE;
+  int32_t *p_remain = remain[mode];
+  int32_t *p_out;
+
+  in[0] = constrain(dx, -MOTION_DELTA_MAX, MOTION_DELTA_MAX) * MOTION_GAIN_ONE;
+  in[1] = constrain(dy, -MOTION_DELTA_MAX, MOTION_DELTA_MAX) * MOTION_GAIN_ONE;
+
+  for (int i=0; i<2; i++)
+  {
+    ema[i] += (in[i] - ema[i]) * alpha / MOTION_GAIN_ONE;
+  }
+
+  switch (mode)
+  {
+    case MOTION_MODE_NORMAL:
+      for (int i=0; i<2; i++)
+      {
+        int32_t speed = ema[i] < 0 ? -ema[i] : ema[i];
+
+        acc[i] = ema[i] * motion_curve_gain(motion_cfg.curve[i], speed) / MOTION_GAIN_ONE + p_remain[i];
+      }
+      p_out = out_xy;
+      break;
+
+    case MOTION_MODE_SCROLL:
+      // 마우스 위로 = 스크롤 아래로 (Y 반전)
+      acc[0] = p_remain[0] + ema[0];
+      acc[1] = p_remain[1] - ema[1];
+      p_out  = out_hv;
+      break;
+
+    default:
+      acc[0] = p_remain[0] + ema[0];
+      acc[1] = p_remain[1] + ema[1];
+      p_out  = mode == MOTION_MODE_CARET ? out_caret : out_xy;
+      break;
+  }
+
+  // 스크롤(snap on)과 방향키는 처음 한 칸만큼 움직인 축으로 고정하고, 프레임이 끊길 때까지 다른 축은 버린다
+  if ((mode == MOTION_MODE_SCROLL && motion_cfg.scroll_snap) || mode == MOTION_MODE_CARET)
+  {
+    if (snap_axis == SNAP_AXIS_NONE && abs(acc[0]) + abs(acc[1]) >= step)
+    {
+      snap_axis = abs(acc[0]) >= abs(acc[1]) ? SNAP_AXIS_X : SNAP_AXIS_Y;
+    }
+    if (snap_axis == SNAP_AXIS_X)
+      acc[1] = 0;
+    if (snap_axis == SNAP_AXIS_Y)
+      acc[0] = 0;
+  }
+
+  for (int i=0; i<2; i++)
+  {
+    int32_t out = acc[i] / step;
+
+    p_remain[i] = acc[i] - out * step;
+    p_out[i]   += out;
+  }
+  if (mode == MOTION_MODE_CARET)
+  {
+    out_caret[0] = constrain(out_caret[0], -MOTION_CARET_PENDING_MAX, MOTION_CARET_PENDING_MAX);
+    out_caret[1] = constrain(out_caret[1], -MOTION_CARET_PENDING_MAX, MOTION_CARET_PENDING_MAX);
+  }
+  is_out = true;
+}
+
+static void motion_caret_send(void)
+{
+  // 누름/뗌을 한 번에 연달아 보내면 엔드포인트가 바빠 뗌 리포트가 빠지므로 호출마다 하나씩 보낸다
+  if (caret_pressed != KC_NO)
+  {
+    unregister_code(caret_pressed);
+    caret_pressed = KC_NO;
+    return;
+  }
+
+  for (int i=0; i<2; i++)
+  {
+    if (out_caret[i] != 0)
+    {
+      int dir = out_caret[i] > 0 ? 1 : 0;
+
+      out_caret[i] += dir ? -1 : 1;
+      caret_pressed = caret_key[i][dir];
+      register_code(caret_pressed);
+      return;
+    }
+  }
+}
+
+// my_key_protocol.c 에서 RF 트랙볼 프레임이 들어올 때마다 호출
+void key_protocol_motion_frame(uint8_t device_id, int16_t x, int16_t y)
+{
+#ifdef _USE_HW_CYCLE
+  uint32_t pre_cycle = cycleGet();
+#endif
+  uint32_t cur_time = timer_read32();
+
+  (void)device_id;
+
+  if (TIMER_DIFF_32(cur_time, frame_time) > MOTION_IDLE_RESET_MS)
+  {
+    motion_state_clear();
+  }
+  frame_time = cur_time;
+
+  motion_process(x, y);
+
+#ifdef _USE_HW_CYCLE
+  uint32_t cycles = cycleGet() - pre_cycle;
+
+  motion_stats.cycle_last = cycles;
+  motion_stats.cycle_min  = MIN(motion_stats.cycle_min, cycles);
+  motion_stats.cycle_max  = MAX(motion_stats.cycle_max, cycles);
+  motion_stats.cycle_sum += cycles;
+#endif
+  motion_stats.frames++;
+}
+
+bool motion_pipeline_read(int32_t *x, int32_t *y, int32_t *h, int32_t *v)
+{
+  // 방향키는 마우스 리포트와 별개로 키보드 리포트로 보낸다
+  if (caret_pressed != KC_NO || out_caret[0] != 0 || out_caret[1] != 0)
+  {
+    motion_caret_send();
+  }
+
+  if (!is_out)
+  {
+    return false;
+  }
+
+  *x = out_xy[0];
+  *y = out_xy[1];
+  *h = out_hv[0];
+  *v = out_hv[1];
+  out_xy[0] = 0;
+  out_xy[1] = 0;
+  out_hv[0] = 0;
+  out_hv[1] = 0;
+  is_out = false;
+  return true;
+}
+
+bool motion_pipeline_process(uint16_t keycode, keyrecord_t *record)
+{
+  for (int i=0; i<(int)ARRAY_SIZE(mode_key); i++)
+  {
+    if (keycode != mode_key[i])
+      continue;
+
+    if (record->event.pressed)
+      mode_keys |= (1 << i);
+    else
+      mode_keys &= ~(1 << i);
+    motion_mode_update();
+
+    return keycode == KC_MS_BTN8;
+  }
+  return true;
+}
+
+void motion_pipeline_set_layer(uint8_t layer)
+{
+  mode_layer = MIN(layer, MOTION_LAYER_MAX - 1);
+  motion_mode_update();
+}
+
+uint8_t motion_pipeline_get_mode(void)
+{
+  return mode;
+}
+
+static void motion_pipeline_save(void)
+{
+  uint8_t buf[MOTION_CONFIG_DATA_SIZE];
+  uint8_t *p_buf = &buf[2];
+
+  buf[0] = MOTION_CONFIG_MAGIC >> 8;
+  buf[1] = MOTION_CONFIG_MAGIC & 0xFF;
+  for (int axis=0; axis<2; axis++)
+  {
+    for (int i=0; i<MOTION_CURVE_POINTS; i++)
+    {
+      *p_buf++ = motion_cfg.curve[axis][i] >> 8;
+      *p_buf++ = motion_cfg.curve[axis][i] & 0xFF;
+    }
+  }
+  *p_buf++ = motion_cfg.smoothing;
+  memcpy(p_buf, motion_cfg.div, MOTION_MODE_MAX);
+  p_buf += MOTION_MODE_MAX;
+  *p_buf++ = motion_cfg.scroll_snap;
+  memcpy(p_buf, motion_cfg.layer_mode, MOTION_LAYER_MAX);
+  eeprom_update_block(buf, (void *)MOTION_PIPELINE_EEPROM_ADDR, sizeof(buf));
+}
+
+void motion_pipeline_init(void)
+{
+  uint8_t buf[MOTION_CONFIG_DATA_SIZE];
+  motion_config_t cfg;
+  uint8_t *p_buf = &buf[2];
+
+  eeprom_read_block(buf, (const void *)MOTION_PIPELINE_EEPROM_ADDR, sizeof(buf));
+  for (int axis=0; axis<2; axis++)
+  {
+    for (int i=0; i<MOTION_CURVE_POINTS; i++)
+    {
+      cfg.curve[axis][i] = (p_buf[0] << 8) | p_buf[1];
+      p_buf += 2;
+    }
+  }
+  cfg.smoothing = *p_buf++;
+  memcpy(cfg.div, p_buf, MOTION_MODE_MAX);
+  p_buf += MOTION_MODE_MAX;
+  cfg.scroll_snap = *p_buf++;
+  memcpy(cfg.layer_mode, p_buf, MOTION_LAYER_MAX);
+
+  if (((buf[0] << 8) | buf[1]) != MOTION_CONFIG_MAGIC || !motion_pipeline_set(&cfg))
+  {
+    motion_pipeline_reset();
+  }
+  motion_stats_clear();
+
+  cliAdd("motion", cliMotion);
+
+  logPrintf("[ON] MOTION PIPELINE\n");
+}
+
+void motion_pipeline_reset(void)
+{
+  motion_pipeline_set(&motion_default);
+}
+
+void motion_pipeline_get(motion_config_t *p_cfg)
+{
+  *p_cfg = motion_cfg;
+}
+
+bool motion_pipeline_set(const motion_config_t *p_cfg)
+{
+  for (int axis=0; axis<2; axis++)
+  {
+    for (int i=0; i<MOTION_CURVE_POINTS; i++)
+    {
+      if (p_cfg->curve[axis][i] > MOTION_GAIN_MAX)
+        return false;
+    }
+  }
+  for (int i=0; i<MOTION_MODE_MAX; i++)
+  {
+    if (p_cfg->div[i] < MOTION_DIV_MIN || p_cfg->div[i] > MOTION_DIV_MAX)
+      return false;
+  }
+  for (int i=0; i<MOTION_LAYER_MAX; i++)
+  {
+    if (p_cfg->layer_mode[i] >= MOTION_MODE_MAX)
+      return false;
+  }
+  if (p_cfg->smoothing > MOTION_SMOOTHING_MAX || p_cfg->scroll_snap > 1)
+  {
+    return false;
+  }
+
+  // CLI 스레드에서도 호출되므로 QMK 스레드의 motion_process() 와 겹치지 않게 lock
+  qmkLock();
+  motion_cfg = *p_cfg;
+  motion_state_clear();
+  motion_mode_update();
+  motion_pipeline_save();
+  qmkUnlock();
+  return true;
+}
+
+void via_qmk_motion_command(uint8_t *data, uint8_t length)
+{
+  // data = [ command_id, channel_id, value_id, value_data ]
+  uint8_t *command_id        = &(data[0]);
+  uint8_t *value_id_and_data = &(data[2]);
+
+  switch (*command_id)
+  {
+    case id_custom_set_value:
+      {
+        // VIA(USB) 에서 호출되므로 QMK 스레드와 겹치지 않게 lock (현재 설정을 읽고 바꾸는 동안)
+        qmkLock();
+        via_qmk_motion_set_value(value_id_and_data);
+        qmkUnlock();
+        break;
+      }
+    case id_custom_get_value:
+      {
+        via_qmk_motion_get_value(value_id_and_data);
+        break;
+      }
+    case id_custom_save:
+      {
+        // set 할 때 바로 EEPROM 에 반영된다
+        break;
+      }
+    default:
+      {
+        *command_id = id_unhandled;
+        break;
+      }
+  }
+}
+
+void via_qmk_motion_get_value(uint8_t *data)
+{
+  // data = [ value_id, value_data ]
+  uint8_t *value_id   = &(data[0]);
+  uint8_t *value_data = &(data[1]);
+
+  switch (*value_id)
+  {
+    case id_qmk_motion_curve:
+      {
+        if (value_data[0] >= 2 || value_data[1] >= MOTION_CURVE_POINTS)
+        {
+          *value_id = id_unhandled;
+          break;
+        }
+        value_data[2] = motion_cfg.curve[value_data[0]][value_data[1]] >> 8;
+        value_data[3] = motion_cfg.curve[value_data[0]][value_data[1]] & 0xFF;
+        break;
+      }
+    case id_qmk_motion_smoothing:
+      {
+        value_data[0] = motion_cfg.smoothing;
+        break;
+      }
+    case id_qmk_motion_div:
+      {
+        if (value_data[0] >= MOTION_MODE_MAX)
+        {
+          *value_id = id_unhandled;
+          break;
+        }
+        value_data[1] = motion_cfg.div[value_data[0]];
+        break;
+      }
+    case id_qmk_motion_scroll_snap:
+      {
+        value_data[0] = motion_cfg.scroll_snap;
+        break;
+      }
+    case id_qmk_motion_layer_mode:
+      {
+        if (value_data[0] >= MOTION_LAYER_MAX)
+        {
+          *value_id = id_unhandled;
+          break;
+        }
+        value_data[1] = motion_cfg.layer_mode[value_data[0]];
+        break;
+      }
+    case id_qmk_motion_mode:
+      {
+        value_data[0] = mode;
+        break;
+      }
+    default:
+      {
+        *value_id = id_unhandled;
+        break;
+      }
+  }
+}
+
+void via_qmk_motion_set_value(uint8_t *data)
+{
+  // data = [ value_id, value_data ]
+  uint8_t *value_id   = &(data[0]);
+  uint8_t *value_data = &(data[1]);
+  motion_config_t cfg = motion_cfg;
+
+  switch (*value_id)
+  {
+    case id_qmk_motion_curve:
+      {
+        if (value_data[0] >= 2 || value_data[1] >= MOTION_CURVE_POINTS)
+        {
+          *value_id = id_unhandled;
+          return;
+        }
+        cfg.curve[value_data[0]][value_data[1]] = (value_data[2] << 8) | value_data[3];
+        break;
+      }
+    case id_qmk_motion_smoothing:
+      {
+        cfg.smoothing = value_data[0];
+        break;
+      }
+    case id_qmk_motion_div:
+      {
+        if (value_data[0] >= MOTION_MODE_MAX)
+        {
+          *value_id = id_unhandled;
+          return;
+        }
+        cfg.div[value_data[0]] = value_data[1];
+        break;
+      }
+    case id_qmk_motion_scroll_snap:
+      {
+        cfg.scroll_snap = value_data[0];
+        break;
+      }
+    case id_qmk_motion_layer_mode:
+      {
+        if (value_data[0] >= MOTION_LAYER_MAX)
+        {
+          *value_id = id_unhandled;
+          return;
+        }
+        cfg.layer_mode[value_data[0]] = value_data[1];
+        break;
+      }
+    default:
+      {
+        *value_id = id_unhandled;
+        return;
+      }
+  }
+
+  if (!motion_pipeline_set(&cfg))
+  {
+    *value_id = id_unhandled;
+  }
+}
+
+static int cliMotionGetMode(cli_args_t *args, uint8_t index)
+{
+  for (int i=0; i<MOTION_MODE_MAX; i++)
+  {
+    if (args->isStr(index, (char *)mode_name[i]))
+      return i;
+  }
+  return -1;
+}
+
+static void cliMotionPrintCurve(void)
+{
+  cliPrintf("speed      :");
+  for (int i=0; i<MOTION_CURVE_POINTS; i++)
+  {
+    cliPrintf(" %5d", curve_speed[i] >> 8);
+  }
+  cliPrintf(" count/frame\n");
+  for (int axis=0; axis<2; axis++)
+  {
+    cliPrintf("gain %s     :", axis == 0 ? "x" : "y");
+    for (int i=0; i<MOTION_CURVE_POINTS; i++)
+    {
+      cliPrintf(" %2d.%02d", motion_cfg.curve[axis][i] / MOTION_GAIN_ONE,
+                (motion_cfg.curve[axis][i] % MOTION_GAIN_ONE) * 100 / MOTION_GAIN_ONE);
+    }
+    cliPrintf("\n");
+  }
+}
+
+void cliMotion(cli_args_t *args)
+{
+  bool ret = false;
+
+
+  if (args->argc == 1 && args->isStr(0, "info"))
+  {
+    cliMotionPrintCurve();
+    cliPrintf("smoothing  : %d (alpha %d/256)\n", motion_cfg.smoothing, MOTION_GAIN_ONE - motion_cfg.smoothing);
+    cliPrintf("div        :");
+    for (int i=0; i<MOTION_MODE_MAX; i++)
+    {
+      cliPrintf(" %s %d", mode_name[i], motion_cfg.div[i]);
+    }
+    cliPrintf(", scroll snap %s\n", motion_cfg.scroll_snap ? "on" : "off");
+    cliPrintf("layer mode :");
+    for (int i=0; i<MOTION_LAYER_MAX; i++)
+    {
+      cliPrintf(" %d:%s", i, mode_name[motion_cfg.layer_mode[i]]);
+    }
+    cliPrintf("\n");
+    cliPrintf("mode       : %s (layer %d, keys 0x%02X)\n", mode_name[mode], mode_layer, mode_keys);
+    cliPrintf("frames     : %d\n", motion_stats.frames);
+#ifdef _USE_HW_CYCLE
+    if (motion_stats.frames > 0)
+    {
+      cliPrintf("cycles     : last %d, min %d, avg %d, max %d (cpu %d MHz)\n",
+                motion_stats.cycle_last,
+                motion_stats.cycle_min,
+                motion_stats.cycle_sum / motion_stats.frames,
+                motion_stats.cycle_max,
+                cycleGetFreqMhz());
+    }
+#endif
+    ret = true;
+  }
+
+  if (args->argc == 1 && args->isStr(0, "clear"))
+  {
+    motion_stats_clear();
+    cliPrintf("motion stats clear\n");
+    ret = true;
+  }
+
+  if (args->argc == 2 + MOTION_CURVE_POINTS && args->isStr(0, "curve") &&
+      (args->isStr(1, "x") || args->isStr(1, "y")))
+  {
+    motion_config_t cfg = motion_cfg;
+    int axis = args->isStr(1, "x") ? 0 : 1;
+
+    for (int i=0; i<MOTION_CURVE_POINTS; i++)
+    {
+      cfg.curve[axis][i] = args->getData(2 + i);
+    }
+    if (!motion_pipeline_set(&cfg))
+      cliPrintf("gain 0~%d (256 = 1.0)\n", MOTION_GAIN_MAX);
+    cliMotionPrintCurve();
+    ret = true;
+  }
+
+  if (args->argc == 2 && args->isStr(0, "smooth"))
+  {
+    motion_config_t cfg = motion_cfg;
+
+    cfg.smoothing = args->getData(1);
+    if (motion_pipeline_set(&cfg))
+      cliPrintf("smoothing %d\n", motion_cfg.smoothing);
+    else
+      cliPrintf("smoothing 0~%d\n", MOTION_SMOOTHING_MAX);
+    ret = true;
+  }
+
+  if (args->argc == 3 && args->isStr(0, "div") && cliMotionGetMode(args, 1) >= 0)
+  {
+    motion_config_t cfg = motion_cfg;
+    int m = cliMotionGetMode(args, 1);
+
+    cfg.div[m] = args->getData(2);
+    if (motion_pipeline_set(&cfg))
+      cliPrintf("%s div %d\n", mode_name[m], motion_cfg.div[m]);
+    else
+      cliPrintf("div %d~%d\n", MOTION_DIV_MIN, MOTION_DIV_MAX);
+    ret = true;
+  }
+
+  if (args->argc == 2 && args->isStr(0, "snap"))
+  {
+    motion_config_t cfg = motion_cfg;
+
+    cfg.scroll_snap = args->isStr(1, "on") ? 1 : 0;
+    motion_pipeline_set(&cfg);
+    cliPrintf("scroll snap %s\n", motion_cfg.scroll_snap ? "on" : "off");
+    ret = true;
+  }
+
+  if (args->argc == 3 && args->isStr(0, "layer") && cliMotionGetMode(args, 2) >= 0)
+  {
+    motion_config_t cfg = motion_cfg;
+    uint8_t layer = args->getData(1);
+
+    if (layer < MOTION_LAYER_MAX)
+    {
+      cfg.layer_mode[layer] = cliMotionGetMode(args, 2);
+      motion_pipeline_set(&cfg);
+      cliPrintf("layer %d : %s\n", layer, mode_name[motion_cfg.layer_mode[layer]]);
+    }
+    else
+    {
+      cliPrintf("layer 0~%d\n", MOTION_LAYER_MAX - 1);
+    }
+    ret = true;
+  }
+
+  if (args->argc == 1 && args->isStr(0, "reset"))
+  {
+    motion_pipeline_reset();
+    cliPrintf("motion reset\n");
+    ret = true;
+  }
+
+  if (ret == false)
+  {
+    cliPrintf("motion info\n");
+    cliPrintf("motion clear\n");
+    cliPrintf("motion curve x|y g0 g1 g2 g3 g4 g5 (256 = 1.0)\n");
+    cliPrintf("motion smooth 0~%d\n", MOTION_SMOOTHING_MAX);
+    cliPrintf("motion div normal|precision|scroll|caret %d~%d\n", MOTION_DIV_MIN, MOTION_DIV_MAX);
+    cliPrintf("motion snap on|off\n");
+    cliPrintf("motion layer 0~%d normal|precision|scroll|caret\n", MOTION_LAYER_MAX - 1);
+    cliPrintf("motion reset\n");
+  }
+}
+
+#endif
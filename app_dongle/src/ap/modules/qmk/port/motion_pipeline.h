@@ -0,0 +1,49 @@
+#pragma once
+
+#include "quantum.h"
+
+
+
+#define MOTION_CURVE_POINTS       6       // 속도 0, 2, 4, 8, 16, 32 count/frame 에서의 gain
+#define MOTION_GAIN_ONE           256     // gain Q8 (256 = 1.0)
+#define MOTION_LAYER_MAX          DYNAMIC_KEYMAP_LAYER_COUNT
+
+
+// 포인터 모드 : 모드마다 나누는 값(div)과 나머지를 따로 가진다
+enum
+{
+  MOTION_MODE_NORMAL = 0,     // gain 커브 적용 후 div 로 나눔
+  MOTION_MODE_PRECISION,      // 커브 없이 div 로 나눔
+  MOTION_MODE_SCROLL,         // div count 마다 스크롤 한 칸
+  MOTION_MODE_CARET,          // div count 마다 방향키 한 번
+  MOTION_MODE_MAX
+};
+
+// 누르고 있는 동안 해당 모드 (VIA 에서는 Custom 0~2)
+enum motion_keycodes
+{
+  MOTION_KEY_PRECISION = QK_KB_0,
+  MOTION_KEY_SCROLL,
+  MOTION_KEY_CARET,
+};
+
+// 동글에서 RF 트랙볼 프레임마다 처리하는 움직임 설정 (VIA/CLI 에서 편집)
+typedef struct
+{
+  uint16_t curve[2][MOTION_CURVE_POINTS];   // [x, y] 축별 gain (Q8)
+  uint8_t  smoothing;                       // EMA 세기 0~224 (0 : off, alpha = 256 - smoothing)
+  uint8_t  div[MOTION_MODE_MAX];            // 모드별로 출력 1 을 만드는 count
+  uint8_t  scroll_snap;                     // 스크롤을 처음 움직인 축으로 고정
+  uint8_t  layer_mode[MOTION_LAYER_MAX];    // 레이어별 기본 모드
+} motion_config_t;
+
+
+void    motion_pipeline_init(void);
+void    motion_pipeline_reset(void);
+void    motion_pipeline_get(motion_config_t *p_cfg);
+bool    motion_pipeline_set(const motion_config_t *p_cfg);
+bool    motion_pipeline_process(uint16_t keycode, keyrecord_t *record);
+void    motion_pipeline_set_layer(uint8_t layer);
+uint8_t motion_pipeline_get_mode(void);
+bool    motion_pipeline_read(int32_t *x, int32_t *y, int32_t *h, int32_t *v);
+void    via_qmk_motion_command(uint8_t *data, uint8_t length);
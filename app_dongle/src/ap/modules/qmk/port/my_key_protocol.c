@@ -1,6 +1,7 @@
 #include "my_key_protocol.h"
 #include "hw.h"
 #include "pointing_device.h"
+#include "time_sync.h"
 #include <string.h>
 #include <zephyr/kernel.h>
 
@@ -13,6 +14,9 @@
 #define PACKET_TYPE_SYSTEM 0x03
 #define PACKET_TYPE_BATTERY 0x04
 #define PACKET_TYPE_HEARTBEAT 0x05
+#define PACKET_TYPE_POWER_STATE 0xF0
+#define PACKET_TYPE_TIME_SYNC 0xF1
+#define PACKET_TYPE_SENSOR_CONFIG 0xF2
 
 #define HEARTBEAT_TIMEOUT_MS     1500
 #define CONNECTION_CHECK_INTERVAL 500
@@ -35,20 +39,41 @@
 #define RIGHT_COLS 1
 #endif // RIGHT_COLS
 
-// Buffer for storing received data
-static uint8_t rx_buffer[MAX_PACKET_SIZE];
+// RX stream buffer
+// ESB 수신 ISR 이 payload 를 qbuffer 에 이어 붙이므로 한 번에 여러 프레임이 올 수 있다.
+// 프레임 경계에서 잘린 나머지를 다음 읽기까지 보관하기 위해 최대 패킷 2개 크기를 사용한다.
+#define RX_STREAM_SIZE (MAX_PACKET_SIZE * 2)
+
+static uint8_t rx_stream[RX_STREAM_SIZE];
+static uint32_t rx_stream_len = 0;
 
 // Forward declarations
-static bool parse_packet(void);
-static bool validate_checksum(uint8_t *data, uint32_t length);
-static void process_key_data(uint8_t device_id, uint8_t *payload, uint8_t length);
-static void process_trackball_data(uint8_t device_id, uint8_t *payload, uint8_t length);
-static void process_heartbeat_data(uint8_t device_id, uint8_t *payload, uint8_t length);
+static key_protocol_rx_t parse_packet(const uint8_t *packet, uint32_t length);
+static bool validate_checksum(const uint8_t *data, uint32_t length);
+static key_protocol_rx_t process_key_data(uint8_t device_id, const uint8_t *payload, uint8_t length);
+static key_protocol_rx_t process_trackball_data(uint8_t device_id, const uint8_t *payload, uint8_t length);
+static key_protocol_rx_t process_heartbeat_data(uint8_t device_id, const uint8_t *payload, uint8_t length);
+static void capture_packet(const uint8_t *packet, uint32_t length);
+static void rx_error(key_protocol_rx_t err);
+static bool ack_payload_update(void);
 static void cli_command(cli_args_t *args);
 
 // Debugging and statistics
 static uint32_t tx_errors = 0;
-static uint32_t rx_errors = 0;
+static key_protocol_rx_stats_t rx_stats;
+static bool is_capture = false;
+
+static const char *key_protocol_rx_name[KEY_PROTOCOL_RX_MAX] =
+{
+    "ok",
+    "start",
+    "length",
+    "truncated",
+    "checksum",
+    "type",
+    "payload",
+    "device",
+};
 
 // TX 관련 버퍼 및 변수
 static uint8_t tx_buffer[MAX_PACKET_SIZE];
@@ -57,6 +82,25 @@ static uint32_t tx_packets = 0;
 // 내부 Matrix 버퍼
 static uint8_t rx_matrix[MATRIX_COLS] = {0};
 
+// 키가 바뀐 시간 (동글 micros 기준)
+// 키 프레임에 하프의 스캔 시간이 있으면 그 시간으로, 없으면 수신 시간으로 기록
+static uint32_t rx_key_time_us[8][MATRIX_COLS];
+
+// 지금 처리 중인 프레임의 수신 시간 (micros)
+static uint32_t rx_time_us = 0;
+static uint32_t rx_count = 0;
+
+// ACK 페이로드로 하프에 돌려주는 상태 : 호스트 전원 상태 + 하프별 마지막 heartbeat 의 수신 시간
+static uint8_t ack_power_state = KEY_PROTOCOL_POWER_ACTIVE;
+static uint8_t ack_time_sync_seq[2];
+static uint32_t ack_time_sync_rx[2];
+
+// 트랙볼 센서 설정 : 하프가 heartbeat 로 알려준 gen 이 다르면 TIME_SYNC 대신 ACK 페이로드에 싣는다
+// (ACK 페이로드 최대 30 byte 에 세 프레임을 함께 실을 수 없음)
+static key_protocol_sensor_config_t ack_sensor_config;
+static uint8_t ack_sensor_gen[2];
+static bool is_ack_sensor_gen[2];
+
 // Trackball movement
 int32_t x_movement = 0;
 int32_t y_movement = 0;
@@ -105,6 +149,11 @@ bool key_protocol_init(void)
         return false;
     }
 
+    time_sync_init();
+
+    // ACK 페이로드로 호스트 전원 상태를 하프에 전달
+    key_protocol_set_power_state(KEY_PROTOCOL_POWER_ACTIVE);
+
     // Register CLI command for debugging
     cliAdd("keyproto", cli_command);
 
@@ -113,37 +162,43 @@ bool key_protocol_init(void)
 
 void key_protocol_update(void)
 {
-    uint32_t rx_len = rfAvailable();
-    bool is_error = false;
-    // Check if RF has data available
-    if (rx_len > 0)
-    {
-        if (rx_len > MAX_PACKET_SIZE)
-            is_error = true;
-
-        if (!rfRead(rx_buffer, rx_len))
-            is_error = true;
+    uint32_t rx_len;
 
-        // Basic validation
-        if (rx_buffer[0] != START_BYTE)
-            is_error = true;
-
-        // Checksum validation
-        if (!validate_checksum(rx_buffer, rx_len))
-            is_error = true;
+    while ((rx_len = rfAvailable()) > 0)
+    {
+        uint32_t used;
+        uint32_t count;
+        uint32_t count_after;
+        uint32_t time_us = rfGetRxTime(&count);
 
+        if (rx_len > RX_STREAM_SIZE - rx_stream_len)
+            rx_len = RX_STREAM_SIZE - rx_stream_len;
 
-        if (is_error)
+        // rfRead() 는 요청한 길이를 모두 읽었는지만 반환
+        if (!rfRead(&rx_stream[rx_stream_len], rx_len))
         {
-            rx_errors++;
             rfBufferFlush();
+            rx_error(KEY_PROTOCOL_RX_ERR_TRUNCATED);
+            break;
         }
-        else
-        {
-            // Parse the packet
-            parse_packet();
-        }
+        rx_stream_len += rx_len;
 
+        // 지난번 이후 패킷이 하나만 들어왔으면 ISR 에서 기록한 수신 시간을 쓰고,
+        // 여러 개면 어느 프레임의 시간인지 알 수 없으므로 지금 시간을 쓴다
+        rfGetRxTime(&count_after);
+        rx_time_us = (count - rx_count == 1 && count_after == count) ? time_us : micros();
+        rx_count = count_after;
+
+        used = key_protocol_rx_process(rx_stream, rx_stream_len, false);
+        rx_stream_len -= used;
+        memmove(rx_stream, &rx_stream[used], rx_stream_len);
+    }
+
+    // ISR 은 payload 단위로 쓰므로 남은 바이트는 더 이어지지 않는다 (qbuffer overflow 등)
+    if (rx_stream_len > 0)
+    {
+        key_protocol_rx_process(rx_stream, rx_stream_len, true);
+        rx_stream_len = 0;
     }
 
     uint32_t current_time = millis();
@@ -159,8 +214,7 @@ void key_protocol_update(void)
             if (state->connected && (current_time - state->last_time > HEARTBEAT_TIMEOUT_MS))
             {
                 state->connected = false;
-                // logPrintf("Device 0x%02X disconnected (no heartbeat %ums)\n",
-                //           state->device_id, current_time - state->last_time);
+                evtlogWrite(EVT_RF_DISCONNECT, state->device_id, current_time - state->last_time);
                 if (state->device_id == DEVICE_ID_LEFT)
                 {
                     memset(&rx_matrix[0], 0, LEFT_COLS);
@@ -173,6 +227,9 @@ void key_protocol_update(void)
                 x_movement = 0;
                 y_movement = 0;
                 is_moving = false;
+
+                // 다시 연결되면 heartbeat 의 gen 으로 다시 확인
+                is_ack_sensor_gen[i] = false;
             }
         }
         
@@ -180,44 +237,136 @@ void key_protocol_update(void)
     }
 }
 
-static bool parse_packet(void)
+uint32_t key_protocol_rx_process(const uint8_t *data, uint32_t length, bool is_last)
+{
+    uint32_t index = 0;
+
+    while (index < length)
+    {
+        uint32_t remain = length - index;
+        uint32_t packet_length;
+        key_protocol_rx_t result;
+
+        if (data[index] != START_BYTE)
+        {
+            // 다음 시작 바이트까지 건너뛰어 프레임 동기를 다시 맞춘다
+            rx_error(KEY_PROTOCOL_RX_ERR_START);
+            while (index < length && data[index] != START_BYTE)
+            {
+                index++;
+                rx_stats.drop_bytes++;
+            }
+            continue;
+        }
+
+        if (remain < HEADER_SIZE)
+        {
+            // 나머지는 다음 읽기에서 이어진다
+            if (!is_last)
+                break;
+            rx_error(KEY_PROTOCOL_RX_ERR_TRUNCATED);
+            index++;
+            rx_stats.drop_bytes++;
+            continue;
+        }
+
+        if (data[index + 4] > MAX_PAYLOAD)
+        {
+            rx_error(KEY_PROTOCOL_RX_ERR_LENGTH);
+            index++;
+            rx_stats.drop_bytes++;
+            continue;
+        }
+
+        packet_length = HEADER_SIZE + data[index + 4] + FOOTER_SIZE;
+
+        if (remain < packet_length)
+        {
+            if (!is_last)
+                break;
+            rx_error(KEY_PROTOCOL_RX_ERR_TRUNCATED);
+            index++;
+            rx_stats.drop_bytes++;
+            continue;
+        }
+
+        if (is_capture)
+            capture_packet(&data[index], packet_length);
+
+        if (!validate_checksum(&data[index], packet_length))
+        {
+            // payload 안의 0xAA 에서 다시 동기를 맞출 수 있도록 1바이트만 건너뛴다
+            rx_error(KEY_PROTOCOL_RX_ERR_CHECKSUM);
+            index++;
+            rx_stats.drop_bytes++;
+            continue;
+        }
+
+        result = parse_packet(&data[index], packet_length);
+        if (result == KEY_PROTOCOL_RX_OK)
+            rx_stats.frames++;
+        else
+            rx_stats.errors[result]++;
+        evtlogWrite(EVT_RF_RX, EVTLOG_U8X2(data[index + 1], data[index + 3]), EVTLOG_U16X2(result, data[index + 4]));
+
+        index += packet_length;
+    }
+
+    return index;
+}
+
+// 프레임 단위 오류 (parse_packet 이전) : 통계와 이벤트 로그에 같이 남긴다
+static void rx_error(key_protocol_rx_t err)
+{
+    rx_stats.errors[err]++;
+    evtlogWrite(EVT_RF_ERR, err, rx_stats.drop_bytes);
+}
+
+void key_protocol_get_rx_stats(key_protocol_rx_stats_t *stats)
+{
+    *stats = rx_stats;
+}
+
+void key_protocol_clear_rx_stats(void)
+{
+    memset(&rx_stats, 0, sizeof(rx_stats));
+}
+
+static key_protocol_rx_t parse_packet(const uint8_t *packet, uint32_t length)
 {
     // Extract packet info
-    uint8_t device_id = rx_buffer[1];
-    // uint8_t version = rx_buffer[2];
-    uint8_t packet_type = rx_buffer[3];
-    uint8_t payload_length = rx_buffer[4];
-    uint8_t *payload = &rx_buffer[5];
+    uint8_t device_id = packet[1];
+    // uint8_t version = packet[2];
+    uint8_t packet_type = packet[3];
+    uint8_t payload_length = packet[4];
+    const uint8_t *payload = &packet[HEADER_SIZE];
+
+    (void)length;
 
     // Process based on packet type
     switch (packet_type)
     {
     case PACKET_TYPE_KEY:
-        process_key_data(device_id, payload, payload_length);
-        break;
+        return process_key_data(device_id, payload, payload_length);
 
     case PACKET_TYPE_TRACKBALL:
-        process_trackball_data(device_id, payload, payload_length);
-        break;
+        return process_trackball_data(device_id, payload, payload_length);
 
     case PACKET_TYPE_SYSTEM:
     case PACKET_TYPE_BATTERY:
         // Not implemented yet
-        break;
+        return KEY_PROTOCOL_RX_OK;
 
     case PACKET_TYPE_HEARTBEAT:
-        process_heartbeat_data(device_id, payload, payload_length);
-        break;
+        return process_heartbeat_data(device_id, payload, payload_length);
 
     default:
         // Unknown packet type
-        return false;
+        return KEY_PROTOCOL_RX_ERR_TYPE;
     }
-
-    return true;
 }
 
-static bool validate_checksum(uint8_t *data, uint32_t length)
+static bool validate_checksum(const uint8_t *data, uint32_t length)
 {
     if (length < 2)
     {
@@ -236,32 +385,83 @@ static bool validate_checksum(uint8_t *data, uint32_t length)
     return (checksum == data[length - 1]);
 }
 
-static void process_key_data(uint8_t device_id, uint8_t *payload, uint8_t length)
+static key_protocol_rx_t process_key_data(uint8_t device_id, const uint8_t *payload, uint8_t length)
 {
+    if (length < 1)
+    {
+        return KEY_PROTOCOL_RX_ERR_PAYLOAD;
+    }
+
     // 첫 바이트는 컬럼 수
     uint8_t cols_length = payload[0];
+    uint8_t col_offset;
+    uint32_t key_time_us = micros();
+    uint32_t rx_age_us = key_time_us - rx_time_us;
 
-    if(length < 1 + cols_length)
+    if (cols_length > length - 1)
     {
-        return;
+        return KEY_PROTOCOL_RX_ERR_PAYLOAD;
+    }
+
+    // 컬럼 뒤에 4바이트가 더 있으면 하프의 스캔 시간 (us, little-endian)
+    if (length >= 1 + cols_length + 4 && (device_id == DEVICE_ID_LEFT || device_id == DEVICE_ID_RIGHT))
+    {
+        const uint8_t *p_time = &payload[1 + cols_length];
+        uint32_t scan_time_us = (uint32_t)p_time[0] | ((uint32_t)p_time[1] << 8) | ((uint32_t)p_time[2] << 16) | ((uint32_t)p_time[3] << 24);
+
+        uint32_t delay_us = time_sync_update(device_id - DEVICE_ID_LEFT, scan_time_us, rx_time_us);
+
+        if ((int32_t)rx_age_us < 0)
+            rx_age_us = 0;
+        key_time_us -= rx_age_us + delay_us;
     }
 
     if (device_id == DEVICE_ID_LEFT)
     {
         if (cols_length > LEFT_COLS)
             cols_length = LEFT_COLS;
-        memcpy(&rx_matrix[0], &payload[1], cols_length);
+        col_offset = 0;
     }
     else if (device_id == DEVICE_ID_RIGHT)
     {
         if (cols_length > RIGHT_COLS)
             cols_length = RIGHT_COLS;
-        memcpy(&rx_matrix[LEFT_COLS], &payload[1], cols_length);
+        col_offset = LEFT_COLS;
     }
     else
     {
-        return;
+        return KEY_PROTOCOL_RX_ERR_DEVICE;
+    }
+
+    for (uint8_t col = 0; col < cols_length; col++)
+    {
+        uint8_t changed = rx_matrix[col_offset + col] ^ payload[1 + col];
+
+        for (uint8_t row = 0; changed != 0; row++, changed >>= 1)
+        {
+            if (changed & 0x01)
+            {
+                rx_key_time_us[row][col_offset + col] = key_time_us;
+            }
+        }
     }
+    memcpy(&rx_matrix[col_offset], &payload[1], cols_length);
+
+    return KEY_PROTOCOL_RX_OK;
+}
+
+uint32_t key_protocol_get_key_time(uint8_t row, uint8_t col)
+{
+    return millis() - (micros() - key_protocol_get_key_time_us(row, col)) / 1000;
+}
+
+uint32_t key_protocol_get_key_time_us(uint8_t row, uint8_t col)
+{
+    if (row >= 8 || col >= MATRIX_COLS)
+    {
+        return micros();
+    }
+    return rx_key_time_us[row][col];
 }
 
 void RfKeysReadBuf(uint8_t *buf, uint32_t len)
@@ -269,12 +469,16 @@ void RfKeysReadBuf(uint8_t *buf, uint32_t len)
     memcpy(buf, rx_matrix, len);
 }
 
-static void process_trackball_data(uint8_t device_id, uint8_t *payload, uint8_t length)
+static key_protocol_rx_t process_trackball_data(uint8_t device_id, const uint8_t *payload, uint8_t length)
 {
     // Make sure we have enough data for X and Y (2 bytes each)
     if (length < 4)
     {
-        return;
+        return KEY_PROTOCOL_RX_ERR_PAYLOAD;
+    }
+    if (device_id != DEVICE_ID_LEFT && device_id != DEVICE_ID_RIGHT)
+    {
+        return KEY_PROTOCOL_RX_ERR_DEVICE;
     }
 
     // 부호 있는 16비트 정수로 올바르게 변환 (little-endian)
@@ -283,16 +487,29 @@ static void process_trackball_data(uint8_t device_id, uint8_t *payload, uint8_t
     int16_t y_val = (int16_t)((payload[3] << 8) | payload[2]);
 
     // 값을 int32_t로 저장하되, 부호 확장이 올바르게 처리되도록 함
-    x_movement = (int32_t)x_val;
-    y_movement = (int32_t)y_val;
+    // 읽기 전에 여러 프레임이 들어오면 움직임을 누적한다
+    if (is_moving)
+    {
+        x_movement += (int32_t)x_val;
+        y_movement += (int32_t)y_val;
+    }
+    else
+    {
+        x_movement = (int32_t)x_val;
+        y_movement = (int32_t)y_val;
+    }
     is_moving = true;
+
+    key_protocol_motion_frame(device_id, x_val, y_val);
+
+    return KEY_PROTOCOL_RX_OK;
 }
 
-static void process_heartbeat_data(uint8_t device_id, uint8_t *payload, uint8_t length)
+static key_protocol_rx_t process_heartbeat_data(uint8_t device_id, const uint8_t *payload, uint8_t length)
 {
     if (length < 2u)
     {
-        return;
+        return KEY_PROTOCOL_RX_ERR_PAYLOAD;
     }
 
     k_mutex_lock(&heartbeat_mutex, K_FOREVER);
@@ -301,7 +518,7 @@ static void process_heartbeat_data(uint8_t device_id, uint8_t *payload, uint8_t
     if (state == NULL)
     {
         k_mutex_unlock(&heartbeat_mutex);
-        return;
+        return KEY_PROTOCOL_RX_ERR_DEVICE;
     }
 
     bool was_connected = state->connected;
@@ -313,11 +530,54 @@ static void process_heartbeat_data(uint8_t device_id, uint8_t *payload, uint8_t
     
     k_mutex_unlock(&heartbeat_mutex);
 
-    // if (!was_connected)
-    // {
-    //     logPrintf("Device 0x%02X connected (battery %u%%)\n",
-    //               state->device_id, state->battery_level);
-    // }
+    // 시간 동기 : seq, 하프의 전송 시간(us), 하프가 잰 왕복 시간(us, 0xFFFF 는 모름)
+    // 전송 시간은 오프셋 추정의 샘플이 되고, 받은 시간은 다음 ACK 페이로드로 돌려준다
+    if (length >= 9u)
+    {
+        uint8_t ch = device_id - DEVICE_ID_LEFT;
+        uint32_t tx_time_us = (uint32_t)payload[3] | ((uint32_t)payload[4] << 8) | ((uint32_t)payload[5] << 16) | ((uint32_t)payload[6] << 24);
+        uint16_t rtt_us = (uint16_t)(payload[7] | (payload[8] << 8));
+
+        time_sync_update(ch, tx_time_us, rx_time_us);
+        time_sync_set_rtt(ch, rtt_us == 0xFFFF ? 0 : rtt_us);
+
+        ack_time_sync_seq[ch] = payload[2];
+        ack_time_sync_rx[ch]  = rx_time_us;
+
+        // 센서 설정 gen : 센서가 있는 하프만 보낸다
+        if (length >= 10u)
+        {
+            ack_sensor_gen[ch]    = payload[9];
+            is_ack_sensor_gen[ch] = true;
+        }
+        ack_payload_update();
+    }
+
+    if (!was_connected)
+    {
+        evtlogWrite(EVT_RF_CONNECT, device_id, payload[1]);
+    }
+
+    return KEY_PROTOCOL_RX_OK;
+}
+
+static void capture_packet(const uint8_t *packet, uint32_t length)
+{
+    // sim/rf_replay 입력 형식 : <time_us> <hex bytes>
+    cliPrintf("%u", micros());
+    for (uint32_t i = 0; i < length; i++)
+    {
+        cliPrintf(" %02X", packet[i]);
+    }
+    cliPrintf("\n");
+}
+
+// 움직임 처리(motion_pipeline.c)가 없는 빌드(rf_replay 등)에서는 아무것도 하지 않음
+__attribute__((weak)) void key_protocol_motion_frame(uint8_t device_id, int16_t x, int16_t y)
+{
+    (void)device_id;
+    (void)x;
+    (void)y;
 }
 
 bool RfMotionRead(int32_t *x, int32_t *y)
@@ -368,27 +628,31 @@ static bool tx_packet_prepare(uint8_t device_id, uint8_t packet_type, uint8_t *p
 }
 
 // 키 데이터 전송 함수
-bool key_protocol_send_key_data(uint8_t device_id, uint8_t *key_matrix, uint8_t column_count)
+bool key_protocol_send_key_data(uint8_t device_id, uint8_t *key_matrix, uint8_t column_count, uint32_t scan_time_us)
 {
-    if (column_count > MAX_PAYLOAD - 1)
+    if (column_count > MAX_PAYLOAD - 5)
     {
         tx_errors++;
         return false;
     }
 
-    // 페이로드 준비: column count + key states
+    // 페이로드 준비: column count + key states + scan time (us, little-endian)
     uint8_t payload[MAX_PAYLOAD];
     payload[0] = column_count;
     memcpy(&payload[1], key_matrix, column_count);
+    payload[column_count + 1] = (uint8_t)(scan_time_us >> 0);
+    payload[column_count + 2] = (uint8_t)(scan_time_us >> 8);
+    payload[column_count + 3] = (uint8_t)(scan_time_us >> 16);
+    payload[column_count + 4] = (uint8_t)(scan_time_us >> 24);
 
     // 패킷 조립
-    if (!tx_packet_prepare(device_id, PACKET_TYPE_KEY, payload, column_count + 1))
+    if (!tx_packet_prepare(device_id, PACKET_TYPE_KEY, payload, column_count + 5))
     {
         return false;
     }
 
     // 패킷 전송
-    uint32_t packet_length = HEADER_SIZE + (column_count + 1) + FOOTER_SIZE;
+    uint32_t packet_length = HEADER_SIZE + (column_count + 5) + FOOTER_SIZE;
     uint32_t sent_len = rfWrite(tx_buffer, packet_length);
 
     if (sent_len == packet_length)
@@ -513,6 +777,111 @@ bool key_protocol_send_heartbeat(uint8_t device_id, uint8_t status_flag, uint8_t
     return false;
 }
 
+static bool ack_sensor_config_pending(void)
+{
+    if (ack_sensor_config.gen == 0u)
+    {
+        return false;
+    }
+    for (int i = 0; i < 2; i++)
+    {
+        if (is_ack_sensor_gen[i] && ack_sensor_gen[i] != ack_sensor_config.gen)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// ACK 페이로드 갱신 : [POWER_STATE 프레임][TIME_SYNC 프레임]
+// 두 하프가 같은 파이프를 쓰므로 TIME_SYNC 에는 두 하프의 응답을 모두 싣고, 하프는 자기 seq 만 확인한다
+// 센서 설정을 아직 적용하지 않은 하프가 있으면 TIME_SYNC 대신 [SENSOR_CONFIG 프레임] 을 싣는다
+static bool ack_payload_update(void)
+{
+    uint8_t ack[2 * HEADER_SIZE + 1 + 10 + 2 * FOOTER_SIZE];
+    uint8_t payload[10];
+    uint32_t length = 0;
+
+    if (!tx_packet_prepare(DEVICE_ID_DONGLE, PACKET_TYPE_POWER_STATE, &ack_power_state, 1))
+    {
+        return false;
+    }
+    memcpy(&ack[length], tx_buffer, HEADER_SIZE + 1 + FOOTER_SIZE);
+    length += HEADER_SIZE + 1 + FOOTER_SIZE;
+
+    if (ack_sensor_config_pending())
+    {
+        // gen, cpi(little-endian), snap angle, flags(bit0 smart mode, bit1 auto), smart threshold(little-endian)
+        payload[0] = ack_sensor_config.gen;
+        payload[1] = (uint8_t)(ack_sensor_config.cpi >> 0);
+        payload[2] = (uint8_t)(ack_sensor_config.cpi >> 8);
+        payload[3] = ack_sensor_config.snap_angle;
+        payload[4] = ack_sensor_config.smart_mode == KEY_PROTOCOL_SMART_AUTO ? 0x03u : (ack_sensor_config.smart_mode & 0x01u);
+        payload[5] = (uint8_t)(ack_sensor_config.smart_threshold >> 0);
+        payload[6] = (uint8_t)(ack_sensor_config.smart_threshold >> 8);
+        if (!tx_packet_prepare(DEVICE_ID_DONGLE, PACKET_TYPE_SENSOR_CONFIG, payload, 7))
+        {
+            return false;
+        }
+        memcpy(&ack[length], tx_buffer, HEADER_SIZE + 7 + FOOTER_SIZE);
+        length += HEADER_SIZE + 7 + FOOTER_SIZE;
+    }
+    else
+    {
+        // 하프별 [seq, heartbeat 수신 시간(us, little-endian)]
+        for (int i = 0; i < 2; i++)
+        {
+            payload[i * 5 + 0] = ack_time_sync_seq[i];
+            payload[i * 5 + 1] = (uint8_t)(ack_time_sync_rx[i] >> 0);
+            payload[i * 5 + 2] = (uint8_t)(ack_time_sync_rx[i] >> 8);
+            payload[i * 5 + 3] = (uint8_t)(ack_time_sync_rx[i] >> 16);
+            payload[i * 5 + 4] = (uint8_t)(ack_time_sync_rx[i] >> 24);
+        }
+        if (!tx_packet_prepare(DEVICE_ID_DONGLE, PACKET_TYPE_TIME_SYNC, payload, sizeof(payload)))
+        {
+            return false;
+        }
+        memcpy(&ack[length], tx_buffer, HEADER_SIZE + sizeof(payload) + FOOTER_SIZE);
+        length += HEADER_SIZE + sizeof(payload) + FOOTER_SIZE;
+    }
+
+    if (rfSetAckPayload(ack, length))
+    {
+        tx_packets++;
+        return true;
+    }
+
+    tx_errors++;
+    return false;
+}
+
+// 호스트 전원 상태 전달 함수 (ACK 페이로드로 하프에 전달됨)
+bool key_protocol_set_power_state(uint8_t power_state)
+{
+    ack_power_state = power_state;
+
+    return ack_payload_update();
+}
+
+bool key_protocol_set_sensor_config(const key_protocol_sensor_config_t *p_cfg)
+{
+    ack_sensor_config = *p_cfg;
+
+    return ack_payload_update();
+}
+
+bool key_protocol_get_sensor_config_gen(uint8_t device_id, uint8_t *p_gen)
+{
+    uint8_t ch = device_id - DEVICE_ID_LEFT;
+
+    if (ch >= 2u || !is_ack_sensor_gen[ch])
+    {
+        return false;
+    }
+    *p_gen = ack_sensor_gen[ch];
+    return true;
+}
+
 bool key_protocol_is_connected(uint8_t device_id)
 {
     k_mutex_lock(&heartbeat_mutex, K_FOREVER);
@@ -606,7 +975,12 @@ static void cli_command(cli_args_t *args)
         cliPrintf("-------------------\n");
         cliPrintf("Total TX packets: %u\n", tx_packets);
         cliPrintf("TX error packets: %u\n", tx_errors);
-        cliPrintf("Total RX errors: %u\n", rx_errors);
+        cliPrintf("RX frames: %u\n", rx_stats.frames);
+        cliPrintf("RX drop bytes: %u\n", rx_stats.drop_bytes);
+        for (int i = KEY_PROTOCOL_RX_OK + 1; i < KEY_PROTOCOL_RX_MAX; i++)
+        {
+            cliPrintf("RX error %-9s: %u\n", key_protocol_rx_name[i], rx_stats.errors[i]);
+        }
         
         k_mutex_lock(&heartbeat_mutex, K_FOREVER);
         for (size_t i = 0; i < sizeof(heartbeat_states) / sizeof(heartbeat_states[0]); ++i)
@@ -626,6 +1000,20 @@ static void cli_command(cli_args_t *args)
         return;
     }
 
+    if (args->argc == 1 && args->isStr(0, "clear"))
+    {
+        key_protocol_clear_rx_stats();
+        cliPrintf("RX stats cleared\n");
+        return;
+    }
+
+    if (args->argc == 2 && args->isStr(0, "capture"))
+    {
+        is_capture = args->isStr(1, "on");
+        cliPrintf("RX capture %s\n", is_capture ? "on" : "off");
+        return;
+    }
+
     // 새로운 테스트 명령어 추가
     if (args->argc == 2 && args->isStr(0, "test_tx"))
     {
@@ -637,7 +1025,7 @@ static void cli_command(cli_args_t *args)
         case 1: // 키 데이터 테스트
         {
             uint8_t key_data[3] = {0x01, 0x02, 0x03};
-            result = key_protocol_send_key_data(DEVICE_ID_LEFT, key_data, 3);
+            result = key_protocol_send_key_data(DEVICE_ID_LEFT, key_data, 3, micros());
             break;
         }
         case 2: // 트랙볼 데이터 테스트
@@ -670,6 +1058,8 @@ static void cli_command(cli_args_t *args)
 
     // Show usage
     cliPrintf("keyproto info\n");
+    cliPrintf("keyproto clear\n");
+    cliPrintf("keyproto capture on:off\n");
     cliPrintf("keyproto test_tx [1:key, 2:trackball, 3:battery]\n");
     cliPrintf("keyproto test_trackball [x] [y] [device_id]\n");
 }
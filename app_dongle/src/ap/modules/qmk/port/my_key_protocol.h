@@ -7,6 +7,46 @@
 
 #define DEVICE_ID_LEFT 0x01u
 #define DEVICE_ID_RIGHT 0x02u
+#define DEVICE_ID_DONGLE 0x00u
+
+// Host power state (dongle -> half, ACK payload)
+#define KEY_PROTOCOL_POWER_ACTIVE  0x00u
+#define KEY_PROTOCOL_POWER_SUSPEND 0x01u
+
+// Trackball sensor config (dongle -> half, ACK payload)
+#define KEY_PROTOCOL_SMART_OFF  0x00u
+#define KEY_PROTOCOL_SMART_ON   0x01u
+#define KEY_PROTOCOL_SMART_AUTO 0x02u   // 하프가 표면에 맞는 threshold 를 찾음
+
+typedef struct
+{
+    uint8_t gen;                // 설정이 바뀔 때마다 증가 (0 은 쓰지 않음)
+    uint16_t cpi;
+    uint8_t snap_angle;         // 0 : off, 1~45 도
+    uint8_t smart_mode;         // KEY_PROTOCOL_SMART_*
+    uint16_t smart_threshold;
+} key_protocol_sensor_config_t;
+
+// RX decode result (error class)
+typedef enum
+{
+    KEY_PROTOCOL_RX_OK = 0,
+    KEY_PROTOCOL_RX_ERR_START,     // start byte 가 아님 (다음 0xAA 까지 건너뜀)
+    KEY_PROTOCOL_RX_ERR_LENGTH,    // payload length 가 MAX_PAYLOAD 초과
+    KEY_PROTOCOL_RX_ERR_TRUNCATED, // length 만큼 데이터가 없음
+    KEY_PROTOCOL_RX_ERR_CHECKSUM,
+    KEY_PROTOCOL_RX_ERR_TYPE,      // 알 수 없는 packet type
+    KEY_PROTOCOL_RX_ERR_PAYLOAD,   // type 별 payload 길이, cols_length 오류
+    KEY_PROTOCOL_RX_ERR_DEVICE,    // 알 수 없는 device id
+    KEY_PROTOCOL_RX_MAX
+} key_protocol_rx_t;
+
+typedef struct
+{
+    uint32_t frames;                        // 정상 처리된 프레임
+    uint32_t drop_bytes;                    // 동기를 다시 맞추면서 버린 바이트
+    uint32_t errors[KEY_PROTOCOL_RX_MAX];
+} key_protocol_rx_stats_t;
 
 // Initialize the key protocol
 bool key_protocol_init(void);
@@ -15,15 +55,30 @@ bool key_protocol_init(void);
 void key_protocol_update(void);
 
 // RX related functions
+// 수신 바이트 스트림을 프레임 단위로 처리하고 사용한 바이트 수를 반환
+// is_last 가 false 이면 끝의 미완성 프레임은 남겨 두고, true 이면 에러로 버린다
+uint32_t key_protocol_rx_process(const uint8_t *data, uint32_t length, bool is_last);
+void key_protocol_get_rx_stats(key_protocol_rx_stats_t *stats);
+void key_protocol_clear_rx_stats(void);
 void RfKeysReadBuf(uint8_t *buf, uint32_t len);
+// 키가 마지막으로 바뀐 시간 (millis/micros 기준, 하프의 스캔 시간으로 보정)
+uint32_t key_protocol_get_key_time(uint8_t row, uint8_t col);
+uint32_t key_protocol_get_key_time_us(uint8_t row, uint8_t col);
 bool RfMotionRead(int32_t *x, int32_t *y);
+// 트랙볼 프레임을 받을 때마다 호출 (weak, 프레임 단위 움직임 처리용)
+void key_protocol_motion_frame(uint8_t device_id, int16_t x, int16_t y);
 
 // TX related functions
-bool key_protocol_send_key_data(uint8_t device_id, uint8_t *key_matrix, uint8_t column_count);
+bool key_protocol_send_key_data(uint8_t device_id, uint8_t *key_matrix, uint8_t column_count, uint32_t scan_time_us);
 bool key_protocol_send_trackball_data(uint8_t device_id, int16_t x, int16_t y);
 bool key_protocol_send_system_data(uint8_t device_id, uint8_t *system_data, uint8_t length);
 bool key_protocol_send_battery_data(uint8_t device_id, uint8_t battery_level);
 bool key_protocol_send_heartbeat(uint8_t device_id, uint8_t status_flag, uint8_t battery_level);
+bool key_protocol_set_power_state(uint8_t power_state);
+// 센서가 있는 하프가 heartbeat 로 알려준 gen 이 다르면 ACK 페이로드로 설정을 보낸다
+bool key_protocol_set_sensor_config(const key_protocol_sensor_config_t *p_cfg);
+// 하프가 적용한 설정의 gen (센서 설정을 보고하지 않는 하프는 false)
+bool key_protocol_get_sensor_config_gen(uint8_t device_id, uint8_t *p_gen);
 
 bool key_protocol_is_connected(uint8_t device_id);
 uint8_t key_protocol_get_battery_level(uint8_t device_id);
@@ -16,9 +16,14 @@ static qbuffer_t      write_q;
 static eeprom_write_t write_buf[EEPROM_WRITE_Q_BUF_MAX];
 static bool           is_req_clean = false;
 
+// 쓰기 큐에 넣는 쪽은 QMK 입력 스레드, VIA(USB), CLI 로 여러 곳이므로 lock
+// (꺼내는 쪽은 eeprom_task() 하나라서 flash 쓰기 동안에는 lock 을 잡지 않음)
+static struct k_mutex write_mutex;
+
 
 void eeprom_init(void)
 {
+  k_mutex_init(&write_mutex);
   eepromRead(0, eeprom_buf, TOTAL_EEPROM_BYTE_COUNT);
   qbufferCreateBySize(&write_q, (uint8_t *)write_buf, sizeof(eeprom_write_t), EEPROM_WRITE_Q_BUF_MAX); 
 }
@@ -101,11 +106,13 @@ void eeprom_write_byte(uint8_t *addr, uint8_t value)
 {
   eeprom_write_t write_byte;
 
+  k_mutex_lock(&write_mutex, K_FOREVER);
   eeprom_buf[(uint32_t)addr] = value;
 
   write_byte.addr = (uint32_t)addr;
   write_byte.data = value;
   qbufferWrite(&write_q, (uint8_t *)&write_byte, 1);
+  k_mutex_unlock(&write_mutex);
 }
 
 void eeprom_write_word(uint16_t *addr, uint16_t value)
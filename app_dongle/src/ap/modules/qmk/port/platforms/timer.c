@@ -35,4 +35,9 @@ uint16_t timer_elapsed(uint16_t last)
 uint32_t timer_elapsed32(uint32_t last)
 {
   return millis()-last;
-}
\ No newline at end of file
+}
+
+uint32_t timer_read_us(void)
+{
+  return micros();
+}
@@ -25,10 +25,25 @@ uint32_t timer_elapsed32(uint32_t last);
 #define TIMER_DIFF_FAST(a, b) TIMER_DIFF_32(a, b)
 #define timer_expired_fast(current, future) timer_expired32(current, future)
 
+uint32_t timer_read_us(void);
+
+// FAST_TIMER_US : fast timer 를 us 단위로 (micros, 약 71분마다 wrap)
+// fast timer 값을 ms 와 비교할 때는 TIMER_FAST_MS() 로 단위를 맞춘다
+#ifdef FAST_TIMER_US
+#define TIMER_FAST_TICKS_PER_MS   1000
+#else
+#define TIMER_FAST_TICKS_PER_MS   1
+#endif
+#define TIMER_FAST_MS(ms)         ((fast_timer_t)(ms) * TIMER_FAST_TICKS_PER_MS)
+
 typedef uint32_t fast_timer_t;
 fast_timer_t inline timer_read_fast(void) {
+#ifdef FAST_TIMER_US
+    return timer_read_us();
+#else
     return timer_read32();
+#endif
 }
 fast_timer_t inline timer_elapsed_fast(fast_timer_t last) {
-    return timer_elapsed32(last);
+    return TIMER_DIFF_FAST(timer_read_fast(), last);
 }
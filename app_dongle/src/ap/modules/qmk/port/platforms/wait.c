@@ -5,4 +5,9 @@
 void wait_ms(uint32_t ms)
 {
   delay(ms);
-}
\ No newline at end of file
+}
+
+void wait_us(uint32_t us)
+{
+  delay_us(us);
+}
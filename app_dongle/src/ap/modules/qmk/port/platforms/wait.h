@@ -4,3 +4,4 @@
 
 
 void wait_ms(uint32_t ms);
+void wait_us(uint32_t us);
@@ -495,18 +495,22 @@ const pointing_device_driver_t pointing_device_driver = {
 #else
 
 #include "my_key_protocol.h"
+#include "motion_pipeline.h"
 
 __attribute__((weak)) void           pointing_device_driver_init(void) {}
 __attribute__((weak)) report_mouse_t pointing_device_driver_get_report(report_mouse_t mouse_report) {
-   
-    int32_t x = 0, y = 0;
-    if (RfMotionRead(&x, &y)) 
+    int32_t x = 0, y = 0, h = 0, v = 0;
+
+    // RF 프레임마다 motion_pipeline 에서 처리한 값을 쓰고, 원시 합은 비우기만 한다
+    RfMotionRead(&x, &y);
+    if (motion_pipeline_read(&x, &y, &h, &v))
     {
         mouse_report.x = CONSTRAIN_HID_XY(x);
         mouse_report.y = CONSTRAIN_HID_XY(y);
+        mouse_report.h = CONSTRAIN_HID(h);
+        mouse_report.v = CONSTRAIN_HID(v);
     }
     return mouse_report;
-    
 }
 __attribute__((weak)) uint16_t pointing_device_driver_get_cpi(void) {
     return 0;
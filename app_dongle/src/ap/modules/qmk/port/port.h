@@ -8,6 +8,11 @@
 #include "kill_switch.h"
 #include "kkuk.h"
 #include "my_key_protocol.h"
+#include "qmk_bench.h"
+#include "dynamic_combo.h"
+#include "dynamic_key_override.h"
+#include "trackball_config.h"
+#include "motion_pipeline.h"
 
 
 #define QMK_BUILDDATE   "2024-04-23-11:29:54"
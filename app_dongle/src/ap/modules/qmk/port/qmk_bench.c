@@ -0,0 +1,356 @@
+#include "qmk_bench.h"
+#include "hw.h"
+#include "debounce.h"
+#include "dynamic_keymap.h"
+#include "pointing_device.h"
+#include "process_key_override.h"
+#include "my_key_protocol.h"
+#include <stdlib.h>
+
+#ifdef _USE_HW_CYCLE
+
+#define QMK_BENCH_RUNS_MAX        1000
+#define QMK_BENCH_PACED_MAX       200       // 1ms 마다 한 번만 의미 있는 항목
+#define QMK_BENCH_TIMEOUT_MS      30000
+#define QMK_BENCH_LAYER_ALL       ((layer_state_t)((1UL << DYNAMIC_KEYMAP_LAYER_COUNT) - 1))
+
+
+enum
+{
+  BENCH_OVERHEAD = 0,
+  BENCH_MATRIX_SCAN,
+  BENCH_DEBOUNCE_IDLE,
+  BENCH_DEBOUNCE_CHANGE,
+  BENCH_LAYER_GET,
+  BENCH_ACTION_FOR_KEY,
+  BENCH_KEYMAP_KEYCODE,
+  BENCH_KEY_OVERRIDE,
+  BENCH_POINTING_IDLE,
+  BENCH_POINTING_MOTION,
+  BENCH_KEYBOARD_TASK,
+  BENCH_REPORT_SEND,
+  BENCH_MAX
+};
+
+typedef struct
+{
+  uint32_t runs;
+  uint32_t min;
+  uint32_t median;
+  uint32_t p99;
+  uint32_t max;
+} bench_result_t;
+
+typedef struct
+{
+  const char *name;
+  bool        is_paced;     // keyboard_task 주기(1ms)에 맞춰 호출
+  void      (*prep)(uint32_t i);
+  void      (*func)(uint32_t i);
+} bench_item_t;
+
+
+static void bench_empty(uint32_t i);
+static void bench_matrix_scan(uint32_t i);
+static void bench_debounce_idle(uint32_t i);
+static void bench_debounce_change_prep(uint32_t i);
+static void bench_debounce_change(uint32_t i);
+static void bench_layer_get(uint32_t i);
+static void bench_action_for_key(uint32_t i);
+static void bench_keymap_keycode(uint32_t i);
+static void bench_key_override(uint32_t i);
+static void bench_pointing(uint32_t i);
+static void bench_pointing_motion_prep(uint32_t i);
+static void bench_keyboard_task(uint32_t i);
+static void bench_report_send(uint32_t i);
+
+
+static const bench_item_t bench_tbl[BENCH_MAX] =
+{
+  [BENCH_OVERHEAD]        = {"overhead",                 false, NULL,                        bench_empty},
+  [BENCH_MATRIX_SCAN]     = {"matrix_scan",              false, NULL,                        bench_matrix_scan},
+  [BENCH_DEBOUNCE_IDLE]   = {"debounce (idle)",          false, NULL,                        bench_debounce_idle},
+  [BENCH_DEBOUNCE_CHANGE] = {"debounce (change)",        false, bench_debounce_change_prep,  bench_debounce_change},
+  [BENCH_LAYER_GET]       = {"layer_switch_get_layer",   false, NULL,                        bench_layer_get},
+  [BENCH_ACTION_FOR_KEY]  = {"action_for_key",           false, NULL,                        bench_action_for_key},
+  [BENCH_KEYMAP_KEYCODE]  = {"dynamic_keymap_keycode",   false, NULL,                        bench_keymap_keycode},
+  [BENCH_KEY_OVERRIDE]    = {"key_override (press+rel)", false, NULL,                        bench_key_override},
+  [BENCH_POINTING_IDLE]   = {"pointing_device (idle)",   true,  NULL,                        bench_pointing},
+  [BENCH_POINTING_MOTION] = {"pointing_device (motion)", true,  bench_pointing_motion_prep,  bench_pointing},
+  [BENCH_KEYBOARD_TASK]   = {"keyboard_task (idle)",     true,  NULL,                        bench_keyboard_task},
+  [BENCH_REPORT_SEND]     = {"report send (keyboard)",   true,  NULL,                        bench_report_send},
+};
+
+// key override 매칭 비용 측정용 : shift 를 누른 상태에서 트리거가 다른 override 16개를 모두 검사
+static const key_override_t bench_ko[] =
+{
+  ko_make_basic(MOD_MASK_SHIFT, KC_F13, KC_NO), ko_make_basic(MOD_MASK_SHIFT, KC_F14, KC_NO),
+  ko_make_basic(MOD_MASK_SHIFT, KC_F15, KC_NO), ko_make_basic(MOD_MASK_SHIFT, KC_F16, KC_NO),
+  ko_make_basic(MOD_MASK_SHIFT, KC_F17, KC_NO), ko_make_basic(MOD_MASK_SHIFT, KC_F18, KC_NO),
+  ko_make_basic(MOD_MASK_SHIFT, KC_F19, KC_NO), ko_make_basic(MOD_MASK_SHIFT, KC_F20, KC_NO),
+  ko_make_basic(MOD_MASK_SHIFT, KC_F21, KC_NO), ko_make_basic(MOD_MASK_SHIFT, KC_F22, KC_NO),
+  ko_make_basic(MOD_MASK_SHIFT, KC_F23, KC_NO), ko_make_basic(MOD_MASK_SHIFT, KC_F24, KC_NO),
+  ko_make_basic(MOD_MASK_SHIFT, KC_INT1, KC_NO), ko_make_basic(MOD_MASK_SHIFT, KC_INT2, KC_NO),
+  ko_make_basic(MOD_MASK_SHIFT, KC_INT3, KC_NO), ko_make_basic(MOD_MASK_SHIFT, KC_INT4, KC_NO),
+};
+static const key_override_t *bench_ko_list[ARRAY_SIZE(bench_ko) + 1];
+
+static uint32_t        samples[QMK_BENCH_RUNS_MAX];
+static bench_result_t  results[BENCH_MAX];
+static uint32_t        overhead = 0;
+static matrix_row_t    bench_raw[MATRIX_ROWS];
+static matrix_row_t    bench_cooked[MATRIX_ROWS];
+static volatile uint32_t request_runs = 0;
+static K_SEM_DEFINE(bench_done_sem, 0, 1);
+
+
+
+static int bench_compare(const void *a, const void *b)
+{
+  uint32_t v_a = *(const uint32_t *)a;
+  uint32_t v_b = *(const uint32_t *)b;
+
+  return v_a < v_b ? -1 : v_a > v_b ? 1 : 0;
+}
+
+static keypos_t bench_key(uint32_t i)
+{
+  return MAKE_KEYPOS(i % MATRIX_ROWS, (i / MATRIX_ROWS) % MATRIX_COLS);
+}
+
+static void bench_pace(void)
+{
+  uint32_t pre_time = timer_read32();
+
+  // pointing_device_task 는 1ms throttle 이 있으므로 실제 루프와 같이 1ms 이상 간격을 둔다
+  while (timer_elapsed32(pre_time) < 1)
+  {
+    usbWaitSof(1);
+  }
+}
+
+static void bench_measure(uint32_t id, uint32_t runs)
+{
+  const bench_item_t *p_item = &bench_tbl[id];
+  bench_result_t *p_result = &results[id];
+
+  if (p_item->is_paced && runs > QMK_BENCH_PACED_MAX)
+  {
+    runs = QMK_BENCH_PACED_MAX;
+  }
+
+  for (uint32_t i=0; i<runs; i++)
+  {
+    uint32_t pre_cycle;
+    uint32_t cycles;
+
+    if (p_item->is_paced)
+      bench_pace();
+    if (p_item->prep != NULL)
+      p_item->prep(i);
+
+    pre_cycle = cycleGet();
+    p_item->func(i);
+    cycles = cycleGet() - pre_cycle;
+
+    samples[i] = cycles > overhead ? cycles - overhead : 0;
+  }
+
+  qsort(samples, runs, sizeof(uint32_t), bench_compare);
+  p_result->runs   = runs;
+  p_result->min    = samples[0];
+  p_result->median = samples[(runs - 1) / 2];
+  p_result->p99    = samples[((runs - 1) * 99 + 50) / 100];
+  p_result->max    = samples[runs - 1];
+}
+
+static void bench_all(uint32_t runs)
+{
+  layer_state_t layer_pre = layer_state;
+  const key_override_t **ko_pre = key_overrides;
+  uint8_t mods_pre = get_mods();
+
+  // 측정 루프 자체의 비용은 빼고 표시
+  overhead = 0;
+  bench_measure(BENCH_OVERHEAD, runs);
+  overhead = results[BENCH_OVERHEAD].min;
+
+  bench_measure(BENCH_MATRIX_SCAN, runs);
+
+  // debounce 는 내부 카운터가 하나뿐이므로 측정 후 다시 초기화 (측정 중 키 입력은 무시됨)
+  memset(bench_raw, 0, sizeof(bench_raw));
+  memset(bench_cooked, 0, sizeof(bench_cooked));
+  bench_measure(BENCH_DEBOUNCE_IDLE, runs);
+  bench_measure(BENCH_DEBOUNCE_CHANGE, runs);
+  debounce_free();
+  debounce_init(MATRIX_ROWS);
+
+  // 모든 레이어가 켜진 최악의 경우 (layer_state_set() 은 LVGL 콜백이 불리므로 직접 바꿈)
+  layer_state = QMK_BENCH_LAYER_ALL;
+  bench_measure(BENCH_LAYER_GET, runs);
+  layer_state = layer_pre;
+
+  bench_measure(BENCH_ACTION_FOR_KEY, runs);
+  bench_measure(BENCH_KEYMAP_KEYCODE, runs);
+
+  for (uint32_t i=0; i<ARRAY_SIZE(bench_ko); i++)
+  {
+    bench_ko_list[i] = &bench_ko[i];
+  }
+  bench_ko_list[ARRAY_SIZE(bench_ko)] = NULL;
+  key_overrides = bench_ko_list;
+  set_mods(MOD_BIT(KC_LSFT));
+  bench_measure(BENCH_KEY_OVERRIDE, runs);
+  set_mods(mods_pre);
+  key_overrides = ko_pre;
+
+  bench_measure(BENCH_POINTING_IDLE, runs);
+  bench_measure(BENCH_POINTING_MOTION, runs);
+  bench_measure(BENCH_KEYBOARD_TASK, runs);
+  bench_measure(BENCH_REPORT_SEND, runs);
+}
+
+bool qmk_bench_run(uint32_t runs)
+{
+  if (runs == 0 || runs > QMK_BENCH_RUNS_MAX)
+  {
+    return false;
+  }
+
+  k_sem_reset(&bench_done_sem);
+  request_runs = runs;
+
+  return k_sem_take(&bench_done_sem, K_MSEC(QMK_BENCH_TIMEOUT_MS)) == 0;
+}
+
+void qmk_bench_task(void)
+{
+  if (request_runs == 0)
+  {
+    return;
+  }
+
+  bench_all(request_runs);
+  request_runs = 0;
+  k_sem_give(&bench_done_sem);
+}
+
+void qmk_bench_print(void)
+{
+  cliPrintf("cpu %d MHz, cycles per call (overhead %d excluded)\n", cycleGetFreqMhz(), overhead);
+  cliPrintf("%-26s %6s %8s %8s %8s %8s\n", "item", "runs", "min", "median", "p99", "max");
+  for (uint32_t i=0; i<BENCH_MAX; i++)
+  {
+    bench_result_t *p_result = &results[i];
+
+    cliPrintf("%-26s %6d %8d %8d %8d %8d\n",
+              bench_tbl[i].name,
+              p_result->runs,
+              p_result->min,
+              p_result->median,
+              p_result->p99,
+              p_result->max);
+  }
+}
+
+
+//-- 측정 항목
+//
+void bench_empty(uint32_t i)
+{
+}
+
+void bench_matrix_scan(uint32_t i)
+{
+  matrix_scan();
+}
+
+void bench_debounce_idle(uint32_t i)
+{
+  debounce(bench_raw, bench_cooked, MATRIX_ROWS, false);
+}
+
+void bench_debounce_change_prep(uint32_t i)
+{
+  bench_raw[i % MATRIX_ROWS] ^= (matrix_row_t)1 << ((i / MATRIX_ROWS) % MATRIX_COLS);
+}
+
+void bench_debounce_change(uint32_t i)
+{
+  debounce(bench_raw, bench_cooked, MATRIX_ROWS, true);
+}
+
+void bench_layer_get(uint32_t i)
+{
+  layer_switch_get_layer(bench_key(i));
+}
+
+void bench_action_for_key(uint32_t i)
+{
+  action_for_key(i % DYNAMIC_KEYMAP_LAYER_COUNT, bench_key(i));
+}
+
+void bench_keymap_keycode(uint32_t i)
+{
+  keypos_t key = bench_key(i);
+
+  dynamic_keymap_get_keycode(i % DYNAMIC_KEYMAP_LAYER_COUNT, key.row, key.col);
+}
+
+void bench_key_override(uint32_t i)
+{
+  keyrecord_t record = {.event = MAKE_KEYEVENT(0, 0, true)};
+
+  process_key_override(KC_A, &record);
+  record.event.pressed = false;
+  process_key_override(KC_A, &record);
+}
+
+void bench_pointing(uint32_t i)
+{
+  pointing_device_task();
+}
+
+void bench_pointing_motion_prep(uint32_t i)
+{
+  // 왼쪽 하프 트랙볼 프레임 (dx = +1/-1 반복, 커서는 제자리)
+  uint8_t frame[] = {0xAA, DEVICE_ID_LEFT, 0x01, 0x02, 4, 0x01, 0x00, 0x00, 0x00, 0x00};
+
+  if (i & 1)
+  {
+    frame[5] = 0xFF;
+    frame[6] = 0xFF;
+  }
+  for (uint32_t j=0; j<sizeof(frame)-1; j++)
+  {
+    frame[sizeof(frame)-1] ^= frame[j];
+  }
+  key_protocol_rx_process(frame, sizeof(frame), true);
+}
+
+void bench_keyboard_task(uint32_t i)
+{
+  keyboard_task();
+}
+
+void bench_report_send(uint32_t i)
+{
+  host_keyboard_send(keyboard_report);
+}
+
+#else
+
+bool qmk_bench_run(uint32_t runs)
+{
+  return false;
+}
+
+void qmk_bench_task(void)
+{
+}
+
+void qmk_bench_print(void)
+{
+}
+
+#endif
@@ -0,0 +1,10 @@
+#pragma once
+
+#include "quantum.h"
+
+
+
+// CLI 스레드에서 요청하고 QMK(main) 스레드의 qmk_bench_task() 에서 실행한다
+bool qmk_bench_run(uint32_t runs);
+void qmk_bench_task(void);
+void qmk_bench_print(void);
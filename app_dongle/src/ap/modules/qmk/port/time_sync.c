@@ -0,0 +1,251 @@
+#include "time_sync.h"
+#include "hw.h"
+
+
+// offset = 수신 시간 - 하프 시간 = 두 시계의 차이 + RF 지연
+// 지연이 가장 적은 프레임의 offset 을 기준선으로 두고, 두 크리스탈의 속도 차이(skew)만큼 기울여서 따라간다
+// skew 는 구간(TIME_SYNC_WINDOW_MS)마다 구간 최소값끼리의 기울기로 구해서 평균한다
+// 키 프레임의 스캔 시간과 heartbeat 의 전송 시간이 모두 샘플이 되므로 입력이 없어도 기준선이 유지된다
+#define TIME_SYNC_WINDOW_MS       2000
+#define TIME_SYNC_WINDOW_SAMPLES  4           // 최소값을 믿을 수 있는 구간의 프레임 수
+#define TIME_SYNC_STALE_MS        60000       // 오래 프레임이 없으면 기준선을 다시 잡는다 (micros 가 wrap 되기 전)
+#define TIME_SYNC_RESYNC_US       1000000
+#define TIME_SYNC_SKEW_MAX_PPB    500000      // ±500 ppm
+#define TIME_SYNC_SKEW_SPAN_US    600000000   // 이보다 먼 구간끼리는 skew 를 구하지 않음 (int32 us 범위)
+#define TIME_SYNC_SKEW_AVG        8
+
+
+typedef struct
+{
+  bool     valid;
+  uint32_t base_offset;       // 기준선 : base_time(micros) 에서의 offset
+  uint32_t base_time;
+  int32_t  skew_ppb;          // 하프 시계가 느리면 + (offset 이 커지는 방향)
+  uint32_t skew_count;
+  uint32_t last_ms;
+
+  uint32_t window_start;      // millis
+  uint32_t window_samples;
+  uint32_t window_min;        // 이번 구간의 최소 offset 과 그 시간
+  uint32_t window_min_time;
+  bool     prev_valid;
+  uint32_t prev_min;          // 이전 구간의 최소 offset 과 그 시간
+  uint32_t prev_min_time;
+
+  uint32_t rtt_us;
+  uint32_t delay_us;
+  uint32_t delay_max_us;
+  uint32_t samples;
+  uint32_t resyncs;
+} time_sync_t;
+
+
+static void cliTimeSync(cli_args_t *args);
+
+static time_sync_t time_sync[TIME_SYNC_MAX];
+
+
+
+
+void time_sync_init(void)
+{
+  time_sync_reset();
+
+  cliAdd("timesync", cliTimeSync);
+}
+
+void time_sync_reset(void)
+{
+  memset(time_sync, 0, sizeof(time_sync));
+}
+
+static uint32_t time_sync_predict(const time_sync_t *sync, uint32_t now_us)
+{
+  int32_t dt = (int32_t)(now_us - sync->base_time);
+
+  return sync->base_offset + (int32_t)(((int64_t)sync->skew_ppb * dt) / 1000000000);
+}
+
+static void time_sync_window_start(time_sync_t *sync, uint32_t offset, uint32_t now_us, uint32_t now_ms)
+{
+  sync->window_start    = now_ms;
+  sync->window_samples  = 1;
+  sync->window_min      = offset;
+  sync->window_min_time = now_us;
+}
+
+// remote_us(하프 시간) 가 rx_us(동글 수신 시간) 보다 기준선 이상으로 앞서는 만큼(us) 반환
+uint32_t time_sync_update(uint8_t ch, uint32_t remote_us, uint32_t rx_us)
+{
+  time_sync_t *sync;
+  uint32_t now_ms = millis();
+  uint32_t offset = rx_us - remote_us;
+  int32_t  delay = 0;
+
+  if (ch >= TIME_SYNC_MAX)
+  {
+    return 0;
+  }
+  sync = &time_sync[ch];
+  sync->samples++;
+
+  if (sync->valid && now_ms - sync->last_ms >= TIME_SYNC_STALE_MS)
+  {
+    sync->valid = false;
+  }
+  if (sync->valid)
+  {
+    delay = (int32_t)(offset - time_sync_predict(sync, rx_us));
+  }
+  sync->last_ms = now_ms;
+
+  // 처음이거나 하프가 리셋되어 시간이 튀면 다시 맞춘다 (skew 는 크리스탈 특성이므로 유지)
+  if (!sync->valid || delay > TIME_SYNC_RESYNC_US || delay < -TIME_SYNC_RESYNC_US)
+  {
+    if (sync->valid)
+    {
+      sync->resyncs++;
+    }
+    sync->valid       = true;
+    sync->base_offset = offset;
+    sync->base_time   = rx_us;
+    sync->prev_valid  = false;
+    sync->delay_us    = 0;
+    time_sync_window_start(sync, offset, rx_us, now_ms);
+    return 0;
+  }
+
+  // 지금까지보다 지연이 적은 프레임이면 기준선을 내린다
+  if (delay < 0)
+  {
+    sync->base_offset = offset;
+    sync->base_time   = rx_us;
+    delay = 0;
+  }
+
+  sync->window_samples++;
+  if ((int32_t)(offset - sync->window_min) < 0)
+  {
+    sync->window_min      = offset;
+    sync->window_min_time = rx_us;
+  }
+  if (now_ms - sync->window_start >= TIME_SYNC_WINDOW_MS)
+  {
+    if (sync->window_samples >= TIME_SYNC_WINDOW_SAMPLES)
+    {
+      int32_t dt = (int32_t)(sync->window_min_time - sync->prev_min_time);
+
+      if (sync->prev_valid && dt > 0 && dt < TIME_SYNC_SKEW_SPAN_US)
+      {
+        int64_t skew = (int64_t)(int32_t)(sync->window_min - sync->prev_min) * 1000000000 / dt;
+
+        if (skew > TIME_SYNC_SKEW_MAX_PPB) skew = TIME_SYNC_SKEW_MAX_PPB;
+        if (skew < -TIME_SYNC_SKEW_MAX_PPB) skew = -TIME_SYNC_SKEW_MAX_PPB;
+        // 처음 몇 개는 평균, 이후는 1/TIME_SYNC_SKEW_AVG 씩 따라간다
+        if (sync->skew_count < TIME_SYNC_SKEW_AVG)
+        {
+          sync->skew_count++;
+        }
+        sync->skew_ppb += (int32_t)(skew - sync->skew_ppb) / (int32_t)sync->skew_count;
+      }
+      sync->prev_valid    = true;
+      sync->prev_min      = sync->window_min;
+      sync->prev_min_time = sync->window_min_time;
+
+      // 기준선을 구간 최소값으로 옮긴다 (skew 추정이 틀려 기준선이 내려가 있던 만큼 다시 올라감)
+      sync->base_offset = sync->window_min;
+      sync->base_time   = sync->window_min_time;
+      delay = (int32_t)(offset - time_sync_predict(sync, rx_us));
+      if (delay < 0)
+      {
+        delay = 0;
+      }
+    }
+    time_sync_window_start(sync, offset, rx_us, now_ms);
+  }
+
+  sync->delay_us = (uint32_t)delay;
+  if (sync->delay_us > sync->delay_max_us)
+  {
+    sync->delay_max_us = sync->delay_us;
+  }
+  return (uint32_t)delay;
+}
+
+void time_sync_set_rtt(uint8_t ch, uint32_t rtt_us)
+{
+  if (ch < TIME_SYNC_MAX)
+  {
+    time_sync[ch].rtt_us = rtt_us;
+  }
+}
+
+bool time_sync_get_info(uint8_t ch, time_sync_info_t *p_info)
+{
+  time_sync_t *sync;
+
+  if (ch >= TIME_SYNC_MAX)
+  {
+    return false;
+  }
+  sync = &time_sync[ch];
+
+  p_info->valid        = sync->valid;
+  p_info->offset_us    = 0;
+  p_info->skew_ppb     = sync->skew_ppb;
+  p_info->rtt_us       = sync->rtt_us;
+  p_info->delay_us     = sync->delay_us;
+  p_info->delay_max_us = sync->delay_max_us;
+  p_info->samples      = sync->samples;
+  p_info->resyncs      = sync->resyncs;
+  if (sync->valid)
+  {
+    p_info->offset_us = (int32_t)(time_sync_predict(sync, micros()) - sync->rtt_us / 2);
+  }
+  return sync->valid;
+}
+
+static void cliTimeSync(cli_args_t *args)
+{
+  bool ret = false;
+
+  if (args->argc == 1 && args->isStr(0, "info"))
+  {
+    for (int i=0; i<TIME_SYNC_MAX; i++)
+    {
+      time_sync_info_t info;
+      int32_t skew_abs;
+
+      time_sync_get_info(i, &info);
+      skew_abs = info.skew_ppb < 0 ? -info.skew_ppb : info.skew_ppb;
+
+      cliPrintf("%s : sync %s, offset %d us, skew %s%d.%03d ppm, rtt %d us\n",
+                i == TIME_SYNC_LEFT ? "L" : "R",
+                info.valid ? "YES" : "NO",
+                info.offset_us,
+                info.skew_ppb < 0 ? "-" : "",
+                skew_abs / 1000,
+                skew_abs % 1000,
+                info.rtt_us);
+      cliPrintf("    delay %d us (max %d), samples %d, resync %d\n",
+                info.delay_us,
+                info.delay_max_us,
+                info.samples,
+                info.resyncs);
+    }
+    ret = true;
+  }
+
+  if (args->argc == 1 && args->isStr(0, "reset"))
+  {
+    time_sync_reset();
+    cliPrintf("timesync reset\n");
+    ret = true;
+  }
+
+  if (ret == false)
+  {
+    cliPrintf("timesync info\n");
+    cliPrintf("timesync reset\n");
+  }
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+
+
+// 하프 시계(us) 를 동글 micros 로 옮기기 위한 하프별 offset/skew 추정
+#define TIME_SYNC_LEFT      0
+#define TIME_SYNC_RIGHT     1
+#define TIME_SYNC_MAX       2
+
+
+typedef struct
+{
+  bool     valid;
+  int32_t  offset_us;     // 동글 - 하프 (지금 시간으로 외삽, rtt 를 알면 편도 지연 rtt/2 를 뺀 값)
+  int32_t  skew_ppb;      // 하프 시계가 느리면 +
+  uint32_t rtt_us;        // 하프가 heartbeat 로 알려준 왕복 시간 (0 : 모름)
+  uint32_t delay_us;      // 마지막 프레임이 기준선보다 늦게 도착한 시간
+  uint32_t delay_max_us;
+  uint32_t samples;
+  uint32_t resyncs;
+} time_sync_info_t;
+
+
+void     time_sync_init(void);
+void     time_sync_reset(void);
+uint32_t time_sync_update(uint8_t ch, uint32_t remote_us, uint32_t rx_us);
+void     time_sync_set_rtt(uint8_t ch, uint32_t rtt_us);
+bool     time_sync_get_info(uint8_t ch, time_sync_info_t *p_info);
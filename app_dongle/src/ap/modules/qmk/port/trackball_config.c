@@ -0,0 +1,344 @@
+#include "trackball_config.h"
+#include "my_key_protocol.h"
+#include "hw.h"
+#include "qmk.h"
+
+#ifdef POINTING_DEVICE_ENABLE
+
+
+#define TRACKBALL_CONFIG_MAGIC          0x5442
+
+// EEPROM : [magic(2), gen, cpi(2), snap angle, smart mode, smart threshold(2)]
+#define TRACKBALL_CONFIG_DATA_SIZE      9
+
+#define TRACKBALL_CPI_MIN               200
+#define TRACKBALL_CPI_MAX               3200
+#define TRACKBALL_CPI_STEP              200
+#define TRACKBALL_SNAP_ANGLE_MAX        45
+
+_Static_assert(TRACKBALL_CONFIG_EEPROM_SIZE >= TRACKBALL_CONFIG_DATA_SIZE, "TRACKBALL_CONFIG_EEPROM_SIZE too small");
+
+
+enum via_qmk_trackball_value {
+    id_qmk_trackball_cpi             = 1,   // [cpi(2)]
+    id_qmk_trackball_snap_angle      = 2,   // [angle 0~45, 0 : off]
+    id_qmk_trackball_smart_mode      = 3,   // [0 : off, 1 : on, 2 : auto]
+    id_qmk_trackball_smart_threshold = 4,   // [threshold(2)]
+    id_qmk_trackball_gen             = 5,   // [gen, left gen, right gen] (get, 0xFF : 보고 없음)
+};
+
+
+static void via_qmk_trackball_get_value(uint8_t *data);
+static void via_qmk_trackball_set_value(uint8_t *data);
+static void cliTrackball(cli_args_t *args);
+
+
+static const trackball_config_t tb_default =
+{
+  .cpi             = 400,
+  .snap_angle      = 0,
+  .smart_mode      = KEY_PROTOCOL_SMART_OFF,
+  .smart_threshold = 45,
+};
+
+static const char *smart_mode_name[] = {"off", "on", "auto"};
+
+static trackball_config_t tb_cfg;
+static uint8_t            tb_gen = 1;    // 설정이 바뀔 때마다 증가, 하프는 적용한 gen 을 heartbeat 로 알려준다
+
+
+
+
+static void trackball_config_send(void)
+{
+  key_protocol_sensor_config_t sensor_cfg;
+
+  sensor_cfg.gen             = tb_gen;
+  sensor_cfg.cpi             = tb_cfg.cpi;
+  sensor_cfg.snap_angle      = tb_cfg.snap_angle;
+  sensor_cfg.smart_mode      = tb_cfg.smart_mode;
+  sensor_cfg.smart_threshold = tb_cfg.smart_threshold;
+  key_protocol_set_sensor_config(&sensor_cfg);
+}
+
+static void trackball_config_save(void)
+{
+  uint8_t buf[TRACKBALL_CONFIG_DATA_SIZE];
+
+  buf[0] = TRACKBALL_CONFIG_MAGIC >> 8;
+  buf[1] = TRACKBALL_CONFIG_MAGIC & 0xFF;
+  buf[2] = tb_gen;
+  buf[3] = tb_cfg.cpi >> 8;
+  buf[4] = tb_cfg.cpi & 0xFF;
+  buf[5] = tb_cfg.snap_angle;
+  buf[6] = tb_cfg.smart_mode;
+  buf[7] = tb_cfg.smart_threshold >> 8;
+  buf[8] = tb_cfg.smart_threshold & 0xFF;
+  eeprom_update_block(buf, (void *)TRACKBALL_CONFIG_EEPROM_ADDR, sizeof(buf));
+}
+
+void trackball_config_init(void)
+{
+  uint8_t buf[TRACKBALL_CONFIG_DATA_SIZE];
+
+  eeprom_read_block(buf, (const void *)TRACKBALL_CONFIG_EEPROM_ADDR, sizeof(buf));
+  if (((buf[0] << 8) | buf[1]) != TRACKBALL_CONFIG_MAGIC || buf[2] == 0)
+  {
+    trackball_config_reset();
+  }
+  else
+  {
+    tb_gen                 = buf[2];
+    tb_cfg.cpi             = (buf[3] << 8) | buf[4];
+    tb_cfg.snap_angle      = buf[5];
+    tb_cfg.smart_mode      = MIN(buf[6], KEY_PROTOCOL_SMART_AUTO);
+    tb_cfg.smart_threshold = (buf[7] << 8) | buf[8];
+  }
+  trackball_config_send();
+
+  cliAdd("trackball", cliTrackball);
+
+  logPrintf("[ON] TRACKBALL CONFIG\n");
+}
+
+void trackball_config_reset(void)
+{
+  trackball_config_set(&tb_default);
+}
+
+void trackball_config_get(trackball_config_t *p_cfg)
+{
+  *p_cfg = tb_cfg;
+}
+
+bool trackball_config_set(const trackball_config_t *p_cfg)
+{
+  if (p_cfg->cpi < TRACKBALL_CPI_MIN || p_cfg->cpi > TRACKBALL_CPI_MAX ||
+      p_cfg->snap_angle > TRACKBALL_SNAP_ANGLE_MAX ||
+      p_cfg->smart_mode > KEY_PROTOCOL_SMART_AUTO)
+  {
+    return false;
+  }
+
+  // CLI 스레드에서도 호출되므로 RF 처리(qmkUpdate)가 보내는 설정과 겹치지 않게 lock
+  qmkLock();
+  tb_cfg     = *p_cfg;
+  tb_cfg.cpi = tb_cfg.cpi / TRACKBALL_CPI_STEP * TRACKBALL_CPI_STEP;
+
+  // 하프는 gen 이 다르면 새 설정으로 보므로 0 은 건너뛴다 (0 : 하프에 설정 없음)
+  tb_gen++;
+  if (tb_gen == 0)
+    tb_gen = 1;
+
+  trackball_config_save();
+  trackball_config_send();
+  qmkUnlock();
+  return true;
+}
+
+void via_qmk_trackball_command(uint8_t *data, uint8_t length)
+{
+  // data = [ command_id, channel_id, value_id, value_data ]
+  uint8_t *command_id        = &(data[0]);
+  uint8_t *value_id_and_data = &(data[2]);
+
+  switch (*command_id)
+  {
+    case id_custom_set_value:
+      {
+        // VIA(USB) 에서 호출되므로 QMK 스레드와 겹치지 않게 lock (현재 설정을 읽고 바꾸는 동안)
+        qmkLock();
+        via_qmk_trackball_set_value(value_id_and_data);
+        qmkUnlock();
+        break;
+      }
+    case id_custom_get_value:
+      {
+        via_qmk_trackball_get_value(value_id_and_data);
+        break;
+      }
+    case id_custom_save:
+      {
+        // set 할 때 바로 EEPROM 에 반영된다
+        break;
+      }
+    default:
+      {
+        *command_id = id_unhandled;
+        break;
+      }
+  }
+}
+
+void via_qmk_trackball_get_value(uint8_t *data)
+{
+  // data = [ value_id, value_data ]
+  uint8_t *value_id   = &(data[0]);
+  uint8_t *value_data = &(data[1]);
+
+  switch (*value_id)
+  {
+    case id_qmk_trackball_cpi:
+      {
+        value_data[0] = tb_cfg.cpi >> 8;
+        value_data[1] = tb_cfg.cpi & 0xFF;
+        break;
+      }
+    case id_qmk_trackball_snap_angle:
+      {
+        value_data[0] = tb_cfg.snap_angle;
+        break;
+      }
+    case id_qmk_trackball_smart_mode:
+      {
+        value_data[0] = tb_cfg.smart_mode;
+        break;
+      }
+    case id_qmk_trackball_smart_threshold:
+      {
+        value_data[0] = tb_cfg.smart_threshold >> 8;
+        value_data[1] = tb_cfg.smart_threshold & 0xFF;
+        break;
+      }
+    case id_qmk_trackball_gen:
+      {
+        value_data[0] = tb_gen;
+        if (!key_protocol_get_sensor_config_gen(DEVICE_ID_LEFT, &value_data[1]))
+          value_data[1] = 0xFF;
+        if (!key_protocol_get_sensor_config_gen(DEVICE_ID_RIGHT, &value_data[2]))
+          value_data[2] = 0xFF;
+        break;
+      }
+    default:
+      {
+        *value_id = id_unhandled;
+        break;
+      }
+  }
+}
+
+void via_qmk_trackball_set_value(uint8_t *data)
+{
+  // data = [ value_id, value_data ]
+  uint8_t *value_id   = &(data[0]);
+  uint8_t *value_data = &(data[1]);
+  trackball_config_t cfg = tb_cfg;
+
+  switch (*value_id)
+  {
+    case id_qmk_trackball_cpi:
+      {
+        cfg.cpi = (value_data[0] << 8) | value_data[1];
+        break;
+      }
+    case id_qmk_trackball_snap_angle:
+      {
+        cfg.snap_angle = value_data[0];
+        break;
+      }
+    case id_qmk_trackball_smart_mode:
+      {
+        cfg.smart_mode = value_data[0];
+        break;
+      }
+    case id_qmk_trackball_smart_threshold:
+      {
+        cfg.smart_threshold = (value_data[0] << 8) | value_data[1];
+        break;
+      }
+    default:
+      {
+        *value_id = id_unhandled;
+        return;
+      }
+  }
+
+  if (!trackball_config_set(&cfg))
+  {
+    *value_id = id_unhandled;
+  }
+}
+
+void cliTrackball(cli_args_t *args)
+{
+  bool ret = false;
+
+
+  if (args->argc == 1 && args->isStr(0, "info"))
+  {
+    const uint8_t dev_id[2] = {DEVICE_ID_LEFT, DEVICE_ID_RIGHT};
+
+    cliPrintf("cpi        : %d\n", tb_cfg.cpi);
+    cliPrintf("snap angle : %d deg\n", tb_cfg.snap_angle);
+    cliPrintf("smart mode : %s, threshold %d\n", smart_mode_name[tb_cfg.smart_mode], tb_cfg.smart_threshold);
+    cliPrintf("gen        : %d\n", tb_gen);
+    for (int i=0; i<2; i++)
+    {
+      uint8_t gen;
+
+      if (key_protocol_get_sensor_config_gen(dev_id[i], &gen))
+        cliPrintf("  %s      : gen %d, %s\n", i == 0 ? "L" : "R", gen, gen == tb_gen ? "applied" : "pending");
+      else
+        cliPrintf("  %s      : -\n", i == 0 ? "L" : "R");
+    }
+    ret = true;
+  }
+
+  if (args->argc == 2 && args->isStr(0, "cpi"))
+  {
+    trackball_config_t cfg = tb_cfg;
+
+    cfg.cpi = args->getData(1);
+    if (trackball_config_set(&cfg))
+      cliPrintf("cpi %d\n", tb_cfg.cpi);
+    else
+      cliPrintf("cpi %d~%d\n", TRACKBALL_CPI_MIN, TRACKBALL_CPI_MAX);
+    ret = true;
+  }
+
+  if (args->argc == 2 && args->isStr(0, "snap"))
+  {
+    trackball_config_t cfg = tb_cfg;
+
+    cfg.snap_angle = args->getData(1);
+    if (trackball_config_set(&cfg))
+      cliPrintf("snap angle %d deg\n", tb_cfg.snap_angle);
+    else
+      cliPrintf("snap angle 0~%d\n", TRACKBALL_SNAP_ANGLE_MAX);
+    ret = true;
+  }
+
+  if (args->argc >= 2 && args->argc <= 3 && args->isStr(0, "smart"))
+  {
+    trackball_config_t cfg = tb_cfg;
+
+    cfg.smart_mode = KEY_PROTOCOL_SMART_OFF;
+    if (args->isStr(1, "on"))
+      cfg.smart_mode = KEY_PROTOCOL_SMART_ON;
+    if (args->isStr(1, "auto"))
+      cfg.smart_mode = KEY_PROTOCOL_SMART_AUTO;
+    if (args->argc == 3)
+      cfg.smart_threshold = args->getData(2);
+    trackball_config_set(&cfg);
+    cliPrintf("smart mode %s, threshold %d\n", smart_mode_name[tb_cfg.smart_mode], tb_cfg.smart_threshold);
+    ret = true;
+  }
+
+  if (args->argc == 1 && args->isStr(0, "reset"))
+  {
+    trackball_config_reset();
+    cliPrintf("trackball reset\n");
+    ret = true;
+  }
+
+  if (ret == false)
+  {
+    cliPrintf("trackball info\n");
+    cliPrintf("trackball cpi %d~%d\n", TRACKBALL_CPI_MIN, TRACKBALL_CPI_MAX);
+    cliPrintf("trackball snap 0~%d\n", TRACKBALL_SNAP_ANGLE_MAX);
+    cliPrintf("trackball smart on|off|auto [threshold]\n");
+    cliPrintf("trackball reset\n");
+  }
+}
+
+#endif
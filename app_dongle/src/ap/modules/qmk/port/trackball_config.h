@@ -0,0 +1,21 @@
+#pragma once
+
+#include "quantum.h"
+
+
+
+// 하프의 트랙볼 센서(PMW3610) 설정 (VIA/CLI 에서 편집, RF ACK 페이로드로 하프에 전달)
+typedef struct
+{
+  uint16_t cpi;
+  uint8_t  snap_angle;
+  uint8_t  smart_mode;        // KEY_PROTOCOL_SMART_OFF/ON/AUTO
+  uint16_t smart_threshold;
+} trackball_config_t;
+
+
+void trackball_config_init(void);
+void trackball_config_reset(void);
+void trackball_config_get(trackball_config_t *p_cfg);
+bool trackball_config_set(const trackball_config_t *p_cfg);
+void via_qmk_trackball_command(uint8_t *data, uint8_t length);
@@ -1,18 +1,22 @@
 #include "qmk.h"
 #include "qmk/port/port.h"
+#include "ap_lvgl.h"
 
 
 static void cliQmk(cli_args_t *args);
 static void idle_task(void);
 
 static bool is_suspended = false;
-// 스크롤 모드 상태
-static bool scroll_mode = false;
+
+// 입력 스레드(qmkUpdate)와 관리 스레드(qmkUpdateIdle)가 QMK 상태(리포트, 매트릭스 등)를 같이 쓰는 구간
+static struct k_mutex qmk_mutex;
 
 
 
 bool qmkInit(void)
 {
+  k_mutex_init(&qmk_mutex);
+
   eeprom_init();
   via_hid_init();
 
@@ -35,14 +39,39 @@ bool qmkInit(void)
   return true;
 }
 
+// 입력 처리 : RF 수신 → 매트릭스 → action → 리포트 전송
 void qmkUpdate(void)
 {
+  k_mutex_lock(&qmk_mutex, K_FOREVER);
   #ifdef RF_DONGLE_MODE_ENABLE
   key_protocol_update();
   #endif
   keyboard_task();
+  qmk_bench_task();
+  k_mutex_unlock(&qmk_mutex);
+}
+
+// 입력과 관계없는 관리 작업 : EEPROM 쓰기, suspend 처리, KKUK
+void qmkUpdateIdle(void)
+{
+  // flash 쓰기는 오래 걸릴 수 있으므로 qmk_mutex 없이 처리
+  // (쓰기 큐는 입력/VIA/CLI 가 eeprom.c 의 lock 을 잡고 넣고, 꺼내는 곳은 여기 하나)
   eeprom_task();
+
+  k_mutex_lock(&qmk_mutex, K_FOREVER);
   idle_task();
+  k_mutex_unlock(&qmk_mutex);
+}
+
+// 다른 스레드(VIA/USB, CLI)에서 입력 처리가 읽는 QMK 상태를 바꿀 때 사용 (재진입 가능)
+void qmkLock(void)
+{
+  k_mutex_lock(&qmk_mutex, K_FOREVER);
+}
+
+void qmkUnlock(void)
+{
+  k_mutex_unlock(&qmk_mutex);
 }
 
 void keyboard_post_init_user(void)
@@ -53,10 +82,42 @@ void keyboard_post_init_user(void)
 #ifdef KKUK_ENABLE
   kkuk_init();
 #endif
+#ifdef COMBO_ENABLE
+  dynamic_combo_init();
+#endif
+#ifdef KEY_OVERRIDE_ENABLE
+  dynamic_key_override_init();
+#endif
+#ifdef POINTING_DEVICE_ENABLE
+  trackball_config_init();
+  motion_pipeline_init();
+#endif
+}
+
+void eeconfig_init_user(void)
+{
+#ifdef COMBO_ENABLE
+  dynamic_combo_reset();
+#endif
+#ifdef KEY_OVERRIDE_ENABLE
+  dynamic_key_override_reset();
+#endif
+#ifdef POINTING_DEVICE_ENABLE
+  trackball_config_reset();
+  motion_pipeline_reset();
+#endif
 }
 
 bool process_record_user(uint16_t keycode, keyrecord_t *record)
 {
+  if (record->event.pressed)
+  {
+    hwSetFirstKey();
+  }
+  evtlogWrite(EVT_KEY,
+              EVTLOG_U8X2(record->event.key.row, record->event.key.col),
+              EVTLOG_U16X2(keycode, record->event.pressed));
+
 #ifdef KILL_SWITCH_ENABLE
   kill_switch_process(keycode, record);
 #endif
@@ -64,12 +125,12 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record)
   kkuk_process(keycode, record);
 #endif
 
-    // KC_LCTL을 스크롤 모드 토글 키로 사용 (원하는 키로 변경 가능)
-    // 예: KC_LCTL, KC_RCTL, KC_LGUI, MO(1) 등
-    if (keycode == KC_MS_BTN8) {
-        scroll_mode = record->event.pressed;
-        return true;
+#ifdef POINTING_DEVICE_ENABLE
+    // 포인터 모드 키 (KC_MS_BTN8 : 스크롤, MOTION_KEY_* : precision/scroll/caret, motion_pipeline.c)
+    if (!motion_pipeline_process(keycode, record)) {
+        return false;
     }
+#endif
     
     return true;
     
@@ -81,16 +142,30 @@ void idle_task(void)
   bool is_suspended_cur;
 
   is_suspended_cur = usbIsSuspended();
+
+  // Suspend 중 키 입력이 있으면 호스트를 깨운다 (remote wakeup)
+  if (is_suspended && is_suspended_cur && suspend_wakeup_condition())
+  {
+    if (usbWakeup())
+    {
+      #ifdef RF_DONGLE_MODE_ENABLE
+      // resume 전까지 입력을 놓치지 않도록 연속 수신으로 복귀
+      rfSetRxDutyCycle(0, 0);
+      #endif
+      evtlogWrite(EVT_USB_WAKEUP, 0, 0);
+    }
+  }
+
   if (is_suspended_cur != is_suspended)
   {
     if (is_suspended_cur)
     {
       suspend_power_down();
-      logPrintf("Enter Suspend\n");
+      evtlogWrite(EVT_USB_SUSPEND, 0, 0);
     }
     else
     {
-      logPrintf("Exit Suspend\n");
+      evtlogWrite(EVT_USB_RESUME, 0, 0);
       suspend_wakeup_init();
     }
 
@@ -102,22 +177,28 @@ void idle_task(void)
 #endif
 }
 /**
- * @brief 마우스 리포트 처리 (스크롤 모드 적용)
+ * @brief USB suspend 진입 콜백
+ * 디스플레이를 끄고, 수신 듀티 사이클을 적용하고, 하프에 suspend 상태를 알린다.
  */
-report_mouse_t pointing_device_task_user(report_mouse_t mouse_report) 
+void suspend_power_down_user(void)
 {
-    if (scroll_mode) {
-        // 마우스 움직임을 스크롤로 변환
-        // x, y 값을 h(horizontal), v(vertical) 스크롤로 매핑
-        mouse_report.h = mouse_report.x/10;
-        mouse_report.v = -mouse_report.y/10;  // Y축 반전 (마우스 위로 = 스크롤 아래로)
-        
-        // 마우스 커서 움직임 제거
-        mouse_report.x = 0;
-        mouse_report.y = 0;
-    }
-    
-    return mouse_report;
+    apLvglSetSuspend(true);
+    #ifdef RF_DONGLE_MODE_ENABLE
+    rfSetRxDutyCycle(HW_RF_SUSPEND_RX_ON_MS, HW_RF_SUSPEND_RX_OFF_MS);
+    key_protocol_set_power_state(KEY_PROTOCOL_POWER_SUSPEND);
+    #endif
+}
+
+/**
+ * @brief USB resume 콜백
+ */
+void suspend_wakeup_init_user(void)
+{
+    #ifdef RF_DONGLE_MODE_ENABLE
+    rfSetRxDutyCycle(0, 0);
+    key_protocol_set_power_state(KEY_PROTOCOL_POWER_ACTIVE);
+    #endif
+    apLvglSetSuspend(false);
 }
 
 /**
@@ -127,6 +208,12 @@ report_mouse_t pointing_device_task_user(report_mouse_t mouse_report)
 layer_state_t layer_state_set_user(layer_state_t state)
 {
     uint8_t layer = get_highest_layer(state);
+
+    // 레이어 변경 시점에 한 번만 유효 키맵 테이블을 다시 만든다
+    dynamic_keymap_update_effective(state | default_layer_state);
+#ifdef POINTING_DEVICE_ENABLE
+    motion_pipeline_set_layer(get_highest_layer(state | default_layer_state));
+#endif
     apLvglUpdateLayer(layer);
 
     return state;   
@@ -144,9 +231,25 @@ void cliQmk(cli_args_t *args)
     ret = true;
   }
 
+  if (args->argc >= 1 && args->isStr(0, "bench"))
+  {
+    uint32_t runs = 1000;
+
+    if (args->argc == 2)
+      runs = args->getData(1);
+
+    // QMK 스레드에서 실행되는 동안(약 1~2초) 키 입력은 처리되지 않음
+    if (qmk_bench_run(runs))
+      qmk_bench_print();
+    else
+      cliPrintf("bench fail (runs 1~1000)\n");
+    ret = true;
+  }
+
   if (ret == false)
   {
     cliPrintf("qmk info\n");
     cliPrintf("qmk clear eeprom\n");
+    cliPrintf("qmk bench [runs]\n");
   }
 }
\ No newline at end of file
@@ -13,6 +13,9 @@ extern "C" {
 
 bool qmkInit(void);
 void qmkUpdate(void);
+void qmkUpdateIdle(void);
+void qmkLock(void);
+void qmkUnlock(void);
 
 
 #ifdef __cplusplus
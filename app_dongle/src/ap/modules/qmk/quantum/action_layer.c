@@ -6,6 +6,9 @@
 #include "encoder.h"
 #include "util.h"
 #include "action_layer.h"
+#if defined(DYNAMIC_KEYMAP_ENABLE)
+#    include "dynamic_keymap.h"
+#endif
 
 /** \brief Default Layer State
  */
@@ -326,6 +329,13 @@ uint8_t layer_switch_get_layer(keypos_t key) {
     action.code = ACTION_TRANSPARENT;
 
     layer_state_t layers = layer_state | default_layer_state;
+#    if defined(DYNAMIC_KEYMAP_ENABLE)
+    /* matrix keys: only KC_TRANSPARENT maps to ACTION_TRANSPARENT, so the
+     * precomputed effective keymap gives the same answer as the walk below */
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        return dynamic_keymap_get_effective_layer(layers, key.row, key.col);
+    }
+#    endif
     /* check top layer first */
     for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
         if (layers & ((layer_state_t)1 << i)) {
@@ -20,8 +20,14 @@
 #    else
 #        define IS_TAPPING_RECORD(r) (KEYEQ(tapping_key.event.key, (r->event.key)) && tapping_key.keycode == r->keycode)
 #    endif
-#    define WITHIN_TAPPING_TERM(e) (TIMER_DIFF_16(e.time, tapping_key.event.time) < GET_TAPPING_TERM(get_record_keycode(&tapping_key, false), &tapping_key))
-#    define WITHIN_QUICK_TAP_TERM(e) (TIMER_DIFF_16(e.time, tapping_key.event.time) < GET_QUICK_TAP_TERM(get_record_keycode(&tapping_key, false), &tapping_key))
+#    ifdef EVENT_TIME_US
+// Compare event times in microseconds so both ends of the term are not rounded to a millisecond
+#        define WITHIN_TAPPING_TERM(e) (TIMER_DIFF_FAST(e.time_us, tapping_key.event.time_us) < TIMER_FAST_MS(GET_TAPPING_TERM(get_record_keycode(&tapping_key, false), &tapping_key)))
+#        define WITHIN_QUICK_TAP_TERM(e) (TIMER_DIFF_FAST(e.time_us, tapping_key.event.time_us) < TIMER_FAST_MS(GET_QUICK_TAP_TERM(get_record_keycode(&tapping_key, false), &tapping_key)))
+#    else
+#        define WITHIN_TAPPING_TERM(e) (TIMER_DIFF_16(e.time, tapping_key.event.time) < GET_TAPPING_TERM(get_record_keycode(&tapping_key, false), &tapping_key))
+#        define WITHIN_QUICK_TAP_TERM(e) (TIMER_DIFF_16(e.time, tapping_key.event.time) < GET_QUICK_TAP_TERM(get_record_keycode(&tapping_key, false), &tapping_key))
+#    endif
 
 #    ifdef DYNAMIC_TAPPING_TERM_ENABLE
 uint16_t g_tapping_term = TAPPING_TERM;
@@ -307,6 +313,9 @@ bool process_tapping(keyrecord_t *keyp) {
                             .tap           = tapping_key.tap,
                             .event.key     = tapping_key.event.key,
                             .event.time    = event.time,
+#    ifdef EVENT_TIME_US
+                            .event.time_us = event.time_us,
+#    endif
                             .event.pressed = false,
                             .event.type    = tapping_key.event.type,
 #    ifdef COMBO_ENABLE
@@ -358,6 +367,9 @@ bool process_tapping(keyrecord_t *keyp) {
                             .tap           = tapping_key.tap,
                             .event.key     = tapping_key.event.key,
                             .event.time    = event.time,
+#    ifdef EVENT_TIME_US
+                            .event.time_us = event.time_us,
+#    endif
                             .event.pressed = false,
                             .event.type    = tapping_key.event.type,
 #    ifdef COMBO_ENABLE
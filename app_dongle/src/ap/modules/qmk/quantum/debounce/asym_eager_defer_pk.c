@@ -37,10 +37,26 @@ releasing a key, that state is pushed after no changes occur for DEBOUNCE millis
 #    define DEBOUNCE 5
 #endif
 
-// Maximum debounce: 127ms
-#if DEBOUNCE > 127
-#    undef DEBOUNCE
-#    define DEBOUNCE 127
+// DEBOUNCE_US: debounce time in microseconds, counted in DEBOUNCE_TICK_US steps of the
+// microsecond fast timer (FAST_TIMER_US). Otherwise the counters run in milliseconds.
+#ifdef DEBOUNCE_US
+#    ifndef FAST_TIMER_US
+#        error "DEBOUNCE_US requires FAST_TIMER_US"
+#    endif
+#    ifndef DEBOUNCE_TICK_US
+#        define DEBOUNCE_TICK_US 100
+#    endif
+#    define DEBOUNCE_TICKS ((DEBOUNCE_US + DEBOUNCE_TICK_US - 1) / DEBOUNCE_TICK_US)
+#    define DEBOUNCE_TICK DEBOUNCE_TICK_US
+#else
+#    define DEBOUNCE_TICKS DEBOUNCE
+#    define DEBOUNCE_TICK TIMER_FAST_MS(1)
+#endif
+
+// Maximum debounce: 127 ticks (127ms, or 127 * DEBOUNCE_TICK_US with DEBOUNCE_US)
+#if DEBOUNCE_TICKS > 127
+#    undef DEBOUNCE_TICKS
+#    define DEBOUNCE_TICKS 127
 #endif
 
 #define ROW_SHIFTER ((matrix_row_t)1)
@@ -50,7 +66,7 @@ typedef struct {
     uint8_t time : 7;
 } debounce_counter_t;
 
-#if DEBOUNCE > 0
+#if DEBOUNCE_TICKS > 0
 static debounce_counter_t *debounce_counters;
 static fast_timer_t        last_time;
 static bool                counters_need_update;
@@ -84,9 +100,10 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
 
     if (counters_need_update) {
         fast_timer_t now          = timer_read_fast();
-        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time);
+        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time) / DEBOUNCE_TICK;
 
-        last_time    = now;
+        // keep the sub-tick remainder, a microsecond fast timer would otherwise lose up to a tick per scan
+        last_time += elapsed_time * DEBOUNCE_TICK;
         updated_last = true;
         if (elapsed_time > UINT8_MAX) {
             elapsed_time = UINT8_MAX;
@@ -154,7 +171,7 @@ static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], ui
             if (delta & col_mask) {
                 if (debounce_pointer->time == DEBOUNCE_ELAPSED) {
                     debounce_pointer->pressed = (raw[row] & col_mask);
-                    debounce_pointer->time    = DEBOUNCE;
+                    debounce_pointer->time    = DEBOUNCE_TICKS;
                     counters_need_update      = true;
 
                     if (debounce_pointer->pressed) {
@@ -39,6 +39,9 @@ No further inputs are accepted until DEBOUNCE milliseconds have occurred.
 #    define DEBOUNCE UINT8_MAX
 #endif
 
+// Counters run in milliseconds regardless of the fast timer resolution
+#define DEBOUNCE_TICK TIMER_FAST_MS(1)
+
 typedef uint8_t debounce_counter_t;
 
 #if DEBOUNCE > 0
@@ -73,9 +76,10 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
 
     if (counters_need_update) {
         fast_timer_t now          = timer_read_fast();
-        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time);
+        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time) / DEBOUNCE_TICK;
 
-        last_time    = now;
+        // keep the sub-tick remainder, a microsecond fast timer would otherwise lose up to a tick per scan
+        last_time += elapsed_time * DEBOUNCE_TICK;
         updated_last = true;
         if (elapsed_time > UINT8_MAX) {
             elapsed_time = UINT8_MAX;
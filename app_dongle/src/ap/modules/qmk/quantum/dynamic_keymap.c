@@ -110,8 +110,21 @@ void *dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t c
     return ((void *)DYNAMIC_KEYMAP_EEPROM_ADDR) + (layer * MATRIX_ROWS * MATRIX_COLS * 2) + (row * MATRIX_COLS * 2) + (column * 2);
 }
 
-uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
-    if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
+// RAM copy of the keymap in EEPROM, so lookups don't go through the EEPROM driver.
+// Loaded on first access and kept in sync by dynamic_keymap_set_keycode/set_buffer.
+static uint16_t      keymap_cache[DYNAMIC_KEYMAP_LAYER_COUNT][MATRIX_ROWS][MATRIX_COLS];
+static volatile bool keymap_cache_valid = false;
+// Bumped on every keymap write; the effective table is rebuilt when it differs.
+static volatile uint32_t keymap_cache_gen = 0;
+
+// Resolved layer/keycode per key for effective_state (highest active non-transparent layer).
+static uint8_t       effective_layer[MATRIX_ROWS][MATRIX_COLS];
+static uint16_t      effective_keycode[MATRIX_ROWS][MATRIX_COLS];
+static layer_state_t effective_state = 0;
+static uint32_t      effective_gen   = 0;
+static bool          effective_valid = false;
+
+static uint16_t dynamic_keymap_read_keycode(uint8_t layer, uint8_t row, uint8_t column) {
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = eeprom_read_byte(address) << 8;
@@ -119,12 +132,78 @@ uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column)
     return keycode;
 }
 
+void dynamic_keymap_cache_load(void) {
+    for (uint8_t layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t column = 0; column < MATRIX_COLS; column++) {
+                keymap_cache[layer][row][column] = dynamic_keymap_read_keycode(layer, row, column);
+            }
+        }
+    }
+    keymap_cache_gen++;
+    keymap_cache_valid = true;
+}
+
+uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
+    if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
+    if (!keymap_cache_valid) {
+        dynamic_keymap_cache_load();
+    }
+    return keymap_cache[layer][row][column];
+}
+
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return;
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
     eeprom_update_byte(address, (uint8_t)(keycode >> 8));
     eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+    keymap_cache[layer][row][column] = keycode;
+    keymap_cache_gen++;
+}
+
+uint32_t dynamic_keymap_get_generation(void) {
+    return keymap_cache_gen;
+}
+
+void dynamic_keymap_update_effective(layer_state_t layers) {
+    if (!keymap_cache_valid) {
+        dynamic_keymap_cache_load();
+    }
+    // Sample the generation first: a write racing with the rebuild (VIA runs in the
+    // USB context) leaves effective_gen stale, so the next lookup rebuilds again.
+    uint32_t gen = keymap_cache_gen;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t column = 0; column < MATRIX_COLS; column++) {
+            uint8_t  layer   = 0;
+            uint16_t keycode = keymap_cache[0][row][column];
+            for (int8_t i = DYNAMIC_KEYMAP_LAYER_COUNT - 1; i > 0; i--) {
+                if ((layers & ((layer_state_t)1 << i)) && keymap_cache[i][row][column] != KC_TRANSPARENT) {
+                    layer   = i;
+                    keycode = keymap_cache[i][row][column];
+                    break;
+                }
+            }
+            effective_layer[row][column]   = layer;
+            effective_keycode[row][column] = keycode;
+        }
+    }
+    effective_state = layers;
+    effective_gen   = gen;
+    effective_valid = true;
+}
+
+uint8_t dynamic_keymap_get_effective_layer(layer_state_t layers, uint8_t row, uint8_t column) {
+    if (row >= MATRIX_ROWS || column >= MATRIX_COLS) return 0;
+    if (!effective_valid || effective_state != layers || effective_gen != keymap_cache_gen) {
+        dynamic_keymap_update_effective(layers);
+    }
+    return effective_layer[row][column];
+}
+
+uint16_t dynamic_keymap_get_effective_keycode(uint8_t row, uint8_t column) {
+    if (row >= MATRIX_ROWS || column >= MATRIX_COLS || !effective_valid) return KC_NO;
+    return effective_keycode[row][column];
 }
 
 #ifdef ENCODER_MAP_ENABLE
@@ -189,10 +268,20 @@ void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < dynamic_keymap_eeprom_size) {
             eeprom_update_byte(target, *source);
+            if (keymap_cache_valid) {
+                uint16_t *keycode = &((uint16_t *)keymap_cache)[(offset + i) / 2];
+                // Big endian in EEPROM, native in the cache
+                if ((offset + i) & 1) {
+                    *keycode = (*keycode & 0xFF00) | *source;
+                } else {
+                    *keycode = (*keycode & 0x00FF) | ((uint16_t)*source << 8);
+                }
+            }
         }
         source++;
         target++;
     }
+    keymap_cache_gen++;
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
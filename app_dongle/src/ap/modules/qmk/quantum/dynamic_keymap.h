@@ -17,6 +17,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "action_layer.h"
 
 uint8_t  dynamic_keymap_get_layer_count(void);
 void *   dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t column);
@@ -27,6 +28,17 @@ uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool cloc
 void     dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise, uint16_t keycode);
 #endif // ENCODER_MAP_ENABLE
 void dynamic_keymap_reset(void);
+// Keycodes are served from a RAM copy of the EEPROM keymap, loaded on first use.
+void dynamic_keymap_cache_load(void);
+// Changes whenever a keycode is written, for tables derived from the keymap
+uint32_t dynamic_keymap_get_generation(void);
+// Effective keymap: for each key, the highest layer in `layers` that isn't KC_TRANSPARENT
+// (layer 0 if none). Rebuilt only when the layer state or the keymap changes, so
+// layer_switch_get_layer() is a single table load per key.
+void     dynamic_keymap_update_effective(layer_state_t layers);
+uint8_t  dynamic_keymap_get_effective_layer(layer_state_t layers, uint8_t row, uint8_t column);
+// Keycode from the last built table, without rebuilding (safe for the display thread)
+uint16_t dynamic_keymap_get_effective_keycode(uint8_t row, uint8_t column);
 // These get/set the keycodes as stored in the EEPROM buffer
 // Data is big-endian 16-bit values (the keycodes)
 // Order is by layer/row/column
@@ -555,6 +555,17 @@ static bool matrix_task(void) {
 
     const bool process_keypress = should_process_keypress();
 
+#ifdef MATRIX_EVENT_TIME
+    // Changes seen by one scan can come from different sources, run them in the order they happened
+    keyevent_t events[MATRIX_EVENT_BUFFER_SIZE];
+    uint8_t    event_count = 0;
+#    ifdef EVENT_TIME_US
+#        define EVENT_BEFORE(a, b) ((int32_t)TIMER_DIFF_FAST((a).time_us, (b).time_us) < 0)
+#    else
+#        define EVENT_BEFORE(a, b) ((int16_t)TIMER_DIFF_16((a).time, (b).time) < 0)
+#    endif
+#endif
+
     for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
         const matrix_row_t current_row = matrix_get_row(row);
         const matrix_row_t row_changes = current_row ^ matrix_previous[row];
@@ -569,7 +580,30 @@ static bool matrix_task(void) {
                 const bool key_pressed = current_row & col_mask;
 
                 if (process_keypress) {
+#ifdef MATRIX_EVENT_TIME
+                    keyevent_t event = MAKE_KEYEVENT(row, col, key_pressed);
+                    event.time       = matrix_event_time(row, col);
+#    ifdef EVENT_TIME_US
+                    event.time_us    = matrix_event_time_us(row, col);
+#    endif
+
+                    if (event_count == MATRIX_EVENT_BUFFER_SIZE) {
+                        // buffer full: run what we have first so overflow events never overtake them
+                        for (uint8_t i = 0; i < event_count; i++) {
+                            action_exec(events[i]);
+                        }
+                        event_count = 0;
+                    }
+
+                    uint8_t i = event_count++;
+                    while (i > 0 && EVENT_BEFORE(event, events[i - 1])) {
+                        events[i] = events[i - 1];
+                        i--;
+                    }
+                    events[i] = event;
+#else
                     action_exec(MAKE_KEYEVENT(row, col, key_pressed));
+#endif
                 }
 
                 switch_events(row, col, key_pressed);
@@ -579,6 +613,12 @@ static bool matrix_task(void) {
         matrix_previous[row] = current_row;
     }
 
+#ifdef MATRIX_EVENT_TIME
+    for (uint8_t i = 0; i < event_count; i++) {
+        action_exec(events[i]);
+    }
+#endif
+
     return matrix_changed;
 }
 
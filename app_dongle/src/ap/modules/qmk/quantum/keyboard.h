@@ -38,6 +38,9 @@ typedef enum keyevent_type_t { TICK_EVENT = 0, KEY_EVENT = 1, ENCODER_CW_EVENT =
 typedef struct {
     keypos_t        key;
     uint16_t        time;
+#ifdef EVENT_TIME_US
+    fast_timer_t    time_us; // microsecond fast timer, used by tapping instead of time
+#endif
     keyevent_type_t type;
     bool            pressed;
 } keyevent_t;
@@ -74,13 +77,36 @@ static inline bool IS_DIPSWITCHEVENT(const keyevent_t event) {
 #define MAKE_KEYPOS(row_num, col_num) ((keypos_t){.row = (row_num), .col = (col_num)})
 
 /* Common keyevent_t object factory */
-#define MAKE_EVENT(row_num, col_num, press, event_type) ((keyevent_t){.key = MAKE_KEYPOS((row_num), (col_num)), .pressed = (press), .time = timer_read(), .type = (event_type)})
+#ifdef EVENT_TIME_US
+#    ifndef FAST_TIMER_US
+#        error "EVENT_TIME_US requires FAST_TIMER_US"
+#    endif
+#    define MAKE_EVENT(row_num, col_num, press, event_type) ((keyevent_t){.key = MAKE_KEYPOS((row_num), (col_num)), .pressed = (press), .time = timer_read(), .time_us = timer_read_fast(), .type = (event_type)})
+#else
+#    define MAKE_EVENT(row_num, col_num, press, event_type) ((keyevent_t){.key = MAKE_KEYPOS((row_num), (col_num)), .pressed = (press), .time = timer_read(), .type = (event_type)})
+#endif
 
 /**
  * @brief Constructs a key event for a pressed or released key.
  */
 #define MAKE_KEYEVENT(row_num, col_num, press) MAKE_EVENT((row_num), (col_num), (press), KEY_EVENT)
 
+#ifdef MATRIX_EVENT_TIME
+#    ifndef MATRIX_EVENT_BUFFER_SIZE
+#        define MATRIX_EVENT_BUFFER_SIZE 8
+#    endif
+/**
+ * @brief Returns the time a matrix key changed, for matrices that know it better than the scan that saw the change (e.g. remote halves with their own scan timestamps).
+ */
+uint16_t matrix_event_time(uint8_t row, uint8_t col);
+#    ifdef EVENT_TIME_US
+/**
+ * @brief Same as matrix_event_time() on the microsecond fast timer.
+ */
+fast_timer_t matrix_event_time_us(uint8_t row, uint8_t col);
+#    endif
+#endif
+
 /**
  * @brief Constructs a combo event.
  */
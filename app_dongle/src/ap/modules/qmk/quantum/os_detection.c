@@ -75,7 +75,7 @@ static volatile fast_timer_t last_time;
 void os_detection_task(void) {
     if (current_usb_device_state == USB_DEVICE_STATE_CONFIGURED) {
         // debouncing goes for both the detected OS as well as the USB state
-        if (debouncing && timer_elapsed_fast(last_time) >= OS_DETECTION_DEBOUNCE) {
+        if (debouncing && timer_elapsed_fast(last_time) >= TIMER_FAST_MS(OS_DETECTION_DEBOUNCE)) {
             debouncing                = false;
             reported_usb_device_state = current_usb_device_state;
             if (detected_os != reported_os || first_report) {
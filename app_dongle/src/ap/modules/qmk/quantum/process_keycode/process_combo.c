@@ -16,6 +16,7 @@
 
 #include "process_combo.h"
 #include <stddef.h>
+#include <string.h>
 #include "process_auto_shift.h"
 #include "caps_word.h"
 #include "timer.h"
@@ -26,6 +27,9 @@
 #include "action_tapping.h"
 #include "action_util.h"
 #include "keymap_introspection.h"
+#if defined(COMBO_KEY_INDEX) && defined(DYNAMIC_KEYMAP_ENABLE)
+#    include "dynamic_keymap.h"
+#endif
 
 __attribute__((weak)) void process_combo_event(uint16_t combo_index, bool pressed) {}
 
@@ -77,6 +81,16 @@ static uint16_t timer = 0;
 static bool     b_combo_enable = true; // defaults to enabled
 static uint16_t longest_term   = 0;
 
+__attribute__((weak)) uint16_t combo_event_time(keyrecord_t *record) {
+#ifdef MATRIX_EVENT_TIME
+    // key events already carry the time the key changed
+    if (IS_KEYEVENT(record->event)) {
+        return record->event.time;
+    }
+#endif
+    return timer_read();
+}
+
 typedef struct {
     keyrecord_t record;
     uint16_t    combo_index;
@@ -191,9 +205,115 @@ static inline uint16_t _get_combo_term(uint16_t combo_index, combo_t *combo) {
     return COMBO_TERM;
 }
 
+#ifdef COMBO_KEY_INDEX
+#    define COMBO_INDEX_WORDS ((COMBO_KEY_INDEX_MAX + 31) / 32)
+
+static uint32_t combo_key_index[MATRIX_ROWS][MATRIX_COLS][COMBO_INDEX_WORDS];
+static uint32_t combo_touched[COMBO_INDEX_WORDS];
+static bool     combo_index_valid = false;
+#    ifdef DYNAMIC_KEYMAP_ENABLE
+static uint32_t combo_index_keymap_gen = 0;
+#    endif
+
+void combo_index_invalidate(void) {
+    combo_index_valid = false;
+}
+
+static bool combo_index_is_valid(void) {
+#    ifdef DYNAMIC_KEYMAP_ENABLE
+    return combo_index_valid && combo_index_keymap_gen == dynamic_keymap_get_generation();
+#    else
+    return combo_index_valid;
+#    endif
+}
+
+/* A key can take part in a combo when any layer maps it to one of the combo's
+ * keycodes. That is a superset of what process_single_combo() will accept, so
+ * skipping the other combos does not change the result. */
+static void combo_index_build(void) {
+    uint16_t count = combo_count();
+
+    memset(combo_key_index, 0, sizeof(combo_key_index));
+    memset(combo_touched, 0, sizeof(combo_touched));
+#    ifdef DYNAMIC_KEYMAP_ENABLE
+    combo_index_keymap_gen = dynamic_keymap_get_generation();
+#    endif
+    if (count > COMBO_KEY_INDEX_MAX) {
+        // too many combos for the index, process_combo() scans all of them
+        combo_index_valid = false;
+        return;
+    }
+
+    // combos held down while the index was stale still need their release
+    for (uint16_t idx = 0; idx < count; idx++) {
+        combo_t *combo = combo_get(idx);
+        if (COMBO_ACTIVE(combo)) {
+            combo_touched[idx / 32] |= (uint32_t)1 << (idx % 32);
+        } else {
+            RESET_COMBO_STATE(combo);
+        }
+    }
+
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            uint16_t keycodes[MAX_LAYER];
+            uint8_t  layers = keymap_layer_count();
+
+            if (layers > MAX_LAYER) layers = MAX_LAYER;
+            for (uint8_t layer = 0; layer < layers; layer++) {
+                keycodes[layer] = keymap_key_to_keycode(layer, MAKE_KEYPOS(row, col));
+            }
+            for (uint16_t idx = 0; idx < count; idx++) {
+                const uint16_t *keys = combo_get(idx)->keys;
+                bool            hit  = false;
+                uint16_t        key;
+
+                for (uint8_t i = 0; !hit && (key = pgm_read_word(&keys[i])) != COMBO_END; i++) {
+                    for (uint8_t layer = 0; layer < layers; layer++) {
+                        if (keycodes[layer] == key) {
+                            hit = true;
+                            break;
+                        }
+                    }
+                }
+                if (hit) {
+                    combo_key_index[row][col][idx / 32] |= (uint32_t)1 << (idx % 32);
+                }
+            }
+        }
+    }
+    combo_index_valid = true;
+}
+
+static const uint32_t *combo_index_get(keyrecord_t *record) {
+    if (!combo_index_is_valid() || record->event.type != KEY_EVENT || record->event.key.row >= MATRIX_ROWS || record->event.key.col >= MATRIX_COLS) {
+        return NULL;
+    }
+    return combo_key_index[record->event.key.row][record->event.key.col];
+}
+#endif
+
 void clear_combos(void) {
     uint16_t index = 0;
     longest_term   = 0;
+#ifdef COMBO_KEY_INDEX
+    if (combo_index_is_valid()) {
+        for (uint16_t w = 0; w < COMBO_INDEX_WORDS; w++) {
+            uint32_t bits = combo_touched[w];
+            while (bits) {
+                index = w * 32 + __builtin_ctz(bits);
+                bits &= bits - 1;
+
+                combo_t *combo = combo_get(index);
+                if (!COMBO_ACTIVE(combo)) {
+                    RESET_COMBO_STATE(combo);
+                    combo_touched[w] &= ~((uint32_t)1 << (index % 32));
+                }
+            }
+        }
+        return;
+    }
+#endif
     for (index = 0; index < combo_count(); ++index) {
         combo_t *combo = combo_get(index);
         if (!COMBO_ACTIVE(combo)) {
@@ -414,7 +534,14 @@ static bool keys_pressed_in_order(uint16_t combo_index, combo_t *combo, uint16_t
 }
 #endif
 
-static bool process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *record, uint16_t combo_index) {
+/* Time between two key events. Keys from different halves can arrive out of
+ * order, so the window is symmetric. */
+static inline uint16_t combo_time_gap(uint16_t a, uint16_t b) {
+    int16_t diff = (int16_t)TIMER_DIFF_16(a, b);
+    return diff < 0 ? -diff : diff;
+}
+
+static bool process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *record, uint16_t combo_index, uint16_t event_time) {
     uint8_t  key_count = 0;
     uint16_t key_index = -1;
     _find_key_index_and_count(combo->keys, keycode, &key_index, &key_count);
@@ -423,6 +550,9 @@ static bool process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *
     if (-1 == (int16_t)key_index) {
         return false;
     }
+#ifdef COMBO_KEY_INDEX
+    combo_touched[combo_index / 32] |= (uint32_t)1 << (combo_index % 32);
+#endif
 
     bool key_is_part_of_combo = (!COMBO_DISABLED(combo) && is_combo_enabled()
 #if defined(COMBO_MUST_PRESS_IN_ORDER) || defined(COMBO_MUST_PRESS_IN_ORDER_PER_COMBO)
@@ -447,7 +577,7 @@ static bool process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *
 
 #ifndef COMBO_NO_TIMER
             /* Don't buffer this combo if its combo term has passed. */
-            if (timer && timer_elapsed(timer) > time) {
+            if (timer && combo_time_gap(event_time, timer) > time) {
                 DISABLE_COMBO(combo);
                 return true;
             } else
@@ -535,8 +665,8 @@ static bool process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *
 }
 
 bool process_combo(uint16_t keycode, keyrecord_t *record) {
-    bool is_combo_key          = false;
-    bool no_combo_keys_pressed = true;
+    bool     is_combo_key = false;
+    uint16_t event_time   = combo_event_time(record);
 
     if (keycode == QK_COMBO_ON && record->event.pressed) {
         combo_enable();
@@ -564,10 +694,25 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     }
 #endif
 
-    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
-        combo_t *combo = combo_get(idx);
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+#ifdef COMBO_KEY_INDEX
+    const uint32_t *candidates = combo_index_get(record);
+    if (candidates) {
+        /* only combos containing this key */
+        for (uint16_t w = 0; w < COMBO_INDEX_WORDS; w++) {
+            uint32_t bits = candidates[w];
+            while (bits) {
+                uint16_t idx = w * 32 + __builtin_ctz(bits);
+                bits &= bits - 1;
+                is_combo_key |= process_single_combo(combo_get(idx), keycode, record, idx, event_time);
+            }
+        }
+    } else
+#endif
+    {
+        for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+            combo_t *combo = combo_get(idx);
+            is_combo_key |= process_single_combo(combo, keycode, record, idx, event_time);
+        }
     }
 
     if (record->event.pressed && is_combo_key) {
@@ -575,10 +720,13 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
 #    ifdef COMBO_STRICT_TIMER
         if (!timer) {
             // timer is set only on the first key
-            timer = timer_read();
+            timer = event_time;
         }
 #    else
-        timer = timer_read();
+        // latest key by scan time, keys can arrive out of order
+        if (!timer || (int16_t)TIMER_DIFF_16(event_time, timer) > 0) {
+            timer = event_time;
+        }
 #    endif
 #endif
 
@@ -610,6 +758,13 @@ void combo_task(void) {
         return;
     }
 
+#ifdef COMBO_KEY_INDEX
+    /* rebuild between chords, process_combo() scans all combos until then */
+    if (key_buffer_size == 0 && !combo_index_is_valid()) {
+        combo_index_build();
+    }
+#endif
+
 #ifndef COMBO_NO_TIMER
     if (timer && timer_elapsed(timer) > longest_term) {
         if (combo_buffer_read != combo_buffer_write) {
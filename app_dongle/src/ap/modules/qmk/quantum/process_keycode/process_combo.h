@@ -76,6 +76,19 @@ typedef struct combo_t {
 bool process_combo(uint16_t keycode, keyrecord_t *record);
 void combo_task(void);
 void process_combo_event(uint16_t combo_index, bool pressed);
+// Time of a key event used for the combo window, defaults to the time it is processed
+// (or the event time with MATRIX_EVENT_TIME)
+uint16_t combo_event_time(keyrecord_t *record);
+
+#ifdef COMBO_KEY_INDEX
+// Per matrix key bitset of the combos it can take part in. Combos are only
+// evaluated for keys whose bit is set, and only combos that saw a key are reset.
+// Call after combos change; keymap changes are picked up automatically.
+#    ifndef COMBO_KEY_INDEX_MAX
+#        define COMBO_KEY_INDEX_MAX 64
+#    endif
+void combo_index_invalidate(void);
+#endif
 
 void combo_enable(void);
 void combo_disable(void);
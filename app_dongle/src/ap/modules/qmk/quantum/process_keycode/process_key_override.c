@@ -23,6 +23,7 @@
 #include "action_util.h"
 #include "quantum.h"
 #include "quantum_keycodes.h"
+#include <string.h>
 
 #ifndef KEY_OVERRIDE_REPEAT_DELAY
 #    define KEY_OVERRIDE_REPEAT_DELAY 500
@@ -112,6 +113,13 @@ bool key_override_is_enabled(void) {
     return enabled;
 }
 
+void key_override_deactivate(const key_override_t *override) {
+    // the replacement that was registered must be released before it is overwritten
+    if (override != NULL && override == active_override) {
+        clear_active_override(false);
+    }
+}
+
 // Returns whether the modifiers that are pressed are such that the override should activate
 static bool key_override_matches_active_modifiers(const key_override_t *override, const uint8_t mods) {
     // Check that negative keys pass
@@ -245,13 +253,165 @@ static bool check_activation_event(const key_override_t *override, const bool ke
     }
 }
 
+#ifdef KEY_OVERRIDE_INDEX
+#    define KO_INDEX_WORDS ((KEY_OVERRIDE_INDEX_MAX + 31) / 32)
+
+typedef struct {
+    uint16_t trigger;
+    uint32_t bits[KO_INDEX_WORDS];
+} ko_trigger_index_t;
+
+// Distinct triggers sorted by keycode, each with the overrides using it
+static ko_trigger_index_t     ko_trigger_index[KEY_OVERRIDE_INDEX_MAX];
+static uint8_t                ko_trigger_count = 0;
+static uint32_t               ko_layer_bits[MAX_LAYER][KO_INDEX_WORDS];
+static uint32_t               ko_negative_bits[8][KO_INDEX_WORDS];
+static uint32_t               ko_needs_mods_bits[KO_INDEX_WORDS];
+static const key_override_t **ko_index_list  = NULL;
+static bool                   ko_index_built = false;
+static bool                   ko_index_valid = false;
+
+void key_override_index_invalidate(void) {
+    ko_index_built = false;
+}
+
+static ko_trigger_index_t *key_override_index_find(uint16_t trigger) {
+    uint8_t lo = 0;
+    uint8_t hi = ko_trigger_count;
+
+    while (lo < hi) {
+        uint8_t mid = (lo + hi) / 2;
+        if (ko_trigger_index[mid].trigger < trigger) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo < ko_trigger_count && ko_trigger_index[lo].trigger == trigger ? &ko_trigger_index[lo] : NULL;
+}
+
+/* Everything the loop below checks that does not depend on the event type
+ * becomes a bitset: trigger keycode, layer, required and negative mods. */
+static void key_override_index_build(void) {
+    memset(ko_trigger_index, 0, sizeof(ko_trigger_index));
+    memset(ko_layer_bits, 0, sizeof(ko_layer_bits));
+    memset(ko_negative_bits, 0, sizeof(ko_negative_bits));
+    memset(ko_needs_mods_bits, 0, sizeof(ko_needs_mods_bits));
+    ko_trigger_count = 0;
+    ko_index_list    = key_overrides;
+    ko_index_built   = true;
+    ko_index_valid   = false;
+
+    if (key_overrides == NULL) {
+        return;
+    }
+
+    for (uint16_t i = 0; key_overrides[i] != NULL; i++) {
+        const key_override_t *override = key_overrides[i];
+        ko_trigger_index_t   *entry;
+        uint32_t              bit  = (uint32_t)1 << (i % 32);
+        uint8_t               word = i / 32;
+
+        if (i >= KEY_OVERRIDE_INDEX_MAX) {
+            // too many overrides for the index, scan all of them
+            return;
+        }
+
+        entry = key_override_index_find(override->trigger);
+        if (entry == NULL) {
+            uint8_t pos = 0;
+
+            while (pos < ko_trigger_count && ko_trigger_index[pos].trigger < override->trigger) {
+                pos++;
+            }
+            memmove(&ko_trigger_index[pos + 1], &ko_trigger_index[pos], (ko_trigger_count - pos) * sizeof(ko_trigger_index_t));
+            memset(&ko_trigger_index[pos], 0, sizeof(ko_trigger_index_t));
+            ko_trigger_index[pos].trigger = override->trigger;
+            ko_trigger_count++;
+            entry = &ko_trigger_index[pos];
+        }
+        entry->bits[word] |= bit;
+
+        for (uint8_t layer = 0; layer < MAX_LAYER; layer++) {
+            if (override->layers & ((layer_state_t)1 << layer)) {
+                ko_layer_bits[layer][word] |= bit;
+            }
+        }
+        for (uint8_t mod = 0; mod < 8; mod++) {
+            if (override->negative_mod_mask & (1 << mod)) {
+                ko_negative_bits[mod][word] |= bit;
+            }
+        }
+        if (override->trigger_mods != 0) {
+            ko_needs_mods_bits[word] |= bit;
+        }
+    }
+    ko_index_valid = true;
+}
+
+/* Overrides that can activate on this event: only those triggered by the
+ * pressed key, the last key down or no key at all can pass the trigger check. */
+static bool key_override_index_candidates(uint32_t *candidates, uint16_t keycode, uint8_t layer, uint8_t active_mods) {
+    const uint16_t      triggers[3] = {keycode, last_key_down, KC_NO};
+    ko_trigger_index_t *entry;
+
+    if (!ko_index_built || ko_index_list != key_overrides) {
+        key_override_index_build();
+    }
+    if (!ko_index_valid || layer >= MAX_LAYER) {
+        return false;
+    }
+
+    memset(candidates, 0, KO_INDEX_WORDS * sizeof(uint32_t));
+    for (uint8_t t = 0; t < 3; t++) {
+        entry = key_override_index_find(triggers[t]);
+        if (entry != NULL) {
+            for (uint8_t w = 0; w < KO_INDEX_WORDS; w++) {
+                candidates[w] |= entry->bits[w];
+            }
+        }
+    }
+    for (uint8_t w = 0; w < KO_INDEX_WORDS; w++) {
+        candidates[w] &= ko_layer_bits[layer][w];
+        if (active_mods == 0) {
+            candidates[w] &= ~ko_needs_mods_bits[w];
+        }
+        for (uint8_t mod = 0; mod < 8; mod++) {
+            if (active_mods & (1 << mod)) {
+                candidates[w] &= ~ko_negative_bits[mod][w];
+            }
+        }
+    }
+    return true;
+}
+#endif
+
 /** Iterates through the list of key overrides and tries activating each, until it finds one that activates or reaches the end of overrides. Returns true if the key action for `keycode` should be sent */
 static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
     if (key_overrides == NULL) {
         return true;
     }
 
+#ifdef KEY_OVERRIDE_INDEX
+    uint32_t   candidates[KO_INDEX_WORDS] = {0};
+    const bool use_index = key_override_index_candidates(candidates, keycode, layer, active_mods);
+    uint8_t    word      = 0;
+#endif
+
     for (uint8_t i = 0;; i++) {
+#ifdef KEY_OVERRIDE_INDEX
+        // visit candidates in list order, so the same override wins as without the index
+        if (use_index) {
+            while (word < KO_INDEX_WORDS && candidates[word] == 0) {
+                word++;
+            }
+            if (word == KO_INDEX_WORDS) {
+                break;
+            }
+            i = word * 32 + __builtin_ctz(candidates[word]);
+            candidates[word] &= candidates[word] - 1;
+        }
+#endif
         const key_override_t *const override = key_overrides[i];
 
         // End of array
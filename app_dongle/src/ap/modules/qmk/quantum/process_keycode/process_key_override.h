@@ -108,6 +108,20 @@ bool process_key_override(const uint16_t keycode, const keyrecord_t *const recor
 /** Perform any deferred keys */
 void key_override_task(void);
 
+/** Deactivates the override if it is the active one, call this before changing an override in place */
+void key_override_deactivate(const key_override_t *override);
+
+#ifdef KEY_OVERRIDE_INDEX
+/**
+ * Key overrides are looked up by trigger keycode, layer and mods through bitset indexes built from key_overrides.
+ * A different key_overrides array is picked up automatically, call this after changing the overrides in place.
+ */
+#    ifndef KEY_OVERRIDE_INDEX_MAX
+#        define KEY_OVERRIDE_INDEX_MAX 32
+#    endif
+void key_override_index_invalidate(void);
+#endif
+
 /**
  *  Preferrably use these macros to create key overrides. They fix many of the options to a standard setting that should satisfy most basic use-cases. Only directly create a key_override_t struct when you really need to.
  */
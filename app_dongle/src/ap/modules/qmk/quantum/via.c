@@ -221,6 +221,10 @@ __attribute__((weak)) void via_custom_value_command_kb(uint8_t *data, uint8_t le
 //      id_qmk_rgb_matrix_channel   ->  via_qmk_rgb_matrix_command()
 //      id_qmk_led_matrix_channel   ->  via_qmk_led_matrix_command()
 //      id_qmk_audio_channel        ->  via_qmk_audio_command()
+//      id_qmk_combo                ->  via_qmk_combo_command()
+//      id_qmk_key_override         ->  via_qmk_key_override_command()
+//      id_qmk_trackball            ->  via_qmk_trackball_command()
+//      id_qmk_motion               ->  via_qmk_motion_command()
 //
 __attribute__((weak)) void via_custom_value_command(uint8_t *data, uint8_t length) {
     // data = [ command_id, channel_id, value_id, value_data ]
@@ -261,6 +265,31 @@ __attribute__((weak)) void via_custom_value_command(uint8_t *data, uint8_t lengt
     }
 #endif // AUDIO_ENABLE
 
+#if defined(COMBO_ENABLE)
+    if (*channel_id == id_qmk_combo) {
+        via_qmk_combo_command(data, length);
+        return;
+    }
+#endif // COMBO_ENABLE
+
+#if defined(KEY_OVERRIDE_ENABLE)
+    if (*channel_id == id_qmk_key_override) {
+        via_qmk_key_override_command(data, length);
+        return;
+    }
+#endif // KEY_OVERRIDE_ENABLE
+
+#if defined(POINTING_DEVICE_ENABLE)
+    if (*channel_id == id_qmk_trackball) {
+        via_qmk_trackball_command(data, length);
+        return;
+    }
+    if (*channel_id == id_qmk_motion) {
+        via_qmk_motion_command(data, length);
+        return;
+    }
+#endif // POINTING_DEVICE_ENABLE
+
     (void)channel_id; // force use of variable
 
     // If we haven't returned before here, then let the keyboard level code
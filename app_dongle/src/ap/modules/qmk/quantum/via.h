@@ -118,6 +118,10 @@ enum via_channel_id {
     id_qmk_kill_switch_lr     = 10,
     id_qmk_kill_switch_ud     = 11,
     id_qmk_kkuk               = 12,
+    id_qmk_combo              = 13,
+    id_qmk_key_override       = 14,
+    id_qmk_trackball          = 15,
+    id_qmk_motion             = 16,
 };
 
 enum via_qmk_backlight_value {
@@ -204,6 +208,19 @@ void via_qmk_led_matrix_get_value(uint8_t *data);
 void via_qmk_led_matrix_save(void);
 #endif
 
+#if defined(COMBO_ENABLE)
+void via_qmk_combo_command(uint8_t *data, uint8_t length);
+#endif
+
+#if defined(KEY_OVERRIDE_ENABLE)
+void via_qmk_key_override_command(uint8_t *data, uint8_t length);
+#endif
+
+#if defined(POINTING_DEVICE_ENABLE)
+void via_qmk_trackball_command(uint8_t *data, uint8_t length);
+void via_qmk_motion_command(uint8_t *data, uint8_t length);
+#endif
+
 #if defined(AUDIO_ENABLE)
 void via_qmk_audio_command(uint8_t *data, uint8_t length);
 void via_qmk_audio_set_value(uint8_t *data);
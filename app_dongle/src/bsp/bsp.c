@@ -42,12 +42,19 @@ uint32_t millis(void)
   return (uint32_t)(k_uptime_get());
 }
 
+// 시스템 타이머(nRF52 는 RTC 32.768kHz, 약 30.5us 단위) 기준의 단조 증가 시간
+// 32bit 사이클로 변환하면 사이클이 wrap 될 때(약 36시간) us 값이 튀므로 64bit 로 변환해서
+// 2^32 us(약 71분) 마다 깨끗하게 wrap 되도록 한다 (QMK fast timer 의 TIMER_DIFF_32 계산용)
 uint32_t micros(void)
 {
+#ifdef CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER
+  return (uint32_t)(k_cyc_to_us_floor64(k_cycle_get_64()));
+#else
   uint32_t cycles;
 
   cycles = k_cycle_get_32();
 
   return (uint32_t)(k_cyc_to_us_floor32(cycles));
+#endif
 }
 
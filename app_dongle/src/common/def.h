@@ -57,6 +57,10 @@
 #define _DEF_OUTPUT_PULLUP    4
 #define _DEF_OUTPUT_PULLDOWN  5
 
+#define _DEF_INTR_RISING      0
+#define _DEF_INTR_FALLING     1
+#define _DEF_INTR_BOTH        2
+
 #define _DEF_CAN1             0
 #define _DEF_CAN2             1
 
@@ -0,0 +1,29 @@
+/*
+ * cycle.h
+ *
+ *  CPU 사이클 카운터 (코드 실행 시간 측정용)
+ */
+
+#ifndef SRC_COMMON_HW_INCLUDE_CYCLE_H_
+#define SRC_COMMON_HW_INCLUDE_CYCLE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "hw_def.h"
+
+#ifdef _USE_HW_CYCLE
+
+
+bool     cycleInit(void);
+uint32_t cycleGet(void);
+uint32_t cycleGetFreqMhz(void);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SRC_COMMON_HW_INCLUDE_CYCLE_H_ */
@@ -0,0 +1,102 @@
+/*
+ * evtlog.h
+ *
+ *  바이너리 이벤트 로그 (printf 대신 고정 크기 레코드를 RAM 링에 기록)
+ *  - 기록은 lock 없이 id/인자만 저장하므로 ISR, QMK 스레드에서도 항상 켜 둘 수 있음
+ *  - 낮은 우선순위 스레드가 CDC 로 프레임을 내보내고, tool/evtlog.py 가 문자로 풀어줌
+ */
+
+#ifndef SRC_COMMON_HW_INCLUDE_EVTLOG_H_
+#define SRC_COMMON_HW_INCLUDE_EVTLOG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "hw_def.h"
+
+
+// X(이름, id, 인자 형식)
+//  - id 상위 바이트가 그룹 (evt mask 의 bit 번호)
+//  - 인자 형식은 tool/evtlog.py 가 이 목록을 읽어서 사용 (python str.format)
+//    a0, a1 : 인자 그대로, a0h/a0l : a0 상위/하위 8bit, a1h/a1l : a1 상위/하위 16bit, a1s : a1 signed
+#define EVTLOG_ID_LIST(X) \
+  X(EVT_BOOT,         0x0001, "ready_ms={a1}")                                      \
+  X(EVT_FIRST_KEY,    0x0002, "ms={a1}")                                            \
+  X(EVT_KEY,          0x0101, "row={a0h} col={a0l} kc=0x{a1h:04X} pressed={a1l}")   \
+  X(EVT_RF_RX,        0x0201, "dev=0x{a0h:02X} type=0x{a0l:02X} len={a1l} ret={a1h}") \
+  X(EVT_RF_ERR,       0x0202, "err={a0} drop_bytes={a1}")                           \
+  X(EVT_RF_CONNECT,   0x0203, "dev=0x{a0:02X} battery={a1}")                        \
+  X(EVT_RF_DISCONNECT,0x0204, "dev=0x{a0:02X} no_heartbeat_ms={a1}")                \
+  X(EVT_USB_SUSPEND,  0x0301, "")                                                   \
+  X(EVT_USB_RESUME,   0x0302, "")                                                   \
+  X(EVT_USB_WAKEUP,   0x0303, "")                                                   \
+  X(EVT_HID_FAIL,     0x0304, "report={a0} err={a1s}")                              \
+  X(EVT_LCD_FRAME,    0x0401, "render_us={a0} px={a1}")
+
+#define EVTLOG_ENUM(name, id, fmt)    name = id,
+
+enum
+{
+  EVTLOG_ID_LIST(EVTLOG_ENUM)
+};
+
+enum
+{
+  EVTLOG_GROUP_SYS = 0,
+  EVTLOG_GROUP_KEY,
+  EVTLOG_GROUP_RF,
+  EVTLOG_GROUP_USB,
+  EVTLOG_GROUP_LCD,
+  EVTLOG_GROUP_MAX
+};
+
+#define EVTLOG_GROUP(id)        ((id) >> 8)
+#define EVTLOG_MASK_ALL         ((1U << EVTLOG_GROUP_MAX) - 1)
+#define EVTLOG_U8X2(h, l)       ((uint16_t)(((h) << 8) | ((l) & 0xFF)))
+#define EVTLOG_U16X2(h, l)      ((uint32_t)(((uint32_t)(h) << 16) | ((l) & 0xFFFF)))
+
+
+#ifdef _USE_HW_EVTLOG
+
+// CDC 로 나가는 프레임 : sync(2) + 레코드(16, little endian) + xor(1)
+#define EVTLOG_SYNC0            0xE5
+#define EVTLOG_SYNC1            0x7E
+#define EVTLOG_FRAME_SIZE       19
+
+typedef struct
+{
+  uint32_t seq;         // 기록 순서 (1 부터, 빠진 번호는 잃어버린 레코드)
+  uint32_t time_us;
+  uint16_t id;
+  uint16_t a0;
+  uint32_t a1;
+} evtlog_rec_t;
+
+typedef struct
+{
+  uint32_t written;     // 기록한 레코드 수
+  uint32_t sent;        // CDC 로 보낸 프레임 수
+  uint32_t lost;        // 보내기 전에 덮어쓰인 레코드 수
+  uint32_t pending;     // 링에 남아 있는 레코드 수
+} evtlog_stats_t;
+
+
+bool evtlogInit(void);
+void evtlogWrite(uint16_t id, uint16_t a0, uint32_t a1);
+void evtlogSetMask(uint32_t mask);
+uint32_t evtlogGetMask(void);
+void evtlogSetStream(bool enable);
+void evtlogGetStats(evtlog_stats_t *p_stats);
+
+#else
+
+#define evtlogWrite(id, a0, a1)
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SRC_COMMON_HW_INCLUDE_EVTLOG_H_ */
@@ -26,6 +26,7 @@ bool    gpioPinMode(uint8_t ch, uint8_t mode);
 void    gpioPinWrite(uint8_t ch, uint8_t value);
 uint8_t gpioPinRead(uint8_t ch);
 void    gpioPinToggle(uint8_t ch);
+bool    gpioAttachInterrupt(uint8_t ch, uint8_t mode, void (*func)(void));
 
 
 #endif
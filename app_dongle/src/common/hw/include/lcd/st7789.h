@@ -25,10 +25,15 @@ bool st7789Init(void);
 void st7789SetWindow(int32_t x, int32_t y, int32_t w, int32_t h);
 bool st7789SetCallBack(void (*p_func)(void));
 bool st7789SendBuffer(uint8_t *p_data, uint32_t length, uint32_t timeout_ms);
+bool st7789SetSleep(bool enable);
 uint16_t st7789GetWidth(void);
 uint16_t st7789GetHeight(void);
 
 void st7789FillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+bool st7789FillRectDma(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color);
+bool st7789DrawBuffer(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint8_t *p_data);
+bool st7789SetTearSync(bool enable);
+bool st7789IsTearSync(void);
 
 #endif
 
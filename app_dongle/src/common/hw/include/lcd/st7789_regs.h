@@ -38,6 +38,8 @@
 #define ST7789_RAMRD   0x2E
 
 #define ST7789_PTLAR   0x30
+#define ST7789_TEOFF   0x34
+#define ST7789_TEON    0x35
 #define ST7789_COLMOD  0x3A
 #define ST7789_MADCTL  0x36
 
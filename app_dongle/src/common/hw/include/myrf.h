@@ -16,6 +16,12 @@ uint32_t rfAvailable(void);
 uint32_t rfWrite(uint8_t *p_data, uint32_t length);
 uint32_t rfRead(uint8_t *p_data, uint32_t length);
 bool rfBufferFlush(void);
+uint32_t rfGetRxTime(uint32_t *p_count);
+bool rfSetRxCallBack(void (*p_func)(void));
+#if HW_RF_MODE == _DEF_RF_MODE_RX
+bool rfSetAckPayload(uint8_t *p_data, uint32_t length);
+bool rfSetRxDutyCycle(uint32_t on_ms, uint32_t off_ms);
+#endif
 
 /*
 bool rfSetTxPower(int8_t power);
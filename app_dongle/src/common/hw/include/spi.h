@@ -24,6 +24,36 @@ extern "C"
 #define SPI_MODE2 2
 #define SPI_MODE3 3
 
+#define SPI_PIN_NONE  (-1)
+
+    // 버스 큐에 넣는 전송 하나. cs/dc 는 GPIO 채널(SPI_PIN_NONE : 건드리지 않음)
+    // dc 는 전송 시작 전에 dc_level 로, cs 는 전송 동안 LOW 로 두고 끝나면 HIGH 로 돌린다
+    typedef struct
+    {
+        const uint8_t *tx_buf;
+        uint32_t       tx_length;
+        uint16_t       tx_repeat;   // tx_buf 를 이어서 반복해 보낼 횟수 (0, 1 : 한 번), 반복하면 rx 는 사용 안 함
+        uint8_t       *rx_buf;
+        uint32_t       rx_length;
+        int8_t         cs_pin;
+        int8_t         dc_pin;
+        uint8_t        dc_level;
+        void         (*p_done_func)(void *arg);   // 전송 완료 시 ISR 에서 호출
+        void          *arg;
+    } spi_xfer_t;
+
+    typedef struct
+    {
+        uint32_t xfer_count;
+        uint32_t bytes;
+        uint32_t busy_us;       // 전송에 걸린 시간의 합
+        uint32_t wait_us;       // 큐에 넣은 뒤 전송이 시작될 때까지 기다린 시간의 합
+        uint32_t wait_max_us;
+        uint32_t queue_max;
+        uint32_t timeout_count;
+        uint32_t error_count;
+    } spi_info_t;
+
     bool spiInit(void);
     // bool spiBegin(uint8_t ch);
     // void spiSetDataMode(uint8_t ch, uint8_t dataMode);
@@ -32,6 +62,11 @@ extern "C"
     bool spiTransfer(uint8_t ch, uint8_t *tx_buf, uint32_t tx_length, uint8_t *rx_buf, uint32_t rx_length, uint32_t timeout);
     bool spiTransferDma(uint8_t ch, uint8_t *tx_buf, uint32_t tx_length, uint8_t *rx_buf, uint32_t rx_length);
 
+    bool spiXfer(uint8_t ch, const spi_xfer_t *p_xfer, uint32_t count, uint32_t timeout_ms);
+    bool spiXferQueue(uint8_t ch, const spi_xfer_t *p_xfer, uint32_t count);
+    bool spiGetInfo(uint8_t ch, spi_info_t *p_info);
+    void spiClearInfo(uint8_t ch);
+
     // uint8_t  spiTransfer8(uint8_t ch, uint8_t data);
     // uint16_t spiTransfer16(uint8_t ch, uint16_t data);
 
@@ -0,0 +1,27 @@
+#include "cycle.h"
+
+#ifdef _USE_HW_CYCLE
+#include <nrfx.h>
+
+
+bool cycleInit(void)
+{
+  // DWT CYCCNT : 디버거 연결 없이도 TRCENA 를 켜면 동작 (64MHz, 약 67초마다 wrap)
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+
+  return (DWT->CTRL & DWT_CTRL_NOCYCCNT_Msk) == 0;
+}
+
+uint32_t cycleGet(void)
+{
+  return DWT->CYCCNT;
+}
+
+uint32_t cycleGetFreqMhz(void)
+{
+  return SystemCoreClock / 1000000;
+}
+
+#endif
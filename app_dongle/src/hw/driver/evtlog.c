@@ -0,0 +1,376 @@
+#include "evtlog.h"
+
+#ifdef _USE_HW_EVTLOG
+#include "uart.h"
+#include "cli.h"
+#include <zephyr/kernel.h>
+
+
+#if (HW_EVTLOG_RECORD_MAX & (HW_EVTLOG_RECORD_MAX - 1)) != 0
+#error "HW_EVTLOG_RECORD_MAX must be a power of 2"
+#endif
+
+#define EVTLOG_RECORD_MAX       HW_EVTLOG_RECORD_MAX
+#define EVTLOG_TX_FRAME_MAX     8         // 한 번에 uartWrite 하는 프레임 수
+#define EVTLOG_DRAIN_MS         10
+#define EVTLOG_LIST_DEFAULT     16
+
+#define THREAD_STACK_SIZE       1024
+#define THREAD_PRIORITY         HW_EVTLOG_THREAD_PRI
+
+
+// seq 는 나머지를 다 쓴 뒤에 마지막으로 기록 (0 : 쓰는 중)
+// 읽는 쪽은 복사 전후의 seq 가 같아야 온전한 레코드로 본다
+typedef struct
+{
+  atomic_t seq;
+  uint32_t time_us;
+  uint16_t id;
+  uint16_t a0;
+  uint32_t a1;
+} evtlog_slot_t;
+
+typedef struct
+{
+  uint16_t    id;
+  const char *name;
+} evtlog_name_t;
+
+
+#ifdef _USE_HW_CLI
+static void cliEvtlog(cli_args_t *args);
+#endif
+static void evtlogThread(void *arg1, void *arg2, void *arg3);
+
+#define EVTLOG_NAME(name, id, fmt)    { id, #name },
+
+static const evtlog_name_t evt_name_tbl[] =
+{
+  EVTLOG_ID_LIST(EVTLOG_NAME)
+};
+
+static const char *evt_group_name[EVTLOG_GROUP_MAX] =
+{
+  "sys",
+  "key",
+  "rf",
+  "usb",
+  "lcd",
+};
+
+static K_THREAD_STACK_DEFINE(evtlog_thread_stack, THREAD_STACK_SIZE);
+static struct k_thread evtlog_thread_data;
+
+static evtlog_slot_t ring[EVTLOG_RECORD_MAX];
+static atomic_t      wr_index  = ATOMIC_INIT(0);
+static uint32_t      rd_index  = 0;
+static uint32_t      evt_mask  = EVTLOG_MASK_ALL;
+static bool          is_stream = false;
+
+static uint8_t  tx_buf[EVTLOG_FRAME_SIZE * EVTLOG_TX_FRAME_MAX];
+static uint32_t tx_len    = 0;
+static uint32_t tx_frames = 0;
+static uint32_t sent      = 0;
+static uint32_t lost      = 0;
+
+
+
+
+bool evtlogInit(void)
+{
+  k_tid_t tid;
+
+  tid = k_thread_create(&evtlog_thread_data, evtlog_thread_stack,
+                        K_THREAD_STACK_SIZEOF(evtlog_thread_stack),
+                        evtlogThread, NULL, NULL, NULL,
+                        THREAD_PRIORITY, 0, K_NO_WAIT);
+  k_thread_name_set(tid, "evtlog");
+
+#ifdef _USE_HW_CLI
+  cliAdd("evt", cliEvtlog);
+#endif
+  return true;
+}
+
+void evtlogWrite(uint16_t id, uint16_t a0, uint32_t a1)
+{
+  evtlog_slot_t *p_slot;
+  uint32_t index;
+
+  if ((evt_mask & (1U << EVTLOG_GROUP(id))) == 0)
+    return;
+
+  // 칸만 먼저 잡으므로 스레드/ISR 가 동시에 기록해도 서로 다른 칸에 쓴다
+  index  = (uint32_t)atomic_inc(&wr_index);
+  p_slot = &ring[index % EVTLOG_RECORD_MAX];
+
+  atomic_set(&p_slot->seq, 0);
+  p_slot->time_us = micros();
+  p_slot->id      = id;
+  p_slot->a0      = a0;
+  p_slot->a1      = a1;
+  atomic_set(&p_slot->seq, (atomic_val_t)(index + 1));
+}
+
+void evtlogSetMask(uint32_t mask)
+{
+  evt_mask = mask;
+}
+
+uint32_t evtlogGetMask(void)
+{
+  return evt_mask;
+}
+
+void evtlogSetStream(bool enable)
+{
+  // 꺼져 있는 동안 쌓인 레코드도 링에 남아 있는 만큼 이어서 보낸다 (처음 켜면 부팅 이벤트부터)
+  is_stream = enable;
+}
+
+void evtlogGetStats(evtlog_stats_t *p_stats)
+{
+  uint32_t wr = (uint32_t)atomic_get(&wr_index);
+
+  p_stats->written = wr;
+  p_stats->sent    = sent;
+  p_stats->lost    = lost;
+  p_stats->pending = wr - rd_index;
+  if (p_stats->pending > EVTLOG_RECORD_MAX)
+    p_stats->pending = EVTLOG_RECORD_MAX;
+}
+
+static bool evtlogReadSlot(uint32_t index, evtlog_rec_t *p_rec)
+{
+  evtlog_slot_t *p_slot = &ring[index % EVTLOG_RECORD_MAX];
+  uint32_t seq;
+
+  seq = (uint32_t)atomic_get(&p_slot->seq);
+  if (seq != index + 1)
+    return false;
+
+  p_rec->seq     = seq;
+  p_rec->time_us = p_slot->time_us;
+  p_rec->id      = p_slot->id;
+  p_rec->a0      = p_slot->a0;
+  p_rec->a1      = p_slot->a1;
+
+  // 복사하는 사이에 다음 바퀴 레코드가 덮어썼으면 버림
+  return (uint32_t)atomic_get(&p_slot->seq) == seq;
+}
+
+// 보낼 다음 레코드 (evtlog 스레드에서만 호출)
+static bool evtlogRead(evtlog_rec_t *p_rec)
+{
+  while (true)
+  {
+    uint32_t wr = (uint32_t)atomic_get(&wr_index);
+    uint32_t seq;
+
+    // 한 바퀴 넘게 밀렸으면 덮어쓰인 만큼 건너뜀
+    if (wr - rd_index > EVTLOG_RECORD_MAX)
+    {
+      lost    += wr - rd_index - EVTLOG_RECORD_MAX;
+      rd_index = wr - EVTLOG_RECORD_MAX;
+    }
+    if (rd_index == wr)
+      return false;
+
+    if (evtlogReadSlot(rd_index, p_rec))
+    {
+      rd_index++;
+      return true;
+    }
+
+    // 아직 쓰는 중이면 다음 주기에 다시 읽고, 이미 덮어쓰였으면 건너뜀
+    seq = (uint32_t)atomic_get(&ring[rd_index % EVTLOG_RECORD_MAX].seq);
+    if (seq == 0 || (int32_t)(seq - (rd_index + 1)) < 0)
+      return false;
+    lost++;
+    rd_index++;
+  }
+}
+
+static uint32_t evtlogEncode(const evtlog_rec_t *p_rec, uint8_t *p_buf)
+{
+  uint8_t xor = 0;
+
+  p_buf[0]  = EVTLOG_SYNC0;
+  p_buf[1]  = EVTLOG_SYNC1;
+  p_buf[2]  = (p_rec->seq >>  0) & 0xFF;
+  p_buf[3]  = (p_rec->seq >>  8) & 0xFF;
+  p_buf[4]  = (p_rec->seq >> 16) & 0xFF;
+  p_buf[5]  = (p_rec->seq >> 24) & 0xFF;
+  p_buf[6]  = (p_rec->time_us >>  0) & 0xFF;
+  p_buf[7]  = (p_rec->time_us >>  8) & 0xFF;
+  p_buf[8]  = (p_rec->time_us >> 16) & 0xFF;
+  p_buf[9]  = (p_rec->time_us >> 24) & 0xFF;
+  p_buf[10] = (p_rec->id >> 0) & 0xFF;
+  p_buf[11] = (p_rec->id >> 8) & 0xFF;
+  p_buf[12] = (p_rec->a0 >> 0) & 0xFF;
+  p_buf[13] = (p_rec->a0 >> 8) & 0xFF;
+  p_buf[14] = (p_rec->a1 >>  0) & 0xFF;
+  p_buf[15] = (p_rec->a1 >>  8) & 0xFF;
+  p_buf[16] = (p_rec->a1 >> 16) & 0xFF;
+  p_buf[17] = (p_rec->a1 >> 24) & 0xFF;
+
+  for (int i=2; i<EVTLOG_FRAME_SIZE-1; i++)
+  {
+    xor ^= p_buf[i];
+  }
+  p_buf[EVTLOG_FRAME_SIZE-1] = xor;
+
+  return EVTLOG_FRAME_SIZE;
+}
+
+static void evtlogDrain(void)
+{
+  evtlog_rec_t rec;
+  uint32_t tx_sent;
+
+  while (true)
+  {
+    if (tx_len == 0)
+    {
+      tx_frames = 0;
+      while (tx_len + EVTLOG_FRAME_SIZE <= sizeof(tx_buf) && evtlogRead(&rec))
+      {
+        tx_len += evtlogEncode(&rec, &tx_buf[tx_len]);
+        tx_frames++;
+      }
+      if (tx_len == 0)
+        break;
+    }
+
+    // CDC 가 연결 전이거나 가득 차면 남은 바이트를 들고 있다가 다음 주기에 이어서 보냄
+    tx_sent = uartWrite(HW_EVTLOG_CH, tx_buf, tx_len);
+    if (tx_sent < tx_len)
+    {
+      memmove(tx_buf, &tx_buf[tx_sent], tx_len - tx_sent);
+      tx_len -= tx_sent;
+      break;
+    }
+    sent  += tx_frames;
+    tx_len = 0;
+  }
+}
+
+static void evtlogThread(void *arg1, void *arg2, void *arg3)
+{
+  ARG_UNUSED(arg1);
+  ARG_UNUSED(arg2);
+  ARG_UNUSED(arg3);
+
+  while (1)
+  {
+    if (is_stream)
+    {
+      evtlogDrain();
+    }
+    k_msleep(EVTLOG_DRAIN_MS);
+  }
+}
+
+
+#ifdef _USE_HW_CLI
+static const char *evtlogGetName(uint16_t id)
+{
+  for (int i=0; i<(int)ARRAY_SIZE(evt_name_tbl); i++)
+  {
+    if (evt_name_tbl[i].id == id)
+      return evt_name_tbl[i].name;
+  }
+  return "EVT_?";
+}
+
+static void cliEvtlogPrintMask(void)
+{
+  cliPrintf("mask    : 0x%02X (", evt_mask);
+  for (int i=0; i<EVTLOG_GROUP_MAX; i++)
+  {
+    cliPrintf(" %s:%s", evt_group_name[i], (evt_mask & (1U << i)) ? "on" : "off");
+  }
+  cliPrintf(" )\n");
+}
+
+void cliEvtlog(cli_args_t *args)
+{
+  bool ret = false;
+
+
+  if (args->argc == 1 && args->isStr(0, "info"))
+  {
+    evtlog_stats_t stats;
+
+    evtlogGetStats(&stats);
+    cliPrintf("records : %d x %d byte\n", EVTLOG_RECORD_MAX, (int)sizeof(evtlog_slot_t));
+    cliPrintf("stream  : %s (uart ch %d)\n", is_stream ? "on" : "off", HW_EVTLOG_CH);
+    cliPrintf("written : %d\n", stats.written);
+    cliPrintf("sent    : %d\n", stats.sent);
+    cliPrintf("lost    : %d\n", stats.lost);
+    cliPrintf("pending : %d\n", stats.pending);
+    cliEvtlogPrintMask();
+    ret = true;
+  }
+
+  if (args->argc == 2 && args->isStr(0, "stream"))
+  {
+    evtlogSetStream(args->isStr(1, "on"));
+    cliPrintf("stream %s\n", is_stream ? "on" : "off");
+    ret = true;
+  }
+
+  if (args->argc == 2 && args->isStr(0, "mask"))
+  {
+    evtlogSetMask(args->getData(1));
+    cliEvtlogPrintMask();
+    ret = true;
+  }
+
+  if (args->argc >= 1 && args->argc <= 2 && args->isStr(0, "list"))
+  {
+    uint32_t wr = (uint32_t)atomic_get(&wr_index);
+    uint32_t cnt = EVTLOG_LIST_DEFAULT;
+    evtlog_rec_t rec;
+
+    if (args->argc == 2)
+      cnt = args->getData(1);
+    cnt = constrain(cnt, 1, EVTLOG_RECORD_MAX);
+    if (cnt > wr)
+      cnt = wr;
+
+    // 스트림과 상관없이 링에 남아 있는 최근 레코드를 보여줌
+    for (uint32_t index = wr - cnt; index != wr; index++)
+    {
+      if (!evtlogReadSlot(index, &rec))
+        continue;
+      cliPrintf("%8d %6d.%03d %-16s a0 0x%04X a1 0x%08X\n",
+                rec.seq,
+                rec.time_us / 1000, rec.time_us % 1000,
+                evtlogGetName(rec.id),
+                rec.a0,
+                rec.a1);
+    }
+    ret = true;
+  }
+
+  if (args->argc == 1 && args->isStr(0, "clear"))
+  {
+    sent = 0;
+    lost = 0;
+    cliPrintf("evt clear\n");
+    ret = true;
+  }
+
+  if (ret == false)
+  {
+    cliPrintf("evt info\n");
+    cliPrintf("evt stream on|off\n");
+    cliPrintf("evt mask 0x1F (sys, key, rf, usb, lcd)\n");
+    cliPrintf("evt list [n]\n");
+    cliPrintf("evt clear\n");
+  }
+}
+#endif
+
+#endif
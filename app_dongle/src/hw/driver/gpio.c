@@ -28,10 +28,14 @@ static gpio_tbl_t gpio_tbl[GPIO_MAX_CH] =
       {GPIO_DT_SPEC_GET(DT_NODELABEL(lcd_dc), gpios), _DEF_OUTPUT, _DEF_LOW }, // 0. LCD DC
       {GPIO_DT_SPEC_GET(DT_NODELABEL(lcd_rst), gpios), _DEF_OUTPUT, _DEF_HIGH}, // 1. LCD RST
       {GPIO_DT_SPEC_GET(DT_NODELABEL(lcd_blk), gpios), _DEF_OUTPUT, _DEF_HIGH}, // 2. LCD BLK
+      {GPIO_DT_SPEC_GET(DT_NODELABEL(lcd_te), gpios),  _DEF_INPUT,  _DEF_LOW }, // 3. LCD TE
     };
 
 static uint8_t gpio_data[GPIO_MAX_CH];
 
+static struct gpio_callback gpio_cb[GPIO_MAX_CH];
+static void (*gpio_intr_func[GPIO_MAX_CH])(void);
+
 
 #ifdef _USE_HW_CLI
 static void cliGpio(cli_args_t *args);
@@ -48,7 +52,10 @@ gpioInit(void)
   for (int i=0; i<GPIO_MAX_CH; i++)
   {
     gpioPinMode(i, gpio_tbl[i].mode);
-    gpioPinWrite(i, gpio_tbl[i].init_value);
+    if (gpio_tbl[i].mode >= _DEF_OUTPUT)
+    {
+      gpioPinWrite(i, gpio_tbl[i].init_value);
+    }
   }
 
 #ifdef _USE_HW_CLI
@@ -136,6 +143,70 @@ void gpioPinToggle(uint8_t ch)
   gpio_pin_toggle(gpio_tbl[ch].gpio_spec.port, gpio_tbl[ch].gpio_spec.pin);
 }
 
+static void gpioISR(const struct device *port, struct gpio_callback *cb, gpio_port_pins_t pins)
+{
+  uint8_t ch = cb - gpio_cb;
+
+  if (ch < GPIO_MAX_CH && gpio_intr_func[ch] != NULL)
+  {
+    gpio_intr_func[ch]();
+  }
+}
+
+// func 는 ISR 에서 호출된다. func 가 NULL 이면 인터럽트를 끈다
+bool gpioAttachInterrupt(uint8_t ch, uint8_t mode, void (*func)(void))
+{
+  const struct gpio_dt_spec *p_spec;
+  gpio_flags_t flags;
+
+  if (ch >= GPIO_MAX_CH)
+  {
+    return false;
+  }
+  p_spec = &gpio_tbl[ch].gpio_spec;
+
+  gpio_pin_interrupt_configure(p_spec->port, p_spec->pin, GPIO_INT_DISABLE);
+  if (gpio_intr_func[ch] != NULL)
+  {
+    gpio_remove_callback(p_spec->port, &gpio_cb[ch]);
+    gpio_intr_func[ch] = NULL;
+  }
+  if (func == NULL)
+  {
+    return true;
+  }
+
+  switch(mode)
+  {
+    case _DEF_INTR_RISING:
+      flags = GPIO_INT_EDGE_RISING;
+      break;
+
+    case _DEF_INTR_FALLING:
+      flags = GPIO_INT_EDGE_FALLING;
+      break;
+
+    default:
+      flags = GPIO_INT_EDGE_BOTH;
+      break;
+  }
+
+  gpio_intr_func[ch] = func;
+  gpio_init_callback(&gpio_cb[ch], gpioISR, BIT(p_spec->pin));
+  if (gpio_add_callback(p_spec->port, &gpio_cb[ch]) != 0)
+  {
+    gpio_intr_func[ch] = NULL;
+    return false;
+  }
+  if (gpio_pin_interrupt_configure(p_spec->port, p_spec->pin, flags) != 0)
+  {
+    gpio_remove_callback(p_spec->port, &gpio_cb[ch]);
+    gpio_intr_func[ch] = NULL;
+    return false;
+  }
+  return true;
+}
+
 
 
 
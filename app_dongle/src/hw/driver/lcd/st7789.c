@@ -30,10 +30,52 @@
 #define MADCTL_BGR      0x08
 #define MADCTL_MH       0x04
 
+#define ST7789_FILL_BUF_PIXELS  512   // 단색 채우기 버퍼, 반복 전송하므로 화면 전체도 DMA 한두 번으로 끝난다
+#define ST7789_WIN_XFER_CNT     5     // CASET, 인자, RASET, 인자, RAMWR
+#define ST7789_FRAME_XFER_MAX   (ST7789_WIN_XFER_CNT + 2)
+
+#ifdef HW_ST7789_TE_PIN
+// 패널 스캔 타이밍 (레지스터 기본값 기준)
+// TE(V-blank 모드)는 마지막 라인 스캔이 끝나면 올라가고, 포치(VFP+VBP) 후 RAM row 0 부터 다시 스캔한다
+#define ST7789_TE_SCAN_LINES    320                         // GATECTRL 기본값 (RAM 전체 row)
+#define ST7789_TE_PORCH_LINES   24                          // PORCTRL 기본값 VBP 12 + VFP 12
+#define ST7789_TE_LINES         (ST7789_TE_SCAN_LINES + ST7789_TE_PORCH_LINES)
+#define ST7789_TE_PERIOD_US     16667                       // FRCTRL2 기본값 60Hz, 실제 주기는 TE 간격으로 측정
+#define ST7789_TE_LOST_US       (ST7789_TE_PERIOD_US * 3)   // 이보다 오래 TE 가 없으면 동기 없이 바로 전송
+#define ST7789_TE_MARGIN_LINES  2                           // 타이머 분해능, 창 설정 전송 시간 여유
+#define ST7789_SPI_BYTE_NS      250                         // 32MHz SPIM
+#endif
+
 #define ST7789_BLACK       0x0000
 #define ST7789_BLUE        0x001F
 #define ST7789_RED         0xF800
 
+#ifdef HW_ST7789_TE_PIN
+typedef struct
+{
+  bool              enable;
+  volatile uint32_t te_us;        // 마지막 TE 상승 시간
+  volatile uint32_t te_count;
+  uint32_t          period_us;
+
+  volatile bool     is_pending;   // 시작 시점을 기다리는 프레임 (frame_xfer 에 준비되어 있음)
+  volatile bool     is_deferred;  // 바로 보내지 못하고 타이머로 미룬 프레임 (wait 통계)
+  uint32_t          xfer_cnt;
+  int32_t           y0;
+  int32_t           y1;
+  uint32_t          bytes;
+  uint32_t          req_us;
+
+  uint32_t          frame_cnt;    // TE 를 보고 시작한 프레임
+  uint32_t          wait_cnt;     // 그 중 기다린 프레임
+  uint32_t          wait_us;
+  uint32_t          wait_max_us;
+  uint32_t          unsafe_cnt;   // 한 프레임 안에 안전한 시점이 없던 큰 영역
+  uint32_t          nosync_cnt;   // TE 가 없어 바로 보낸 프레임
+  uint32_t          fail_cnt;
+} te_sync_t;
+#endif
+
 static void writecommand(uint8_t c);
 static void writedata(uint8_t d);
 static void st7789InitRegs(void);
@@ -52,13 +94,30 @@ volatile static bool  is_write_frame = false;
 static uint32_t colstart = 0;
 static uint32_t rowstart = 320 - HW_LCD_HEIGHT;
 
+// 비동기 프레임 전송(창 설정 + 픽셀)에 쓰는 버퍼, is_write_frame 동안 유지된다
+static spi_xfer_t frame_xfer[ST7789_FRAME_XFER_MAX];
+static uint8_t    frame_win_arg[8];
+static uint8_t    fill_buf[ST7789_FILL_BUF_PIXELS * 2];
+static int32_t    fill_buf_color = -1;
+static K_SEM_DEFINE(fill_done_sem, 0, 1);
+static int32_t    win_y0 = 0;     // st7789SetWindow() 의 row, st7789SendBuffer() 의 TE 동기에 사용
+static int32_t    win_y1 = HW_LCD_HEIGHT - 1;
+
+#ifdef HW_ST7789_TE_PIN
+static te_sync_t      te_sync;
+static struct k_timer te_timer;
+
+static void st7789TeISR(void);
+static void st7789TeTimerISR(struct k_timer *timer);
+#endif
+
 
 
 #ifdef _USE_HW_CLI
 static void cliCmd(cli_args_t *args);
 #endif
 
-static void transferDoneISR(void)
+static void transferDoneISR(void *arg)
 {
   if (is_write_frame == true)
   {
@@ -71,6 +130,12 @@ static void transferDoneISR(void)
   }
 }
 
+static void fillDoneISR(void *arg)
+{
+  is_write_frame = false;
+  k_sem_give(&fill_done_sem);
+}
+
 
 
 
@@ -79,6 +144,13 @@ bool st7789Init(void)
 {
   bool ret = true;
 
+#ifdef HW_ST7789_TE_PIN
+  te_sync.enable    = true;
+  te_sync.period_us = ST7789_TE_PERIOD_US;
+  k_timer_init(&te_timer, st7789TeTimerISR, NULL);
+  gpioAttachInterrupt(HW_ST7789_TE_PIN, _DEF_INTR_RISING, st7789TeISR);
+#endif
+
   ret &= st7789Reset();
 
 #ifdef _USE_HW_CLI
@@ -96,8 +168,6 @@ bool st7789Reset(void)
   delay(10);
   gpioPinWrite(_PIN_DEF_RST, _DEF_HIGH);
   delay(50);
-  //TODO: spi dma setting
-  spiAttachTxInterrupt(spi_ch, transferDoneISR);
 
   st7789InitRegs();
 
@@ -117,19 +187,37 @@ uint16_t st7789GetHeight(void)
   return _height;
 }
 
-void writecommand(uint8_t c)
+// DC 레벨은 전송 큐에서 전송 직전에 바꾸므로 앞서 넣은 프레임 전송이 끝나기 전에 바뀌지 않는다
+static void st7789SetXfer(spi_xfer_t *p_xfer, uint8_t dc, const uint8_t *p_data, uint32_t length)
+{
+  p_xfer->tx_buf      = p_data;
+  p_xfer->tx_length   = length;
+  p_xfer->tx_repeat   = 0;
+  p_xfer->rx_buf      = NULL;
+  p_xfer->rx_length   = 0;
+  p_xfer->cs_pin      = SPI_PIN_NONE;
+  p_xfer->dc_pin      = _PIN_DEF_DC;
+  p_xfer->dc_level    = dc;
+  p_xfer->p_done_func = NULL;
+  p_xfer->arg         = NULL;
+}
+
+static bool st7789Write(uint8_t dc, const uint8_t *p_data, uint32_t length, uint32_t timeout_ms)
 {
-  gpioPinWrite(_PIN_DEF_DC, _DEF_LOW);
+  spi_xfer_t xfer;
 
-  spiTransfer(spi_ch, &c, 1, NULL, 0, 100);
-  
-  gpioPinWrite(_PIN_DEF_DC, _DEF_HIGH);
+  st7789SetXfer(&xfer, dc, p_data, length);
+  return spiXfer(spi_ch, &xfer, 1, timeout_ms);
+}
+
+void writecommand(uint8_t c)
+{
+  st7789Write(_DEF_LOW, &c, 1, 100);
 }
 
 void writedata(uint8_t d)
 {
-  gpioPinWrite(_PIN_DEF_DC, _DEF_HIGH);
-  spiTransfer(spi_ch, &d, 1, NULL, 0, 100);
+  st7789Write(_DEF_HIGH, &d, 1, 100);
 }
 
 // New helper function to write 16-bit data as two 8-bit transfers
@@ -141,8 +229,7 @@ void write16BitData(uint16_t data)
   data_bytes[0] = (data >> 8) & 0xFF;  // High byte
   data_bytes[1] = data & 0xFF;         // Low byte
   
-  gpioPinWrite(_PIN_DEF_DC, _DEF_HIGH);
-  spiTransfer(spi_ch, data_bytes, 2, NULL, 0, 100);
+  st7789Write(_DEF_HIGH, data_bytes, 2, 100);
 }
 
 void st7789InitRegs(void)
@@ -161,6 +248,11 @@ void st7789InitRegs(void)
   writecommand(ST7789_COLMOD);  // 15: set color mode, 1 arg, no delay:
   writedata(0x05);              //     16-bit color
 
+#ifdef HW_ST7789_TE_PIN
+  writecommand(ST7789_TEON);    // Tearing effect line on, 1 arg:
+  writedata(0x00);              //     V-blank only
+#endif
+
 
   writecommand(ST7789_CASET);   //  1: Column addr set, 4 args, no delay:
   writedata(0x00);
@@ -228,57 +320,291 @@ void st7789SetRotationDriver(uint8_t mode)
   st7789SetRotation(mode);
 }
 
+// 창 설정 명령/데이터 5개를 만든다. p_arg(8바이트)는 전송이 끝날 때까지 유지되어야 한다
+static uint32_t st7789SetWindowXfer(spi_xfer_t *p_xfer, uint8_t *p_arg, int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+  static const uint8_t cmd[3] = {ST7789_CASET, ST7789_RASET, ST7789_RAMWR};
+
+  p_arg[0] = (x0+colstart)>>8;
+  p_arg[1] = (x0+colstart)>>0;    // XSTART
+  p_arg[2] = (x1+colstart)>>8;
+  p_arg[3] = (x1+colstart)>>0;    // XEND
+
+  p_arg[4] = (y0+rowstart)>>8;
+  p_arg[5] = (y0+rowstart)>>0;    // YSTART
+  p_arg[6] = (y1+rowstart)>>8;
+  p_arg[7] = (y1+rowstart)>>0;    // YEND
+
+  st7789SetXfer(&p_xfer[0], _DEF_LOW,  &cmd[0], 1);   // Column addr set
+  st7789SetXfer(&p_xfer[1], _DEF_HIGH, &p_arg[0], 4);
+  st7789SetXfer(&p_xfer[2], _DEF_LOW,  &cmd[1], 1);   // Row addr set
+  st7789SetXfer(&p_xfer[3], _DEF_HIGH, &p_arg[4], 4);
+  st7789SetXfer(&p_xfer[4], _DEF_LOW,  &cmd[2], 1);   // write to RAM
+
+  return ST7789_WIN_XFER_CNT;
+}
+
 void st7789SetWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
 {
-  // Remove spiSetBitWidth call - not needed, we always use 8-bit mode
+  uint8_t arg[8];
+  spi_xfer_t xfer[ST7789_WIN_XFER_CNT];
 
-  writecommand(ST7789_CASET); // Column addr set
-  writedata((x0+colstart)>>8);
-  writedata((x0+colstart)>>0);     // XSTART
-  writedata((x1+colstart)>>8);
-  writedata((x1+colstart)>>0);     // XEND
+  win_y0 = y0;
+  win_y1 = y1;
+
+  // 명령/데이터 5개를 한 번에 큐에 넣어 인터럽트에서 이어서 전송
+  spiXfer(spi_ch, xfer, st7789SetWindowXfer(xfer, arg, x0, y0, x1, y1), 100);
+}
 
-  writecommand(ST7789_RASET); // Row addr set
-  writedata((y0+rowstart)>>8);
-  writedata((y0+rowstart)>>0);     // YSTART
-  writedata((y1+rowstart)>>8);
-  writedata((y1+rowstart)>>0);     // YEND
+#ifdef HW_ST7789_TE_PIN
+// 기다리는 프레임을 지금부터 몇 us 뒤에 시작해야 하는지. 한 프레임 안에 안전한 시점이 없으면 *p_safe = false, 0 반환
+//
+// row y0~y1 에 bytes 를 쓰기 시작하는 시간(TE 기준)을 start 라 하면, k 번째 스캔과 섞이지 않으려면
+//   새 내용만 보임   : 스캔이 row 에 오기 전에 다 씀     -> start <= k * frame + new_ns
+//   이전 내용만 보임 : 스캔이 row 를 먼저 지나감        -> start >= k * frame + old_ns
+// row 마다 row_ns 씩 쓰므로 스캔 시간과 쓰는 시간의 차이는 row 에 대해 선형이라 양 끝 row 만 보면 되고,
+// 위험 구간 (new_ns, old_ns) 가 프레임마다 반복되므로 현재 위치의 위상만 보면 된다 (TE ISR 에서 호출, 반복 없음)
+static uint32_t st7789TeGetDelay(bool *p_safe)
+{
+  int32_t frame_ns = te_sync.period_us * 1000;
+  int32_t line_ns  = frame_ns / ST7789_TE_LINES;
+  int32_t pos_ns   = ((micros() - te_sync.te_us) * 1000) % (uint32_t)frame_ns;
+  int32_t d_ns     = te_sync.bytes * ST7789_SPI_BYTE_NS;
+  int32_t row_ns   = d_ns / (te_sync.y1 - te_sync.y0 + 1);
+  int32_t margin   = ST7789_TE_MARGIN_LINES * line_ns;
+  int32_t r0_ns    = (ST7789_TE_PORCH_LINES + te_sync.y0 + (int32_t)rowstart) * line_ns;
+  int32_t r1_ns    = (ST7789_TE_PORCH_LINES + te_sync.y1 + (int32_t)rowstart) * line_ns;
+  int32_t new_ns   = cmin(r0_ns - row_ns, r1_ns - d_ns) - margin;
+  int32_t old_ns   = cmax(r0_ns, r1_ns - d_ns + row_ns) + line_ns + margin;
+  int32_t phase_ns;
+
+  // 전송이 한 프레임보다 긴 영역은 언제 시작해도 스캔과 한 번은 겹치므로 기다리지 않는다
+  if (old_ns - new_ns >= frame_ns)
+  {
+    *p_safe = false;
+    return 0;
+  }
+  *p_safe = true;
 
-  writecommand(ST7789_RAMWR); // write to RAM
+  phase_ns = (pos_ns - new_ns) % frame_ns;
+  if (phase_ns < 0)
+  {
+    phase_ns += frame_ns;
+  }
+  if (phase_ns == 0 || phase_ns >= old_ns - new_ns)
+  {
+    return 0;
+  }
+  return (old_ns - new_ns - phase_ns + 999) / 1000;
 }
 
-void st7789FillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+static void st7789TeStart(void)
 {
-  // Create buffer for 8-bit transfers (twice the size for 16-bit colors)
-  uint8_t line_buf[w * 2];
+  unsigned int key;
+  uint32_t wait_us;
+  spi_xfer_t *p_last;
 
-  // Clipping
-  if ((x >= _width) || (y >= _height)) return;
+  key = irq_lock();
+  if (te_sync.is_pending == false)
+  {
+    irq_unlock(key);
+    return;
+  }
+  te_sync.is_pending = false;
+  irq_unlock(key);
 
-  if (x < 0) { w += x; x = 0; }
-  if (y < 0) { h += y; y = 0; }
+  wait_us = micros() - te_sync.req_us;
+  if (te_sync.is_deferred == true)
+  {
+    te_sync.wait_cnt++;
+    te_sync.wait_us += wait_us;
+    te_sync.wait_max_us = cmax(te_sync.wait_max_us, wait_us);
+  }
 
-  if ((x + w) > _width)  w = _width  - x;
-  if ((y + h) > _height) h = _height - y;
+  if (spiXferQueue(spi_ch, frame_xfer, te_sync.xfer_cnt) == false)
+  {
+    // 완료 콜백을 불러서 기다리는 쪽(LVGL flush, st7789FillRect)이 멈추지 않게 한다
+    te_sync.fail_cnt++;
+    p_last = &frame_xfer[te_sync.xfer_cnt - 1];
+    if (p_last->p_done_func != NULL)
+    {
+      p_last->p_done_func(p_last->arg);
+    }
+  }
+}
 
-  if ((w < 1) || (h < 1)) return;
+static void st7789TeSchedule(bool is_first)
+{
+  bool is_safe;
+  uint32_t delay_us;
 
-  st7789SetWindow(x, y, x + w - 1, y + h - 1);
-  
-  // Pre-fill the buffer with the color data (in 8-bit chunks)
-  for (int i = 0; i < w; i++) {
-    // Split each 16-bit color into two 8-bit values (MSB first)
-    line_buf[i*2]   = (color >> 8) & 0xFF;  // High byte
-    line_buf[i*2+1] = color & 0xFF;         // Low byte
+  delay_us = st7789TeGetDelay(&is_safe);
+  if (is_first == true && is_safe == false)
+  {
+    te_sync.unsafe_cnt++;
+  }
+  if (delay_us == 0)
+  {
+    st7789TeStart();
   }
+  else
+  {
+    te_sync.is_deferred = true;
+    k_timer_start(&te_timer, K_USEC(delay_us), K_NO_WAIT);
+  }
+}
 
-  gpioPinWrite(_PIN_DEF_DC, _DEF_HIGH);
+static void st7789TeTimerISR(struct k_timer *timer)
+{
+  st7789TeStart();
+}
 
-  for (int i = 0; i < h; i++) {
-    // Transfer the entire line using 8-bit transfers
-    spiTransfer(spi_ch, line_buf, w * 2, NULL, 0, 10000);
+static void st7789TeISR(void)
+{
+  uint32_t now = micros();
+  uint32_t dt  = now - te_sync.te_us;
+
+  if (te_sync.te_count > 0 && dt > ST7789_TE_PERIOD_US / 2 && dt < ST7789_TE_PERIOD_US * 2)
+  {
+    te_sync.period_us += ((int32_t)dt - (int32_t)te_sync.period_us) / 8;
+  }
+  te_sync.te_us = now;
+  te_sync.te_count++;
+
+  // 기다리는 프레임이 있으면 새 TE 시간으로 다시 계산
+  if (te_sync.is_pending == true)
+  {
+    st7789TeSchedule(false);
   }
 }
+#endif
+
+// 준비된 frame_xfer 를 큐에 넣는다.
+// TE 동기 중이면 스캔 위치를 보고 row y0~y1 이 찢어지지 않는 시점에 넣는다 (그 동안 호출한 쪽은 기다리지 않음)
+static bool st7789StartFrame(uint32_t cnt, int32_t y0, int32_t y1, uint32_t bytes)
+{
+#ifdef HW_ST7789_TE_PIN
+  if (st7789IsTearSync() == true && y1 >= y0 && bytes > 0)
+  {
+    te_sync.xfer_cnt = cnt;
+    te_sync.y0       = y0;
+    te_sync.y1       = y1;
+    te_sync.bytes    = bytes;
+    te_sync.req_us   = micros();
+    te_sync.frame_cnt++;
+
+    // 기다리는 동안 TE 가 들어오면 ISR 에서 새 TE 시간으로 다시 계산
+    te_sync.is_deferred = false;
+    te_sync.is_pending  = true;
+    st7789TeSchedule(true);
+    return true;
+  }
+  if (te_sync.enable == true)
+  {
+    te_sync.nosync_cnt++;
+  }
+#endif
+
+  return spiXferQueue(spi_ch, frame_xfer, cnt);
+}
+
+static bool st7789ClipRect(int32_t *x, int32_t *y, int32_t *w, int32_t *h)
+{
+  if ((*x >= _width) || (*y >= _height)) return false;
+
+  if (*x < 0) { *w += *x; *x = 0; }
+  if (*y < 0) { *h += *y; *y = 0; }
+
+  if ((*x + *w) > _width)  *w = _width  - *x;
+  if ((*y + *h) > _height) *h = _height - *y;
+
+  if ((*w < 1) || (*h < 1)) return false;
+
+  return true;
+}
+
+// 창 설정과 단색 픽셀을 한 번에 큐에 넣는다.
+// 픽셀은 fill_buf 를 반복 전송(나머지가 있으면 한 번 더)하므로 크기와 상관없이 DMA 전송 1~2개
+static bool st7789FillQueue(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color, void (*p_done_func)(void *arg))
+{
+  uint32_t pixels;
+  uint32_t buf_pixels;
+  uint32_t cnt;
+
+  if (st7789ClipRect(&x, &y, &w, &h) == false)
+    return false;
+  if (is_write_frame == true)
+    return false;
+
+  is_write_frame = true;
+
+  pixels     = w * h;
+  buf_pixels = cmin(pixels, ST7789_FILL_BUF_PIXELS);
+  if (fill_buf_color != color)
+  {
+    fill_buf_color = color;
+    for (int i = 0; i < ST7789_FILL_BUF_PIXELS; i++) {
+      fill_buf[i*2]   = (color >> 8) & 0xFF;  // High byte
+      fill_buf[i*2+1] = color & 0xFF;         // Low byte
+    }
+  }
+
+  cnt = st7789SetWindowXfer(frame_xfer, frame_win_arg, x, y, x + w - 1, y + h - 1);
+  st7789SetXfer(&frame_xfer[cnt], _DEF_HIGH, fill_buf, buf_pixels * 2);
+  frame_xfer[cnt].tx_repeat = pixels / buf_pixels;
+  cnt++;
+  if (pixels % buf_pixels > 0)
+  {
+    st7789SetXfer(&frame_xfer[cnt], _DEF_HIGH, fill_buf, (pixels % buf_pixels) * 2);
+    cnt++;
+  }
+  frame_xfer[cnt - 1].p_done_func = p_done_func;
+
+  if (st7789StartFrame(cnt, y, y + h - 1, pixels * 2) == false)
+  {
+    is_write_frame = false;
+    return false;
+  }
+  return true;
+}
+
+void st7789FillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+  k_sem_reset(&fill_done_sem);
+  if (st7789FillQueue(x, y, w, h, color, fillDoneISR) == true)
+  {
+    k_sem_take(&fill_done_sem, K_MSEC(100));
+  }
+}
+
+// 전송이 끝나면 st7789SetCallBack() 의 콜백 호출
+bool st7789FillRectDma(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color)
+{
+  return st7789FillQueue(x, y, w, h, color, transferDoneISR);
+}
+
+// 창 설정과 픽셀 버퍼를 한 번에 큐에 넣는다. 전송이 끝나면 st7789SetCallBack() 의 콜백 호출
+bool st7789DrawBuffer(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint8_t *p_data)
+{
+  uint32_t cnt;
+
+  if (is_write_frame == true)
+    return false;
+
+  is_write_frame = true;
+
+  cnt = st7789SetWindowXfer(frame_xfer, frame_win_arg, x0, y0, x1, y1);
+  st7789SetXfer(&frame_xfer[cnt], _DEF_HIGH, p_data, (x1 - x0 + 1) * (y1 - y0 + 1) * 2);
+  frame_xfer[cnt].p_done_func = transferDoneISR;
+  cnt++;
+
+  if (st7789StartFrame(cnt, y0, y1, (x1 - x0 + 1) * (y1 - y0 + 1) * 2) == false)
+  {
+    is_write_frame = false;
+    return false;
+  }
+  return true;
+}
 
 bool st7789SendBuffer(uint8_t *p_data, uint32_t length, uint32_t timeout_ms)
 {
@@ -287,13 +613,43 @@ bool st7789SendBuffer(uint8_t *p_data, uint32_t length, uint32_t timeout_ms)
 
   is_write_frame = true;
 
-  // No need to set bit width - we always use 8-bit transfers
-  gpioPinWrite(_PIN_DEF_DC, _DEF_HIGH);
-  
   // Note: p_data contains 16-bit color values, but we're using 8-bit transfers
   // The caller would need to handle converting 16-bit colors to 8-bit transfer format
   // by ensuring p_data contains MSB first, then LSB for each color
-  spiTransferDma(spi_ch, p_data, length, NULL, 0);
+  st7789SetXfer(&frame_xfer[0], _DEF_HIGH, p_data, length);
+  frame_xfer[0].p_done_func = transferDoneISR;
+
+  // 창은 앞서 st7789SetWindow() 로 설정한 row 로 본다
+  if (st7789StartFrame(1, win_y0, win_y1, length) == false)
+  {
+    is_write_frame = false;
+    return false;
+  }
+
+  return true;
+}
+
+bool st7789SetSleep(bool enable)
+{
+  // DMA 전송 중에는 명령을 보낼 수 없음
+  if (is_write_frame == true)
+    return false;
+
+  if (enable)
+  {
+    writecommand(ST7789_DISPOFF);
+    writecommand(ST7789_SLPIN);
+    delay(5);
+#ifdef HW_ST7789_TE_PIN
+    te_sync.te_count = 0;     // 깨어나면 첫 TE 부터 다시 동기
+#endif
+  }
+  else
+  {
+    writecommand(ST7789_SLPOUT);
+    delay(120);               // SLPOUT 이후 120ms 이내 명령 금지
+    writecommand(ST7789_DISPON);
+  }
 
   return true;
 }
@@ -305,6 +661,26 @@ bool st7789SetCallBack(void (*p_func)(void))
   return true;
 }
 
+bool st7789SetTearSync(bool enable)
+{
+#ifdef HW_ST7789_TE_PIN
+  te_sync.enable = enable;
+  return true;
+#else
+  return false;
+#endif
+}
+
+// TE 동기를 켰고 최근에 TE 가 들어오고 있으면 true
+bool st7789IsTearSync(void)
+{
+#ifdef HW_ST7789_TE_PIN
+  return te_sync.enable == true && te_sync.te_count > 0 && micros() - te_sync.te_us < ST7789_TE_LOST_US;
+#else
+  return false;
+#endif
+}
+
 
 #ifdef _USE_HW_CLI
 void cliCmd(cli_args_t *args)
@@ -348,10 +724,66 @@ void cliCmd(cli_args_t *args)
     ret = true;
   }
 
+#ifdef HW_ST7789_TE_PIN
+  if (args->argc == 1 && args->isStr(0, "te"))
+  {
+    cliPrintf("te     : %s, sync %s, period %d us, count %d\n",
+              te_sync.enable ? "on" : "off",
+              st7789IsTearSync() ? "YES" : "NO",
+              te_sync.period_us,
+              te_sync.te_count);
+    cliPrintf("frame  : %d, wait %d (avg %d us, max %d us)\n",
+              te_sync.frame_cnt,
+              te_sync.wait_cnt,
+              te_sync.wait_cnt > 0 ? te_sync.wait_us / te_sync.wait_cnt : 0,
+              te_sync.wait_max_us);
+    cliPrintf("         unsafe %d, no sync %d, fail %d\n",
+              te_sync.unsafe_cnt,
+              te_sync.nosync_cnt,
+              te_sync.fail_cnt);
+    ret = true;
+  }
+
+  if (args->argc == 2 && args->isStr(0, "te"))
+  {
+    if (args->isStr(1, "on") || args->isStr(1, "off"))
+    {
+      st7789SetTearSync(args->isStr(1, "on"));
+      cliPrintf("st7789 te %s\n", te_sync.enable ? "on" : "off");
+      ret = true;
+    }
+    if (args->isStr(1, "clear"))
+    {
+      te_sync.frame_cnt   = 0;
+      te_sync.wait_cnt    = 0;
+      te_sync.wait_us     = 0;
+      te_sync.wait_max_us = 0;
+      te_sync.unsafe_cnt  = 0;
+      te_sync.nosync_cnt  = 0;
+      te_sync.fail_cnt    = 0;
+      cliPrintf("st7789 te clear\n");
+      ret = true;
+    }
+  }
+#endif
+
+  if (args->argc == 2 && args->isStr(0, "sleep"))
+  {
+    bool enable = args->isStr(1, "on");
+
+    cliPrintf("st7789 sleep %s : %s\n", enable ? "on":"off", st7789SetSleep(enable) ? "OK":"Fail");
+    ret = true;
+  }
+
   if (ret == false)
   {
     cliPrintf("st7789 info\n");
     cliPrintf("st7789 test\n");
+    cliPrintf("st7789 sleep on:off\n");
+#ifdef HW_ST7789_TE_PIN
+    cliPrintf("st7789 te\n");
+    cliPrintf("st7789 te on:off:clear\n");
+#endif
   }
 }
 
@@ -10,9 +10,12 @@
  *      INCLUDES
  *********************/
 #include "lv_port_disp.h"
+#include "lvgl/src/draw/sw/lv_draw_sw.h"
 #include <stdbool.h>
 #include "lcd/st7789.h"
 #include "cli.h"
+#include "evtlog.h"
+#include <zephyr/kernel.h>
 /*********************
  *      DEFINES
  *********************/
@@ -29,9 +32,36 @@
     #define MY_DISP_VER_RES    HW_LCD_HEIGHT
 #endif
 
+#define DISP_STATS_MAX          32      /*프레임 기록 개수*/
+#define DISP_STATS_PRINT_MAX    8       /*`disp stats` 에서 출력할 최근 프레임 수*/
+#define DISP_CPU_BUDGET_X10     100     /*UI 렌더링 CPU 예산 (10.0 %)*/
+#define DISP_OVERLAY_PERIOD_MS  500
+
 /**********************
  *      TYPEDEFS
  **********************/
+typedef struct {
+    uint32_t time_ms;       /*프레임 렌더링 시작 시간*/
+    uint32_t total_us;      /*렌더링 시작 ~ 마지막 영역 flush 시작*/
+    uint32_t render_us;     /*total_us 에서 DMA 완료를 기다린 시간을 뺀 CPU 시간*/
+    uint32_t flush_us;      /*flush DMA 시간의 합 (마지막 flush 는 프레임이 끝난 뒤 더해짐)*/
+    uint32_t px;            /*다시 그린 픽셀 수*/
+    uint32_t heap_used;     /*LVGL heap 사용량*/
+    uint16_t flush_cnt;
+    uint16_t fill_cnt;      /*DMA fill 로 보낸 flush 수*/
+} disp_frame_t;
+
+typedef struct {
+    disp_frame_t frame[DISP_STATS_MAX];
+    uint32_t     head;          /*다음에 기록할 위치 (누적 프레임 수)*/
+    uint32_t     start_us;      /*지금 그리는 프레임의 시작*/
+    uint32_t     wait_us;       /*지금 그리는 프레임에서 DMA 완료를 기다린 시간*/
+    uint32_t     flush_start_us;
+    disp_frame_t * p_flush;     /*DMA 중인 flush 가 속한 프레임*/
+    uint32_t     render_max_us;
+    uint32_t     heap_max;
+    uint32_t     heap_total;
+} disp_stats_t;
 
 /**********************
  *  STATIC PROTOTYPES
@@ -40,13 +70,37 @@ static void disp_init(void);
 static lv_disp_drv_t * disp_drv_p;
 
 static void disp_flush(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p);
-//static void gpu_fill(lv_disp_drv_t * disp_drv, lv_color_t * dest_buf, lv_coord_t dest_width,
-//        const lv_area_t * fill_area, lv_color_t color);
+static void disp_draw_ctx_init(lv_disp_drv_t * disp_drv, lv_draw_ctx_t * draw_ctx);
+static void disp_blend(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc);
+static void disp_fill_apply(lv_draw_ctx_t * draw_ctx);
+static void disp_wait(lv_disp_drv_t * disp_drv);
 static void DmaTxPostCallBack(void);
+static void disp_render_start(lv_disp_drv_t * disp_drv);
+static void disp_sort_areas(lv_disp_t * disp);
+static void disp_monitor(lv_disp_drv_t * disp_drv, uint32_t time, uint32_t px);
+static void disp_overlay_update(lv_timer_t * timer);
+#ifdef _USE_HW_CLI
+static void cliDisp(cli_args_t * args);
+#endif
 /**********************
  *  STATIC VARIABLES
  **********************/
 static bool isColorBufferSend = false;
+static K_SEM_DEFINE(flush_done_sem, 0, 1);
+
+/*그리기 버퍼 전체를 덮는 단색 fill 은 바로 칠하지 않고 미뤄둔다.
+ *그 위에 다른 것이 그려지면 그때 버퍼에 칠하고, 끝까지 아무것도 없으면
+ *flush 에서 버퍼 대신 패널에 DMA 로 채운다 (배경만 있는 영역은 CPU 가 픽셀을 만들지 않음)*/
+static void (*sw_blend)(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc);
+static bool       fill_pending = false;
+static lv_color_t fill_color;
+static lv_color_t * fill_buf;
+static lv_area_t  fill_area;
+
+/*프레임별 렌더링/flush 시간 기록. LVGL 스레드에서 기록하고 DMA 완료 ISR 에서 flush 시간을 더한다*/
+static disp_stats_t disp_stats;
+static volatile bool is_overlay_req = false;
+static lv_obj_t * overlay_label = NULL;
 /**********************
  *      MACROS
  **********************/
@@ -121,6 +175,9 @@ void lv_port_disp_init(void)
     /*Used to copy the buffer's content to the display*/
     disp_drv.flush_cb = disp_flush;
 
+    /*DMA 전송 완료를 기다리는 동안 spin 하지 않고 다른 스레드에 CPU 를 양보*/
+    disp_drv.wait_cb = disp_wait;
+
     /*Set a display buffer*/
     // disp_drv.draw_buf = &draw_buf_dsc_3;
     disp_drv.draw_buf = &draw_buf_dsc_2;
@@ -128,13 +185,21 @@ void lv_port_disp_init(void)
     /*Required for Example 3)*/
     // disp_drv.full_refresh = 1;
 
-    /* Fill a memory array with a color if you have GPU.
-     * Note that, in lv_conf.h you can enable GPUs that has built-in support in LVGL.
-     * But if you have a different GPU you can use with this callback.*/
-    //disp_drv.gpu_fill_cb = gpu_fill;
+    /*단색 배경 fill 을 패널 DMA fill 로 돌리기 위해 SW 렌더러의 blend 를 감싼다*/
+    disp_drv.draw_ctx_init = disp_draw_ctx_init;
+
+    /*프레임 시작/끝에서 렌더링 시간 기록*/
+    disp_drv.render_start_cb = disp_render_start;
+    disp_drv.monitor_cb = disp_monitor;
 
     /*Finally register the driver*/
     lv_disp_drv_register(&disp_drv);
+
+    lv_timer_create(disp_overlay_update, DISP_OVERLAY_PERIOD_MS, NULL);
+
+#ifdef _USE_HW_CLI
+    cliAdd("disp", cliDisp);
+#endif
 }
 
 /**********************
@@ -188,11 +253,107 @@ static void disp_flush(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_colo
         // cliPrintf("x1 = %d, x2 = %d, w = %d\r\n",area->x1,area->x2,w);
         // cliPrintf("y1 = %d, y2 = %d, h = %d\r\n",area->y1,area->y2,h);
 
-        st7789SetWindow(area->x1,area->y1,area->x2,area->y2);
-        
+        bool ret;
+        disp_frame_t * p_frame = &disp_stats.frame[disp_stats.head % DISP_STATS_MAX];
+
+        p_frame->flush_cnt++;
+        disp_stats.p_flush = p_frame;
+        disp_stats.flush_start_us = micros();
+
         isColorBufferSend = true;
-        st7789SendBuffer((uint8_t*)color_p,w*h*2,200);
+        if(fill_pending && _lv_area_is_equal(area, &fill_area)) {
+            uint16_t color = fill_color.full;
+#if LV_COLOR_16_SWAP
+            color = (color >> 8) | (color << 8);
+#endif
+            fill_pending = false;
+            p_frame->fill_cnt++;
+            ret = st7789FillRectDma(area->x1, area->y1, w, h, color);
+        }
+        else {
+            if(fill_pending) {
+                disp_fill_apply(disp_drv->draw_ctx);
+            }
+            ret = st7789DrawBuffer(area->x1, area->y1, area->x2, area->y2, (uint8_t *)color_p);
+        }
+
+        if(ret == false) {
+            isColorBufferSend = false;
+            lv_disp_flush_ready(disp_drv);
+        }
     }
+    fill_pending = false;
+}
+
+static void disp_draw_ctx_init(lv_disp_drv_t * disp_drv, lv_draw_ctx_t * draw_ctx)
+{
+    lv_draw_sw_ctx_t * sw_ctx = (lv_draw_sw_ctx_t *)draw_ctx;
+
+    lv_draw_sw_init_ctx(disp_drv, draw_ctx);
+    sw_blend = sw_ctx->blend;
+    sw_ctx->blend = disp_blend;
+}
+
+/*미뤄둔 fill 을 원래 버퍼에 칠한다 (레이어를 그리는 중이면 draw_ctx 의 버퍼가 바뀌어 있음)*/
+static void disp_fill_apply(lv_draw_ctx_t * draw_ctx)
+{
+    lv_draw_sw_blend_dsc_t dsc;
+    void * buf = draw_ctx->buf;
+    lv_area_t * buf_area = draw_ctx->buf_area;
+    const lv_area_t * clip_area = draw_ctx->clip_area;
+
+    fill_pending = false;
+
+    lv_memset_00(&dsc, sizeof(dsc));
+    dsc.blend_area = &fill_area;
+    dsc.color = fill_color;
+    dsc.mask_res = LV_DRAW_MASK_RES_FULL_COVER;
+    dsc.opa = LV_OPA_COVER;
+    dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+
+    draw_ctx->buf = fill_buf;
+    draw_ctx->buf_area = &fill_area;
+    draw_ctx->clip_area = &fill_area;
+    sw_blend(draw_ctx, &dsc);
+    draw_ctx->buf = buf;
+    draw_ctx->buf_area = buf_area;
+    draw_ctx->clip_area = clip_area;
+}
+
+static void disp_blend(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc)
+{
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    lv_area_t area;
+
+    /*화면 버퍼 전체를 덮는 불투명 단색 fill 이면 미뤄둔다*/
+    if(dsc->src_buf == NULL && dsc->opa >= LV_OPA_MAX &&
+       (dsc->mask_buf == NULL || dsc->mask_res == LV_DRAW_MASK_RES_FULL_COVER) &&
+       dsc->blend_mode == LV_BLEND_MODE_NORMAL && disp != NULL &&
+       draw_ctx->buf == disp->driver->draw_buf->buf_act &&
+       _lv_area_intersect(&area, dsc->blend_area, draw_ctx->clip_area) &&
+       _lv_area_is_equal(&area, draw_ctx->buf_area)) {
+        fill_pending = true;
+        fill_color = dsc->color;
+        fill_buf = draw_ctx->buf;
+        fill_area = *draw_ctx->buf_area;
+        return;
+    }
+
+    if(fill_pending) {
+        disp_fill_apply(draw_ctx);
+    }
+    sw_blend(draw_ctx, dsc);
+}
+
+static void disp_wait(lv_disp_drv_t * disp_drv)
+{
+    LV_UNUSED(disp_drv);
+
+    uint32_t pre_time = micros();
+
+    /*LVGL 이 flushing 플래그를 다시 확인하므로 timeout 되어도 문제 없음*/
+    k_sem_take(&flush_done_sem, K_MSEC(1));
+    disp_stats.wait_us += micros() - pre_time;
 }
 
 static void DmaTxPostCallBack(void)
@@ -200,30 +361,249 @@ static void DmaTxPostCallBack(void)
     if (isColorBufferSend == true)
     {
         isColorBufferSend = false;
+        if(disp_stats.p_flush != NULL) {
+            disp_stats.p_flush->flush_us += micros() - disp_stats.flush_start_us;
+            disp_stats.p_flush = NULL;
+        }
         /*IMPORTANT!!!
          *Inform the graphics library that you are ready with the flushing*/
         lv_disp_flush_ready(disp_drv_p);
+        k_sem_give(&flush_done_sem);
+    }
+}
+
+static void disp_render_start(lv_disp_drv_t * disp_drv)
+{
+    LV_UNUSED(disp_drv);
+
+    /*TE 동기 중이면 다시 그릴 영역을 패널 스캔 방향(위 -> 아래) 순서로 보낸다*/
+    if(st7789IsTearSync()) {
+        disp_sort_areas(_lv_refr_get_disp_refreshing());
+    }
+
+    disp_frame_t * p_frame = &disp_stats.frame[disp_stats.head % DISP_STATS_MAX];
+
+    /*이전 프레임의 마지막 flush 가 아직 이 자리를 가리키고 있으면 끊는다*/
+    if(disp_stats.p_flush == p_frame) {
+        disp_stats.p_flush = NULL;
+    }
+    lv_memset_00(p_frame, sizeof(disp_frame_t));
+    p_frame->time_ms = millis();
+    disp_stats.start_us = micros();
+    disp_stats.wait_us = 0;
+}
+
+/*합쳐지지 않은 영역들을 y 순서로 정렬한다.
+ *LVGL 은 render_start_cb 전에 마지막 영역의 index 를 정해두므로 합쳐지지 않은 자리끼리만 바꾼다.
+ *위에서부터 차례로 보내면 각 flush 가 스캔을 따라가므로 TE 를 기다리는 시간이 줄고,
+ *화면 전체를 다시 그려도 이전/새 화면의 경계가 한 프레임에 한 번만 생긴다*/
+static void disp_sort_areas(lv_disp_t * disp)
+{
+    uint16_t idx[LV_INV_BUF_SIZE];
+    uint16_t cnt = 0;
+
+    if(disp == NULL) return;
+
+    for(uint16_t i = 0; i < disp->inv_p; i++) {
+        if(disp->inv_area_joined[i] == 0) {
+            idx[cnt++] = i;
+        }
+    }
+
+    for(uint16_t i = 1; i < cnt; i++) {
+        lv_area_t area = disp->inv_areas[idx[i]];
+        uint16_t j = i;
+
+        while(j > 0 && (disp->inv_areas[idx[j - 1]].y1 > area.y1 ||
+                        (disp->inv_areas[idx[j - 1]].y1 == area.y1 && disp->inv_areas[idx[j - 1]].x1 > area.x1))) {
+            disp->inv_areas[idx[j]] = disp->inv_areas[idx[j - 1]];
+            j--;
+        }
+        disp->inv_areas[idx[j]] = area;
     }
 }
 
-/*OPTIONAL: GPU INTERFACE*/
+static void disp_monitor(lv_disp_drv_t * disp_drv, uint32_t time, uint32_t px)
+{
+    LV_UNUSED(disp_drv);
+    LV_UNUSED(time);
+
+    disp_frame_t * p_frame = &disp_stats.frame[disp_stats.head % DISP_STATS_MAX];
+    lv_mem_monitor_t mon;
+
+    p_frame->total_us = micros() - disp_stats.start_us;
+    p_frame->render_us = p_frame->total_us > disp_stats.wait_us ? p_frame->total_us - disp_stats.wait_us : 0;
+    p_frame->px = px;
+
+    lv_mem_monitor(&mon);
+    p_frame->heap_used = mon.total_size - mon.free_size;
+    disp_stats.heap_max = mon.max_used;
+    disp_stats.heap_total = mon.total_size;
+    if(p_frame->render_us > disp_stats.render_max_us) {
+        disp_stats.render_max_us = p_frame->render_us;
+    }
+    /*flush 시간은 DMA 완료 후에 더해지므로 렌더링 시간만 남긴다*/
+    evtlogWrite(EVT_LCD_FRAME, LV_MIN(p_frame->render_us, 0xFFFF), px);
 
-/*If your MCU has hardware accelerator (GPU) then you can use it to fill a memory with a color*/
-//static void gpu_fill(lv_disp_drv_t * disp_drv, lv_color_t * dest_buf, lv_coord_t dest_width,
-//                    const lv_area_t * fill_area, lv_color_t color)
-//{
-//    /*It's an example code which should be done by your GPU*/
-//    int32_t x, y;
-//    dest_buf += dest_width * fill_area->y1; /*Go to the first line*/
-//
-//    for(y = fill_area->y1; y <= fill_area->y2; y++) {
-//        for(x = fill_area->x1; x <= fill_area->x2; x++) {
-//            dest_buf[x] = color;
-//        }
-//        dest_buf+=dest_width;    /*Go to the next line*/
-//    }
-//}
+    disp_stats.head++;
+}
+
+typedef struct {
+    uint32_t frames;
+    uint32_t span_ms;
+    uint32_t render_us;
+    uint32_t render_max_us;
+    uint32_t flush_us;
+    uint32_t flush_max_us;
+    uint32_t px;
+    uint32_t px_max;
+    uint32_t flush_cnt;
+    uint32_t fill_cnt;
+} disp_sum_t;
+
+/*기록된 프레임 합계. span 은 가장 오래된 프레임부터 지금까지*/
+static void disp_stats_sum(disp_sum_t * p_sum)
+{
+    uint32_t head = disp_stats.head;
+    uint32_t cnt = LV_MIN(head, DISP_STATS_MAX);
+
+    lv_memset_00(p_sum, sizeof(disp_sum_t));
+    for(uint32_t i = head - cnt; i != head; i++) {
+        const disp_frame_t * p_frame = &disp_stats.frame[i % DISP_STATS_MAX];
+
+        p_sum->render_us += p_frame->render_us;
+        p_sum->render_max_us = LV_MAX(p_sum->render_max_us, p_frame->render_us);
+        p_sum->flush_us += p_frame->flush_us;
+        p_sum->flush_max_us = LV_MAX(p_sum->flush_max_us, p_frame->flush_us);
+        p_sum->px += p_frame->px;
+        p_sum->px_max = LV_MAX(p_sum->px_max, p_frame->px);
+        p_sum->flush_cnt += p_frame->flush_cnt;
+        p_sum->fill_cnt += p_frame->fill_cnt;
+    }
+    p_sum->frames = cnt;
+    if(cnt > 0) {
+        p_sum->span_ms = millis() - disp_stats.frame[(head - cnt) % DISP_STATS_MAX].time_ms;
+    }
+}
+
+/*span 동안 렌더링에 쓴 CPU (0.1% 단위)*/
+static uint32_t disp_stats_cpu_x10(const disp_sum_t * p_sum)
+{
+    if(p_sum->span_ms == 0) return 0;
+    return (uint32_t)((uint64_t)p_sum->render_us / p_sum->span_ms);
+}
 
+/*오버레이는 LVGL 스레드에서만 만들고 지운다 (CLI 는 요청 플래그만 바꿈)*/
+static void disp_overlay_update(lv_timer_t * timer)
+{
+    LV_UNUSED(timer);
+
+    if(is_overlay_req == false) {
+        if(overlay_label != NULL) {
+            lv_obj_del(overlay_label);
+            overlay_label = NULL;
+        }
+        return;
+    }
+
+    if(overlay_label == NULL) {
+        overlay_label = lv_label_create(lv_layer_sys());
+        lv_obj_set_style_text_font(overlay_label, LV_FONT_DEFAULT, 0);
+        lv_obj_set_style_text_color(overlay_label, lv_color_hex(0xFFFFFF), 0);
+        lv_obj_set_style_bg_color(overlay_label, lv_color_hex(0x000000), 0);
+        lv_obj_set_style_bg_opa(overlay_label, LV_OPA_70, 0);
+        lv_obj_set_style_pad_all(overlay_label, 2, 0);
+        lv_obj_align(overlay_label, LV_ALIGN_BOTTOM_RIGHT, 0, 0);
+    }
+
+    disp_sum_t sum;
+    uint32_t cpu_x10;
+
+    disp_stats_sum(&sum);
+    cpu_x10 = disp_stats_cpu_x10(&sum);
+    lv_label_set_text_fmt(overlay_label, "%d FPS %d.%d%% CPU\n%d us %d KB",
+                          sum.span_ms > 0 ? (int)(sum.frames * 1000 / sum.span_ms) : 0,
+                          (int)(cpu_x10 / 10), (int)(cpu_x10 % 10),
+                          sum.frames > 0 ? (int)(sum.render_us / sum.frames) : 0,
+                          (int)(disp_stats.heap_max / 1024));
+}
+
+#ifdef _USE_HW_CLI
+static void cliDisp(cli_args_t * args)
+{
+    bool ret = false;
+
+    if(args->argc == 1 && args->isStr(0, "stats")) {
+        disp_sum_t sum;
+        uint32_t cpu_x10;
+        uint32_t head = disp_stats.head;
+
+        disp_stats_sum(&sum);
+        cpu_x10 = disp_stats_cpu_x10(&sum);
+
+        cliPrintf("frames  : %d (last %d in %d ms, %d.%d fps)\n",
+                  head, sum.frames, sum.span_ms,
+                  sum.span_ms > 0 ? sum.frames * 1000 / sum.span_ms : 0,
+                  sum.span_ms > 0 ? (sum.frames * 10000 / sum.span_ms) % 10 : 0);
+        cliPrintf("render  : avg %d us, max %d us (all time %d us)\n",
+                  sum.frames > 0 ? sum.render_us / sum.frames : 0,
+                  sum.render_max_us,
+                  disp_stats.render_max_us);
+        cliPrintf("flush   : avg %d us, max %d us, %d flush (%d dma fill)\n",
+                  sum.frames > 0 ? sum.flush_us / sum.frames : 0,
+                  sum.flush_max_us,
+                  sum.flush_cnt,
+                  sum.fill_cnt);
+        cliPrintf("dirty   : avg %d px, max %d px\n",
+                  sum.frames > 0 ? sum.px / sum.frames : 0,
+                  sum.px_max);
+        cliPrintf("cpu     : %d.%d %% (budget %d.%d %%, %s)\n",
+                  cpu_x10 / 10, cpu_x10 % 10,
+                  DISP_CPU_BUDGET_X10 / 10, DISP_CPU_BUDGET_X10 % 10,
+                  cpu_x10 <= DISP_CPU_BUDGET_X10 ? "OK" : "OVER");
+        cliPrintf("heap    : max %d / %d bytes\n", disp_stats.heap_max, disp_stats.heap_total);
+
+        cliPrintf("\n%10s %9s %9s %7s %6s %s\n", "time ms", "render us", "flush us", "px", "heap", "fill/flush");
+        for(uint32_t i = head - LV_MIN(head, DISP_STATS_PRINT_MAX); i != head; i++) {
+            const disp_frame_t * p_frame = &disp_stats.frame[i % DISP_STATS_MAX];
+
+            cliPrintf("%10d %9d %9d %7d %6d %2d/%-2d\n",
+                      p_frame->time_ms,
+                      p_frame->render_us,
+                      p_frame->flush_us,
+                      p_frame->px,
+                      p_frame->heap_used,
+                      p_frame->fill_cnt,
+                      p_frame->flush_cnt);
+        }
+        ret = true;
+    }
+
+    if(args->argc == 1 && args->isStr(0, "clear")) {
+        disp_stats.head = 0;
+        disp_stats.render_max_us = 0;
+        cliPrintf("disp stats cleared\n");
+        ret = true;
+    }
+
+    if(args->argc == 2 && args->isStr(0, "overlay")) {
+        if(args->isStr(1, "on")) {
+            is_overlay_req = true;
+            ret = true;
+        }
+        if(args->isStr(1, "off")) {
+            is_overlay_req = false;
+            ret = true;
+        }
+    }
+
+    if(ret == false) {
+        cliPrintf("disp stats\n");
+        cliPrintf("disp clear\n");
+        cliPrintf("disp overlay on:off\n");
+    }
+}
+#endif
 
 #else /*Enable this file at the top*/
 
@@ -22,10 +22,32 @@ static struct esb_payload rx_payload;
 static struct esb_payload tx_payload = ESB_CREATE_PAYLOAD(0,
                               0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17);
 
+#if HW_RF_MODE == _DEF_RF_MODE_RX
+// PRX 모드에서 ACK 에 실어 보낼 페이로드 (전송될 때마다 다시 큐에 넣는다)
+static struct esb_payload ack_payload;
+static volatile bool is_ack_payload = false;
+
+// 수신 듀티 사이클 (on/off 가 0 이면 연속 수신)
+static struct k_work_delayable rf_duty_work;
+static uint32_t rf_duty_on_ms  = 0;
+static uint32_t rf_duty_off_ms = 0;
+static bool     rf_is_rx_on    = true;
+
+static void rfDutyWorkFunc(struct k_work *work);
+#endif
+
+static bool is_init = false;
 static qbuffer_t rf_rx_q;
 static uint8_t rf_rx_buf[RF_RX_BUF_LENGTH];
 static struct k_mutex rf_rx_mutex;
 
+// 마지막으로 받은 패킷의 수신 시간 (micros) 과 받은 패킷 수
+static volatile uint32_t rf_rx_time = 0;
+static volatile uint32_t rf_rx_count = 0;
+
+// 패킷 수신 시 호출 (ISR), 입력 처리 스레드를 깨우는 용도
+static void (*rf_rx_func)(void) = NULL;
+
 #ifdef _USE_CLI_HW_RF
 static void cliCmd(cli_args_t *args);
 #endif
@@ -37,6 +59,12 @@ bool rfInit(void)
 {
   int err;
 
+  // hwInit() 에서 먼저 초기화되므로 key_protocol_init() 의 재호출은 건너뜀
+  if (is_init)
+  {
+    return true;
+  }
+
   qbufferCreate(&rf_rx_q, rf_rx_buf, RF_RX_BUF_LENGTH);
   k_mutex_init(&rf_rx_mutex);
 
@@ -57,12 +85,7 @@ bool rfInit(void)
 #if HW_RF_MODE == _DEF_RF_MODE_TX
   tx_payload.noack = false;
 #else
-  err = esb_write_payload(&tx_payload);
-  if (err)
-  {
-    LOG_ERR("Write payload, err %d", err);
-  return false;
-  }
+  k_work_init_delayable(&rf_duty_work, rfDutyWorkFunc);
 
   LOG_INF("Setting up for packet receiption");
 
@@ -74,6 +97,8 @@ bool rfInit(void)
   }
 #endif
 
+  is_init = true;
+
 #ifdef _USE_CLI_HW_RF
   cliAdd("rf", cliCmd);
 #endif
@@ -118,6 +143,100 @@ uint32_t rfWrite(uint8_t *p_data, uint32_t length)
 #endif
 }
 
+#if HW_RF_MODE == _DEF_RF_MODE_RX
+bool rfSetAckPayload(uint8_t *p_data, uint32_t length)
+{
+  if (length > 30)
+  {
+    return false;
+  }
+
+  unsigned int key;
+  bool ret = true;
+
+  // 기존 ACK 페이로드를 버리고 새 데이터로 교체
+  // TX_SUCCESS 이벤트(ISR)가 같은 버퍼를 다시 큐에 넣으므로 쓰는 동안 인터럽트를 막는다
+  // (esb_write_payload() 는 ESB FIFO 로 복사하므로 lock 밖에서는 버퍼를 읽지 않음)
+  key = irq_lock();
+  esb_flush_tx();
+
+  ack_payload.pipe   = 0;
+  ack_payload.length = length;
+  ack_payload.noack  = false;
+  memcpy(ack_payload.data, p_data, length);
+
+  is_ack_payload = (length > 0);
+  if (is_ack_payload)
+  {
+    ret = (esb_write_payload(&ack_payload) == 0);
+  }
+  irq_unlock(key);
+
+  return ret;
+}
+
+bool rfSetRxDutyCycle(uint32_t on_ms, uint32_t off_ms)
+{
+  rf_duty_on_ms  = on_ms;
+  rf_duty_off_ms = off_ms;
+
+  k_work_reschedule(&rf_duty_work, K_NO_WAIT);
+  return true;
+}
+
+static void rfDutyWorkFunc(struct k_work *work)
+{
+  ARG_UNUSED(work);
+
+  // 듀티 사이클 해제 : 연속 수신으로 복귀
+  if (rf_duty_on_ms == 0 || rf_duty_off_ms == 0)
+  {
+    if (rf_is_rx_on == false)
+    {
+      rf_is_rx_on = (esb_start_rx() == 0);
+    }
+    return;
+  }
+
+  if (rf_is_rx_on)
+  {
+    // 수신 중인 패킷이 있으면 esb_stop_rx() 가 실패하므로 다음 주기에 다시 시도
+    if (esb_stop_rx() == 0)
+    {
+      rf_is_rx_on = false;
+      k_work_reschedule(&rf_duty_work, K_MSEC(rf_duty_off_ms));
+    }
+    else
+    {
+      k_work_reschedule(&rf_duty_work, K_MSEC(rf_duty_on_ms));
+    }
+  }
+  else
+  {
+    rf_is_rx_on = (esb_start_rx() == 0);
+    k_work_reschedule(&rf_duty_work, K_MSEC(rf_duty_on_ms));
+  }
+}
+#endif
+
+bool rfSetRxCallBack(void (*p_func)(void))
+{
+  rf_rx_func = p_func;
+  return true;
+}
+
+uint32_t rfGetRxTime(uint32_t *p_count)
+{
+  uint32_t ret;
+
+  k_mutex_lock(&rf_rx_mutex, K_FOREVER);
+  ret = rf_rx_time;
+  *p_count = rf_rx_count;
+  k_mutex_unlock(&rf_rx_mutex);
+
+  return ret;
+}
+
 uint32_t rfRead(uint8_t *p_data, uint32_t length)
 {
   uint32_t ret;
@@ -135,6 +254,13 @@ static void event_handler(struct esb_evt const *event)
   {
   case ESB_EVENT_TX_SUCCESS:
     LOG_DBG("TX SUCCESS EVENT");
+#if HW_RF_MODE == _DEF_RF_MODE_RX
+    // ACK 페이로드가 전송되었으므로 다음 ACK 를 위해 다시 큐에 넣는다
+    if (is_ack_payload)
+    {
+      esb_write_payload(&ack_payload);
+    }
+#endif
   break;
   case ESB_EVENT_TX_FAILED:
     esb_flush_tx(); // TX 큐 비우기
@@ -146,7 +272,14 @@ static void event_handler(struct esb_evt const *event)
     // 수신된 데이터를 큐에 저장
     k_mutex_lock(&rf_rx_mutex, K_FOREVER);
     qbufferWrite(&rf_rx_q, rx_payload.data, rx_payload.length);
+    rf_rx_time = micros();
+    rf_rx_count++;
     k_mutex_unlock(&rf_rx_mutex);
+
+    if (rf_rx_func != NULL)
+    {
+      rf_rx_func();
+    }
   }
   break;
   }
@@ -308,10 +441,25 @@ void cliCmd(cli_args_t *args)
   {
   cliPrintf("rf available: %d\n", rfAvailable());
   }
+#if HW_RF_MODE == _DEF_RF_MODE_RX
+  else if (args->argc == 1 && args->isStr(0, "duty"))
+  {
+  cliPrintf("rf duty on %d ms, off %d ms, rx %s\n",
+            rf_duty_on_ms, rf_duty_off_ms, rf_is_rx_on ? "on":"off");
+  }
+  else if (args->argc == 3 && args->isStr(0, "duty"))
+  {
+  rfSetRxDutyCycle(args->getData(1), args->getData(2));
+  cliPrintf("rf duty on %d ms, off %d ms\n", rf_duty_on_ms, rf_duty_off_ms);
+  }
+#endif
   else
   {
   cliPrintf("rf tx\n");
   cliPrintf("rf rx\n");
+#if HW_RF_MODE == _DEF_RF_MODE_RX
+  cliPrintf("rf duty [on_ms off_ms]\n");
+#endif
   }
 }
 #endif
@@ -3,6 +3,32 @@
 #ifdef _USE_HW_SPI
 #include <nrfx_spim.h>
 #include "cli.h"
+#include "gpio.h"
+
+
+// 버스마다 전송 큐를 두고, 전송이 끝나면 SPIM 인터럽트에서 바로 다음 전송을 시작한다.
+// 전송을 기다리는 스레드는 세마포어로 잠들어 있으므로 전송 중에도 CPU 를 다른 스레드가 쓸 수 있다.
+// spiXfer() 로 함께 넣은 전송들은 큐에 한 번에 들어가므로 다른 클라이언트의 전송이 사이에 끼지 않는다.
+#define SPI_QUEUE_MAX         16
+#define SPI_XFER_LENGTH_MAX   0xFFFF    // SPIM3 EasyDMA MAXCNT(16bit), 넘으면 나눠서 전송
+
+
+typedef struct
+{
+  struct k_sem sem;
+  bool         ret;
+} spi_wait_t;
+
+typedef struct
+{
+  spi_xfer_t  xfer;
+  uint32_t    offset;       // 나눠서 보낸 경우 지금까지 보낸 길이
+  uint32_t    length;       // 지금 전송 중인 길이
+  uint32_t    queue_time;   // 큐에 들어간 시간 (micros)
+  spi_wait_t *p_wait;       // spiXfer() 로 넣은 전송이면 기다리는 스레드
+  bool        is_last;      // spiXfer() 묶음의 마지막 전송
+  bool        is_cancel;
+} spi_req_t;
 
 typedef struct
 {
@@ -11,8 +37,14 @@ typedef struct
   void (*p_tx_done_func)(void);
   uint32_t freq;
   bool is_init;
-  bool is_dma_mode;
-  bool is_tx_done;
+
+  volatile bool is_busy;
+  uint32_t      start_time;
+  uint32_t      q_in;
+  uint32_t      q_out;
+  spi_req_t     queue[SPI_QUEUE_MAX];
+  struct k_sem  free_sem;     // 큐에 빈 자리가 생기면 준다
+  spi_info_t    info;
 } spi_tbl_t;
 
 #define SCK_PIN 24  // P0.24
@@ -27,14 +59,123 @@ static spi_tbl_t spi_tbl[HW_SPI_MAX_CH] = {
         .freq = 32000000,
         .p_tx_done_func = NULL,
         .is_init = false,
-        .is_dma_mode = true
-    } 
+    }
 };
 
 #ifdef _USE_CLI_SPI
 void cliSpi(cli_args_t *args);
 #endif
 
+
+static void spiStartNext(spi_tbl_t *p_spi);
+
+
+static uint32_t spiXferLength(const spi_xfer_t *p_xfer)
+{
+  return cmax(p_xfer->tx_length * cmax(p_xfer->tx_repeat, 1), p_xfer->rx_length);
+}
+
+static void spiComplete(spi_tbl_t *p_spi, spi_req_t *p_req, bool ret)
+{
+  if (p_req->xfer.cs_pin != SPI_PIN_NONE)
+  {
+    gpioPinWrite(p_req->xfer.cs_pin, _DEF_HIGH);
+  }
+  if (ret == false)
+  {
+    p_spi->info.error_count++;
+  }
+  p_spi->info.xfer_count++;
+
+  if (p_req->xfer.p_done_func != NULL)
+  {
+    p_req->xfer.p_done_func(p_req->xfer.arg);
+  }
+  if (p_req->p_wait != NULL)
+  {
+    if (ret == false)
+    {
+      p_req->p_wait->ret = false;
+    }
+    if (p_req->is_last)
+    {
+      k_sem_give(&p_req->p_wait->sem);
+    }
+  }
+  p_spi->q_out++;
+  k_sem_give(&p_spi->free_sem);
+}
+
+// 버스가 쉬고 있을 때 큐의 다음 전송을 시작 (인터럽트 잠금 상태에서 호출)
+static void spiStartNext(spi_tbl_t *p_spi)
+{
+  while (p_spi->q_out != p_spi->q_in)
+  {
+    spi_req_t *p_req = &p_spi->queue[p_spi->q_out % SPI_QUEUE_MAX];
+    const uint8_t *tx_buf = NULL;
+    uint8_t *rx_buf = NULL;
+    uint32_t tx_length = 0;
+    uint32_t rx_length = 0;
+
+    if (p_req->is_cancel)
+    {
+      p_spi->q_out++;
+      k_sem_give(&p_spi->free_sem);
+      continue;
+    }
+
+    if (p_req->offset == 0)
+    {
+      uint32_t wait_us = micros() - p_req->queue_time;
+
+      p_spi->info.wait_us += wait_us;
+      if (wait_us > p_spi->info.wait_max_us)
+      {
+        p_spi->info.wait_max_us = wait_us;
+      }
+      if (p_req->xfer.dc_pin != SPI_PIN_NONE)
+      {
+        gpioPinWrite(p_req->xfer.dc_pin, p_req->xfer.dc_level);
+      }
+      if (p_req->xfer.cs_pin != SPI_PIN_NONE)
+      {
+        gpioPinWrite(p_req->xfer.cs_pin, _DEF_LOW);
+      }
+    }
+
+    // 반복 전송은 tx_buf 끝에서 다시 처음부터 보낸다
+    if (p_req->xfer.tx_repeat > 1)
+    {
+      uint32_t pos = p_req->offset % p_req->xfer.tx_length;
+
+      tx_buf    = &p_req->xfer.tx_buf[pos];
+      tx_length = cmin(p_req->xfer.tx_length - pos, SPI_XFER_LENGTH_MAX);
+    }
+    else if (p_req->xfer.tx_length > p_req->offset)
+    {
+      tx_buf    = &p_req->xfer.tx_buf[p_req->offset];
+      tx_length = cmin(p_req->xfer.tx_length - p_req->offset, SPI_XFER_LENGTH_MAX);
+    }
+    if (p_req->xfer.tx_repeat <= 1 && p_req->xfer.rx_length > p_req->offset)
+    {
+      rx_buf    = &p_req->xfer.rx_buf[p_req->offset];
+      rx_length = cmin(p_req->xfer.rx_length - p_req->offset, SPI_XFER_LENGTH_MAX);
+    }
+    p_req->length = cmax(tx_length, rx_length);
+
+    nrfx_spim_xfer_desc_t xfer_desc = NRFX_SPIM_XFER_TRX(tx_buf, tx_length, rx_buf, rx_length);
+
+    p_spi->is_busy    = true;
+    p_spi->start_time = micros();
+    if (nrfx_spim_xfer(&p_spi->spim, &xfer_desc, 0) == NRFX_SUCCESS)
+    {
+      return;
+    }
+    p_spi->is_busy = false;
+    spiComplete(p_spi, p_req, false);
+  }
+}
+
 /**
  * @brief Function for handling SPIM driver events.
  *
@@ -43,21 +184,29 @@ void cliSpi(cli_args_t *args);
  */
 static void spim_handler(nrfx_spim_evt_t const * p_event, void * p_context)
 {
-    if (p_event->type == NRFX_SPIM_EVENT_DONE)
+    spi_tbl_t *p_spi = (spi_tbl_t *)p_context;
+
+    if (p_event->type == NRFX_SPIM_EVENT_DONE && p_spi->is_busy)
     {
-        spi_tbl_t *p_spi = (spi_tbl_t *)p_context;
-        p_spi->is_tx_done = true;
-        if (p_spi->p_tx_done_func != NULL)
+        spi_req_t *p_req = &p_spi->queue[p_spi->q_out % SPI_QUEUE_MAX];
+
+        p_spi->is_busy = false;
+        p_spi->info.busy_us += micros() - p_spi->start_time;
+        p_spi->info.bytes   += p_req->length;
+
+        p_req->offset += p_req->length;
+        if (p_req->offset >= spiXferLength(&p_req->xfer))
         {
-          p_spi->p_tx_done_func();
+          spiComplete(p_spi, p_req, true);
         }
+        spiStartNext(p_spi);
     }
 }
 
 bool spiInit(void)
 {
   uint32_t err_count = 0;
-  
+
 
   IRQ_CONNECT(NRFX_IRQ_NUMBER_GET(NRF_SPIM_INST_GET(3)), IRQ_PRIO_LOWEST,
         NRFX_SPIM_INST_HANDLER_GET(3), 0, 0);
@@ -67,21 +216,17 @@ bool spiInit(void)
     nrfx_err_t status;
 
     spi_tbl[i].config.frequency = spi_tbl[i].freq;
-    
-    if(spi_tbl[i].is_dma_mode == true)
-    {
-
-
-      status = nrfx_spim_init(&spi_tbl[i].spim, &spi_tbl[i].config, spim_handler, (void *)&spi_tbl[i]);
-    }
-    else
-    {
-      status = nrfx_spim_init(&spi_tbl[i].spim, &spi_tbl[i].config, NULL, NULL);
-    }
+    spi_tbl[i].q_in  = 0;
+    spi_tbl[i].q_out = 0;
+    spi_tbl[i].is_busy = false;
+    k_sem_init(&spi_tbl[i].free_sem, 0, 1);
+    memset(&spi_tbl[i].info, 0, sizeof(spi_info_t));
 
+    status = nrfx_spim_init(&spi_tbl[i].spim, &spi_tbl[i].config, spim_handler, (void *)&spi_tbl[i]);
     if (status != NRFX_SUCCESS)
     {
       err_count++;
+      continue;
     }
     spi_tbl[i].is_init = true;
   }
@@ -97,6 +242,10 @@ bool spiInit(void)
   return true;
 }
 
+void spiSetBitWidth(uint8_t ch, uint8_t bit_width)
+{
+}
+
 void spiAttachTxInterrupt(uint8_t ch, void (*func)())
 {
   if (ch >= HW_SPI_MAX_CH)
@@ -104,162 +253,251 @@ void spiAttachTxInterrupt(uint8_t ch, void (*func)())
     return;
   }
 
-  if(spi_tbl[ch].is_dma_mode == false)
-  {
-    return;
-  }
-
   spi_tbl[ch].p_tx_done_func = func;
 }
 
-bool spiTransfer(uint8_t ch, uint8_t *tx_buf, uint32_t tx_length, uint8_t *rx_buf, uint32_t rx_length, uint32_t timeout)
+static bool spiEnqueue(spi_tbl_t *p_spi, const spi_xfer_t *p_xfer, uint32_t count, spi_wait_t *p_wait)
 {
-  nrfx_err_t status;
+  unsigned int key;
+  uint32_t q_len;
 
-  uint32_t timeout_cnt = timeout;
+  for (uint32_t i=0; i<count; i++)
+  {
+    if (p_xfer[i].tx_repeat > 1 && p_xfer[i].tx_length == 0)
+    {
+      return false;
+    }
+  }
 
-  if ((ch >= HW_SPI_MAX_CH) || (spi_tbl[ch].is_init == false))
+  key = irq_lock();
+  q_len = p_spi->q_in - p_spi->q_out;
+  if (q_len + count > SPI_QUEUE_MAX)
   {
+    irq_unlock(key);
     return false;
   }
 
-  if(spi_tbl[ch].is_dma_mode == true)
+  for (uint32_t i=0; i<count; i++)
+  {
+    spi_req_t *p_req = &p_spi->queue[p_spi->q_in % SPI_QUEUE_MAX];
+
+    p_req->xfer       = p_xfer[i];
+    p_req->offset     = 0;
+    p_req->length     = 0;
+    p_req->queue_time = micros();
+    p_req->p_wait     = p_wait;
+    p_req->is_last    = (i == count - 1);
+    p_req->is_cancel  = false;
+    p_spi->q_in++;
+  }
+  if (q_len + count > p_spi->info.queue_max)
   {
-    spi_tbl[ch].is_tx_done = false;
+    p_spi->info.queue_max = q_len + count;
   }
 
-  nrfx_spim_t spim_inst = spi_tbl[ch].spim;
+  if (p_spi->is_busy == false)
+  {
+    spiStartNext(p_spi);
+  }
+  irq_unlock(key);
 
-  nrfx_spim_xfer_desc_t xfer_desc = NRFX_SPIM_XFER_TRX(tx_buf, tx_length, rx_buf, rx_length);
+  return true;
+}
 
-  status = nrfx_spim_xfer(&spim_inst, &xfer_desc, 0);
-  if (status != NRFX_SUCCESS)
+// timeout 으로 포기한 spiXfer() 의 전송을 큐에서 뺀다 (전송 중이면 중단)
+static void spiCancel(spi_tbl_t *p_spi, spi_wait_t *p_wait)
+{
+  unsigned int key;
+
+  key = irq_lock();
+  for (uint32_t i=p_spi->q_out; i!=p_spi->q_in; i++)
+  {
+    spi_req_t *p_req = &p_spi->queue[i % SPI_QUEUE_MAX];
+
+    if (p_req->p_wait == p_wait)
+    {
+      p_req->is_cancel = true;
+      p_req->p_wait    = NULL;
+    }
+  }
+  if (p_spi->is_busy && p_spi->queue[p_spi->q_out % SPI_QUEUE_MAX].is_cancel)
+  {
+    spi_req_t *p_req = &p_spi->queue[p_spi->q_out % SPI_QUEUE_MAX];
+
+    nrfx_spim_abort(&p_spi->spim);
+    p_spi->is_busy = false;
+    if (p_req->xfer.cs_pin != SPI_PIN_NONE)
+    {
+      gpioPinWrite(p_req->xfer.cs_pin, _DEF_HIGH);
+    }
+    p_spi->q_out++;
+    k_sem_give(&p_spi->free_sem);
+    spiStartNext(p_spi);
+  }
+  irq_unlock(key);
+}
+
+// 전송이 끝날 때까지 잠들어서 기다린다 (스레드에서 호출)
+bool spiXfer(uint8_t ch, const spi_xfer_t *p_xfer, uint32_t count, uint32_t timeout_ms)
+{
+  spi_tbl_t *p_spi;
+  spi_wait_t wait;
+  uint32_t pre_time;
+  uint32_t elapsed;
+
+  if ((ch >= HW_SPI_MAX_CH) || (spi_tbl[ch].is_init == false) || count == 0 || count > SPI_QUEUE_MAX)
   {
     return false;
   }
+  p_spi = &spi_tbl[ch];
 
-  // dma 모드 spi를 polling 방식으로 사용 시 완료 대기
-  if(spi_tbl[ch].is_dma_mode == true)
+  k_sem_init(&wait.sem, 0, 1);
+  wait.ret = true;
+
+  // 큐가 차 있으면 빈 자리가 생길 때까지 기다린다
+  pre_time = millis();
+  while (spiEnqueue(p_spi, p_xfer, count, &wait) == false)
   {
-    while(spi_tbl[ch].is_tx_done == false)
+    elapsed = millis() - pre_time;
+
+    if (elapsed >= timeout_ms || k_sem_take(&p_spi->free_sem, K_MSEC(timeout_ms - elapsed)) != 0)
     {
-      timeout_cnt--;
-      if (timeout_cnt == 0)
-      {
-        return false;
-      }
-      // delay(1);
+      p_spi->info.timeout_count++;
+      return false;
     }
   }
 
+  // 큐에서 기다린 시간을 빼고 남은 시간만 완료를 기다린다 (이미 끝났으면 0 으로도 성공)
+  elapsed = millis() - pre_time;
+  if (k_sem_take(&wait.sem, K_MSEC(elapsed < timeout_ms ? timeout_ms - elapsed : 0)) != 0)
+  {
+    spiCancel(p_spi, &wait);
+    p_spi->info.timeout_count++;
+    return false;
+  }
 
-
-  return true;
+  return wait.ret;
 }
 
-bool spiTransferDma(uint8_t ch, uint8_t *tx_buf, uint32_t tx_length, uint8_t *rx_buf, uint32_t rx_length)
+// 큐에 넣고 바로 돌아온다. 완료는 각 전송의 p_done_func 로 알린다
+bool spiXferQueue(uint8_t ch, const spi_xfer_t *p_xfer, uint32_t count)
 {
-  nrfx_err_t status;
-
-  if ((ch >= HW_SPI_MAX_CH) || (spi_tbl[ch].is_init == false) || (spi_tbl[ch].is_dma_mode == false))
+  if ((ch >= HW_SPI_MAX_CH) || (spi_tbl[ch].is_init == false) || count == 0)
   {
     return false;
   }
 
-  nrfx_spim_t spim_inst = spi_tbl[ch].spim;
+  return spiEnqueue(&spi_tbl[ch], p_xfer, count, NULL);
+}
 
-  nrfx_spim_xfer_desc_t xfer_desc = NRFX_SPIM_XFER_TRX(tx_buf, tx_length, rx_buf, rx_length);
+bool spiTransfer(uint8_t ch, uint8_t *tx_buf, uint32_t tx_length, uint8_t *rx_buf, uint32_t rx_length, uint32_t timeout)
+{
+  spi_xfer_t xfer = {
+    .tx_buf    = tx_buf,
+    .tx_length = tx_length,
+    .rx_buf    = rx_buf,
+    .rx_length = rx_length,
+    .cs_pin    = SPI_PIN_NONE,
+    .dc_pin    = SPI_PIN_NONE,
+  };
+
+  return spiXfer(ch, &xfer, 1, timeout);
+}
 
-  status = nrfx_spim_xfer(&spim_inst, &xfer_desc, 0);
-  if (status != NRFX_SUCCESS)
+static void spiTransferDmaDone(void *arg)
+{
+  spi_tbl_t *p_spi = (spi_tbl_t *)arg;
+
+  if (p_spi->p_tx_done_func != NULL)
   {
-    return false;
+    p_spi->p_tx_done_func();
   }
+}
+
+bool spiTransferDma(uint8_t ch, uint8_t *tx_buf, uint32_t tx_length, uint8_t *rx_buf, uint32_t rx_length)
+{
+  spi_xfer_t xfer = {
+    .tx_buf      = tx_buf,
+    .tx_length   = tx_length,
+    .rx_buf      = rx_buf,
+    .rx_length   = rx_length,
+    .cs_pin      = SPI_PIN_NONE,
+    .dc_pin      = SPI_PIN_NONE,
+    .p_done_func = spiTransferDmaDone,
+    .arg         = &spi_tbl[ch % HW_SPI_MAX_CH],
+  };
+
+  return spiXferQueue(ch, &xfer, 1);
+}
 
+bool spiGetInfo(uint8_t ch, spi_info_t *p_info)
+{
+  if (ch >= HW_SPI_MAX_CH)
+  {
+    return false;
+  }
+  *p_info = spi_tbl[ch].info;
   return true;
 }
 
+void spiClearInfo(uint8_t ch)
+{
+  if (ch < HW_SPI_MAX_CH)
+  {
+    memset(&spi_tbl[ch].info, 0, sizeof(spi_info_t));
+  }
+}
+
 #ifdef _USE_CLI_SPI
 void cliSpi(cli_args_t *args)
 {
   bool ret = false;
-  /** @brief Transmit buffer initialized with the specified message ( @ref MSG_TO_SEND ). */
-  // static uint8_t m_tx_buffer[16] = {0};
 
-  /** @brief Receive buffer defined with the size to store specified message ( @ref MSG_TO_SEND ). */
-  // static uint8_t m_rx_buffer[16];
 
-  if (args->argc == 1)
+  if (args->argc == 1 && args->isStr(0, "info"))
   {
-    if (args->isStr(0, "test") == true)
+    for (int i=0; i<SPI_MAX_CH; i++)
     {
-      // Perform test operation
-      // spiTransfer(0, m_tx_buffer, m_rx_buffer, sizeof(m_tx_buffer), 1000);
-      cliPrintf("SPI test executed.\n");
+      spi_info_t info;
+      uint32_t mbps_x100;
+
+      spiGetInfo(i, &info);
+      mbps_x100 = info.busy_us > 0 ? (uint32_t)((uint64_t)info.bytes * 800 / info.busy_us) : 0;
+
+      cliPrintf("ch%d : xfer %d, %d bytes, busy %d us (%d.%02d Mbps)\n",
+                i + 1,
+                info.xfer_count,
+                info.bytes,
+                info.busy_us,
+                mbps_x100 / 100,
+                mbps_x100 % 100);
+      cliPrintf("      wait avg %d us, max %d us, queue max %d/%d, timeout %d, error %d\n",
+                info.xfer_count > 0 ? info.wait_us / info.xfer_count : 0,
+                info.wait_max_us,
+                info.queue_max,
+                SPI_QUEUE_MAX,
+                info.timeout_count,
+                info.error_count);
+    }
+    ret = true;
+  }
 
-      ret = true;
+  if (args->argc == 1 && args->isStr(0, "clear"))
+  {
+    for (int i=0; i<SPI_MAX_CH; i++)
+    {
+      spiClearInfo(i);
     }
+    cliPrintf("spi info cleared\n");
+    ret = true;
   }
-  // if (args->argc == 3)
-  // {
-  //   if(args->isStr(0, "read") == true)
-  //   {
-  //     addr   = (uint32_t)args->getData(1);
-  //     length = (uint32_t)args->getData(2);
-
-  //     if (length > eepromGetLength())
-  //     {
-  //       cliPrintf( "length error\n");
-  //     }
-  //     for (i=0; i<length; i++)
-  //     {
-  //       if (eepromReadByte(addr+i, &data) == true)
-  //       {
-  //         cliPrintf( "addr : %d\t 0x%02X\n", addr+i, data);
-  //       }
-  //       else
-  //       {
-  //         cliPrintf("eepromReadByte() Error\n");
-  //         break;
-  //       }
-  //     }
-  //   }
-  //   else if(args->isStr(0, "write") == true)
-  //   {
-  //     addr = (uint32_t)args->getData(1);
-  //     data = (uint8_t )args->getData(2);
-
-  //     pre_time = millis();
-  //     eep_ret = eepromWriteByte(addr, data);
-
-  //     cliPrintf( "addr : %d\t 0x%02X %dms\n", addr, data, millis()-pre_time);
-  //     if (eep_ret)
-  //     {
-  //       cliPrintf("OK\n");
-  //     }
-  //     else
-  //     {
-  //       cliPrintf("FAIL\n");
-  //     }
-  //   }
-  //   else
-  //   {
-  //     ret = false;
-  //   }
-  // }
-  // else
-  // {
-  //   ret = false;
-  // }
-  ret = false;
 
   if (ret == false)
   {
-    cliPrintf("spi test\n");
-    cliPrintf("spi read  [addr] [length]\n");
-    cliPrintf("spi write [addr] [data]\n");
+    cliPrintf("spi info\n");
+    cliPrintf("spi clear\n");
   }
 }
 #endif
 
-#endif
\ No newline at end of file
+#endif
@@ -4,6 +4,7 @@
 #include "usb_hid/usbd_hid.h"
 #include "cdc.h"
 #include "cli.h"
+#include "hw.h"
 
 #include <zephyr/kernel.h>
 #include <zephyr/device.h>
@@ -19,6 +20,22 @@ static bool is_init = false;
 // semaphore for USB operations
 K_SEM_DEFINE(usb_setting_sema, 1, 1); // 초기 카운트 1, 최대 카운트 1 (Binary Semaphore)
 
+// SOF 동기화용 세마포어 (SOF 마다 give, QMK 루프에서 take)
+K_SEM_DEFINE(usb_sof_sema, 0, 1);
+
+// SOF -> 리포트 전송까지의 위상(phase) 히스토그램 (100us 단위)
+#define USB_SOF_HIST_STEP_US    100
+#define USB_SOF_HIST_MAX        (1000 / USB_SOF_HIST_STEP_US)
+
+static volatile uint32_t sof_time_us = 0;
+static volatile uint32_t sof_count   = 0;
+static void (*sof_func)(void) = NULL;
+static uint32_t sof_hist[USB_SOF_HIST_MAX + 1];
+static uint32_t sof_report_count = 0;
+
+// remote wakeup 재요청 간격
+#define USB_WAKEUP_RETRY_MS     100
+
 static bool usb_configured = false;
 static bool usb_suspended = false;
 static bool reconnect_needed = false;
@@ -39,12 +56,23 @@ static void hid_status_cb(enum usb_dc_status_code status, const uint8_t *param)
 {
   switch (status)
   {
+  case USB_DC_SOF:
+    // 1ms 마다 호출되므로 로그/세마포어 잠금 없이 처리
+    sof_time_us = micros();
+    sof_count++;
+    k_sem_give(&usb_sof_sema);
+    if (sof_func != NULL)
+    {
+      sof_func();
+    }
+    break;
   case USB_DC_CONFIGURED:
     // semephore를 사용하여 USB 작업 동기화
     k_sem_take(&usb_setting_sema, K_FOREVER);
     usb_configured = true;
     usb_suspended = false;
     k_sem_give(&usb_setting_sema);
+    hwSetReady(HW_READY_USB);
     LOG_INF("USB device configured");
     break;
   case USB_DC_DISCONNECTED:
@@ -127,11 +155,9 @@ bool usbInit(void)
 {
   bool ret = false;
   ret |= cdcInit();
-  k_msleep(500); // 하드웨어 안정화 대기
   ret |= usbHidInit();
   is_init = ret;
-  // USB 활성화 (지연된 초기화)
-  k_msleep(500); // 하드웨어 안정화 대기
+  // enumeration 완료는 기다리지 않음 (USB_DC_CONFIGURED 에서 HW_READY_USB 설정)
   ret = usb_enable(hid_status_cb);
   if (ret != 0)
   {
@@ -140,7 +166,6 @@ bool usbInit(void)
   }
 
   LOG_INF("HID device ready");
-  k_msleep(1000);
   k_thread_create(&usb_thread_data, usb_thread_stack,
                   K_THREAD_STACK_SIZEOF(usb_thread_stack),
                   usb_thread_func,
@@ -172,8 +197,79 @@ bool usbIsConnect(void)
 
 bool usbIsSuspended(void)
 {
-  // return tud_suspended();
-  return false; // 현재는 일시 중단 상태를 사용하지 않음
+  bool ret;
+
+  k_sem_take(&usb_setting_sema, K_FOREVER);
+  ret = usb_configured && usb_suspended;
+  k_sem_give(&usb_setting_sema);
+  return ret;
+}
+
+bool usbWakeup(void)
+{
+#ifdef CONFIG_USB_DEVICE_REMOTE_WAKEUP
+  static uint32_t pre_time = 0;
+
+  // resume 이 완료될 때까지 반복 요청하지 않도록 제한
+  if (pre_time != 0 && millis() - pre_time < USB_WAKEUP_RETRY_MS)
+  {
+    return false;
+  }
+  pre_time = millis();
+
+  int err = usb_wakeup_request();
+  if (err != 0)
+  {
+    LOG_WRN("USB wakeup request failed: %d", err);
+    return false;
+  }
+  LOG_INF("USB remote wakeup requested");
+  return true;
+#else
+  return false;
+#endif
+}
+
+uint32_t usbGetPollInterval(void)
+{
+#ifdef CONFIG_USB_HID_POLL_INTERVAL_MS
+  return CONFIG_USB_HID_POLL_INTERVAL_MS;
+#else
+  return 0;
+#endif
+}
+
+bool usbWaitSof(uint32_t timeout_ms)
+{
+  // SOF가 오지 않는 상태(미연결/Suspend)에서는 timeout 후 반환
+  return k_sem_take(&usb_sof_sema, K_MSEC(timeout_ms)) == 0;
+}
+
+bool usbSetSofCallBack(void (*p_func)(void))
+{
+  // SOF 인터럽트에서 호출되므로 짧게 처리해야 함
+  sof_func = p_func;
+  return true;
+}
+
+void usbSofLogReport(void)
+{
+  uint32_t phase;
+  uint32_t index;
+
+  if (sof_count == 0)
+  {
+    return;
+  }
+
+  phase = micros() - sof_time_us;
+  index = phase / USB_SOF_HIST_STEP_US;
+  if (index > USB_SOF_HIST_MAX)
+  {
+    index = USB_SOF_HIST_MAX;
+  }
+  sof_hist[index]++;
+  sof_report_count++;
 }
 
 #ifdef _USE_HW_CLI
@@ -214,6 +310,36 @@ void cliCmd(cli_args_t *args)
     ret = true;
   }
 
+  if (args->argc == 1 && args->isStr(0, "sof"))
+  {
+    cliPrintf("Poll Interval : %d ms\n", usbGetPollInterval());
+    cliPrintf("SOF Count     : %d\n", sof_count);
+    cliPrintf("Report Count  : %d\n", sof_report_count);
+    cliPrintf("SOF -> Report phase\n");
+    for (int i=0; i<=USB_SOF_HIST_MAX; i++)
+    {
+      uint32_t percent = 0;
+
+      if (sof_report_count > 0)
+      {
+        percent = sof_hist[i] * 100 / sof_report_count;
+      }
+      if (i < USB_SOF_HIST_MAX)
+        cliPrintf("  %4d ~ %4d us : %8d (%3d%%)\n", i*USB_SOF_HIST_STEP_US, (i+1)*USB_SOF_HIST_STEP_US, sof_hist[i], percent);
+      else
+        cliPrintf("  %4d ~      us : %8d (%3d%%)\n", i*USB_SOF_HIST_STEP_US, sof_hist[i], percent);
+    }
+    ret = true;
+  }
+
+  if (args->argc == 2 && args->isStr(0, "sof") && args->isStr(1, "clear"))
+  {
+    memset(sof_hist, 0, sizeof(sof_hist));
+    sof_report_count = 0;
+    cliPrintf("SOF histogram cleared\n");
+    ret = true;
+  }
+
   if (args->argc == 1 && args->isStr(0, "test"))
   {
     uint8_t keycode[6] = {0};
@@ -225,6 +351,8 @@ void cliCmd(cli_args_t *args)
   if (ret == false)
   {
     cliPrintf("usb info\n");
+    cliPrintf("usb sof\n");
+    cliPrintf("usb sof clear\n");
   }
 }
 #endif
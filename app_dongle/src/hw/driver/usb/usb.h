@@ -22,6 +22,11 @@ bool usbInit(void);
 bool usbIsOpen(void);
 bool usbIsConnect(void);
 bool usbIsSuspended(void);
+bool usbWakeup(void);
+uint32_t usbGetPollInterval(void);
+bool usbWaitSof(uint32_t timeout_ms);
+bool usbSetSofCallBack(void (*p_func)(void));
+void usbSofLogReport(void);
 
 #endif
 
@@ -1,4 +1,5 @@
 #include "usbd_hid.h"
+#include "evtlog.h"
 
 #ifdef _USE_HW_USB
 
@@ -143,7 +144,26 @@ static void (*via_hid_receive_func)(uint8_t *data, uint8_t length) = NULL;
 
 static uint8_t via_hid_usb_report[HID_VIA_EP_SIZE];
 
-static qbuffer_t report_q;
+// 키보드/마우스는 같은 IN 엔드포인트를 쓰므로 호스트가 가져가기 전에 다음 리포트를 쓰면 busy(-EAGAIN)
+// 리포트를 버리면 키 release 를 잃어버리므로 큐에 넣고 IN 완료 콜백에서 순서대로 보낸다
+#define HID_REPORT_Q_MAX    16
+#define HID_REPORT_LEN_MAX  9
+#define HID_IN_TIMEOUT_MS   20    // IN 완료가 이보다 늦으면 (suspend/reset 으로 잃어버림) 다시 보냄
+
+typedef struct
+{
+  uint8_t len;
+  uint8_t buf[HID_REPORT_LEN_MAX];
+} report_info_t;
+
+static qbuffer_t      report_q;
+static report_info_t  report_q_buf[HID_REPORT_Q_MAX + 1];
+static struct k_mutex report_mutex;
+static bool           is_in_busy    = false;   // 보낸 리포트를 호스트가 아직 가져가지 않음
+static uint32_t       in_busy_time  = 0;
+static uint32_t       report_q_cnt  = 0;   // 큐에 넣었던 리포트 수
+static uint32_t       report_q_max  = 0;   // 가장 많이 쌓였던 수
+static uint32_t       report_q_drop = 0;   // 큐가 가득 차서 버린 수
 
 
 #ifdef _USE_HW_CLI
@@ -185,10 +205,14 @@ static void hid_out_ready_cb(const struct device *dev)
   if (ret < 0)
   {
     LOG_ERR("Failed to send mouse report: %d", ret);
+    evtlogWrite(EVT_HID_FAIL, 0, ret);    // VIA 는 report id 가 없으므로 0
   }
 }
 
+static void hid_in_ready_cb(const struct device *dev);
+
 static const struct hid_ops hid_ops = {
+    .int_in_ready = hid_in_ready_cb,
     .set_report = hid_set_report_cb, // set_report 콜백 추가
     .get_report = hid_get_report_cb, // get_report 콜백 추가
 };
@@ -199,6 +223,88 @@ static const struct hid_ops via_ops = {
     .get_report = hid_get_report_cb, // get_report 콜백 추가
 };
 
+// report_mutex 를 잡고 호출. 큐의 맨 앞 리포트를 보내고, busy 면 IN 완료 때 다시 시도
+static void hidSendNextReport(void)
+{
+  report_info_t *p_info;
+  int ret;
+
+  if (is_in_busy == true && millis() - in_busy_time < HID_IN_TIMEOUT_MS)
+  {
+    return;
+  }
+  is_in_busy = false;
+
+  while (qbufferAvailable(&report_q) > 0)
+  {
+    p_info = (report_info_t *)qbufferPeekRead(&report_q);
+    ret = hid_int_ep_write(hid_dev, p_info->buf, p_info->len, NULL);
+    if (ret == -EAGAIN)
+    {
+      break;
+    }
+    qbufferRead(&report_q, NULL, 1);
+    if (ret == 0)
+    {
+      is_in_busy   = true;
+      in_busy_time = millis();
+      usbSofLogReport();
+      break;
+    }
+    LOG_ERR("Failed to send report %d: %d", p_info->buf[0], ret);
+    evtlogWrite(EVT_HID_FAIL, p_info->buf[0], ret);
+  }
+}
+
+static void hid_in_ready_cb(const struct device *dev)
+{
+  ARG_UNUSED(dev);
+
+  k_mutex_lock(&report_mutex, K_FOREVER);
+  is_in_busy = false;
+  hidSendNextReport();
+  k_mutex_unlock(&report_mutex);
+}
+
+// 리포트를 큐에 넣고, 엔드포인트가 비어 있으면 바로 보낸다
+static bool hidWriteReport(const uint8_t *p_data, uint8_t length)
+{
+  report_info_t info;
+  bool ret = true;
+
+  k_mutex_lock(&report_mutex, K_FOREVER);
+
+  // suspend/연결 해제 중에는 IN 완료가 오지 않으므로 쌓아두지 않는다 (resume 후 오래된 상태를 보내지 않게 비움)
+  if (usbIsConnect() == false)
+  {
+    qbufferFlush(&report_q);
+    is_in_busy = false;
+    k_mutex_unlock(&report_mutex);
+    return false;
+  }
+
+  info.len = length;
+  memcpy(info.buf, p_data, length);
+  if (qbufferWrite(&report_q, (uint8_t *)&info, 1) == true)
+  {
+    report_q_cnt++;
+    report_q_max = cmax(report_q_max, qbufferAvailable(&report_q));
+  }
+  else
+  {
+    report_q_drop++;
+    LOG_ERR("HID report queue full");
+    evtlogWrite(EVT_HID_FAIL, p_data[0], -ENOMEM);
+    ret = false;
+  }
+
+  // 큐 맨 앞이 이번 리포트면 바로 보내고, 아니면 앞의 리포트부터 (IN 완료를 놓쳤을 때도 여기서 다시 시작)
+  hidSendNextReport();
+
+  k_mutex_unlock(&report_mutex);
+  return ret;
+}
+
 static void send_keyboard_report(void)
 {
   uint8_t report[] = {
@@ -242,6 +348,9 @@ bool usbHidInit(void)
 {
   bool ret = true;
 
+  k_mutex_init(&report_mutex);
+  qbufferCreateBySize(&report_q, (uint8_t *)report_q_buf, sizeof(report_info_t), HID_REPORT_Q_MAX + 1);
+
   // HID 디바이스 바인딩
   hid_dev = device_get_binding("HID_0");
   if (!hid_dev)
@@ -305,11 +414,8 @@ bool usbHidSendMouseReport(uint8_t buttons, int8_t x, int8_t y, int8_t v, int8_t
       (uint8_t)y,            // Y movement
       (uint8_t)v            // Wheel
   };
-  int ret = hid_int_ep_write(hid_dev, report, sizeof(report), NULL);
-  if (ret < 0)
-  {
-    LOG_ERR("Failed to send mouse report: %d", ret);
-  }
+
+  return hidWriteReport(report, sizeof(report));
 }
 
 bool usbHidSendReport(uint8_t *p_data, uint16_t length)
@@ -331,18 +437,12 @@ bool usbHidSendReport(uint8_t *p_data, uint16_t length)
   if (length > 8)
     return false;
     
-  static uint8_t report[9] = {0};
+  uint8_t report[9] = {0};
   report[0] = REPORT_ID_KEYBOARD;
   memcpy(report + 1, p_data, length);
 
-  int usb_write_ret = hid_int_ep_write(hid_dev, report, sizeof(report), NULL);
-  if (usb_write_ret < 0)
-  {
-    LOG_ERR("Failed to send keyboard report: %d", usb_write_ret);
-    ret = false;
-  }
+  ret = hidWriteReport(report, sizeof(report));
 
-  
   return ret;
 }
 
@@ -394,6 +494,8 @@ void cliCmd(cli_args_t *args)
 
   if (args->argc == 1 && args->isStr(0, "info") == true)
   {
+    cliPrintf("report q   : %d/%d\n", qbufferAvailable(&report_q), HID_REPORT_Q_MAX);
+    cliPrintf("report cnt : %d (max %d, drop %d)\n", report_q_cnt, report_q_max, report_q_drop);
     ret = true;
   }
 
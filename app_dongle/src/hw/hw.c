@@ -1,13 +1,39 @@
 #include "hw.h"
+#include <zephyr/kernel.h>
 
 static void bootMsg(void);
+#ifdef _USE_HW_CLI
+static void cliBoot(cli_args_t *args);
+#endif
 
 
+// 고정 delay 대신 각 초기화 단계의 완료를 이벤트로 알리고, 필요한 쪽에서만 기다린다
+static K_EVENT_DEFINE(hw_ready_event);
+
+static uint32_t hw_ready_time[HW_READY_MAX];
+static uint32_t boot_ready_time = 0;
+static uint32_t first_key_time  = 0;
+
+#ifdef _USE_HW_CLI
+static const char *hw_ready_name[HW_READY_MAX] =
+{
+  "rf",
+  "usb",
+  "eeprom",
+  "keys",
+  "sensor",
+  "lcd",
+  "ap",
+};
+#endif
 
 
 bool hwInit(void)
 {
   bspInit();
+#ifdef _USE_HW_CYCLE
+  cycleInit();
+#endif
 
   
 
@@ -16,6 +42,9 @@ bool hwInit(void)
   gpioInit();
   uartInit();
   uartOpen(_DEF_UART1, 115200);
+#ifdef _USE_HW_EVTLOG
+  evtlogInit();
+#endif
   // cliOpen(_DEF_UART1, 115200);
 
   // logOpen(HW_LOG_CH, 115200);
@@ -35,24 +64,91 @@ bool hwInit(void)
   // i2cInit();
   spiInit();
 
-  pmw3610_init();
+  // 동글에는 트랙볼 센서가 없음 (LCD 와 SPI 버스를 같이 쓰면서 부팅 시간만 차지)
+  // pmw3610_init();
   
-  eepromInit();
-  st7789Init();
-  lv_init();
-  lv_port_disp_init();
-  rfInit();
+  if (eepromInit())
+    hwSetReady(HW_READY_EEPROM);
+  // st7789/LVGL 은 LVGL 스레드에서 hwDisplayInit() 로 초기화 (패널 리셋 대기가 부팅을 막지 않도록)
+  if (rfInit())
+    hwSetReady(HW_READY_RF);
   // keysInit();
-  // delay(100);
+  // HW_READY_USB 는 호스트 enumeration 완료(USB_DC_CONFIGURED) 시 설정됨
   usbInit();
   
-  // delay(100);
   // bleInit();
 
+#ifdef _USE_HW_CLI
+  cliAdd("boot", cliBoot);
+#endif
 
   return true;
 }
 
+bool hwDisplayInit(void)
+{
+  bool ret;
+
+  ret = st7789Init();
+  lv_init();
+  lv_port_disp_init();
+  hwSetReady(HW_READY_LCD);
+
+  return ret;
+}
+
+void hwSetReady(uint32_t ready_bits)
+{
+  uint32_t cur_time = millis();
+  uint32_t pre_bits;
+  uint32_t new_bits;
+
+  pre_bits = k_event_post(&hw_ready_event, ready_bits);
+  new_bits = ready_bits & ~pre_bits;
+
+  for (int i=0; i<HW_READY_MAX; i++)
+  {
+    if (new_bits & (1U << i))
+    {
+      hw_ready_time[i] = cur_time;
+    }
+  }
+
+  if ((pre_bits & HW_BOOT_READY_MASK) != HW_BOOT_READY_MASK &&
+      ((pre_bits | ready_bits) & HW_BOOT_READY_MASK) == HW_BOOT_READY_MASK)
+  {
+    boot_ready_time = cur_time;
+    logPrintf("[%s] Boot Ready : %d ms\n", boot_ready_time <= HW_BOOT_TARGET_MS ? "OK":"E_", boot_ready_time);
+    evtlogWrite(EVT_BOOT, 0, boot_ready_time);
+  }
+}
+
+bool hwWaitReady(uint32_t ready_bits, uint32_t timeout_ms)
+{
+  uint32_t ret;
+
+  ret = k_event_wait_all(&hw_ready_event, ready_bits, false,
+                         timeout_ms == HW_WAIT_FOREVER ? K_FOREVER : K_MSEC(timeout_ms));
+
+  return (ret & ready_bits) == ready_bits;
+}
+
+uint32_t hwGetReady(void)
+{
+  return k_event_test(&hw_ready_event, 0xFFFFFFFF);
+}
+
+void hwSetFirstKey(void)
+{
+  if (first_key_time != 0)
+  {
+    return;
+  }
+  first_key_time = millis();
+  logPrintf("[  ] First Key  : %d ms\n", first_key_time);
+  evtlogWrite(EVT_FIRST_KEY, 0, first_key_time);
+}
+
 void bootMsg(void)
 {
   // logPrintf("\r\n[ ESP32-S3 Info ]\r\n");
@@ -81,3 +177,32 @@ void bootMsg(void)
   // logPrintf("Free Heapi: %d KB\n", esp_get_free_internal_heap_size()/1024);
   // logPrintf("CPU Freq  : %lu Mhz\n", bspGetCpuFreqMhz());
 }
+
+#ifdef _USE_HW_CLI
+void cliBoot(cli_args_t *args)
+{
+  bool ret = false;
+
+
+  if (args->argc == 1 && args->isStr(0, "info"))
+  {
+    uint32_t ready_bits = hwGetReady();
+
+    for (int i=0; i<HW_READY_MAX; i++)
+    {
+      if (ready_bits & (1U << i))
+        cliPrintf("%-8s : %d ms\n", hw_ready_name[i], hw_ready_time[i]);
+      else
+        cliPrintf("%-8s : -\n", hw_ready_name[i]);
+    }
+    cliPrintf("boot     : %d ms (target %d ms)\n", boot_ready_time, HW_BOOT_TARGET_MS);
+    cliPrintf("1st key  : %d ms\n", first_key_time);
+    ret = true;
+  }
+
+  if (ret == false)
+  {
+    cliPrintf("boot info\n");
+  }
+}
+#endif
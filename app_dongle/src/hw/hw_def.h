@@ -56,19 +56,26 @@
 #define      HW_LOG_BOOT_BUF_MAX    1024
 #define      HW_LOG_LIST_BUF_MAX    1024
 
+#define _USE_HW_EVTLOG                // 바이너리 이벤트 로그 (tool/evtlog.py 로 확인)
+#define      HW_EVTLOG_CH           _DEF_UART1
+#define      HW_EVTLOG_RECORD_MAX   256   // 2의 거듭제곱 (16 byte * 256 = 4KB)
+#define      HW_EVTLOG_THREAD_PRI   8     // qmk_idle(7) 보다 낮게
+
 
 #define _USE_HW_ST7789
 #define      HW_LCD_WIDTH           240
 #define      HW_LCD_HEIGHT          240
 #define      HW_ST7789_CLI_ON
 #define      HW_ST7789_SPI_CH        _DEF_SPI1
+#define      HW_ST7789_TE_PIN        HW_GPIO_PIN_LCD_TE   // TE 가 들어오지 않으면 동기 없이 바로 전송
 
 
 #define _USE_HW_GPIO
 #define      HW_GPIO_PIN_LCD_DC            0
 #define      HW_GPIO_PIN_LCD_RST           1
 #define      HW_GPIO_PIN_LCD_BLK           2
-#define      HW_GPIO_MAX_CH                3
+#define      HW_GPIO_PIN_LCD_TE            3
+#define      HW_GPIO_MAX_CH                4
 
 
 // #define _USE_HW_I2C
@@ -85,11 +92,23 @@
 
 #define _USE_HW_RF
 #define    HW_RF_MODE   _DEF_RF_MODE_RX
+// USB suspend 중 수신 듀티 사이클 (전류 ↔ wakeup 지연)
+//  - off 동안 들어온 키는 모듈의 ESB 재전송으로 받으므로 wakeup 키 지연이 최대 off 시간만큼 늘어남
+//  - 모듈은 호스트 suspend 중 ESB 재전송 구간(약 9ms)을 off 시간보다 길게 둔다 (app_keyboard ap_power.c)
+//  - OFF_MS 를 0 으로 하면 suspend 중에도 연속 수신
+#ifndef HW_RF_SUSPEND_RX_ON_MS
+#define    HW_RF_SUSPEND_RX_ON_MS     5     // USB suspend 중 수신 on 시간
+#endif
+#ifndef HW_RF_SUSPEND_RX_OFF_MS
+#define    HW_RF_SUSPEND_RX_OFF_MS    5     // USB suspend 중 수신 off 시간
+#endif
 
 
 #define _USE_HW_SPI
 #define     HW_SPI_MAX_CH          1
 
+#define _USE_HW_CYCLE                 // DWT 사이클 카운터 (qmk bench)
+
 //-- CLI
 //
 // #define _USE_CLI_HW_EEPROM          1
@@ -103,6 +122,11 @@
 #define _USE_HW_PMW3610
 #define     HW_PMW3610_SPI_CH        _DEF_SPI1
 
+// 부팅 시간 (전원 인가 -> RF 수신 + QMK 준비)
+#define HW_BOOT_READY_MASK          (HW_READY_RF | HW_READY_EEPROM | HW_READY_AP)
+#define HW_BOOT_TARGET_MS           200
+
+
 #define __WEAK                      __attribute__((weak))
 
 
@@ -2,9 +2,12 @@
 // main.c
 #include <zephyr/kernel.h>
 #include "ap/my_key_protocol.h"
+#include "ap_power.h"
+#include "ap_trackball.h"
 #define CLI_THREAD_STACK_SIZE 4096
 #define CLI_THREAD_PRIORITY 5
 
+#ifdef _USE_HW_CLI
 static K_THREAD_STACK_DEFINE(cli_thread_stack, CLI_THREAD_STACK_SIZE);
 // 스레드 데이터 구조체
 static struct k_thread cli_thread_data;
@@ -13,54 +16,86 @@ static k_tid_t cli_thread_id = NULL;
 // 스레드 함수 프로토타입
 
 static void cli_thread_func(void *arg1, void *arg2, void *arg3);
+#endif
 
 void apInit(void)
 {
+#ifdef _USE_HW_CLI
   // 스레드 생성
   cli_thread_id = k_thread_create(&cli_thread_data, cli_thread_stack,
                                   K_THREAD_STACK_SIZEOF(cli_thread_stack),
                                   cli_thread_func, NULL, NULL, NULL,
                                   CLI_THREAD_PRIORITY, 0, K_NO_WAIT);
+#endif
 }
 
 static uint8_t keybuffer[MATRIX_COLS] = {0};
 static uint8_t new_keybuffer[MATRIX_COLS] = {0};
+static uint32_t key_scan_time = 0;
 
 void apMain(void)
 {
-  delay(10);
+  uint32_t tx_fail_count;
+  uint32_t loop_delay;
+
+  apPowerInit();
+  apTrackballInit();
+  tx_fail_count = rfGetTxFailCount();
+  hwSetReady(HW_READY_AP);
 
   while (1)
   {
+    // 동글에서 ACK 페이로드로 전달된 데이터 처리
+    key_protocol_update();
+
+    // 호스트/배터리 상태와 무입력 시간으로 전원 상태 갱신 (스캔/센서/TX power 조정)
+    apPowerUpdate(false);
+    loop_delay = apPowerGetLoopDelay();
+
+    // 동글이 수신을 쉬고 있는 동안 전송이 실패하면 키 상태를 다시 보낸다
+    bool is_resend = false;
+    if (rfGetTxFailCount() != tx_fail_count)
+    {
+      tx_fail_count = rfGetTxFailCount();
+      is_resend = true;
+    }
+
     // key scan
+    uint32_t scan_time = micros();
     keysReadBuf(new_keybuffer, MATRIX_COLS);
     bool is_changed = (memcmp(keybuffer, new_keybuffer, MATRIX_COLS) != 0);
     if (is_changed)
     {
-      memcpy(keybuffer, new_keybuffer, MATRIX_COLS);
-      key_protocol_send_key_data(KEY_BOARD_ID, keybuffer, MATRIX_COLS);
-    }
-    delay(5);
+      // 동글은 이 시간으로 키 간격(combo 등)을 계산하므로 재전송 시에도 처음 스캔 시간을 보낸다
+      key_scan_time = scan_time;
 
-    // trackball read
-    int32_t x = 0, y = 0;
-    if (pmw3610_motion_read(&x, &y))
+      // 전송 전에 active 상태(TX power 복귀)로 전환
+      apPowerUpdate(true);
+      hwSetFirstKey();
+    }
+    if (is_changed || is_resend)
     {
-      key_protocol_send_trackball_data(KEY_BOARD_ID, (int16_t)x, (int16_t)y);
+      memcpy(keybuffer, new_keybuffer, MATRIX_COLS);
+      key_protocol_send_key_data(KEY_BOARD_ID, keybuffer, MATRIX_COLS, key_scan_time);
     }
-    delay(5);
+    delay(loop_delay);
+
+    // trackball read (동글에서 받은 센서 설정 적용 포함)
+    apTrackballUpdate();
+    delay(loop_delay);
 
     // heartbeat send
     static uint32_t last_heartbeat_time = 0;
-    if (millis() - last_heartbeat_time >= 500)
+    if (millis() - last_heartbeat_time >= apPowerGetHeartbeatPeriod())
     {
       last_heartbeat_time = millis();
-      key_protocol_send_heartbeat(KEY_BOARD_ID, 0x01, 100);
+      key_protocol_send_heartbeat(KEY_BOARD_ID, 0x01, apPowerGetBatteryLevel());
       delay(5);
     }
   }
 }
 
+#ifdef _USE_HW_CLI
 // 스레드 함수
 static void cli_thread_func(void *arg1, void *arg2, void *arg3)
 {
@@ -68,8 +103,15 @@ static void cli_thread_func(void *arg1, void *arg2, void *arg3)
   ARG_UNUSED(arg3);
   while (1)
   {
+    // USB(VBUS) 가 연결되지 않은 동안에는 CLI 를 처리할 필요가 없으므로 길게 쉰다
+    if (usbIsConnect() != true)
+    {
+      delay(100);
+      continue;
+    }
     cliOpen(HW_UART_CH_CLI, 115200);
     cliMain();
     delay(2);
   }
-}
\ No newline at end of file
+}
+#endif
\ No newline at end of file
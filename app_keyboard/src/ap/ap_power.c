@@ -0,0 +1,212 @@
+#include "ap_power.h"
+#include "ap/my_key_protocol.h"
+#include <zephyr/kernel.h>
+#include <zephyr/sys/poweroff.h>
+
+
+#define POWER_IDLE_TIMEOUT_MS         (5*1000)
+#define POWER_SLEEP_TIMEOUT_MS        (60*1000)
+#define POWER_DEEP_SLEEP_TIMEOUT_MS   (15*60*1000)
+#define POWER_HOST_SUSPEND_SLEEP_MS   (1*1000)    // 호스트 suspend 중 입력이 없으면 sleep 으로
+#define POWER_BATTERY_CRITICAL        3           // 이 잔량 이하면 바로 deep sleep
+
+// 호스트 suspend 중 wakeup 키 지연 : 디바운스(5ms) + 루프 + 동글 수신 off(HW_RF_SUSPEND_RX_OFF_MS)
+#define POWER_HOST_SUSPEND_SCAN_MS    1
+#define POWER_HOST_SUSPEND_LOOP_MS    2
+#define POWER_HOST_SUSPEND_RETRANSMIT 15          // 600us x 15 = 9ms, 동글 수신 off(5ms) 를 넘기도록 ESB 재전송
+#define POWER_RETRANSMIT              3           // ESB 기본값
+
+
+typedef struct
+{
+  const char *name;
+  uint32_t    scan_ms;        // 키 스캔 주기
+  uint32_t    loop_ms;        // apMain 루프 지연
+  uint32_t    heartbeat_ms;   // 동글 HEARTBEAT_TIMEOUT_MS(1500) 보다 짧게
+  bool        sensor_awake;   // PMW3610 force awake (false 면 센서 자체 downshift)
+  int8_t      tx_power;       // dBm
+} power_cfg_t;
+
+static const power_cfg_t power_cfg[AP_POWER_MAX] =
+{
+  [AP_POWER_ACTIVE]     = {"active", 1,  5,  500, true,   0},
+  [AP_POWER_IDLE]       = {"idle",   2,  5,  500, false, -4},
+  [AP_POWER_SLEEP]      = {"sleep",  10, 20, 1000, false, -8},
+  [AP_POWER_DEEP_SLEEP] = {"deep",   10, 20, 1000, false, -8},
+};
+
+
+#ifdef _USE_HW_CLI
+static void cliCmd(cli_args_t *args);
+#endif
+static void powerApplyState(ap_power_state_t state);
+static void powerEnterDeepSleep(void);
+
+static ap_power_state_t power_state = AP_POWER_ACTIVE;
+static uint32_t last_activity_time = 0;
+static bool     is_deep_sleep_enable = true;
+static bool     is_tx_power_pending = false;
+static bool     is_retransmit_pending = false;
+static bool     is_host_suspend = false;
+
+
+
+
+bool apPowerInit(void)
+{
+  last_activity_time = millis();
+  powerApplyState(AP_POWER_ACTIVE);
+
+#ifdef _USE_HW_CLI
+  cliAdd("power", cliCmd);
+#endif
+  return true;
+}
+
+void apPowerUpdate(bool is_activity)
+{
+  ap_power_state_t next_state;
+  uint32_t idle_time;
+  bool is_host_suspend_cur;
+
+  if (is_activity)
+  {
+    last_activity_time = millis();
+  }
+  idle_time = millis() - last_activity_time;
+
+  next_state = AP_POWER_ACTIVE;
+  if (idle_time >= POWER_IDLE_TIMEOUT_MS)
+    next_state = AP_POWER_IDLE;
+  if (idle_time >= POWER_SLEEP_TIMEOUT_MS)
+    next_state = AP_POWER_SLEEP;
+  if (idle_time >= POWER_DEEP_SLEEP_TIMEOUT_MS)
+    next_state = AP_POWER_DEEP_SLEEP;
+
+  is_host_suspend_cur = (key_protocol_get_power_state() == KEY_PROTOCOL_POWER_SUSPEND);
+  if (is_host_suspend_cur &&
+      idle_time >= POWER_HOST_SUSPEND_SLEEP_MS &&
+      next_state < AP_POWER_SLEEP)
+  {
+    next_state = AP_POWER_SLEEP;
+  }
+
+  if (batteryIsInit() && batteryGetPercent() <= POWER_BATTERY_CRITICAL)
+  {
+    next_state = AP_POWER_DEEP_SLEEP;
+  }
+
+  if (next_state != power_state || is_host_suspend_cur != is_host_suspend)
+  {
+    is_host_suspend = is_host_suspend_cur;
+    powerApplyState(next_state);
+  }
+  else
+  {
+    // 전송 중이라 TX power/재전송 횟수 변경이 실패한 경우 다시 시도
+    if (is_tx_power_pending)
+      is_tx_power_pending = !rfSetTxPower(power_cfg[power_state].tx_power);
+    if (is_retransmit_pending)
+      is_retransmit_pending = !rfSetRetransmitCount(is_host_suspend ? POWER_HOST_SUSPEND_RETRANSMIT : POWER_RETRANSMIT);
+  }
+
+  if (power_state == AP_POWER_DEEP_SLEEP && is_deep_sleep_enable)
+  {
+#ifdef _USE_HW_USB
+    // USB 전원으로 동작 중(CLI 사용 등)에는 System OFF 로 진입하지 않음
+    if (usbIsConnect())
+      return;
+#endif
+    powerEnterDeepSleep();
+  }
+}
+
+ap_power_state_t apPowerGetState(void)
+{
+  return power_state;
+}
+
+uint32_t apPowerGetLoopDelay(void)
+{
+  if (is_host_suspend)
+  {
+    return cmin(power_cfg[power_state].loop_ms, POWER_HOST_SUSPEND_LOOP_MS);
+  }
+  return power_cfg[power_state].loop_ms;
+}
+
+uint32_t apPowerGetHeartbeatPeriod(void)
+{
+  return power_cfg[power_state].heartbeat_ms;
+}
+
+uint8_t apPowerGetBatteryLevel(void)
+{
+  return (uint8_t)constrain(batteryGetPercent(), 0, 100);
+}
+
+void powerApplyState(ap_power_state_t state)
+{
+  const power_cfg_t *p_cfg = &power_cfg[state];
+
+  // 호스트 suspend 중에는 sleep 상태라도 wakeup 키를 바로 보낼 수 있게 스캔/재전송을 유지
+  keysSetScanPeriod(is_host_suspend ? POWER_HOST_SUSPEND_SCAN_MS : p_cfg->scan_ms);
+  is_retransmit_pending = !rfSetRetransmitCount(is_host_suspend ? POWER_HOST_SUSPEND_RETRANSMIT : POWER_RETRANSMIT);
+  if (pmw3610_get_force_awake() != p_cfg->sensor_awake)
+  {
+    pmw3610_set_force_awake(p_cfg->sensor_awake);
+  }
+  is_tx_power_pending = !rfSetTxPower(p_cfg->tx_power);
+
+  power_state = state;
+}
+
+void powerEnterDeepSleep(void)
+{
+  logPrintf("[  ] Enter deep sleep (System OFF)\n");
+  delay(10);
+
+  // 키 입력(row sense)으로만 깨어나며, 깨어나면 리셋부터 다시 시작
+  pmw3610_shutdown();
+  keysEnterSleep();
+  gpioPinWrite(HW_GPIO_VCC_ON, _DEF_LOW);
+
+  sys_poweroff();
+}
+
+#ifdef _USE_HW_CLI
+void cliCmd(cli_args_t *args)
+{
+  bool ret = false;
+
+
+  if (args->argc == 1 && args->isStr(0, "info"))
+  {
+    cliPrintf("power state   : %s\n", power_cfg[power_state].name);
+    cliPrintf("idle time     : %d ms\n", millis() - last_activity_time);
+    cliPrintf("scan period   : %d ms\n", is_host_suspend ? POWER_HOST_SUSPEND_SCAN_MS : power_cfg[power_state].scan_ms);
+    cliPrintf("loop delay    : %d ms\n", apPowerGetLoopDelay());
+    cliPrintf("heartbeat     : %d ms\n", power_cfg[power_state].heartbeat_ms);
+    cliPrintf("sensor awake  : %s\n", pmw3610_get_force_awake() ? "on":"off");
+    cliPrintf("tx power      : %d dBm\n", rfGetTxPower());
+    cliPrintf("retransmit    : %d\n", rfGetRetransmitCount());
+    cliPrintf("battery       : %d%% %d mV\n", batteryGetPercent(), batteryGetVoltageMv());
+    cliPrintf("host          : %s\n", key_protocol_get_power_state() == KEY_PROTOCOL_POWER_SUSPEND ? "suspend":"active");
+    cliPrintf("deep sleep    : %s\n", is_deep_sleep_enable ? "enable":"disable");
+    ret = true;
+  }
+
+  if (args->argc == 2 && args->isStr(0, "deep"))
+  {
+    is_deep_sleep_enable = args->isStr(1, "on");
+    cliPrintf("deep sleep %s\n", is_deep_sleep_enable ? "enable":"disable");
+    ret = true;
+  }
+
+  if (ret == false)
+  {
+    cliPrintf("power info\n");
+    cliPrintf("power deep on:off\n");
+  }
+}
+#endif
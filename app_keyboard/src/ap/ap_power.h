@@ -0,0 +1,42 @@
+#ifndef AP_POWER_H_
+#define AP_POWER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "ap_def.h"
+
+
+typedef enum
+{
+  AP_POWER_ACTIVE = 0,
+  AP_POWER_IDLE,
+  AP_POWER_SLEEP,
+  AP_POWER_DEEP_SLEEP,
+  AP_POWER_MAX,
+} ap_power_state_t;
+
+
+/**
+ * @brief 전원 상태 관리 초기화
+ */
+bool apPowerInit(void);
+
+/**
+ * @brief 전원 상태 갱신 (apMain 루프에서 호출)
+ * @param is_activity 키 입력/트랙볼 움직임이 있었는지 여부
+ * @note  Deep sleep 조건이 되면 System OFF 로 진입하며 리턴하지 않음
+ */
+void apPowerUpdate(bool is_activity);
+
+ap_power_state_t apPowerGetState(void);
+uint32_t apPowerGetLoopDelay(void);
+uint32_t apPowerGetHeartbeatPeriod(void);
+uint8_t  apPowerGetBatteryLevel(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AP_POWER_H_ */
@@ -0,0 +1,403 @@
+#include "ap_trackball.h"
+#include "ap_power.h"
+#include "ap/my_key_protocol.h"
+
+
+#define TRACKBALL_EEPROM_ADDR     0
+#define TRACKBALL_EEPROM_MAGIC    0x3B
+#define TRACKBALL_SNAP_ANGLE_MAX  45
+
+// smart mode auto : threshold 를 높은 것(smart mode 가 오래 켜짐, 전류 작음)부터 바꿔가며
+// 움직이는 동안의 SQUAL 이 안정적인 첫 단계를 고른다
+#define TUNE_MOTION_FRAMES        400     // 단계마다 모으는 움직임 burst 수
+#define TUNE_SQUAL_MIN            20      // 이보다 낮은 SQUAL 이 한 번이라도 나오면 불안정
+#define TUNE_SQUAL_AVG_MIN        40
+#define TUNE_TOGGLE_PER_1000_MAX  20      // smart mode 가 자주 바뀌면 LED 밝기가 흔들리므로 불안정
+#define TUNE_RUN_CURRENT_UA       1600    // run 모드 평균 전류 추정값 (smart mode off, 실측으로 조정)
+#define TUNE_SMART_CURRENT_UA     1000    // smart mode on 일 때
+
+
+typedef struct
+{
+  uint8_t  magic;
+  uint8_t  gen;               // 동글에서 받은 설정의 gen (0 : 기본값)
+  uint16_t cpi;
+  uint8_t  snap_angle;        // 0 : off
+  uint8_t  smart_mode;        // KEY_PROTOCOL_SMART_*
+  uint16_t smart_threshold;   // auto 이면 찾은 값 (0 : smart mode 를 쓰지 않음)
+} trackball_cfg_t;
+
+typedef struct
+{
+  bool     is_done;
+  bool     is_stable;
+  uint8_t  squal_min;
+  uint8_t  squal_avg;
+  uint16_t smart_permil;      // smart mode 가 켜져 있던 비율 (0.1%)
+  uint16_t toggle_permil;
+  uint16_t current_ua;        // 추정 전류
+} tune_result_t;
+
+
+#ifdef _USE_HW_CLI
+static void cliCmd(cli_args_t *args);
+#endif
+static void trackballApplyConfig(void);
+static void trackballApplySmart(void);
+static void trackballSnap(int16_t *p_x, int16_t *p_y);
+static void tuneStart(void);
+static void tuneUpdate(void);
+
+// tan(0~45도) * 1024
+static const uint16_t snap_tan_q10[TRACKBALL_SNAP_ANGLE_MAX + 1] =
+{
+     0,   18,   36,   54,   72,   90,  108,  126,  144,  162,
+   181,  199,  218,  236,  255,  274,  294,  313,  333,  353,
+   373,  393,  414,  435,  456,  477,  499,  522,  544,  568,
+   591,  615,  640,  665,  691,  717,  744,  772,  800,  829,
+   859,  890,  922,  955,  989, 1024,
+};
+
+// 전류가 작은 순, 마지막(0)은 smart mode off 로 항상 안정으로 본다
+static const uint16_t tune_threshold_tbl[] = {160, 100, 45, 0};
+
+#define TUNE_LEVEL_MAX  (int)(sizeof(tune_threshold_tbl) / sizeof(tune_threshold_tbl[0]))
+
+static trackball_cfg_t tb_cfg;
+static bool is_gen_reported = false;
+
+static bool          is_tuning = false;
+static bool          is_stats_on = false;
+static uint8_t       tune_level = 0;
+static tune_result_t tune_result[TUNE_LEVEL_MAX];
+
+
+
+
+bool apTrackballInit(void)
+{
+  uint16_t threshold;
+  bool     smart_mode;
+
+  smart_mode = pmw3610_get_smart_mode(&threshold);
+
+  if (!eepromRead(TRACKBALL_EEPROM_ADDR, (uint8_t *)&tb_cfg, sizeof(tb_cfg)) ||
+      tb_cfg.magic != TRACKBALL_EEPROM_MAGIC)
+  {
+    tb_cfg.magic           = TRACKBALL_EEPROM_MAGIC;
+    tb_cfg.gen             = 0;
+    tb_cfg.cpi             = pmw3610_get_cpi();
+    tb_cfg.snap_angle      = 0;
+    tb_cfg.smart_mode      = smart_mode ? KEY_PROTOCOL_SMART_ON : KEY_PROTOCOL_SMART_OFF;
+    tb_cfg.smart_threshold = threshold;
+  }
+  tb_cfg.snap_angle = constrain(tb_cfg.snap_angle, 0, TRACKBALL_SNAP_ANGLE_MAX);
+
+  // 센서 초기화 중이면 설정만 저장되고 초기화 마지막 단계에서 적용됨
+  // auto 는 저장해 둔 결과로 시작하고, 동글에서 다시 auto 를 받거나 CLI 로 요청할 때 다시 찾는다
+  pmw3610_set_cpi(tb_cfg.cpi);
+  trackballApplySmart();
+
+#ifdef _USE_HW_CLI
+  cliAdd("trackball", cliCmd);
+#endif
+  return true;
+}
+
+bool apTrackballUpdate(void)
+{
+  pmw3610_motion_t motion;
+
+  trackballApplyConfig();
+  tuneUpdate();
+
+  if (!pmw3610_motion_burst(&motion))
+  {
+    return false;
+  }
+
+  // 전송 전에 active 상태(TX power 복귀)로 전환
+  apPowerUpdate(true);
+
+  trackballSnap(&motion.x, &motion.y);
+  if (motion.x != 0 || motion.y != 0)
+  {
+    key_protocol_send_trackball_data(KEY_BOARD_ID, motion.x, motion.y);
+  }
+  return true;
+}
+
+void trackballApplySmart(void)
+{
+  bool is_smart = tb_cfg.smart_mode != KEY_PROTOCOL_SMART_OFF && tb_cfg.smart_threshold > 0;
+
+  pmw3610_set_smart_mode(is_smart, tb_cfg.smart_threshold);
+}
+
+void trackballApplyConfig(void)
+{
+  key_protocol_sensor_config_t rf_cfg;
+
+  // 센서가 없는 하프는 gen 을 보내지 않으므로 동글도 설정을 기다리지 않는다
+  if (!pmw3610_is_ready())
+  {
+    return;
+  }
+  if (!is_gen_reported)
+  {
+    key_protocol_set_sensor_config_gen(tb_cfg.gen);
+    is_gen_reported = true;
+  }
+
+  if (!key_protocol_get_sensor_config(&rf_cfg))
+  {
+    return;
+  }
+
+  // 적용에 실패하면 gen 을 올리지 않으므로 동글이 다음 heartbeat 후에 다시 보낸다
+  if (!pmw3610_set_cpi(rf_cfg.cpi))
+  {
+    return;
+  }
+
+  tb_cfg.gen             = rf_cfg.gen;
+  tb_cfg.cpi             = pmw3610_get_cpi();
+  tb_cfg.snap_angle      = constrain(rf_cfg.snap_angle, 0, TRACKBALL_SNAP_ANGLE_MAX);
+  tb_cfg.smart_mode      = constrain(rf_cfg.smart_mode, KEY_PROTOCOL_SMART_OFF, KEY_PROTOCOL_SMART_AUTO);
+  if (tb_cfg.smart_mode != KEY_PROTOCOL_SMART_AUTO)
+  {
+    tb_cfg.smart_threshold = rf_cfg.smart_threshold;
+  }
+  is_tuning = false;
+  trackballApplySmart();
+  eepromWrite(TRACKBALL_EEPROM_ADDR, (uint8_t *)&tb_cfg, sizeof(tb_cfg));
+
+  key_protocol_set_sensor_config_gen(tb_cfg.gen);
+  logPrintf("[  ] trackball cfg gen %d, cpi %d, snap %d, smart %d\n",
+            tb_cfg.gen, tb_cfg.cpi, tb_cfg.snap_angle, tb_cfg.smart_mode);
+
+  if (tb_cfg.smart_mode == KEY_PROTOCOL_SMART_AUTO)
+  {
+    tuneStart();
+  }
+}
+
+// 축과 이루는 각도가 snap_angle 이하이면 그 축으로 붙인다
+void trackballSnap(int16_t *p_x, int16_t *p_y)
+{
+  int32_t ax = abs(*p_x);
+  int32_t ay = abs(*p_y);
+  int32_t tan_q10;
+
+  if (tb_cfg.snap_angle == 0)
+  {
+    return;
+  }
+  tan_q10 = snap_tan_q10[tb_cfg.snap_angle];
+
+  if (ay * 1024 <= ax * tan_q10)
+  {
+    *p_y = 0;
+  }
+  else if (ax * 1024 <= ay * tan_q10)
+  {
+    *p_x = 0;
+  }
+}
+
+static void tuneStartLevel(uint8_t level)
+{
+  uint16_t threshold = tune_threshold_tbl[level];
+
+  tune_level = level;
+  pmw3610_set_smart_mode(threshold > 0, threshold);
+  pmw3610_clear_stats();
+}
+
+void tuneStart(void)
+{
+  memset(tune_result, 0, sizeof(tune_result));
+  pmw3610_set_telemetry(true);
+  is_tuning = true;
+  tuneStartLevel(0);
+}
+
+static uint16_t tuneGetCurrent(const pmw3610_stats_t *p_stats)
+{
+  uint32_t smart_ua;
+
+  if (p_stats->frames == 0)
+  {
+    return TUNE_RUN_CURRENT_UA;
+  }
+  smart_ua = (uint32_t)(TUNE_RUN_CURRENT_UA - TUNE_SMART_CURRENT_UA) * p_stats->smart_frames / p_stats->frames;
+  return TUNE_RUN_CURRENT_UA - smart_ua;
+}
+
+// 움직이는 동안의 통계로 단계를 평가하므로 트랙볼을 굴려야 진행된다
+void tuneUpdate(void)
+{
+  pmw3610_stats_t stats;
+  tune_result_t  *p_result;
+
+  if (!is_tuning)
+  {
+    return;
+  }
+
+  pmw3610_get_stats(&stats);
+  if (stats.motion_frames < TUNE_MOTION_FRAMES)
+  {
+    return;
+  }
+
+  p_result = &tune_result[tune_level];
+  p_result->is_done       = true;
+  p_result->squal_min     = stats.squal_min;
+  p_result->squal_avg     = stats.squal_sum / stats.motion_frames;
+  p_result->smart_permil  = stats.smart_frames * 1000 / stats.frames;
+  p_result->toggle_permil = stats.smart_toggles * 1000 / stats.frames;
+  p_result->current_ua    = tuneGetCurrent(&stats);
+  p_result->is_stable     = p_result->squal_min >= TUNE_SQUAL_MIN &&
+                            p_result->squal_avg >= TUNE_SQUAL_AVG_MIN &&
+                            p_result->toggle_permil <= TUNE_TOGGLE_PER_1000_MAX;
+
+  if (!p_result->is_stable && tune_level + 1 < TUNE_LEVEL_MAX)
+  {
+    tuneStartLevel(tune_level + 1);
+    return;
+  }
+
+  is_tuning = false;
+  pmw3610_set_telemetry(is_stats_on);
+
+  tb_cfg.smart_threshold = tune_threshold_tbl[tune_level];
+  trackballApplySmart();
+  eepromWrite(TRACKBALL_EEPROM_ADDR, (uint8_t *)&tb_cfg, sizeof(tb_cfg));
+
+  logPrintf("[  ] trackball smart auto : threshold %d, squal %d/%d, %d uA (-%d uA)\n",
+            tb_cfg.smart_threshold,
+            p_result->squal_min,
+            p_result->squal_avg,
+            p_result->current_ua,
+            TUNE_RUN_CURRENT_UA - p_result->current_ua);
+}
+
+#ifdef _USE_HW_CLI
+void cliCmd(cli_args_t *args)
+{
+  bool ret = false;
+  const char *smart_mode_name[] = {"off", "on", "auto"};
+
+
+  if (args->argc == 1 && args->isStr(0, "info"))
+  {
+    cliPrintf("sensor        : %s\n", pmw3610_is_ready() ? "ready":"not ready");
+    cliPrintf("config gen    : %d\n", tb_cfg.gen);
+    cliPrintf("cpi           : %d\n", pmw3610_get_cpi());
+    cliPrintf("snap angle    : %d deg\n", tb_cfg.snap_angle);
+    cliPrintf("smart mode    : %s, threshold %d%s\n",
+              smart_mode_name[tb_cfg.smart_mode],
+              tb_cfg.smart_threshold,
+              is_tuning ? " (tuning)" : "");
+    ret = true;
+  }
+
+  // 동작 확인용, 저장하지 않으며 동글 설정이 바뀌면 덮어씀
+  if (args->argc == 2 && args->isStr(0, "cpi"))
+  {
+    uint16_t cpi = (uint16_t)args->getData(1);
+
+    if (pmw3610_set_cpi(cpi))
+      cliPrintf("cpi %d\n", pmw3610_get_cpi());
+    else
+      cliPrintf("cpi %d fail (200~3200)\n", cpi);
+    ret = true;
+  }
+
+  if (args->argc == 2 && args->isStr(0, "snap"))
+  {
+    tb_cfg.snap_angle = constrain(args->getData(1), 0, TRACKBALL_SNAP_ANGLE_MAX);
+    cliPrintf("snap angle %d deg\n", tb_cfg.snap_angle);
+    ret = true;
+  }
+
+  if (args->argc >= 1 && args->isStr(0, "stats"))
+  {
+    pmw3610_stats_t stats;
+
+    if (args->argc == 2 && (args->isStr(1, "on") || args->isStr(1, "off")))
+    {
+      is_stats_on = args->isStr(1, "on");
+      pmw3610_set_telemetry(is_stats_on || is_tuning);
+    }
+    if (args->argc == 2 && args->isStr(1, "clear"))
+    {
+      pmw3610_clear_stats();
+    }
+
+    pmw3610_get_stats(&stats);
+    cliPrintf("telemetry     : %s\n", is_stats_on ? "on":"off");
+    cliPrintf("frames        : %d (motion %d)\n", stats.frames, stats.motion_frames);
+    cliPrintf("squal         : min %d, avg %d, max %d\n",
+              stats.squal_min,
+              stats.motion_frames ? stats.squal_sum / stats.motion_frames : 0,
+              stats.squal_max);
+    cliPrintf("shutter       : min %d, avg %d, max %d\n",
+              stats.shutter_min,
+              stats.frames ? stats.shutter_sum / stats.frames : 0,
+              stats.shutter_max);
+    cliPrintf("smart         : %d frames, %d toggles\n", stats.smart_frames, stats.smart_toggles);
+    cliPrintf("current (est) : %d uA\n", tuneGetCurrent(&stats));
+    ret = true;
+  }
+
+  if (args->argc == 1 && args->isStr(0, "tune"))
+  {
+    cliPrintf("level threshold  squal(min/avg)  smart   toggle  current  result\n");
+    for (int i=0; i<TUNE_LEVEL_MAX; i++)
+    {
+      tune_result_t *p_result = &tune_result[i];
+
+      if (!p_result->is_done)
+      {
+        cliPrintf("%5d %9d  %s\n", i, tune_threshold_tbl[i], is_tuning && i == tune_level ? "measuring" : "-");
+        continue;
+      }
+      cliPrintf("%5d %9d  %7d/%-7d %3d.%d%% %3d.%d%% %5d uA  %s\n",
+                i, tune_threshold_tbl[i],
+                p_result->squal_min, p_result->squal_avg,
+                p_result->smart_permil / 10, p_result->smart_permil % 10,
+                p_result->toggle_permil / 10, p_result->toggle_permil % 10,
+                p_result->current_ua,
+                p_result->is_stable ? "stable" : "unstable");
+    }
+    if (!is_tuning && tune_result[tune_level].is_done)
+    {
+      cliPrintf("selected : threshold %d, saving %d uA (run %d uA)\n",
+                tune_threshold_tbl[tune_level],
+                TUNE_RUN_CURRENT_UA - tune_result[tune_level].current_ua,
+                TUNE_RUN_CURRENT_UA);
+    }
+    ret = true;
+  }
+
+  // 결과는 저장되지만 동글에서 auto 가 아닌 설정이 오면 덮어씀
+  if (args->argc == 2 && args->isStr(0, "tune") && args->isStr(1, "start"))
+  {
+    tb_cfg.smart_mode = KEY_PROTOCOL_SMART_AUTO;
+    tuneStart();
+    cliPrintf("tuning, roll the trackball\n");
+    ret = true;
+  }
+
+  if (ret == false)
+  {
+    cliPrintf("trackball info\n");
+    cliPrintf("trackball cpi 200~3200\n");
+    cliPrintf("trackball snap 0~45\n");
+    cliPrintf("trackball stats [on:off:clear]\n");
+    cliPrintf("trackball tune [start]\n");
+  }
+}
+#endif
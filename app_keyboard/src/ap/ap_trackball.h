@@ -0,0 +1,27 @@
+#ifndef AP_TRACKBALL_H_
+#define AP_TRACKBALL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "ap_def.h"
+
+
+/**
+ * @brief 트랙볼 설정(CPI, 각도 스냅, smart mode) 을 EEPROM 에서 읽어 센서에 적용
+ */
+bool apTrackballInit(void);
+
+/**
+ * @brief 센서 burst 읽기 후 동글로 전송 (apMain 루프에서 호출)
+ * @note  동글에서 새 센서 설정이 오면 적용하고 EEPROM 에 저장한다
+ * @return 움직임이 있었는지 여부
+ */
+bool apTrackballUpdate(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AP_TRACKBALL_H_ */
@@ -11,6 +11,9 @@
 #define PACKET_TYPE_SYSTEM 0x03
 #define PACKET_TYPE_BATTERY 0x04
 #define PACKET_TYPE_HEARTBEAT 0x05
+#define PACKET_TYPE_POWER_STATE 0xF0
+#define PACKET_TYPE_TIME_SYNC 0xF1
+#define PACKET_TYPE_SENSOR_CONFIG 0xF2
 
 #define HEARTBEAT_TIMEOUT_MS     1500
 #define CONNECTION_CHECK_INTERVAL 500
@@ -25,6 +28,17 @@
 #define MAX_PAYLOAD 32
 // Total max packet size
 #define MAX_PACKET_SIZE (HEADER_SIZE + MAX_PAYLOAD + FOOTER_SIZE)
+// ACK 페이로드에 프레임이 여러 개 실려 오고, 읽기 전에 ACK 가 쌓일 수 있으므로 myrf.c 의 RX 버퍼 크기만큼 읽는다
+#define RX_BUFFER_SIZE 256
+
+// 동글 시간 동기
+// heartbeat 를 보낸 시간(t1) 과 ACK 를 받은 시간(t4), ACK 페이로드로 돌아온 동글의 수신 시간(t2) 으로
+// offset = t2 - t1 - rtt/2, rtt = t4 - t1 을 구한다 (응답은 다음 전송의 ACK 로 오므로 seq 로 맞춘다)
+#define TIME_SYNC_HISTORY       4           // 응답을 기다리는 heartbeat 수
+#define TIME_SYNC_FILTER        8           // 최근 샘플 중 rtt 가 가장 짧은 것을 쓴다
+#define TIME_SYNC_SKEW_SPAN_US  10000000    // skew 를 구하는 최소 간격
+#define TIME_SYNC_SKEW_AVG      8
+#define TIME_SYNC_SKEW_MAX_PPB  500000      // ±500 ppm
 
 
 #ifndef LEFT_COLS
@@ -34,16 +48,31 @@
 #define RIGHT_COLS 1
 #endif // RIGHT_COLS
 
+// 동글에서 전달받은 호스트 전원 상태
+static uint8_t host_power_state = KEY_PROTOCOL_POWER_ACTIVE;
+
+// 동글에서 전달받은 트랙볼 센서 설정
+// sensor_config_gen 은 적용한 설정의 gen 으로 heartbeat 에 실어 보내며, 센서가 있는 하프만 보낸다
+static key_protocol_sensor_config_t sensor_config;
+static uint8_t sensor_config_gen = 0;
+static bool is_sensor_config = false;
+
 // Buffer for storing received data
-static uint8_t rx_buffer[MAX_PACKET_SIZE];
+static uint8_t rx_buffer[RX_BUFFER_SIZE];
 
 // Forward declarations
-static bool parse_packet(void);
+static bool parse_packet(uint8_t *packet);
 static bool validate_checksum(uint8_t *data, uint32_t length);
+static void process_time_sync_data(uint8_t device_id, uint8_t *payload, uint8_t length);
+static void time_sync_update(void);
 static void process_key_data(uint8_t device_id, uint8_t *payload, uint8_t length);
 static void process_trackball_data(uint8_t device_id, uint8_t *payload, uint8_t length);
 static void process_heartbeat_data(uint8_t device_id, uint8_t *payload, uint8_t length);
+static void process_sensor_config_data(uint8_t device_id, uint8_t *payload, uint8_t length);
+#ifdef _USE_HW_CLI
 static void cli_command(cli_args_t *args);
+static void cli_time_sync(cli_args_t *args);
+#endif
 
 // Debugging and statistics
 static uint32_t tx_errors = 0;
@@ -78,6 +107,44 @@ static heartbeat_state_t heartbeat_states[] =
 
 static uint32_t last_connection_check_time = 0u;
 
+typedef struct
+{
+    uint32_t tx_time;       // t1 (micros)
+    uint32_t tx_count;      // rfGetTxCount() 기준 전송 번호
+    uint32_t ack_time;      // t4 (micros)
+    bool is_sent;
+    bool is_acked;
+} time_sync_tx_t;
+
+typedef struct
+{
+    uint32_t offset;        // 동글 - 하프
+    uint32_t rtt;
+    uint32_t time;          // 하프 시간 (t1)
+} time_sync_sample_t;
+
+typedef struct
+{
+    uint8_t device_id;
+    uint8_t seq;
+    time_sync_tx_t tx[TIME_SYNC_HISTORY];
+    time_sync_sample_t filter[TIME_SYNC_FILTER];
+    uint8_t filter_index;
+    uint8_t filter_count;
+
+    bool valid;
+    time_sync_sample_t best;    // filter 중 rtt 가 가장 짧은 샘플
+    int32_t skew_ppb;           // 동글 시계가 빠르면 +
+    uint32_t skew_count;
+    bool skew_valid;
+    time_sync_sample_t skew_base;
+
+    uint32_t samples;
+    uint32_t lost;
+} time_sync_t;
+
+static time_sync_t time_sync;
+
 static heartbeat_state_t *get_heartbeat_state(uint8_t device_id)
 {
     for (size_t i = 0; i < sizeof(heartbeat_states) / sizeof(heartbeat_states[0]); ++i)
@@ -98,8 +165,11 @@ bool key_protocol_init(void)
         return false;
     }
 
+#ifdef _USE_HW_CLI
     // Register CLI command for debugging
     cliAdd("keyproto", cli_command);
+    cliAdd("timesync", cli_time_sync);
+#endif
 
     return true;
 }
@@ -107,38 +177,45 @@ bool key_protocol_init(void)
 void key_protocol_update(void)
 {
     uint32_t rx_len = rfAvailable();
-    bool is_error = false;
     // Check if RF has data available
     if (rx_len > 0)
     {
-        if (rx_len > MAX_PACKET_SIZE)
-            is_error = true;
-
-        if (!rfRead(rx_buffer, rx_len))
-            is_error = true;
-
-        // Basic validation
-        if (rx_buffer[0] != START_BYTE)
-            is_error = true;
-
-        // Checksum validation
-        if (!validate_checksum(rx_buffer, rx_len))
-            is_error = true;
-
-
-        if (is_error)
+        if (rx_len > RX_BUFFER_SIZE || !rfRead(rx_buffer, rx_len))
         {
             rx_errors++;
             rfBufferFlush();
+            rx_len = 0;
         }
-        else
+
+        // ACK 페이로드에는 프레임이 여러 개 이어져 있다
+        uint32_t index = 0;
+        while (index < rx_len)
         {
+            uint32_t packet_length;
+
+            // Basic validation
+            if (rx_len - index < HEADER_SIZE + FOOTER_SIZE || rx_buffer[index] != START_BYTE)
+            {
+                rx_errors++;
+                break;
+            }
+            packet_length = HEADER_SIZE + rx_buffer[index + 4] + FOOTER_SIZE;
+
+            // Checksum validation
+            if (packet_length > rx_len - index || !validate_checksum(&rx_buffer[index], packet_length))
+            {
+                rx_errors++;
+                break;
+            }
+
             // Parse the packet
-            parse_packet();
+            parse_packet(&rx_buffer[index]);
+            index += packet_length;
         }
-
     }
 
+    time_sync_update();
+
     uint32_t current_time = millis();
     if (current_time - last_connection_check_time >= CONNECTION_CHECK_INTERVAL + CONNECTION_CHECK_INTERVAL_OFFSET)
     {
@@ -168,14 +245,14 @@ void key_protocol_update(void)
     }
 }
 
-static bool parse_packet(void)
+static bool parse_packet(uint8_t *packet)
 {
     // Extract packet info
-    uint8_t device_id = rx_buffer[1];
-    // uint8_t version = rx_buffer[2];
-    uint8_t packet_type = rx_buffer[3];
-    uint8_t payload_length = rx_buffer[4];
-    uint8_t *payload = &rx_buffer[5];
+    uint8_t device_id = packet[1];
+    // uint8_t version = packet[2];
+    uint8_t packet_type = packet[3];
+    uint8_t payload_length = packet[4];
+    uint8_t *payload = &packet[HEADER_SIZE];
 
     // Process based on packet type
     switch (packet_type)
@@ -197,6 +274,21 @@ static bool parse_packet(void)
         process_heartbeat_data(device_id, payload, payload_length);
         break;
 
+    case PACKET_TYPE_POWER_STATE:
+        if (device_id == DEVICE_ID_DONGLE && payload_length >= 1)
+        {
+            host_power_state = payload[0];
+        }
+        break;
+
+    case PACKET_TYPE_TIME_SYNC:
+        process_time_sync_data(device_id, payload, payload_length);
+        break;
+
+    case PACKET_TYPE_SENSOR_CONFIG:
+        process_sensor_config_data(device_id, payload, payload_length);
+        break;
+
     default:
         // Unknown packet type
         return false;
@@ -303,6 +395,137 @@ static void process_heartbeat_data(uint8_t device_id, uint8_t *payload, uint8_t
     // }
 }
 
+// heartbeat 의 ACK 를 받은 시간 (t4) 기록
+static void time_sync_update(void)
+{
+    for (int i = 0; i < TIME_SYNC_HISTORY; i++)
+    {
+        time_sync_tx_t *tx = &time_sync.tx[i];
+        uint32_t ack_time;
+
+        if (tx->is_sent && !tx->is_acked && rfGetTxAckTime(tx->tx_count, &ack_time))
+        {
+            tx->ack_time = ack_time;
+            tx->is_acked = true;
+        }
+    }
+}
+
+static void time_sync_add_sample(const time_sync_sample_t *sample)
+{
+    time_sync.filter[time_sync.filter_index] = *sample;
+    time_sync.filter_index = (time_sync.filter_index + 1) % TIME_SYNC_FILTER;
+    if (time_sync.filter_count < TIME_SYNC_FILTER)
+    {
+        time_sync.filter_count++;
+    }
+    time_sync.samples++;
+
+    // 재전송이나 큐 대기로 rtt 가 늘어난 샘플은 offset 도 틀리므로 rtt 가 가장 짧은 샘플을 쓴다
+    time_sync_sample_t *best = &time_sync.filter[0];
+    for (int i = 1; i < time_sync.filter_count; i++)
+    {
+        if (time_sync.filter[i].rtt < best->rtt)
+        {
+            best = &time_sync.filter[i];
+        }
+    }
+    time_sync.best = *best;
+    time_sync.valid = true;
+
+    // skew : 일정 간격 이상 떨어진 best 샘플끼리의 기울기 평균
+    if (!time_sync.skew_valid)
+    {
+        time_sync.skew_base = *best;
+        time_sync.skew_valid = true;
+        return;
+    }
+
+    int32_t dt = (int32_t)(best->time - time_sync.skew_base.time);
+    if (dt >= TIME_SYNC_SKEW_SPAN_US)
+    {
+        int64_t skew = (int64_t)(int32_t)(best->offset - time_sync.skew_base.offset) * 1000000000 / dt;
+
+        if (skew > TIME_SYNC_SKEW_MAX_PPB) skew = TIME_SYNC_SKEW_MAX_PPB;
+        if (skew < -TIME_SYNC_SKEW_MAX_PPB) skew = -TIME_SYNC_SKEW_MAX_PPB;
+        if (time_sync.skew_count < TIME_SYNC_SKEW_AVG)
+        {
+            time_sync.skew_count++;
+        }
+        time_sync.skew_ppb += (int32_t)(skew - time_sync.skew_ppb) / (int32_t)time_sync.skew_count;
+        time_sync.skew_base = *best;
+    }
+    else if (dt < 0)
+    {
+        // 동글이나 하프가 리셋되어 시간이 튀면 skew 를 다시 구한다
+        time_sync.skew_base = *best;
+    }
+}
+
+// ACK 페이로드 : 하프별 [seq, 동글이 heartbeat 를 받은 시간(us, little-endian)]
+static void process_time_sync_data(uint8_t device_id, uint8_t *payload, uint8_t length)
+{
+    if (device_id != DEVICE_ID_DONGLE || length < 10u)
+    {
+        return;
+    }
+    if (time_sync.device_id != DEVICE_ID_LEFT && time_sync.device_id != DEVICE_ID_RIGHT)
+    {
+        return;
+    }
+
+    uint8_t *entry = &payload[(time_sync.device_id - DEVICE_ID_LEFT) * 5];
+    uint8_t seq = entry[0];
+    time_sync_tx_t *tx = &time_sync.tx[seq % TIME_SYNC_HISTORY];
+
+    // 같은 응답이 ACK 마다 반복되므로 기다리던 heartbeat 의 응답만 한 번 사용한다
+    if ((uint8_t)(time_sync.seq - seq) >= TIME_SYNC_HISTORY || !tx->is_sent)
+    {
+        return;
+    }
+    tx->is_sent = false;
+    if (!tx->is_acked)
+    {
+        time_sync.lost++;
+        return;
+    }
+
+    uint32_t rx_time = (uint32_t)entry[1] | ((uint32_t)entry[2] << 8) | ((uint32_t)entry[3] << 16) | ((uint32_t)entry[4] << 24);
+    time_sync_sample_t sample;
+
+    sample.rtt    = tx->ack_time - tx->tx_time;
+    sample.offset = rx_time - tx->tx_time - sample.rtt / 2;
+    sample.time   = tx->tx_time;
+    time_sync_add_sample(&sample);
+}
+
+// ACK 페이로드 : gen, cpi(little-endian), snap angle, flags(bit0 smart mode, bit1 auto), smart threshold(little-endian)
+static void process_sensor_config_data(uint8_t device_id, uint8_t *payload, uint8_t length)
+{
+    if (device_id != DEVICE_ID_DONGLE || length < 7u || payload[0] == 0u)
+    {
+        return;
+    }
+
+    sensor_config.gen             = payload[0];
+    sensor_config.cpi             = (uint16_t)payload[1] | ((uint16_t)payload[2] << 8);
+    sensor_config.snap_angle      = payload[3];
+    sensor_config.smart_mode      = (payload[4] & 0x02u) ? KEY_PROTOCOL_SMART_AUTO : (payload[4] & 0x01u);
+    sensor_config.smart_threshold = (uint16_t)payload[5] | ((uint16_t)payload[6] << 8);
+}
+
+bool key_protocol_get_sensor_config(key_protocol_sensor_config_t *p_cfg)
+{
+    *p_cfg = sensor_config;
+    return sensor_config.gen != 0u && sensor_config.gen != sensor_config_gen;
+}
+
+void key_protocol_set_sensor_config_gen(uint8_t gen)
+{
+    sensor_config_gen = gen;
+    is_sensor_config = true;
+}
+
 bool RfMotionRead(int32_t *x, int32_t *y)
 {
     if (is_moving)
@@ -368,27 +591,31 @@ static bool tx_packet_send(uint32_t packet_length)
 }
 
 // 키 데이터 전송 함수
-bool key_protocol_send_key_data(uint8_t device_id, uint8_t *key_matrix, uint8_t column_count)
+bool key_protocol_send_key_data(uint8_t device_id, uint8_t *key_matrix, uint8_t column_count, uint32_t scan_time_us)
 {
-    if (column_count > MAX_PAYLOAD - 1)
+    if (column_count > MAX_PAYLOAD - 5)
     {
         tx_errors++;
         return false;
     }
 
-    // 페이로드 준비: column count + key states
+    // 페이로드 준비: column count + key states + scan time (us, little-endian)
     uint8_t payload[MAX_PAYLOAD];
     payload[0] = column_count;
     memcpy(&payload[1], key_matrix, column_count);
+    payload[column_count + 1] = (uint8_t)(scan_time_us >> 0);
+    payload[column_count + 2] = (uint8_t)(scan_time_us >> 8);
+    payload[column_count + 3] = (uint8_t)(scan_time_us >> 16);
+    payload[column_count + 4] = (uint8_t)(scan_time_us >> 24);
 
     // 패킷 조립
-    if (!tx_packet_prepare(device_id, PACKET_TYPE_KEY, payload, column_count + 1))
+    if (!tx_packet_prepare(device_id, PACKET_TYPE_KEY, payload, column_count + 5))
     {
         return false;
     }
 
     // 패킷 전송 (재시도 포함)
-    uint32_t packet_length = HEADER_SIZE + (column_count + 1) + FOOTER_SIZE;
+    uint32_t packet_length = HEADER_SIZE + (column_count + 5) + FOOTER_SIZE;
     return tx_packet_send(packet_length);
 }
 
@@ -448,18 +675,91 @@ bool key_protocol_send_battery_data(uint8_t device_id, uint8_t battery_level)
 // 하트비트 데이터 전송 함수
 bool key_protocol_send_heartbeat(uint8_t device_id, uint8_t status_flag, uint8_t battery_level)
 {
-    uint8_t payload[2];
+    uint8_t payload[10];
+    uint8_t length = 9;
+    uint16_t rtt = 0xFFFF;
+    uint32_t tx_time;
+    time_sync_tx_t *tx;
 
+    if (time_sync.device_id != device_id)
+    {
+        memset(&time_sync, 0, sizeof(time_sync));
+        time_sync.device_id = device_id;
+    }
+    if (time_sync.valid)
+    {
+        rtt = time_sync.best.rtt < 0xFFFF ? (uint16_t)time_sync.best.rtt : 0xFFFE;
+    }
+    time_sync.seq++;
+    tx = &time_sync.tx[time_sync.seq % TIME_SYNC_HISTORY];
+    if (tx->is_sent)
+    {
+        time_sync.lost++;
+    }
+    tx->is_sent = false;
+
+    // 페이로드 : status, battery, seq, 전송 시간(us), rtt(us)
+    tx_time = micros();
     payload[0] = status_flag;
     payload[1] = battery_level;
+    payload[2] = time_sync.seq;
+    payload[3] = (uint8_t)(tx_time >> 0);
+    payload[4] = (uint8_t)(tx_time >> 8);
+    payload[5] = (uint8_t)(tx_time >> 16);
+    payload[6] = (uint8_t)(tx_time >> 24);
+    payload[7] = (uint8_t)(rtt >> 0);
+    payload[8] = (uint8_t)(rtt >> 8);
+    // 센서 설정 gen : 동글은 이 값이 자기 gen 과 다르면 ACK 페이로드로 설정을 다시 보낸다
+    if (is_sensor_config)
+    {
+        payload[length++] = sensor_config_gen;
+    }
 
-    if (!tx_packet_prepare(device_id, PACKET_TYPE_HEARTBEAT, payload, sizeof(payload)))
+    if (!tx_packet_prepare(device_id, PACKET_TYPE_HEARTBEAT, payload, length))
     {
         return false;
     }
 
     // 패킷 전송 (재시도 포함)
-    return tx_packet_send(HEADER_SIZE + sizeof(payload) + FOOTER_SIZE);
+    if (!tx_packet_send(HEADER_SIZE + length + FOOTER_SIZE))
+    {
+        return false;
+    }
+
+    tx->tx_time  = tx_time;
+    tx->tx_count = rfGetTxCount();
+    tx->is_sent  = true;
+    tx->is_acked = false;
+    return true;
+}
+
+bool key_protocol_get_time_sync(key_protocol_time_sync_t *p_sync)
+{
+    p_sync->valid    = time_sync.valid;
+    p_sync->offset   = (int32_t)time_sync.best.offset;
+    p_sync->rtt      = time_sync.best.rtt;
+    p_sync->skew_ppb = time_sync.skew_ppb;
+    p_sync->samples  = time_sync.samples;
+    p_sync->lost     = time_sync.lost;
+    return time_sync.valid;
+}
+
+bool key_protocol_get_dongle_time(uint32_t local_us, uint32_t *p_dongle_us)
+{
+    if (!time_sync.valid)
+    {
+        return false;
+    }
+
+    int32_t dt = (int32_t)(local_us - time_sync.best.time);
+
+    *p_dongle_us = local_us + time_sync.best.offset + (int32_t)(((int64_t)time_sync.skew_ppb * dt) / 1000000000);
+    return true;
+}
+
+uint8_t key_protocol_get_power_state(void)
+{
+    return host_power_state;
 }
 
 bool key_protocol_is_connected(uint8_t device_id)
@@ -491,6 +791,7 @@ uint32_t key_protocol_get_last_heartbeat_elapsed(uint8_t device_id)
     return (now >= state->last_time) ? (now - state->last_time) : 0u;
 }
 
+#ifdef _USE_HW_CLI
 // cli_command 함수 수정 - TX 통계 추가
 static void cli_command(cli_args_t *args)
 {
@@ -501,6 +802,7 @@ static void cli_command(cli_args_t *args)
         cliPrintf("Total TX packets: %u\n", tx_packets);
         cliPrintf("TX error packets: %u\n", tx_errors);
         cliPrintf("Total RX errors: %u\n", rx_errors);
+        cliPrintf("Host power state: %s\n", host_power_state == KEY_PROTOCOL_POWER_SUSPEND ? "SUSPEND" : "ACTIVE");
         for (size_t i = 0; i < sizeof(heartbeat_states) / sizeof(heartbeat_states[0]); ++i)
         {
             heartbeat_state_t *state = &heartbeat_states[i];
@@ -512,6 +814,8 @@ static void cli_command(cli_args_t *args)
                       key_protocol_get_last_heartbeat_elapsed(state->device_id));
         }
         cliPrintf("Heartbeat timeout: %ums\n", HEARTBEAT_TIMEOUT_MS);
+        cliPrintf("Sensor config gen: %u (dongle %u)%s\n", sensor_config_gen, sensor_config.gen,
+                  is_sensor_config ? "" : ", not reported");
         return;
     }
 
@@ -526,7 +830,7 @@ static void cli_command(cli_args_t *args)
         case 1: // 키 데이터 테스트
         {
             uint8_t key_data[3] = {0x01, 0x02, 0x03};
-            result = key_protocol_send_key_data(DEVICE_ID_LEFT, key_data, 3);
+            result = key_protocol_send_key_data(DEVICE_ID_LEFT, key_data, 3, micros());
             break;
         }
         case 2: // 트랙볼 데이터 테스트
@@ -561,4 +865,31 @@ static void cli_command(cli_args_t *args)
     cliPrintf("keyproto info\n");
     cliPrintf("keyproto test_tx [1:key, 2:trackball, 3:battery]\n");
     cliPrintf("keyproto test_trackball [x] [y] [device_id]\n");
-}
\ No newline at end of file
+}
+
+static void cli_time_sync(cli_args_t *args)
+{
+    if (args->argc == 1 && args->isStr(0, "info"))
+    {
+        key_protocol_time_sync_t sync;
+        uint32_t dongle_us = 0;
+        int32_t skew_abs;
+
+        key_protocol_get_time_sync(&sync);
+        key_protocol_get_dongle_time(micros(), &dongle_us);
+        skew_abs = sync.skew_ppb < 0 ? -sync.skew_ppb : sync.skew_ppb;
+
+        cliPrintf("Time Sync (device 0x%02X)\n", time_sync.device_id);
+        cliPrintf("-------------------\n");
+        cliPrintf("sync    : %s\n", sync.valid ? "YES" : "NO");
+        cliPrintf("offset  : %d us\n", sync.offset);
+        cliPrintf("skew    : %s%d.%03d ppm\n", sync.skew_ppb < 0 ? "-" : "", skew_abs / 1000, skew_abs % 1000);
+        cliPrintf("rtt     : %u us\n", sync.rtt);
+        cliPrintf("samples : %u, lost %u\n", sync.samples, sync.lost);
+        cliPrintf("dongle  : %u us (local %u us)\n", dongle_us, micros());
+        return;
+    }
+
+    cliPrintf("timesync info\n");
+}
+#endif
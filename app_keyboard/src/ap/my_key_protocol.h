@@ -7,6 +7,36 @@
 
 #define DEVICE_ID_LEFT 0x01u
 #define DEVICE_ID_RIGHT 0x02u
+#define DEVICE_ID_DONGLE 0x00u
+
+// Host power state (dongle -> half, ACK payload)
+#define KEY_PROTOCOL_POWER_ACTIVE  0x00u
+#define KEY_PROTOCOL_POWER_SUSPEND 0x01u
+
+// Dongle time sync (heartbeat + ACK payload)
+typedef struct
+{
+    bool valid;
+    int32_t offset;     // dongle - half (us)
+    uint32_t rtt;       // us
+    int32_t skew_ppb;   // dongle clock faster : +
+    uint32_t samples;
+    uint32_t lost;
+} key_protocol_time_sync_t;
+
+// Trackball sensor config (dongle -> half, ACK payload)
+#define KEY_PROTOCOL_SMART_OFF  0x00u
+#define KEY_PROTOCOL_SMART_ON   0x01u
+#define KEY_PROTOCOL_SMART_AUTO 0x02u   // 하프가 표면에 맞는 threshold 를 찾음
+
+typedef struct
+{
+    uint8_t gen;                // 동글에서 설정이 바뀔 때마다 증가 (0 : 설정 없음)
+    uint16_t cpi;
+    uint8_t snap_angle;         // 0 : off, 1~45 도
+    uint8_t smart_mode;         // KEY_PROTOCOL_SMART_*
+    uint16_t smart_threshold;
+} key_protocol_sensor_config_t;
 
 // Initialize the key protocol
 bool key_protocol_init(void);
@@ -19,12 +49,24 @@ void RfKeysReadBuf(uint8_t *buf, uint32_t len);
 bool RfMotionRead(int32_t *x, int32_t *y);
 
 // TX related functions
-bool key_protocol_send_key_data(uint8_t device_id, uint8_t *key_matrix, uint8_t column_count);
+bool key_protocol_send_key_data(uint8_t device_id, uint8_t *key_matrix, uint8_t column_count, uint32_t scan_time_us);
 bool key_protocol_send_trackball_data(uint8_t device_id, int16_t x, int16_t y);
 bool key_protocol_send_system_data(uint8_t device_id, uint8_t *system_data, uint8_t length);
 bool key_protocol_send_battery_data(uint8_t device_id, uint8_t battery_level);
 bool key_protocol_send_heartbeat(uint8_t device_id, uint8_t status_flag, uint8_t battery_level);
 
+// Host power state received from the dongle
+uint8_t key_protocol_get_power_state(void);
+
+// Dongle time sync
+bool key_protocol_get_time_sync(key_protocol_time_sync_t *p_sync);
+bool key_protocol_get_dongle_time(uint32_t local_us, uint32_t *p_dongle_us);
+
+// Trackball sensor config received from the dongle
+// 적용하지 않은 새 설정이 있으면 true, 적용한 뒤 key_protocol_set_sensor_config_gen() 으로 알린다
+bool key_protocol_get_sensor_config(key_protocol_sensor_config_t *p_cfg);
+void key_protocol_set_sensor_config_gen(uint8_t gen);
+
 bool key_protocol_is_connected(uint8_t device_id);
 uint8_t key_protocol_get_battery_level(uint8_t device_id);
 uint8_t key_protocol_get_status_flag(uint8_t device_id);
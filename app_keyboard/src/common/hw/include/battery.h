@@ -21,6 +21,7 @@ bool batteryIsConnected(void);
 
 int32_t batteryGetPercent(void);
 float   batteryGetVoltage(void);
+int32_t batteryGetVoltageMv(void);
 
 
 #endif
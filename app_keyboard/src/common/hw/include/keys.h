@@ -15,6 +15,7 @@ bool keysIsReady(void);
 bool keysUpdate(void);
 bool keysGetPressed(uint16_t row, uint16_t col);
 bool keysReadBuf(uint8_t *p_data, uint32_t length);
+bool keysSetScanPeriod(uint32_t period_ms);
 bool keysEnterSleep(void);
 bool keysExitSleep(void);
 
@@ -16,10 +16,15 @@ uint32_t rfAvailable(void);
 uint32_t rfWrite(uint8_t *p_data, uint32_t length);
 uint32_t rfRead(uint8_t *p_data, uint32_t length);
 bool rfBufferFlush(void);
-
-/*
+uint32_t rfGetTxFailCount(void);
+uint32_t rfGetTxCount(void);
+bool rfGetTxAckTime(uint32_t tx_count, uint32_t *p_time_us);
 bool rfSetTxPower(int8_t power);
 int8_t rfGetTxPower(void);
+bool rfSetRetransmitCount(uint16_t count);
+uint16_t rfGetRetransmitCount(void);
+
+/*
 bool rfSetChannel(uint8_t channel);
 uint8_t rfGetChannel(void);
 bool rfSetAddress(uint8_t *p_address, uint8_t length);
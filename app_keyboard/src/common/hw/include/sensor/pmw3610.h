@@ -10,8 +10,47 @@
 
 #ifdef _USE_HW_PMW3610
 
+#define PMW3610_BURST_SIZE    8
+
+
+typedef struct
+{
+  uint8_t  burst[PMW3610_BURST_SIZE];  // SPI RX 버퍼로 바로 받음, [0] 은 주소를 보내는 동안 받은 값
+  int16_t  x;
+  int16_t  y;
+  uint8_t  squal;                      // smart mode 일 때만 채워짐
+  uint16_t shutter;
+} pmw3610_motion_t;
+
+typedef struct
+{
+  uint32_t frames;                     // shutter 를 읽은 burst 수
+  uint32_t smart_frames;               // 그 중 smart mode 가 켜져 있던 수
+  uint32_t smart_toggles;
+  uint32_t motion_frames;              // 움직임이 있던 burst 수 (squal 통계)
+  uint8_t  squal_min;
+  uint8_t  squal_max;
+  uint32_t squal_sum;
+  uint16_t shutter_min;
+  uint16_t shutter_max;
+  uint32_t shutter_sum;
+} pmw3610_stats_t;
+
+
 bool pmw3610_init(void);
+bool pmw3610_is_ready(void);
+bool pmw3610_motion_burst(pmw3610_motion_t *p_motion);
 bool pmw3610_motion_read(int32_t* x_out, int32_t* y_out);
+bool pmw3610_set_force_awake(bool enable);
+bool pmw3610_get_force_awake(void);
+bool pmw3610_set_cpi(uint16_t cpi);
+uint16_t pmw3610_get_cpi(void);
+bool pmw3610_set_smart_mode(bool enable, uint16_t threshold);
+bool pmw3610_get_smart_mode(uint16_t *p_threshold);
+bool pmw3610_set_telemetry(bool enable);
+void pmw3610_get_stats(pmw3610_stats_t *p_stats);
+void pmw3610_clear_stats(void);
+bool pmw3610_shutdown(void);
 
 #endif //_USE_HW_PMW3610
 
@@ -2,77 +2,124 @@
 
 
 #ifdef _USE_HW_BATTERY
-#include "adc.h"
 #include "cli.h"
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/adc.h>
+#include <zephyr/logging/log.h>
 
+LOG_MODULE_REGISTER(battery, LOG_LEVEL_INF);
 
-#define BAT_ADC_MAX_COUNT     10
-#define BAT_ADC_TO_VOL(x)     ((float)x * 3.3f * 2.0f / 4095.f)
 
+#define BAT_ADC_MAX_COUNT     4           // 이동 평균 샘플 수
+#define BAT_INIT_SAMPLE_MS    100         // 부팅 직후 평균 버퍼를 채우는 주기
 
-#define lock()      xSemaphoreTake(mutex_lock, portMAX_DELAY);
-#define unLock()    xSemaphoreGive(mutex_lock);
+
+#define lock()      k_mutex_lock(&mutex_lock, K_FOREVER);
+#define unLock()    k_mutex_unlock(&mutex_lock);
 
 
 typedef struct
 {
   int32_t percent;
-  float   voltage;
+  int32_t voltage_mv;
   int32_t adc_raw;
 } battery_info_t;
 
+typedef struct
+{
+  int32_t mv;
+  int32_t percent;
+} battery_curve_t;
+
 
 #ifdef _USE_HW_CLI
 static void cliBattery(cli_args_t *args);
 #endif
-static void batteryThread(void *args);
+static void batteryWorkFunc(struct k_work *work);
+static bool batteryReadMv(int32_t *p_mv, int32_t *p_raw);
+static int32_t batteryMvToPercent(int32_t mv);
+
 
+// app.overlay 의 zephyr,user io-channels (SAADC VDDH/5)
+static const struct adc_dt_spec adc_chan = ADC_DT_SPEC_GET(DT_PATH(zephyr_user));
 
-static SemaphoreHandle_t mutex_lock;
+static K_MUTEX_DEFINE(mutex_lock);
+static struct k_work_delayable bat_work;
 static bool is_init = false;
+static bool is_valid = false;     // 측정에 한 번이라도 성공해야 잔량을 사용
 
-static float bat_max = 4.1f;
-static float bat_min = 3.1f;
 static battery_info_t bat_info;
-static uint32_t adc_data[BAT_ADC_MAX_COUNT];
-static uint8_t  adc_ch = 0;
+static int32_t  adc_data[BAT_ADC_MAX_COUNT];
 static uint16_t buf_index = 0;
+static uint16_t buf_count = 0;
+static int16_t  adc_buf;
+static uint32_t sample_count = 0;
+
+// LiPo 방전 곡선 (mV -> %), 전압 내림차순
+static const battery_curve_t bat_curve[] =
+{
+  {4200, 100},
+  {4100,  90},
+  {4000,  80},
+  {3900,  65},
+  {3800,  50},
+  {3750,  40},
+  {3700,  30},
+  {3650,  20},
+  {3600,  10},
+  {3500,   5},
+  {3300,   0},
+};
 
 
 
 
 bool batteryInit(void)
 {
-  bool    ret = true;
-  int32_t adc_sum;
-  int32_t adc_avg;
+  int err;
 
-  mutex_lock = xSemaphoreCreateMutex();
+  if (!adc_is_ready_dt(&adc_chan))
+  {
+    LOG_ERR("ADC %s is not ready", adc_chan.dev->name);
+    return false;
+  }
 
-  adc_sum = 0;
-  for (int i=0; i<BAT_ADC_MAX_COUNT; i++)
+  err = adc_channel_setup_dt(&adc_chan);
+  if (err < 0)
   {
-    adc_data[i] = adcRead12(adc_ch);
-    adc_sum += adc_data[i];
+    LOG_ERR("ADC channel setup failed: %d", err);
+    return false;
   }
-  adc_avg = adc_sum / BAT_ADC_MAX_COUNT;
 
-  if (xTaskCreate(batteryThread, "batteryThread", _HW_DEF_RTOS_THREAD_MEM_BATTERY, NULL, _HW_DEF_RTOS_THREAD_PRI_BATTERY, NULL) != pdPASS)
+  // 첫 측정은 바로 수행해서 부팅 직후부터 값이 유효하도록 함
+  int32_t mv;
+  int32_t raw;
+  if (batteryReadMv(&mv, &raw))
   {
-    logPrintf("[NG] batteryThread()\n");   
-    ret = false;
+    for (int i=0; i<BAT_ADC_MAX_COUNT; i++)
+    {
+      adc_data[i] = mv;
+    }
+    buf_count = BAT_ADC_MAX_COUNT;
+
+    bat_info.adc_raw    = raw;
+    bat_info.voltage_mv = mv;
+    bat_info.percent    = batteryMvToPercent(mv);
+    is_valid = true;
   }
 
-  is_init = ret;
+  k_work_init_delayable(&bat_work, batteryWorkFunc);
+  k_work_schedule(&bat_work, K_MSEC(BAT_INIT_SAMPLE_MS));
 
-  logPrintf("[%s] batteryInit()\n", is_init ? "OK":"E_");
-  logPrintf("     %3.2f V\n", BAT_ADC_TO_VOL(adc_avg));
+  is_init = true;
 
 #ifdef _USE_HW_CLI
   cliAdd("battery", cliBattery);
 #endif
 
-  return ret;
+  return true;
 }
 
 bool batteryIsInit(void)
@@ -82,13 +129,23 @@ bool batteryIsInit(void)
 
 bool batteryIsCharging(void)
 {
-  return true;
+  // 충전 상태 핀이 없어 판단할 수 없음
+  return false;
+}
+
+bool batteryIsConnected(void)
+{
+  return is_init && is_valid;
 }
 
 int32_t batteryGetPercent(void)
 {
   int32_t ret;
 
+  // 측정에 성공하기 전에 0% 를 돌려주면 ap_power 가 부팅 직후 deep sleep 으로 들어감
+  if (is_init != true || is_valid != true)
+    return 100;
+
   lock();
   ret = bat_info.percent;
   unLock();
@@ -98,89 +155,117 @@ int32_t batteryGetPercent(void)
 
 float batteryGetVoltage(void)
 {
-  float ret;
+  return (float)batteryGetVoltageMv() / 1000.f;
+}
+
+int32_t batteryGetVoltageMv(void)
+{
+  int32_t ret;
 
   lock();
-  ret = bat_info.voltage;
+  ret = bat_info.voltage_mv;
   unLock();
 
   return ret;
 }
 
-void batteryThread(void *args)
+bool batteryReadMv(int32_t *p_mv, int32_t *p_raw)
 {
-  int32_t adc_value;
-  float adc_vol;
-  float bat_vol;
-  uint8_t dif_cnt = 0;
-  uint8_t state = 0;
+  int err;
+  int32_t mv;
+  struct adc_sequence sequence = {
+    .buffer      = &adc_buf,
+    .buffer_size = sizeof(adc_buf),
+  };
+
+  adc_sequence_init_dt(&adc_chan, &sequence);
+
+  // SAADC 는 측정할 때만 활성화되고 완료 후 드라이버가 다시 끈다
+  err = adc_read(adc_chan.dev, &sequence);
+  if (err < 0)
+  {
+    LOG_ERR("ADC read failed: %d", err);
+    return false;
+  }
 
+  mv = (adc_buf < 0) ? 0 : adc_buf;
+  *p_raw = mv;
 
-  while(1) 
+  err = adc_raw_to_millivolts_dt(&adc_chan, &mv);
+  if (err < 0)
   {
-    adc_data[buf_index] = adcRead12(adc_ch);
-    buf_index = (buf_index + 1) % BAT_ADC_MAX_COUNT;
+    return false;
+  }
 
-    int32_t sum = 0;
-    int32_t percent;
-   
-    for (int i=0; i<BAT_ADC_MAX_COUNT; i++)
+  *p_mv = mv * HW_BATTERY_ADC_DIVIDER;
+  return true;
+}
+
+int32_t batteryMvToPercent(int32_t mv)
+{
+  const uint32_t count = sizeof(bat_curve)/sizeof(bat_curve[0]);
+
+  if (mv >= bat_curve[0].mv)
+    return bat_curve[0].percent;
+  if (mv <= bat_curve[count-1].mv)
+    return bat_curve[count-1].percent;
+
+  for (uint32_t i=1; i<count; i++)
+  {
+    if (mv >= bat_curve[i].mv)
     {
-      sum += adc_data[i];
+      const battery_curve_t *p_hi = &bat_curve[i-1];
+      const battery_curve_t *p_lo = &bat_curve[i];
+
+      return p_lo->percent + (mv - p_lo->mv) * (p_hi->percent - p_lo->percent) / (p_hi->mv - p_lo->mv);
     }
-    adc_value = sum/BAT_ADC_MAX_COUNT;
-    bat_vol = BAT_ADC_TO_VOL(adc_value); 
-    adc_vol = constrain(bat_vol, bat_min, bat_max);
+  }
 
-    percent = (int32_t)cmap(adc_vol, bat_min, bat_max, 0, 100);
+  return 0;
+}
 
+void batteryWorkFunc(struct k_work *work)
+{
+  int32_t mv;
+  int32_t raw;
+  int32_t sum = 0;
+  int32_t percent;
+  int32_t avg_mv;
+
+  ARG_UNUSED(work);
 
-    switch(state)
+  if (batteryReadMv(&mv, &raw))
+  {
+    adc_data[buf_index] = mv;
+    buf_index = (buf_index + 1) % BAT_ADC_MAX_COUNT;
+    if (buf_count < BAT_ADC_MAX_COUNT)
     {
-      case 0:
-        lock();
-        bat_info.adc_raw = adc_value;
-        bat_info.voltage = bat_vol;
-        bat_info.percent = percent;
-        unLock();
-        state = 1;
-        break;
-
-      case 1:
-        if (bat_info.percent != percent)
-        {
-          dif_cnt = 0;
-          state = 2;
-        }
-        break;
-      
-      case 2:
-        dif_cnt++;
-        if (dif_cnt >= 100)
-        {
-          state = 3;
-        }
-        if (bat_info.percent == percent)
-        {
-          state = 1;
-        }
-        break;
-
-      case 3:
-        lock();
-        bat_info.percent = percent;
-        unLock();
-        state = 1;
-        break;
+      buf_count++;
     }
 
+    for (int i=0; i<buf_count; i++)
+    {
+      sum += adc_data[i];
+    }
+    avg_mv  = sum / buf_count;
+    percent = batteryMvToPercent(avg_mv);
+
     lock();
-    bat_info.adc_raw = adc_value;
-    bat_info.voltage = bat_vol;
+    bat_info.adc_raw    = raw;
+    bat_info.voltage_mv = avg_mv;
+    // 부하에 따른 순간적인 전압 상승으로 잔량이 오르내리지 않도록
+    // 5% 이상 올라간 경우(충전)에만 증가를 반영
+    if (!is_valid || percent < bat_info.percent || percent >= bat_info.percent + 5)
+    {
+      bat_info.percent = percent;
+    }
+    is_valid = true;
     unLock();
 
-    delay(10);
+    sample_count++;
   }
+
+  k_work_schedule(&bat_work, K_MSEC(HW_BATTERY_SAMPLE_MS));
 }
 
 
@@ -192,7 +277,11 @@ void cliBattery(cli_args_t *args)
 
   if (args->argc == 1 && args->isStr(0, "info") == true)
   {
-    cliPrintf("battery init : %d\n", is_init);
+    cliPrintf("battery init   : %d\n", is_init);
+    cliPrintf("battery valid  : %d\n", is_valid);
+    cliPrintf("battery period : %d ms\n", HW_BATTERY_SAMPLE_MS);
+    cliPrintf("battery sample : %d\n", sample_count);
+    cliPrintf("battery        : %d%% %d mV\n", batteryGetPercent(), batteryGetVoltageMv());
     ret = true;
   }
 
@@ -200,10 +289,18 @@ void cliBattery(cli_args_t *args)
   {
     while(cliKeepLoop())
     {
-      cliPrintf("%03d%% %1.2fV %04d\n", batteryGetPercent(), batteryGetVoltage(), bat_info.adc_raw);
+      int32_t mv;
+      int32_t raw;
+
+      if (batteryReadMv(&mv, &raw))
+      {
+        cliPrintf("%03d%% %4d mV (now %4d mV, %d%%) %04d\n",
+                  batteryGetPercent(), batteryGetVoltageMv(),
+                  mv, batteryMvToPercent(mv), raw);
+      }
       delay(100);
     }
-    
+
     ret = true;
   }
 
@@ -216,4 +313,4 @@ void cliBattery(cli_args_t *args)
 }
 #endif
 
-#endif
\ No newline at end of file
+#endif
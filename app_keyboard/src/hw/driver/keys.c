@@ -57,6 +57,8 @@ static const struct gpio_dt_spec cols_gpio_tbl[KEYS_COLS] = {
 
 
 static bool is_ready = false;
+static volatile uint32_t scan_period_ms = 1;
+static volatile uint8_t  debounce_count = DEBOUNCE_TIME_MS;
 
 bool keysInit(void)
 {
@@ -73,7 +75,7 @@ bool keysInit(void)
   // TODO: create thread
 
 
-  k_msleep(1000);
+  // 전원 인가 직후의 불안정한 입력은 디바운스로 걸러지므로 바로 스캔 시작
   k_thread_create(&key_thread_data, key_thread_stack,
                   K_THREAD_STACK_SIZEOF(key_thread_stack),
                   keysThread,
@@ -105,32 +107,50 @@ bool keysInitGpio(void)
   return true;
 }
 
+bool keysSetScanPeriod(uint32_t period_ms)
+{
+  if (period_ms == 0)
+  {
+    return false;
+  }
+
+  // 스캔 주기가 길어지면 디바운스 시간이 유지되도록 카운트를 줄인다
+  scan_period_ms = period_ms;
+  debounce_count = (period_ms >= DEBOUNCE_TIME_MS) ? 1 : (DEBOUNCE_TIME_MS / period_ms);
+  return true;
+}
+
 bool keysEnterSleep(void)
 {
-  // esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_ALL);
-
-  // gpio_config_t config = {
-  //   .pin_bit_mask = BIT64(GPIO_NUM_18),
-  //   .mode         = GPIO_MODE_INPUT,
-  //   .pull_down_en = true,
-  //   .pull_up_en   = false,
-  //   .intr_type    = GPIO_INTR_DISABLE};
-
-  // for (int i=0; i<KEYS_COLS; i++)
-  // {
-  //   config.pin_bit_mask = BIT64(cols_gpio_tbl[i]);
-  //   gpio_config(&config);
-  //   gpio_wakeup_enable(cols_gpio_tbl[i], GPIO_INTR_HIGH_LEVEL);
-  // }
-
-  // esp_sleep_enable_gpio_wakeup();
+  // 스캔 스레드를 멈추고 모든 컬럼을 HIGH 로 둔 상태에서
+  // 어느 row 라도 HIGH 가 되면 깨어나도록 GPIO sense 를 설정 (System OFF wakeup)
+  k_thread_suspend(&key_thread_data);
+
+  lockGpio();
+  for (int j = 0; j < ARRAY_SIZE(cols_gpio_tbl); j++)
+  {
+    gpio_pin_set_dt(&cols_gpio_tbl[j], 1);
+  }
+  for (int i = 0; i < ARRAY_SIZE(rows_gpio_tbl); i++)
+  {
+    gpio_pin_interrupt_configure_dt(&rows_gpio_tbl[i], GPIO_INT_LEVEL_ACTIVE);
+  }
+  unLockGpio();
+
   return true;
 }
 
 bool keysExitSleep(void)
 {
-  // esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_ALL);
-  // keysInitGpio();
+  lockGpio();
+  for (int i = 0; i < ARRAY_SIZE(rows_gpio_tbl); i++)
+  {
+    gpio_pin_interrupt_configure_dt(&rows_gpio_tbl[i], GPIO_INT_DISABLE);
+  }
+  unLockGpio();
+
+  keysInitGpio();
+  k_thread_resume(&key_thread_data);
   return true;
 }
 
@@ -198,7 +218,7 @@ void keysScan(void)
       if (new_state != current_state) {
         debounce_counters[rows_i][cols_i]++;
         // If the state has been stable for DEBOUNCE_TIME_MS
-        if (debounce_counters[rows_i][cols_i] >= DEBOUNCE_TIME_MS) {
+        if (debounce_counters[rows_i][cols_i] >= debounce_count) {
           // Update the debounced state
           if (new_state) {
             cols_debounced[cols_i] |= (1 << rows_i);
@@ -242,7 +262,7 @@ static void keysThread(void *arg1, void *arg2, void *arg3)
   while (1)
   {
     keysScan();
-    delay(1);
+    delay(scan_period_ms);
   }
 }
 
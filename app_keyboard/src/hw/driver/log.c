@@ -278,4 +278,11 @@ void cliCmd(cli_args_t *args)
 #endif
 
 
-#endif
\ No newline at end of file
+#else
+
+// 릴리즈 빌드에서는 로그 버퍼 없이 출력만 버림
+void logPrintf(const char *fmt, ...)
+{
+}
+
+#endif
@@ -22,9 +22,19 @@ static struct esb_payload rx_payload;
 static struct esb_payload tx_payload = ESB_CREATE_PAYLOAD(0,
                               0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17);
 
+static bool is_init = false;
 static qbuffer_t rf_rx_q;
 static uint8_t rf_rx_buf[RF_RX_BUF_LENGTH];
 static struct k_mutex rf_rx_mutex;
+static volatile uint32_t rf_tx_fail_count = 0;
+
+// 전송 번호 : rfWrite() 로 큐에 넣은 패킷 수, ACK 를 받은(또는 실패로 버려진) 패킷 수
+static volatile uint32_t rf_tx_count = 0;
+static volatile uint32_t rf_tx_done_count = 0;
+static volatile uint32_t rf_tx_ack_count = 0;
+static volatile uint32_t rf_tx_ack_time = 0;
+static int8_t rf_tx_power = 0;
+static uint16_t rf_retransmit_count = 0;
 
 #ifdef _USE_CLI_HW_RF
 static void cliCmd(cli_args_t *args);
@@ -37,6 +47,12 @@ bool rfInit(void)
 {
   int err;
 
+  // hwInit() 에서 먼저 초기화되므로 key_protocol_init() 의 재호출은 건너뜀
+  if (is_init)
+  {
+    return true;
+  }
+
   qbufferCreate(&rf_rx_q, rf_rx_buf, RF_RX_BUF_LENGTH);
   k_mutex_init(&rf_rx_mutex);
 
@@ -74,6 +90,8 @@ bool rfInit(void)
   }
 #endif
 
+  is_init = true;
+
 #ifdef _USE_CLI_HW_RF
   cliAdd("rf", cliCmd);
 #endif
@@ -110,7 +128,10 @@ uint32_t rfWrite(uint8_t *p_data, uint32_t length)
   tx_payload.length = length;
 
   if (esb_write_payload(&tx_payload) == 0)
-  return length;
+  {
+    rf_tx_count++;
+    return length;
+  }
   else
   return 0;
 #else
@@ -118,6 +139,88 @@ uint32_t rfWrite(uint8_t *p_data, uint32_t length)
 #endif
 }
 
+bool rfSetTxPower(int8_t power)
+{
+  // ESB TX power 값은 dBm 단위 (RADIO TXPOWER 레지스터 값과 동일)
+  const int8_t power_tbl[] = {4, 0, -4, -8, -12, -16, -20};
+  bool is_valid = false;
+
+  for (int i=0; i<ARRAY_SIZE(power_tbl); i++)
+  {
+    if (power_tbl[i] == power)
+    {
+      is_valid = true;
+      break;
+    }
+  }
+  if (is_valid != true)
+  {
+    return false;
+  }
+  if (power == rf_tx_power)
+  {
+    return true;
+  }
+
+  // 전송 중이면 -EBUSY, 호출한 쪽에서 다음에 다시 시도
+  if (esb_set_tx_power(power) != 0)
+  {
+    return false;
+  }
+  rf_tx_power = power;
+  return true;
+}
+
+int8_t rfGetTxPower(void)
+{
+  return rf_tx_power;
+}
+
+bool rfSetRetransmitCount(uint16_t count)
+{
+  if (count == rf_retransmit_count)
+  {
+    return true;
+  }
+
+  // 전송 중이면 -EBUSY, 호출한 쪽에서 다음에 다시 시도
+  if (esb_set_retransmit_count(count) != 0)
+  {
+    return false;
+  }
+  rf_retransmit_count = count;
+  return true;
+}
+
+uint16_t rfGetRetransmitCount(void)
+{
+  return rf_retransmit_count;
+}
+
+uint32_t rfGetTxFailCount(void)
+{
+  return rf_tx_fail_count;
+}
+
+uint32_t rfGetTxCount(void)
+{
+  return rf_tx_count;
+}
+
+bool rfGetTxAckTime(uint32_t tx_count, uint32_t *p_time_us)
+{
+  unsigned int key;
+  bool ret;
+
+  // tx_count 번째 패킷이 마지막으로 ACK 를 받은 패킷일 때만 그 시간이 유효
+  key = irq_lock();
+  ret = (rf_tx_ack_count == tx_count);
+  *p_time_us = rf_tx_ack_time;
+  irq_unlock(key);
+
+  return ret;
+}
+
 uint32_t rfRead(uint8_t *p_data, uint32_t length)
 {
   uint32_t ret;
@@ -135,9 +238,14 @@ static void event_handler(struct esb_evt const *event)
   {
   case ESB_EVENT_TX_SUCCESS:
     LOG_DBG("TX SUCCESS EVENT");
+    rf_tx_ack_time = micros();
+    rf_tx_done_count++;
+    rf_tx_ack_count = rf_tx_done_count;
   break;
   case ESB_EVENT_TX_FAILED:
     esb_flush_tx(); // TX 큐 비우기
+    rf_tx_done_count = rf_tx_count;
+    rf_tx_fail_count++;
     LOG_DBG("TX FAILED EVENT");
   break;
   case ESB_EVENT_RX_RECEIVED:
@@ -219,6 +327,7 @@ static int esb_initialize(void)
   {
     return err;
   }
+  rf_retransmit_count = config.retransmit_count;
 
   err = esb_set_base_address_0(base_addr_0);
   if (err)
@@ -308,10 +417,20 @@ void cliCmd(cli_args_t *args)
   {
   cliPrintf("rf available: %d\n", rfAvailable());
   }
+  else if (args->argc == 1 && args->isStr(0, "power"))
+  {
+  cliPrintf("rf power %d dBm, tx fail %d\n", rfGetTxPower(), rfGetTxFailCount());
+  }
+  else if (args->argc == 2 && args->isStr(0, "power"))
+  {
+  int8_t power = (int8_t)args->getData(1);
+  cliPrintf("rf power %d dBm : %s\n", power, rfSetTxPower(power) ? "OK":"Fail");
+  }
   else
   {
   cliPrintf("rf tx\n");
   cliPrintf("rf rx\n");
+  cliPrintf("rf power [4:0:-4:-8:-12:-16:-20]\n");
   }
 }
 #endif
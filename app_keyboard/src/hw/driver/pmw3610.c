@@ -2,7 +2,9 @@
 #include "gpio.h"
 #include "spi.h"
 #include "bsp.h"
+#include "hw.h"
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
 
 LOG_MODULE_REGISTER(pmw3610, LOG_LEVEL_INF);
 /* Page 0 */
@@ -28,19 +30,21 @@ LOG_MODULE_REGISTER(pmw3610, LOG_LEVEL_INF);
 #define PMW3610_RES_STEP 0x05
 #define PMW3610_SPI_PAGE1 0x7f
 
-/* Burst register offsets */
-#define BURST_MOTION 0
-#define BURST_DELTA_X_L 1
-#define BURST_DELTA_Y_L 2
-#define BURST_DELTA_XY_H 3
-#define BURST_SQUAL 4
-#define BURST_SHUTTER_HI 5
-#define BURST_SHUTTER_LO 6
+/* Burst register offsets (SPI 수신 버퍼 기준, [0] 은 주소를 보내는 동안 받은 바이트) */
+#define BURST_MOTION 1
+#define BURST_DELTA_X_L 2
+#define BURST_DELTA_Y_L 3
+#define BURST_DELTA_XY_H 4
+#define BURST_SQUAL 5
+#define BURST_SHUTTER_HI 6
+#define BURST_SHUTTER_LO 7
 
 #define BURST_DATA_LEN_NORMAL (BURST_DELTA_XY_H + 1)
 #define BURST_DATA_LEN_SMART (BURST_SHUTTER_LO + 1)
 #define BURST_DATA_LEN_MAX MAX(BURST_DATA_LEN_NORMAL, BURST_DATA_LEN_SMART)
 
+BUILD_ASSERT(BURST_DATA_LEN_MAX <= PMW3610_BURST_SIZE, "PMW3610_BURST_SIZE too small");
+
 /* Init sequence values */
 #define OBSERVATION1_INIT_MASK 0x0f
 #define PERFORMANCE_INIT 0x0d
@@ -73,6 +77,7 @@ LOG_MODULE_REGISTER(pmw3610, LOG_LEVEL_INF);
 #define RESET_DELAY_MS 10
 #define INIT_OBSERVATION_DELAY_MS 100
 #define CLOCK_ON_DELAY_US 300
+#define CLOCK_OFF_DELAY_MS 20     // 마지막 레지스터 쓰기 후 SPI clock 을 끌 때까지 (이어지는 설정은 clock on 대기 없이 씀)
 
 #define RES_STEP 200
 #define RES_MIN 200
@@ -87,6 +92,7 @@ struct pmw3610_config
     bool invert_y;
     bool force_awake;
     bool smart_mode;
+    uint16_t smart_threshold;   // shutter 가 이보다 작으면(밝은 표면) smart mode 사용
 };
 
 // struct pmw3610_data
@@ -97,8 +103,38 @@ struct pmw3610_config
 //     bool smart_flag;
 // };
 
-static uint8_t pmw3610_tx_buffer[16] = {0};
-static uint8_t pmw3610_rx_buffer[16] = {0};
+/* Init sequence (k_work_delayable) */
+#define INIT_RETRY_MAX 3
+
+enum pmw3610_init_step
+{
+    PMW3610_INIT_RESET,
+    PMW3610_INIT_OBSERVATION,
+    PMW3610_INIT_CONFIGURE,
+};
+
+// 레지스터 설정(페이지 전환, clock on/off 포함)과 burst 읽기가 서로 끼어들지 않도록 잠근다
+// (페이지 1 로 바뀐 사이에 burst 를 읽으면 다른 레지스터를 읽게 됨)
+static struct k_mutex pmw3610_lock;
+static struct k_work_delayable pmw3610_clk_off_work;
+static bool is_clk_on = false;
+
+// RES_STEP 레지스터 값 (invert 비트 포함), 초기화 때 읽어 두고 해상도를 바꿀 때 다시 읽지 않는다
+static uint8_t res_step_reg = 0;
+// smart mode 레지스터 상태 (shutter 에 따라 켜고 끔)
+static bool is_smart_active = false;
+// smart mode 가 꺼져 있어도 burst 에서 SQUAL/shutter 까지 읽어 통계를 남김
+static bool is_telemetry = false;
+static pmw3610_stats_t pmw3610_stats;
+
+// burst 주소 (EasyDMA 는 RAM 에 있는 버퍼만 보낼 수 있으므로 const 로 두지 않는다)
+static uint8_t pmw3610_burst_addr = PMW3610_BURST_READ;
+
+// 리셋/관찰 대기 시간을 sleep 으로 막지 않고 워크큐에서 단계별로 진행
+static struct k_work_delayable pmw3610_init_work;
+static enum pmw3610_init_step pmw3610_init_step;
+static uint8_t pmw3610_init_retry = 0;
+static volatile bool is_ready = false;
 
 struct pmw3610_config pmw3610_cfg = {
     .axis_x = 0,
@@ -108,134 +144,213 @@ struct pmw3610_config pmw3610_cfg = {
     .invert_y = true,
     .force_awake = true,
     .smart_mode = false,
+    .smart_threshold = SHUTTER_SMART_THRESHOLD,
 };
 
-static int pmw3610_read(uint8_t addr, uint8_t *value, uint8_t len)
+static int pmw3610_read_reg(uint8_t addr, uint8_t *value)
 {
-    bool ret;
-    pmw3610_tx_buffer[0] = addr;
-    pmw3610_tx_buffer[1] = 0x00;
-    memset(pmw3610_rx_buffer, 0, sizeof(pmw3610_rx_buffer));
+    uint8_t tx_buf[1] = {addr};
+    uint8_t rx_buf[2];
 
-    ret = spiTransfer(HW_PMW3610_SPI_CH, pmw3610_tx_buffer, 1, pmw3610_rx_buffer, 1 + len, 1000);
+    if (!spiTransfer(HW_PMW3610_SPI_CH, tx_buf, 1, rx_buf, 2, 1000))
+    {
+        return -1;
+    }
+    *value = rx_buf[1];
+    return 0;
+}
+
+static int pmw3610_write_reg(uint8_t addr, uint8_t value)
+{
+    uint8_t tx_buf[2] = {addr | SPI_WRITE, value};
 
-    if (!ret)
+    if (!spiTransfer(HW_PMW3610_SPI_CH, tx_buf, 2, NULL, 0, 1000))
     {
         return -1;
     }
-    else
+    return 0;
+}
+
+// 레지스터를 쓰기 전에 호출, 쓰기가 끝나면 pmw3610_spi_clk_release()
+static int pmw3610_spi_clk_on(void)
+{
+    int ret;
+
+    k_work_cancel_delayable(&pmw3610_clk_off_work);
+    if (is_clk_on)
     {
-        memcpy(value, &pmw3610_rx_buffer[1], len);
         return 0;
     }
+
+    ret = pmw3610_write_reg(PMW3610_SPI_CLK_ON_REQ, SPI_CLOCK_ON_REQ_ON);
+    if (ret < 0)
+    {
+        return ret;
+    }
+
+    delay_us(CLOCK_ON_DELAY_US);
+    is_clk_on = true;
+
+    return 0;
 }
 
-static int pmw3610_read_reg(uint8_t addr, uint8_t *value)
+// clock 은 바로 끄지 않고 CLOCK_OFF_DELAY_MS 동안 다른 쓰기가 없으면 워크큐에서 끈다
+static void pmw3610_spi_clk_release(void)
 {
-    return pmw3610_read(addr, value, 1);
+    k_work_reschedule(&pmw3610_clk_off_work, K_MSEC(CLOCK_OFF_DELAY_MS));
 }
 
-static int pmw3610_write_reg(uint8_t addr, uint8_t value)
+static void pmw3610_clk_off_work_handler(struct k_work *work)
 {
-    bool ret;
-    pmw3610_tx_buffer[0] = addr | SPI_WRITE;
-    pmw3610_tx_buffer[1] = value;
-
-    ret = spiTransfer(HW_PMW3610_SPI_CH, pmw3610_tx_buffer, 2, pmw3610_rx_buffer, 0, 1000);
+    ARG_UNUSED(work);
 
-    if (!ret)
+    k_mutex_lock(&pmw3610_lock, K_FOREVER);
+    if (is_clk_on)
     {
-        return -1;
-    }
-    else
-    {
-        return 0;
+        pmw3610_write_reg(PMW3610_SPI_CLK_ON_REQ, SPI_CLOCK_ON_REQ_OFF);
+        is_clk_on = false;
     }
+    k_mutex_unlock(&pmw3610_lock);
 }
 
-static int pmw3610_spi_clk_on(void)
+static int pmw3610_set_smart_reg(bool enable)
 {
     int ret;
 
-    ret = pmw3610_write_reg(PMW3610_SPI_CLK_ON_REQ, SPI_CLOCK_ON_REQ_ON);
+    ret = pmw3610_spi_clk_on();
+    if (ret < 0)
+    {
+        return ret;
+    }
 
-    delay_us(CLOCK_ON_DELAY_US);
+    ret = pmw3610_write_reg(PMW3610_SMART_MODE, enable ? SMART_MODE_ENABLE : SMART_MODE_DISABLE);
+    pmw3610_spi_clk_release();
+    if (ret < 0)
+    {
+        return ret;
+    }
 
-    return ret;
+    if (is_smart_active != enable)
+    {
+        pmw3610_stats.smart_toggles++;
+    }
+    is_smart_active = enable;
+    return 0;
 }
 
-static int pmw3610_spi_clk_off(void)
+static void pmw3610_stats_update(const pmw3610_motion_t *p_motion, bool is_motion)
 {
-    return pmw3610_write_reg(PMW3610_SPI_CLK_ON_REQ, SPI_CLOCK_ON_REQ_OFF);
+    pmw3610_stats_t *p_stats = &pmw3610_stats;
+
+    if (p_stats->frames == 0 || p_motion->shutter < p_stats->shutter_min)
+    {
+        p_stats->shutter_min = p_motion->shutter;
+    }
+    p_stats->shutter_max = MAX(p_stats->shutter_max, p_motion->shutter);
+    p_stats->shutter_sum += p_motion->shutter;
+    p_stats->frames++;
+    if (is_smart_active)
+    {
+        p_stats->smart_frames++;
+    }
+
+    // SQUAL 은 표면을 보고 있을 때(움직일 때)의 값만 의미가 있다
+    if (is_motion)
+    {
+        if (p_stats->motion_frames == 0 || p_motion->squal < p_stats->squal_min)
+        {
+            p_stats->squal_min = p_motion->squal;
+        }
+        p_stats->squal_max = MAX(p_stats->squal_max, p_motion->squal);
+        p_stats->squal_sum += p_motion->squal;
+        p_stats->motion_frames++;
+    }
 }
 
+// shutter 가 threshold 보다 작으면(밝은 표면) smart mode 를 켜고, 크면 끈다
+static void pmw3610_smart_update(uint16_t shutter)
+{
+    if (!is_smart_active && shutter < pmw3610_cfg.smart_threshold)
+    {
+        pmw3610_set_smart_reg(true);
+    }
+    else if (is_smart_active && shutter > pmw3610_cfg.smart_threshold)
+    {
+        pmw3610_set_smart_reg(false);
+    }
+}
 
-bool pmw3610_motion_read(int32_t* x_out, int32_t* y_out)
+// SPI 로 받은 burst 데이터를 복사 없이 p_motion->burst 에 바로 받는다
+bool pmw3610_motion_burst(pmw3610_motion_t *p_motion)
 {
-	const struct pmw3610_config *cfg = &pmw3610_cfg;
-	uint8_t burst_data[BURST_DATA_LEN_MAX];
-	uint8_t burst_data_len;
-	int32_t x, y;
-	int ret;
-
-	if (cfg->smart_mode) {
-		burst_data_len = BURST_DATA_LEN_SMART;
-	} else {
-		burst_data_len = BURST_DATA_LEN_NORMAL;
-	}
-
-	ret = pmw3610_read(PMW3610_BURST_READ, burst_data, burst_data_len);
-	if (ret < 0) {
-		return false;
-	}
-    //motion reset
-    // pmw3610_write_reg(PMW3610_MOTION, 0);
-
-	if ((burst_data[BURST_MOTION] & MOTION_STATUS_MOTION) == 0x00) {
-		return false;
-	}
-
-	x = ((burst_data[BURST_DELTA_XY_H] << 4) & 0xf00) | burst_data[BURST_DELTA_X_L];
-	y = ((burst_data[BURST_DELTA_XY_H] << 8) & 0xf00) | burst_data[BURST_DELTA_Y_L];
-
-	x = sign_extend(x, PMW3610_DATA_SIZE_BITS - 1);
-	y = sign_extend(y, PMW3610_DATA_SIZE_BITS - 1);
-
-    *x_out = x;
-    *y_out = y;
-    
-    
-    
+    const struct pmw3610_config *cfg = &pmw3610_cfg;
+    uint8_t *burst = p_motion->burst;
+    bool is_shutter = cfg->smart_mode || is_telemetry;
+    bool is_motion;
+    int32_t x, y;
+    bool ret;
 
-    return true;
+    if (!is_ready)
+    {
+        return false;
+    }
 
-	// if (cfg->smart_mode) {
-	// 	uint16_t shutter_val = sys_get_be16(&burst_data[BURST_SHUTTER_HI]);
+    spi_xfer_t xfer = {
+        .tx_buf    = &pmw3610_burst_addr,
+        .tx_length = 1,
+        .rx_buf    = burst,
+        .rx_length = is_shutter ? BURST_DATA_LEN_SMART : BURST_DATA_LEN_NORMAL,
+        .cs_pin    = SPI_PIN_NONE,
+        .dc_pin    = SPI_PIN_NONE,
+    };
+
+    k_mutex_lock(&pmw3610_lock, K_FOREVER);
+    ret = spiXfer(HW_PMW3610_SPI_CH, &xfer, 1, 1000);
+    is_motion = ret && (burst[BURST_MOTION] & MOTION_STATUS_MOTION) != 0x00;
+    if (ret && is_shutter)
+    {
+        p_motion->squal   = burst[BURST_SQUAL];
+        p_motion->shutter = sys_get_be16(&burst[BURST_SHUTTER_HI]);
+        pmw3610_stats_update(p_motion, is_motion);
+        if (cfg->smart_mode)
+        {
+            pmw3610_smart_update(p_motion->shutter);
+        }
+    }
+    else
+    {
+        p_motion->squal   = 0;
+        p_motion->shutter = 0;
+    }
+    k_mutex_unlock(&pmw3610_lock);
+
+    if (!is_motion)
+    {
+        return false;
+    }
 
-	// 	if (data->smart_flag && shutter_val < SHUTTER_SMART_THRESHOLD) {
-	// 		pmw3610_spi_clk_on();
+    x = ((burst[BURST_DELTA_XY_H] << 4) & 0xf00) | burst[BURST_DELTA_X_L];
+    y = ((burst[BURST_DELTA_XY_H] << 8) & 0xf00) | burst[BURST_DELTA_Y_L];
 
-	// 		ret = pmw3610_write_reg(PMW3610_SMART_MODE, SMART_MODE_ENABLE);
-	// 		if (ret < 0) {
-	// 			return;
-	// 		}
+    p_motion->x = sign_extend(x, PMW3610_DATA_SIZE_BITS - 1);
+    p_motion->y = sign_extend(y, PMW3610_DATA_SIZE_BITS - 1);
 
-	// 		pmw3610_spi_clk_off(dev);
+    return true;
+}
 
-	// 		data->smart_flag = false;
-	// 	} else if (!data->smart_flag && shutter_val > SHUTTER_SMART_THRESHOLD) {
-	// 		pmw3610_spi_clk_on();
+bool pmw3610_motion_read(int32_t* x_out, int32_t* y_out)
+{
+    pmw3610_motion_t motion;
 
-	// 		ret = pmw3610_write_reg(PMW3610_SMART_MODE, SMART_MODE_DISABLE);
-	// 		if (ret < 0) {
-	// 			return;
-	// 		}
+    if (!pmw3610_motion_burst(&motion))
+    {
+        return false;
+    }
 
-	// 		pmw3610_spi_clk_off(dev);
+    *x_out = motion.x;
+    *y_out = motion.y;
 
-	// 		data->smart_flag = true;
-	// 	}
-	// }
+    return true;
 }
 
 
@@ -313,7 +428,7 @@ bool pmw3610_motion_read(int32_t* x_out, int32_t* y_out)
 // 	k_work_submit(&data->motion_work);
 // }
 
-int pmw3610_set_resolution(uint16_t res_cpi)
+static int pmw3610_set_resolution(uint16_t res_cpi)
 {
     uint8_t val;
     int ret;
@@ -333,40 +448,30 @@ int pmw3610_set_resolution(uint16_t res_cpi)
     ret = pmw3610_write_reg(PMW3610_SPI_PAGE0, SPI_PAGE0_1);
     if (ret < 0)
     {
-        return ret;
-    }
-
-    ret = pmw3610_read_reg(PMW3610_RES_STEP, &val);
-    if (ret < 0)
-    {
-        return ret;
+        goto out;
     }
 
-    val &= ~RES_STEP_RES_MASK;
+    val = res_step_reg & ~RES_STEP_RES_MASK;
     val |= res_cpi / RES_STEP;
 
     ret = pmw3610_write_reg(PMW3610_RES_STEP, val);
-    if (ret < 0)
+    if (ret == 0)
     {
-        return ret;
+        res_step_reg = val;
     }
 
-    ret = pmw3610_write_reg(PMW3610_SPI_PAGE1, SPI_PAGE1_0);
-    if (ret < 0)
-    {
-        return ret;
-    }
-
-    ret = pmw3610_spi_clk_off();
-    if (ret < 0)
+    // 쓰기가 실패해도 페이지는 0 으로 돌린다
+    if (pmw3610_write_reg(PMW3610_SPI_PAGE1, SPI_PAGE1_0) < 0)
     {
-        return ret;
+        ret = -1;
     }
 
-    return 0;
+out:
+    pmw3610_spi_clk_release();
+    return ret;
 }
 
-int pmw3610_force_awake(bool enable)
+static int pmw3610_force_awake(bool enable)
 {
     uint8_t val;
     int ret;
@@ -394,26 +499,141 @@ int pmw3610_force_awake(bool enable)
     }
 
     ret = pmw3610_write_reg(PMW3610_PERFORMANCE, val);
-    if (ret < 0)
+    pmw3610_spi_clk_release();
+
+    return ret;
+}
+
+bool pmw3610_set_force_awake(bool enable)
+{
+    bool ret = true;
+
+    k_mutex_lock(&pmw3610_lock, K_FOREVER);
+    // 초기화 중이면 설정만 바꿔두고 초기화 마지막 단계에서 적용
+    if (is_ready && pmw3610_force_awake(enable) < 0)
     {
-        return ret;
+        ret = false;
+    }
+    if (ret)
+    {
+        pmw3610_cfg.force_awake = enable;
     }
+    k_mutex_unlock(&pmw3610_lock);
 
-    ret = pmw3610_spi_clk_off();
-    if (ret < 0)
+    return ret;
+}
+
+bool pmw3610_get_force_awake(void)
+{
+    return pmw3610_cfg.force_awake;
+}
+
+bool pmw3610_set_cpi(uint16_t cpi)
+{
+    bool ret = true;
+
+    if (!IN_RANGE(cpi, RES_MIN, RES_MAX))
     {
-        return ret;
+        return false;
     }
+    cpi = cpi / RES_STEP * RES_STEP;
 
-    return 0;
+    k_mutex_lock(&pmw3610_lock, K_FOREVER);
+    if (is_ready && pmw3610_set_resolution(cpi) < 0)
+    {
+        ret = false;
+    }
+    if (ret)
+    {
+        pmw3610_cfg.res_cpi = cpi;
+    }
+    k_mutex_unlock(&pmw3610_lock);
+
+    return ret;
 }
 
-static int pmw3610_configure(void)
+uint16_t pmw3610_get_cpi(void)
+{
+    return pmw3610_cfg.res_cpi;
+}
+
+bool pmw3610_set_smart_mode(bool enable, uint16_t threshold)
+{
+    bool ret = true;
+
+    k_mutex_lock(&pmw3610_lock, K_FOREVER);
+    pmw3610_cfg.smart_mode = enable;
+    pmw3610_cfg.smart_threshold = threshold;
+    // 끄면 레지스터도 바로 되돌리고, 켜면 다음 burst 의 shutter 로 판단
+    if (is_ready && !enable && is_smart_active && pmw3610_set_smart_reg(false) < 0)
+    {
+        ret = false;
+    }
+    k_mutex_unlock(&pmw3610_lock);
+
+    return ret;
+}
+
+bool pmw3610_get_smart_mode(uint16_t *p_threshold)
+{
+    if (p_threshold != NULL)
+    {
+        *p_threshold = pmw3610_cfg.smart_threshold;
+    }
+    return pmw3610_cfg.smart_mode;
+}
+
+bool pmw3610_set_telemetry(bool enable)
+{
+    k_mutex_lock(&pmw3610_lock, K_FOREVER);
+    is_telemetry = enable;
+    k_mutex_unlock(&pmw3610_lock);
+
+    return true;
+}
+
+void pmw3610_get_stats(pmw3610_stats_t *p_stats)
+{
+    k_mutex_lock(&pmw3610_lock, K_FOREVER);
+    *p_stats = pmw3610_stats;
+    k_mutex_unlock(&pmw3610_lock);
+}
+
+void pmw3610_clear_stats(void)
+{
+    k_mutex_lock(&pmw3610_lock, K_FOREVER);
+    memset(&pmw3610_stats, 0, sizeof(pmw3610_stats));
+    k_mutex_unlock(&pmw3610_lock);
+}
+
+bool pmw3610_is_ready(void)
+{
+    return is_ready;
+}
+
+// System OFF 진입 전 센서 전원 차단 (깨어날 때는 리셋 후 pmw3610_init() 로 재설정됨)
+bool pmw3610_shutdown(void)
+{
+    bool ret;
+
+    k_mutex_lock(&pmw3610_lock, K_FOREVER);
+    k_work_cancel_delayable(&pmw3610_clk_off_work);
+    ret = pmw3610_write_reg(PMW3610_SHUTDOWN, SHUTDOWN_ENABLE) == 0;
+    is_clk_on = false;
+    k_mutex_unlock(&pmw3610_lock);
+
+    return ret;
+}
+
+static int pmw3610_init_reset(void)
 {
-    const struct pmw3610_config *cfg = &pmw3610_cfg;
-    uint8_t val;
     int ret;
 
+    // 리셋되면 센서 클럭/스마트 모드 상태도 초기값으로 돌아감
+    k_work_cancel_delayable(&pmw3610_clk_off_work);
+    is_clk_on = false;
+    is_smart_active = false;
+
     // if (cfg->reset_gpio.port != NULL)
     // {
     //     if (!gpio_is_ready_dt(&cfg->reset_gpio))
@@ -446,10 +666,17 @@ static int pmw3610_configure(void)
     {
         return ret;
     }
-
-    delay(RESET_DELAY_MS);
     // }
 
+    /* RESET_DELAY_MS 후 pmw3610_init_observation() */
+    return 0;
+}
+
+static int pmw3610_init_observation(void)
+{
+    uint8_t val;
+    int ret;
+
     ret = pmw3610_read_reg(PMW3610_PROD_ID, &val);
     if (ret < 0)
     {
@@ -475,7 +702,15 @@ static int pmw3610_configure(void)
         return ret;
     }
 
-    k_sleep(K_MSEC(INIT_OBSERVATION_DELAY_MS));
+    /* INIT_OBSERVATION_DELAY_MS 후 pmw3610_init_configure() */
+    return 0;
+}
+
+static int pmw3610_init_configure(void)
+{
+    const struct pmw3610_config *cfg = &pmw3610_cfg;
+    uint8_t val;
+    int ret;
 
     ret = pmw3610_read_reg(PMW3610_OBSERVATION1, &val);
     if (ret < 0)
@@ -524,43 +759,47 @@ static int pmw3610_configure(void)
 
     /* Configuration */
 
-    if (cfg->invert_x || cfg->invert_y)
+    // RES_STEP 은 CPI 변경 때마다 다시 읽지 않도록 여기서 캐시해 둠
+    ret = pmw3610_write_reg(PMW3610_SPI_PAGE0, SPI_PAGE0_1);
+    if (ret < 0)
     {
-        ret = pmw3610_write_reg(PMW3610_SPI_PAGE0, SPI_PAGE0_1);
-        if (ret < 0)
-        {
-            return ret;
-        }
+        return ret;
+    }
 
-        ret = pmw3610_read_reg(PMW3610_RES_STEP, &val);
-        if (ret < 0)
-        {
-            return ret;
-        }
+    ret = pmw3610_read_reg(PMW3610_RES_STEP, &val);
+    if (ret < 0)
+    {
+        return ret;
+    }
 
-        WRITE_BIT(val, RES_STEP_INV_X_BIT, cfg->invert_x);
-        WRITE_BIT(val, RES_STEP_INV_Y_BIT, cfg->invert_y);
+    WRITE_BIT(val, RES_STEP_INV_X_BIT, cfg->invert_x);
+    WRITE_BIT(val, RES_STEP_INV_Y_BIT, cfg->invert_y);
 
-        ret = pmw3610_write_reg(PMW3610_RES_STEP, val);
-        if (ret < 0)
-        {
-            return ret;
-        }
+    ret = pmw3610_write_reg(PMW3610_RES_STEP, val);
+    if (ret < 0)
+    {
+        return ret;
+    }
+    res_step_reg = val;
+
+    ret = pmw3610_write_reg(PMW3610_SPI_PAGE1, SPI_PAGE1_0);
+    if (ret < 0)
+    {
+        return ret;
+    }
 
-        ret = pmw3610_write_reg(PMW3610_SPI_PAGE1, SPI_PAGE1_0);
+    if (cfg->smart_mode)
+    {
+        ret = pmw3610_set_smart_reg(false);
         if (ret < 0)
         {
             return ret;
         }
     }
 
-    ret = pmw3610_spi_clk_off();
-    if (ret < 0)
-    {
-        return ret;
-    }
+    pmw3610_spi_clk_release();
 
-    /* The remaining functions call spi_clk_on/off independently. */
+    /* The remaining functions call spi_clk_on/release independently. */
 
     if (cfg->res_cpi > 0)
     {
@@ -572,12 +811,62 @@ static int pmw3610_configure(void)
     return 0;
 }
 
+static void pmw3610_init_work_handler(struct k_work *work)
+{
+    uint32_t next_delay_ms = 0;
+    int ret = -EINVAL;
+
+    ARG_UNUSED(work);
+
+    k_mutex_lock(&pmw3610_lock, K_FOREVER);
+
+    switch (pmw3610_init_step)
+    {
+    case PMW3610_INIT_RESET:
+        ret = pmw3610_init_reset();
+        pmw3610_init_step = PMW3610_INIT_OBSERVATION;
+        next_delay_ms = RESET_DELAY_MS;
+        break;
+
+    case PMW3610_INIT_OBSERVATION:
+        ret = pmw3610_init_observation();
+        pmw3610_init_step = PMW3610_INIT_CONFIGURE;
+        next_delay_ms = INIT_OBSERVATION_DELAY_MS;
+        break;
+
+    case PMW3610_INIT_CONFIGURE:
+        ret = pmw3610_init_configure();
+        if (ret == 0)
+        {
+            is_ready = true;
+            k_mutex_unlock(&pmw3610_lock);
+            hwSetReady(HW_READY_SENSOR);
+            return;
+        }
+        break;
+    }
+
+    k_mutex_unlock(&pmw3610_lock);
+
+    if (ret < 0)
+    {
+        if (pmw3610_init_retry >= INIT_RETRY_MAX)
+        {
+            LOG_ERR("Device configuration failed: %d", ret);
+            return;
+        }
+        pmw3610_init_retry++;
+        pmw3610_init_step = PMW3610_INIT_RESET;
+        next_delay_ms = RESET_DELAY_MS;
+    }
+
+    k_work_schedule(&pmw3610_init_work, K_MSEC(next_delay_ms));
+}
+
 bool pmw3610_init(void)
 {
     // const struct pmw3610_config *cfg = &pmw3610_cfg;
 
-    int ret;
-
     // if (!spi_is_ready_dt(&cfg->spi))
     // {
     //     LOG_ERR("%s is not ready", cfg->spi.bus->name);
@@ -611,12 +900,14 @@ bool pmw3610_init(void)
     //     return ret;
     // }
 
-    ret = pmw3610_configure();
-    if (ret != 0)
-    {
-        LOG_ERR("Device configuration failed: %d", ret);
-        return false;
-    }
+    // 리셋 이후 단계는 워크큐에서 진행되며 완료되면 HW_READY_SENSOR 설정
+    is_ready = false;
+    pmw3610_init_retry = 0;
+    k_mutex_init(&pmw3610_lock);
+    k_work_init_delayable(&pmw3610_clk_off_work, pmw3610_clk_off_work_handler);
+    pmw3610_init_step = PMW3610_INIT_RESET;
+    k_work_init_delayable(&pmw3610_init_work, pmw3610_init_work_handler);
+    k_work_schedule(&pmw3610_init_work, K_NO_WAIT);
 
     // ret = gpio_pin_interrupt_configure_dt(&cfg->motion_gpio,
     //                                       GPIO_INT_EDGE_TO_ACTIVE);
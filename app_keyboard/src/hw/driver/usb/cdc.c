@@ -1,6 +1,8 @@
 #include "cdc.h"
 #include "qbuffer.h"
 
+#ifdef _USE_HW_CDC
+
 #include <zephyr/device.h>
 #include <zephyr/drivers/uart.h>
 #include <zephyr/kernel.h>
@@ -192,4 +194,6 @@ uint32_t cdcWrite(uint8_t *p_data, uint32_t length)
 uint32_t cdcGetBaud(void)
 {
   return 115200;
-}
\ No newline at end of file
+}
+
+#endif
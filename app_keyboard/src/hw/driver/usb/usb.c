@@ -4,6 +4,7 @@
 // #include "usb_hid/usbd_hid.h"
 #include "cdc.h"
 #include "cli.h"
+#include "hw.h"
 
 #include <zephyr/kernel.h>
 #include <zephyr/device.h>
@@ -45,6 +46,7 @@ static void hid_status_cb(enum usb_dc_status_code status, const uint8_t *param)
     usb_configured = true;
     usb_suspended = false;
     k_sem_give(&usb_setting_sema);
+    hwSetReady(HW_READY_USB);
     LOG_INF("USB device configured");
     break;
   case USB_DC_DISCONNECTED:
@@ -127,11 +129,9 @@ bool usbInit(void)
 {
   bool ret = false;
   ret |= cdcInit();
-  k_msleep(500); // 하드웨어 안정화 대기
   // ret |= usbHidInit();
   is_init = ret;
-  // USB 활성화 (지연된 초기화)
-  // k_msleep(500); // 하드웨어 안정화 대기
+  // enumeration 완료는 기다리지 않음 (USB_DC_CONFIGURED 에서 HW_READY_USB 설정)
   ret = usb_enable(hid_status_cb);
   if (ret != 0)
   {
@@ -140,7 +140,6 @@ bool usbInit(void)
   }
 
   LOG_INF("HID device ready");
-  // k_msleep(1000);
   k_thread_create(&usb_thread_data, usb_thread_stack,
                   K_THREAD_STACK_SIZEOF(usb_thread_stack),
                   usb_thread_func,
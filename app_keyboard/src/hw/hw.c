@@ -1,8 +1,31 @@
 #include "hw.h"
+#include <zephyr/kernel.h>
 
 static void bootMsg(void);
+#ifdef _USE_HW_CLI
+static void cliBoot(cli_args_t *args);
+#endif
 
 
+// 고정 delay 대신 각 초기화 단계의 완료를 이벤트로 알리고, 필요한 쪽에서만 기다린다
+static K_EVENT_DEFINE(hw_ready_event);
+
+static uint32_t hw_ready_time[HW_READY_MAX];
+static uint32_t boot_ready_time = 0;
+static uint32_t first_key_time  = 0;
+
+#ifdef _USE_HW_CLI
+static const char *hw_ready_name[HW_READY_MAX] =
+{
+  "rf",
+  "usb",
+  "eeprom",
+  "keys",
+  "sensor",
+  "lcd",
+  "ap",
+};
+#endif
 
 
 bool hwInit(void)
@@ -11,13 +34,17 @@ bool hwInit(void)
 
   
 
+#ifdef _USE_HW_CLI
   cliInit();
+#endif
   // logInit();
   gpioInit();
   gpioPinWrite(HW_GPIO_VCC_ON, _DEF_HIGH);
 
+#ifdef _USE_HW_UART
   uartInit();
   uartOpen(_DEF_UART1, 115200);
+#endif
   // cliOpen(_DEF_UART1, 115200);
 
   // logOpen(HW_LOG_CH, 115200);
@@ -33,25 +60,82 @@ bool hwInit(void)
   // logPrintf("Free Heapi: %d KB\n", esp_get_free_internal_heap_size()/1024);
 
   // adcInit();
-  // batteryInit();
+  batteryInit();
   // i2cInit();
   spiInit();
 
+  // 센서 리셋/관찰 대기는 워크큐에서 진행되고 완료되면 HW_READY_SENSOR 설정
   pmw3610_init();
   
-  eepromInit();
-  rfInit();
-  keysInit();
-  // delay(100);
+  if (eepromInit())
+    hwSetReady(HW_READY_EEPROM);
+  if (rfInit())
+    hwSetReady(HW_READY_RF);
+  if (keysInit())
+    hwSetReady(HW_READY_KEYS);
+#ifdef _USE_HW_USB
   usbInit();
+#endif
   
-  // delay(100);
   // bleInit();
 
+#ifdef _USE_HW_CLI
+  cliAdd("boot", cliBoot);
+#endif
 
   return true;
 }
 
+void hwSetReady(uint32_t ready_bits)
+{
+  uint32_t cur_time = millis();
+  uint32_t pre_bits;
+  uint32_t new_bits;
+
+  pre_bits = k_event_post(&hw_ready_event, ready_bits);
+  new_bits = ready_bits & ~pre_bits;
+
+  for (int i=0; i<HW_READY_MAX; i++)
+  {
+    if (new_bits & (1U << i))
+    {
+      hw_ready_time[i] = cur_time;
+    }
+  }
+
+  if ((pre_bits & HW_BOOT_READY_MASK) != HW_BOOT_READY_MASK &&
+      ((pre_bits | ready_bits) & HW_BOOT_READY_MASK) == HW_BOOT_READY_MASK)
+  {
+    boot_ready_time = cur_time;
+    logPrintf("[%s] Boot Ready : %d ms\n", boot_ready_time <= HW_BOOT_TARGET_MS ? "OK":"E_", boot_ready_time);
+  }
+}
+
+bool hwWaitReady(uint32_t ready_bits, uint32_t timeout_ms)
+{
+  uint32_t ret;
+
+  ret = k_event_wait_all(&hw_ready_event, ready_bits, false,
+                         timeout_ms == HW_WAIT_FOREVER ? K_FOREVER : K_MSEC(timeout_ms));
+
+  return (ret & ready_bits) == ready_bits;
+}
+
+uint32_t hwGetReady(void)
+{
+  return k_event_test(&hw_ready_event, 0xFFFFFFFF);
+}
+
+void hwSetFirstKey(void)
+{
+  if (first_key_time != 0)
+  {
+    return;
+  }
+  first_key_time = millis();
+  logPrintf("[  ] First Key  : %d ms\n", first_key_time);
+}
+
 void bootMsg(void)
 {
   // logPrintf("\r\n[ ESP32-S3 Info ]\r\n");
@@ -80,3 +164,32 @@ void bootMsg(void)
   // logPrintf("Free Heapi: %d KB\n", esp_get_free_internal_heap_size()/1024);
   // logPrintf("CPU Freq  : %lu Mhz\n", bspGetCpuFreqMhz());
 }
+
+#ifdef _USE_HW_CLI
+void cliBoot(cli_args_t *args)
+{
+  bool ret = false;
+
+
+  if (args->argc == 1 && args->isStr(0, "info"))
+  {
+    uint32_t ready_bits = hwGetReady();
+
+    for (int i=0; i<HW_READY_MAX; i++)
+    {
+      if (ready_bits & (1U << i))
+        cliPrintf("%-8s : %d ms\n", hw_ready_name[i], hw_ready_time[i]);
+      else
+        cliPrintf("%-8s : -\n", hw_ready_name[i]);
+    }
+    cliPrintf("boot     : %d ms (target %d ms)\n", boot_ready_time, HW_BOOT_TARGET_MS);
+    cliPrintf("1st key  : %d ms\n", first_key_time);
+    ret = true;
+  }
+
+  if (ret == false)
+  {
+    cliPrintf("boot info\n");
+  }
+}
+#endif
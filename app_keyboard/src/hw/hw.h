@@ -19,15 +19,47 @@ extern "C" {
 #include "keys.h"
 #include "myrf.h"
 // #include "adc.h"
-// #include "battery.h"
+#include "battery.h"
 #include "driver/usb/usb.h"
 #include "gpio.h"
 // #include "driver/ble/ble.h"
 #include "spi.h"
 #include "sensor/pmw3610.h"
 
+
+// 초기화 단계별 준비 완료 이벤트
+#define HW_READY_RF         (1U << 0)
+#define HW_READY_USB        (1U << 1)   // USB configured (호스트 enumeration 완료)
+#define HW_READY_EEPROM     (1U << 2)
+#define HW_READY_KEYS       (1U << 3)
+#define HW_READY_SENSOR     (1U << 4)
+#define HW_READY_LCD        (1U << 5)
+#define HW_READY_AP         (1U << 6)   // 어플리케이션(QMK/프로토콜) 초기화 완료
+#define HW_READY_MAX        7
+
+#define HW_WAIT_FOREVER     0xFFFFFFFF
+
+
 bool hwInit(void);
 
+/**
+ * @brief 초기화 단계 완료를 알림
+ * @note  HW_BOOT_READY_MASK 가 모두 채워지는 시점을 부팅 완료 시간으로 기록
+ */
+void     hwSetReady(uint32_t ready_bits);
+
+/**
+ * @brief 지정한 단계들이 모두 준비될 때까지 대기
+ * @return timeout 전에 준비되면 true
+ */
+bool     hwWaitReady(uint32_t ready_bits, uint32_t timeout_ms);
+uint32_t hwGetReady(void);
+
+/**
+ * @brief 첫 키 입력 시점 기록 (최초 1회만 기록)
+ */
+void     hwSetFirstKey(void);
+
 
 #ifdef __cplusplus
 }
@@ -7,6 +7,13 @@
 #include "ap/config.h"
 
 
+// 디버그 빌드(prj.conf)에서만 USB CDC, CLI, LOG 를 사용
+// 릴리즈 빌드(prj_release.conf)는 USB 스택이 빠지므로 관련 모듈도 같이 제외
+#ifdef CONFIG_USB_DEVICE_STACK
+#define _HW_DEF_DEBUG_BUILD
+#endif
+
+
 // #define _HW_DEF_RTOS_THREAD_PRI_CLI           5
 // #define _HW_DEF_RTOS_THREAD_PRI_QMK           5
 // #define _HW_DEF_RTOS_THREAD_PRI_KEYS          5
@@ -24,12 +31,17 @@
 
 // #define _USE_HW_RTOS
 // #define _USE_HW_NVS
+#ifdef _HW_DEF_DEBUG_BUILD
 #define _USE_HW_USB
+#endif
 #define _USE_HW_EEPROM
 #define _USE_HW_RESET
 // #define _USE_HW_BLE
 // #define _USE_HW_BLE_HID
-// #define _USE_HW_BATTERY
+#define _USE_HW_BATTERY
+#define      HW_BATTERY_SAMPLE_MS       (60*1000)   // 배터리 측정 주기
+#define      HW_BATTERY_ADC_DIVIDER     5           // SAADC VDDH/5 입력
+#ifdef _HW_DEF_DEBUG_BUILD
 #define _USE_HW_CDC
 #define      HW_CDC_RX_BUFFER_SIZE      128
 
@@ -51,6 +63,7 @@
 #define      HW_LOG_CH              _DEF_UART1
 #define      HW_LOG_BOOT_BUF_MAX    1024
 #define      HW_LOG_LIST_BUF_MAX    1024
+#endif
 
 // #define _USE_HW_I2C
 // #define      HW_I2C_MAX_CH          1
@@ -75,17 +88,24 @@
 
 //-- CLI
 //
+#ifdef _USE_HW_CLI
 // #define _USE_CLI_HW_EEPROM          1
 // #define _USE_CLI_HW_I2C             1
 #define _USE_CLI_HW_KEYS            1
 #define _USE_CLI_HW_RF              1
 #define _USE_CLI_SPI                1   
+#endif
 
 
 // Drivers
 #define _USE_HW_PMW3610
 #define     HW_PMW3610_SPI_CH        _DEF_SPI1
 
+// 부팅 시간 (전원 인가 -> RF 송신 + 키 스캔 준비)
+#define HW_BOOT_READY_MASK          (HW_READY_RF | HW_READY_KEYS | HW_READY_AP)
+#define HW_BOOT_TARGET_MS           200
+
+
 #define __WEAK                      __attribute__((weak))
 
 
@@ -25,10 +25,10 @@ int main(void) {
         //     send_mouse_report();
         // }
         
-        k_msleep(10);
-        
-        // 어플리케이션 메인 처리
+        // 어플리케이션 메인 처리 (부팅 직후 바로 시작)
         apMain();
+
+        k_msleep(10);
     }
 
     return 0;
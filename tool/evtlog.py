@@ -0,0 +1,197 @@
+#!/usr/bin/env python3
+"""
+동글 바이너리 이벤트 로그(evtlog) 디코더
+
+  # CDC 포트에서 바로 읽기 (스트림을 켜는 명령을 같이 보냄)
+  python tool/evtlog.py /dev/ttyACM0 --send "evt stream on"
+
+  # 저장해 둔 로그 / sim 출력
+  python tool/evtlog.py capture.bin
+  ./build_sim/dongle_sim app_dongle/sim/scenario/evtlog.txt | python tool/evtlog.py - --text
+
+프레임 : sync(0xE5 0x7E) + seq(4) + time_us(4) + id(2) + a0(2) + a1(4) + xor(1), little endian
+이벤트 이름과 인자 형식은 evtlog.h 의 EVTLOG_ID_LIST 를 읽어서 사용하므로
+펌웨어에 이벤트를 추가해도 이 파일은 고치지 않는다.
+CLI 출력 등 프레임이 아닌 바이트는 건너뛰고 (--text 면 그대로 출력) 다음 sync 에서 다시 맞춘다.
+
+외부 패키지 없이 표준 라이브러리만 사용한다.
+"""
+import argparse
+import os
+import re
+import struct
+import sys
+
+
+SYNC = b"\xE5\x7E"
+FRAME_SIZE = 19
+
+DEFAULT_HEADER = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                              "..", "app_dongle", "src", "common", "hw", "include", "evtlog.h")
+
+
+def load_events(path):
+    """EVTLOG_ID_LIST 의 X(이름, id, "형식") 항목 -> {id: (이름, 형식)}"""
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    events = {}
+    for name, ev_id, fmt in re.findall(r'X\(\s*(EVT_\w+)\s*,\s*(0x[0-9A-Fa-f]+|\d+)\s*,\s*"([^"]*)"\s*\)', text):
+        events[int(ev_id, 0)] = (name, fmt)
+    if not events:
+        sys.exit(f"{path}: EVTLOG_ID_LIST 를 찾지 못함")
+    return events
+
+
+def format_args(fmt, a0, a1):
+    if not fmt:
+        return ""
+    fields = {
+        "a0": a0, "a0h": a0 >> 8, "a0l": a0 & 0xFF,
+        "a1": a1, "a1h": a1 >> 16, "a1l": a1 & 0xFFFF,
+        "a1s": a1 - (1 << 32) if a1 & 0x80000000 else a1,
+    }
+    try:
+        return fmt.format(**fields)
+    except (KeyError, ValueError, IndexError):
+        return f"a0=0x{a0:04X} a1=0x{a1:08X}"
+
+
+class Decoder:
+    def __init__(self, events, out, text=False, csv=False):
+        self.events = events
+        self.out = out
+        self.text = text
+        self.csv = csv
+        self.buf = bytearray()
+        self.line = bytearray()
+        self.last_seq = None
+        self.last_us = None
+        self.frames = 0
+        self.lost = 0
+        self.bad = 0
+        self.count = {}
+        if csv:
+            self.out.write("seq,time_us,name,a0,a1,args\n")
+
+    def feed(self, data):
+        self.buf += data
+        while True:
+            pos = self.buf.find(SYNC)
+            if pos < 0:
+                # 마지막 바이트가 sync 의 앞부분일 수 있으므로 남겨 둔다
+                keep = 1 if self.buf[-1:] == SYNC[:1] else 0
+                self.skip(len(self.buf) - keep)
+                return
+            if pos > 0:
+                self.skip(pos)
+            if len(self.buf) < FRAME_SIZE:
+                return
+            frame = bytes(self.buf[:FRAME_SIZE])
+            xor = 0
+            for b in frame[2:-1]:
+                xor ^= b
+            if xor != frame[-1]:
+                # sync 처럼 보이는 텍스트나 CLI 출력이 끼어든 프레임 : 1바이트만 넘기고 다시 찾음
+                self.bad += 1
+                self.skip(1)
+                continue
+            del self.buf[:FRAME_SIZE]
+            self.record(*struct.unpack("<IIHHI", frame[2:-1]))
+
+    def skip(self, n):
+        if n <= 0:
+            return
+        if self.text:
+            for b in self.buf[:n]:
+                if b == 0x0A:
+                    self.out.write("| " + self.line.decode("utf-8", "replace").rstrip("\r") + "\n")
+                    self.line.clear()
+                else:
+                    self.line.append(b)
+        del self.buf[:n]
+
+    def record(self, seq, time_us, ev_id, a0, a1):
+        name, fmt = self.events.get(ev_id, (f"EVT_0x{ev_id:04X}", ""))
+        if ev_id in self.events:
+            args = format_args(fmt, a0, a1)
+        else:
+            args = f"a0=0x{a0:04X} a1=0x{a1:08X}"
+
+        if self.last_seq is not None and seq != (self.last_seq + 1) & 0xFFFFFFFF:
+            gap = (seq - self.last_seq - 1) & 0xFFFFFFFF
+            if gap < 0x80000000:
+                self.lost += gap
+                if not self.csv:
+                    self.out.write(f"-- lost {gap} (seq {self.last_seq + 1}..{seq - 1}) --\n")
+        self.last_seq = seq
+
+        # time_us 는 32bit (약 71분마다 wrap) 이므로 이전 레코드와의 차이로 본다
+        delta = 0
+        if self.last_us is not None:
+            delta = (time_us - self.last_us) & 0xFFFFFFFF
+            if delta >= 0x80000000:
+                delta = 0       # 여러 스레드가 기록하므로 seq 순서와 시간 순서가 조금 다를 수 있음
+        self.last_us = time_us
+
+        self.frames += 1
+        self.count[name] = self.count.get(name, 0) + 1
+        if self.csv:
+            self.out.write(f"{seq},{time_us},{name},{a0},{a1},\"{args}\"\n")
+        else:
+            self.out.write(f"{time_us / 1000:12.3f} +{delta / 1000:8.3f} {seq:8d}  {name:<18} {args}\n")
+
+    def summary(self):
+        out = sys.stderr
+        out.write(f"frames {self.frames}, lost {self.lost}, bad {self.bad}\n")
+        for name, n in sorted(self.count.items(), key=lambda x: -x[1]):
+            out.write(f"  {name:<18} {n}\n")
+
+
+def open_input(path, send):
+    if path == "-":
+        return sys.stdin.buffer, None
+
+    fd = os.open(path, os.O_RDWR | os.O_NOCTTY if send else os.O_RDONLY)
+    if os.isatty(fd):
+        import termios
+        import tty
+        tty.setraw(fd)
+        termios.tcflush(fd, termios.TCIFLUSH)
+    if send:
+        for cmd in send:
+            os.write(fd, cmd.encode() + b"\r\n")
+    return os.fdopen(fd, "rb", buffering=0), fd
+
+
+def main():
+    parser = argparse.ArgumentParser(description="동글 evtlog 바이너리 스트림 디코더")
+    parser.add_argument("input", help="CDC 포트 (/dev/ttyACM0), 저장한 파일, 또는 - (stdin)")
+    parser.add_argument("--header", default=DEFAULT_HEADER, help="이벤트 목록이 있는 evtlog.h")
+    parser.add_argument("--send", action="append", help="시작할 때 보낼 CLI 명령 (예: \"evt stream on\")")
+    parser.add_argument("--text", action="store_true", help="프레임이 아닌 바이트(CLI 출력)도 '| ' 를 붙여 출력")
+    parser.add_argument("--csv", action="store_true", help="seq,time_us,name,a0,a1,args 로 출력")
+    parser.add_argument("-o", "--output", help="출력 파일 (기본 stdout)")
+    args = parser.parse_args()
+
+    events = load_events(args.header)
+    out = open(args.output, "w", encoding="utf-8") if args.output else sys.stdout
+    dec = Decoder(events, out, text=args.text, csv=args.csv)
+
+    f, fd = open_input(args.input, args.send)
+    try:
+        while True:
+            data = f.read1(4096) if hasattr(f, "read1") else f.read(4096)
+            if not data:
+                break
+            dec.feed(data)
+            out.flush()
+    except KeyboardInterrupt:
+        pass
+    finally:
+        if fd is not None and args.send:
+            os.write(fd, b"evt stream off\r\n")
+        dec.summary()
+
+
+if __name__ == "__main__":
+    main()
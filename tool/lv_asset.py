@@ -0,0 +1,907 @@
+#!/usr/bin/env python3
+"""
+LVGL 폰트/이미지 에셋 변환기 (빌드 전에 한 번 실행해서 결과 .c 를 커밋한다)
+
+  # LVGL 폰트(.c) 에서 실제로 쓰는 글자만 남기고 RLE 로 압축
+  python tool/lv_asset.py font app_dongle/src/lib/lvgl/src/font/lv_font_montserrat_10.c \\
+      --name font_ui_10 --range 0x20-0x7E --compress -o app_dongle/src/ap/assets/font_ui_10.c
+
+  # 이미지(PNG/PPM 또는 LVGL 이미지 .c) 를 QGF(QMK painter 형식, RLE) 로 변환
+  python tool/lv_asset.py img app_dongle/src/hw/driver/lcd/logo_img.c \\
+      --name img_logo -o app_dongle/src/ap/assets/img_logo.c
+
+  # 결과 크기만 확인
+  python tool/lv_asset.py font ... --dry-run
+
+font : lv_font_conv 로 만든 LVGL 폰트(--no-compress, format lvgl) 를 읽어서
+       글리프/cmap/kerning 클래스를 줄이고, LVGL 의 RLE(+prefilter) 형식으로 다시 쓴다.
+       (lv_conf.h 의 LV_USE_FONT_COMPRESSED 1 필요)
+img  : 색 수에 맞춰 palette 1/2/4/8bpp 또는 RGB565 로 만들고 QGF RLE 로 압축한다.
+       펌웨어는 ap_qgf.c 의 LVGL 이미지 디코더가 한 줄씩 풀어서 draw buffer 에 바로 쓴다.
+
+외부 패키지 없이 표준 라이브러리만 사용한다.
+"""
+import argparse
+import colorsys
+import os
+import re
+import struct
+import sys
+import zlib
+
+
+# ---------------------------------------------------------------------------
+# C 배열 파싱
+# ---------------------------------------------------------------------------
+
+def strip_comments(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    return re.sub(r"//[^\n]*", "", text)
+
+
+def c_array(text, name):
+    """`name[] = { ... };` 의 정수 목록"""
+    m = re.search(r"\b" + re.escape(name) + r"\s*\[\s*\]\s*=\s*\{(.*?)\};", text, flags=re.S)
+    if m is None:
+        return None
+    body = strip_comments(m.group(1))
+    return [int(v, 0) for v in re.findall(r"-?(?:0x[0-9a-fA-F]+|\d+)", body)]
+
+
+def c_field(text, name, default=None):
+    m = re.search(r"\." + re.escape(name) + r"\s*=\s*(-?(?:0x[0-9a-fA-F]+|\d+))", text)
+    if m is None:
+        if default is None:
+            raise ValueError(f"'{name}' 를 찾을 수 없습니다")
+        return default
+    return int(m.group(1), 0)
+
+
+def c_bytes(data, indent="    ", per_line=16):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ", ".join(f"0x{b:02x}" for b in data[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def c_ints(data, indent="    ", per_line=16, fmt="{}"):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ", ".join(fmt.format(v) for v in data[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def parse_ranges(specs):
+    """'0x20-0x7E', 'abc', 65 ... → 코드포인트 set"""
+    cps = set()
+    for spec in specs or []:
+        for part in spec.split(","):
+            part = part.strip()
+            if not part:
+                continue
+            if "-" in part:
+                lo, hi = part.split("-", 1)
+                cps.update(range(int(lo, 0), int(hi, 0) + 1))
+            else:
+                cps.add(int(part, 0))
+    return cps
+
+
+# ---------------------------------------------------------------------------
+# LVGL 폰트
+# ---------------------------------------------------------------------------
+
+class LvFont:
+    def __init__(self, path):
+        with open(path, encoding="utf-8") as f:
+            text = f.read()
+        self.path = path
+        self.text = text
+        m = re.search(r"\* Size: (\d+) px", text)
+        self.size = int(m.group(1)) if m else None
+
+        self.bitmap = c_array(text, "glyph_bitmap")
+        self.glyphs = []
+        for m in re.finditer(r"\{\s*\.bitmap_index\s*=\s*(\d+),\s*\.adv_w\s*=\s*(\d+),\s*\.box_w\s*=\s*(\d+),"
+                             r"\s*\.box_h\s*=\s*(\d+),\s*\.ofs_x\s*=\s*(-?\d+),\s*\.ofs_y\s*=\s*(-?\d+)\s*\}", text):
+            self.glyphs.append(tuple(int(v) for v in m.groups()))
+
+        dsc = text[text.index("font_dsc = {"):]
+        self.bpp = c_field(dsc, "bpp")
+        self.kern_scale = c_field(dsc, "kern_scale", 16)
+        if c_field(dsc, "bitmap_format", 0) != 0:
+            raise ValueError(f"{path}: 압축되지 않은 폰트(--no-compress --no-prefilter)만 읽을 수 있습니다")
+        if c_field(dsc, "kern_classes", 1) != 1:
+            raise ValueError(f"{path}: kerning 은 class 형식(--force-fast-kern-format)만 지원합니다")
+
+        pub = text[text.index("get_glyph_dsc"):]
+        self.line_height = c_field(pub, "line_height")
+        self.base_line = c_field(pub, "base_line")
+        self.underline_position = c_field(pub, "underline_position", 0)
+        self.underline_thickness = c_field(pub, "underline_thickness", 0)
+
+        # 코드포인트 → glyph id
+        self.cmap = {}
+        cmaps = text[text.index("cmaps[] = {"):]
+        cmaps = cmaps[:cmaps.index("};")]
+        for m in re.finditer(r"\{(.*?)\}", cmaps, flags=re.S):
+            body = m.group(1)
+            start = c_field(body, "range_start")
+            length = c_field(body, "range_length")
+            gid = c_field(body, "glyph_id_start")
+            kind = re.search(r"\.type\s*=\s*(\w+)", body).group(1)
+            ulist = re.search(r"\.unicode_list\s*=\s*(\w+)", body).group(1)
+            if kind == "LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY":
+                for i in range(length):
+                    self.cmap[start + i] = gid + i
+            elif kind == "LV_FONT_FMT_TXT_CMAP_SPARSE_TINY":
+                for i, ofs in enumerate(c_array(text, ulist)):
+                    self.cmap[start + ofs] = gid + i
+            else:
+                raise ValueError(f"{path}: 지원하지 않는 cmap 형식 {kind}")
+
+        self.kern_left = c_array(text, "kern_left_class_mapping")
+        self.kern_right = c_array(text, "kern_right_class_mapping")
+        self.kern_values = c_array(text, "kern_class_values")
+        if self.kern_left is not None:
+            kc = text[text.index("kern_classes = {"):]
+            self.left_cnt = c_field(kc, "left_class_cnt")
+            self.right_cnt = c_field(kc, "right_class_cnt")
+
+    def pixels(self, gid):
+        """glyph 의 픽셀값 목록 (MSB 부터 bpp 비트씩)"""
+        index, _, w, h, _, _ = self.glyphs[gid]
+        count = w * h
+        out = []
+        bit = index * 8
+        for _ in range(count):
+            byte_pos, shift = divmod(bit, 8)
+            word = (self.bitmap[byte_pos] << 8) | (self.bitmap[byte_pos + 1] if byte_pos + 1 < len(self.bitmap) else 0)
+            out.append((word >> (16 - shift - self.bpp)) & ((1 << self.bpp) - 1))
+            bit += self.bpp
+        return out
+
+
+class BitWriter:
+    def __init__(self):
+        self.data = bytearray()
+        self.bits = 0
+
+    def write(self, value, length):
+        for i in range(length - 1, -1, -1):
+            if self.bits % 8 == 0:
+                self.data.append(0)
+            if (value >> i) & 1:
+                self.data[-1] |= 0x80 >> (self.bits % 8)
+            self.bits += 1
+
+
+def lv_rle_encode(pixels, bpp):
+    """lv_font_fmt_txt.c 의 rle_next() 상태머신과 같은 순서로 비트를 쓴다"""
+    out = BitWriter()
+    state = "single"
+    prev = 0
+    cnt = 0
+    i = 0
+    n = len(pixels)
+    while i < n:
+        p = pixels[i]
+        if state == "single":
+            out.write(p, bpp)
+            if i != 0 and p == prev:
+                state = "repeat"
+                cnt = 0
+            prev = p
+        elif state == "repeat":
+            cnt += 1
+            if p == prev:
+                out.write(1, 1)
+                if cnt == 11:
+                    # 다음 c-1 개는 prev 반복, c 번째는 새 값(literal)
+                    run = 0
+                    while i + 1 + run < n and pixels[i + 1 + run] == prev and run < 62:
+                        run += 1
+                    out.write(run + 1, 6)
+                    state = "counter"
+                    cnt = run + 1
+            else:
+                out.write(0, 1)
+                out.write(p, bpp)
+                prev = p
+                state = "single"
+        else:
+            cnt -= 1
+            if cnt == 0:
+                out.write(p, bpp)
+                prev = p
+                state = "single"
+        i += 1
+    return bytes(out.data)
+
+
+def lv_rle_decode(data, count, bpp):
+    """검증용 : lv_font_fmt_txt.c 의 rle_next() 를 그대로 옮김"""
+    padded = bytes(data) + b"\x00\x00"
+
+    def get_bits(pos, length):
+        byte_pos, shift = divmod(pos, 8)
+        word = (padded[byte_pos] << 8) | padded[byte_pos + 1]
+        return (word >> (16 - shift - length)) & ((1 << length) - 1)
+
+    out = []
+    state = "single"
+    rdp = 0
+    prev = 0
+    cnt = 0
+    for _ in range(count):
+        if state == "single":
+            ret = get_bits(rdp, bpp)
+            if rdp != 0 and prev == ret:
+                cnt = 0
+                state = "repeat"
+            prev = ret
+            rdp += bpp
+        elif state == "repeat":
+            v = get_bits(rdp, 1)
+            cnt += 1
+            rdp += 1
+            if v == 1:
+                ret = prev
+                if cnt == 11:
+                    cnt = get_bits(rdp, 6)
+                    rdp += 6
+                    if cnt != 0:
+                        state = "counter"
+                    else:
+                        ret = get_bits(rdp, bpp)
+                        prev = ret
+                        rdp += bpp
+                        state = "single"
+            else:
+                ret = get_bits(rdp, bpp)
+                prev = ret
+                rdp += bpp
+                state = "single"
+        else:
+            ret = prev
+            cnt -= 1
+            if cnt == 0:
+                ret = get_bits(rdp, bpp)
+                prev = ret
+                rdp += bpp
+                state = "single"
+        out.append(ret)
+    return out
+
+
+def prefilter(pixels, w):
+    """윗줄과 XOR (LV_FONT_FMT_TXT_COMPRESSED)"""
+    out = list(pixels[:w])
+    for i in range(w, len(pixels)):
+        out.append(pixels[i] ^ pixels[i - w])
+    return out
+
+
+def pack_plain(pixels, bpp):
+    out = BitWriter()
+    for p in pixels:
+        out.write(p, bpp)
+    return bytes(out.data)
+
+
+def encode_glyphs(font, gids, bitmap_format):
+    """bitmap_format 0 : plain, 1 : RLE + prefilter, 2 : RLE"""
+    bitmap = bytearray()
+    index = []
+    for gid in gids:
+        _, _, w, h, _, _ = font.glyphs[gid]
+        px = font.pixels(gid)
+        index.append(len(bitmap))
+        if not px:
+            continue
+        if bitmap_format == 0:
+            data = pack_plain(px, font.bpp)
+        else:
+            src = prefilter(px, w) if bitmap_format == 1 else px
+            data = lv_rle_encode(src, font.bpp)
+            check = lv_rle_decode(data, len(src), font.bpp)
+            if check != src:
+                raise RuntimeError(f"RLE 검증 실패 (glyph {gid})")
+        bitmap += data
+    return bytes(bitmap), index
+
+
+def build_cmaps(cps):
+    """연속 구간(3글자 이상)은 FORMAT0_TINY, 나머지는 SPARSE_TINY 하나로 묶는다"""
+    cps = sorted(cps)
+    runs = []
+    for cp in cps:
+        if runs and runs[-1][-1] + 1 == cp:
+            runs[-1].append(cp)
+        else:
+            runs.append([cp])
+
+    dense = [r for r in runs if len(r) >= 3]
+    sparse = sorted(cp for r in runs if len(r) < 3 for cp in r)
+
+    order = []
+    cmaps = []
+    for r in dense:
+        cmaps.append({"start": r[0], "length": len(r), "gid": len(order) + 1, "list": None})
+        order += r
+    if sparse:
+        cmaps.append({"start": sparse[0], "length": sparse[-1] - sparse[0] + 1, "gid": len(order) + 1,
+                      "list": [cp - sparse[0] for cp in sparse]})
+        order += sparse
+    return order, cmaps
+
+
+def remap_classes(mapping, old_gids):
+    """쓰는 glyph 의 kerning class 만 남기고 1 부터 다시 번호를 매긴다"""
+    used = sorted({mapping[g] for g in old_gids if mapping[g] != 0})
+    renum = {c: i + 1 for i, c in enumerate(used)}
+    return [0] + [renum.get(mapping[g], 0) for g in old_gids], used
+
+
+def font_cmd(args):
+    font = LvFont(args.input)
+
+    cps = parse_ranges(args.range)
+    for text in args.chars or []:
+        cps.update(ord(c) for c in text)
+    if args.chars_file:
+        with open(args.chars_file, encoding="utf-8") as f:
+            cps.update(ord(c) for c in f.read() if c not in "\r\n")
+    if not cps:
+        sys.exit("--range / --chars 로 남길 글자를 지정하세요")
+
+    missing = sorted(cp for cp in cps if cp not in font.cmap)
+    if missing:
+        print("warning: 폰트에 없는 글자 " + ", ".join(f"U+{cp:04X}" for cp in missing), file=sys.stderr)
+        cps -= set(missing)
+
+    order, cmaps = build_cmaps(cps)
+    old_gids = [font.cmap[cp] for cp in order]
+
+    formats = [0]
+    if args.compress:
+        formats = [1, 2]
+    best = None
+    for fmt in formats:
+        bitmap, index = encode_glyphs(font, old_gids, fmt)
+        if best is None or len(bitmap) < len(best[1]):
+            best = (fmt, bitmap, index)
+    bitmap_format, bitmap, index = best
+
+    kern = None
+    if font.kern_left is not None:
+        left_map, left_used = remap_classes(font.kern_left, old_gids)
+        right_map, right_used = remap_classes(font.kern_right, old_gids)
+        values = []
+        for lc in left_used:
+            for rc in right_used:
+                values.append(font.kern_values[(lc - 1) * font.right_cnt + (rc - 1)])
+        if any(values):
+            kern = (left_map, right_map, values, len(left_used), len(right_used))
+
+    # 크기 비교 (glyph_dsc 는 항목당 8 byte)
+    src_size = len(font.bitmap) + len(font.glyphs) * 8
+    if font.kern_left is not None:
+        src_size += len(font.kern_left) + len(font.kern_right) + len(font.kern_values)
+    new_size = len(bitmap) + 1 + (len(order) + 1) * 8
+    if kern:
+        new_size += len(kern[0]) + len(kern[1]) + len(kern[2])
+    print(f"{args.name}: {len(order)}/{len(font.glyphs) - 1} glyphs, bitmap_format {bitmap_format}, "
+          f"{src_size} -> {new_size} bytes")
+
+    if args.dry_run:
+        return
+
+    cmd = "python tool/lv_asset.py font " + " ".join(
+        [os.path.relpath(args.input).replace(os.sep, "/"), "--name", args.name] +
+        sum((["--range", r] for r in args.range or []), []) +
+        sum((["--chars", repr(c)] for c in args.chars or []), []) +
+        (["--compress"] if args.compress else []))
+
+    out = []
+    out.append("/*******************************************************************************")
+    if font.size is not None:
+        out.append(f" * Size: {font.size} px")
+    else:
+        out.append(f" * Size: {font.line_height} px (line height)")
+    out.append(f" * Bpp: {font.bpp}")
+    out.append(f" * Source: {os.path.basename(args.input)}")
+    out.append(f" * Opts: {cmd}")
+    out.append(" * 이 파일은 tool/lv_asset.py 로 생성됨 (직접 수정하지 말 것)")
+    out.append(" ******************************************************************************/")
+    out.append("")
+    out.append("#ifdef LV_LVGL_H_INCLUDE_SIMPLE")
+    out.append("    #include \"lvgl.h\"")
+    out.append("#else")
+    out.append("    #include \"lvgl/lvgl.h\"")
+    out.append("#endif")
+    out.append("")
+    if bitmap_format != 0:
+        out.append("#if !LV_USE_FONT_COMPRESSED")
+        out.append("    #error \"LV_USE_FONT_COMPRESSED must be enabled in lv_conf.h\"")
+        out.append("#endif")
+        out.append("")
+    out.append("/*-----------------")
+    out.append(" *    BITMAPS")
+    out.append(" *----------------*/")
+    out.append("")
+    out.append("/*Store the image of the glyphs*/")
+    out.append("static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {")
+    for i, cp in enumerate(order):
+        start = index[i]
+        end = index[i + 1] if i + 1 < len(order) else len(bitmap)
+        ch = chr(cp).replace("\\", "\\\\").replace("\"", "\\\"") if 0x20 <= cp < 0x7F else ""
+        out.append(f"    /* U+{cp:04X} \"{ch}\" */")
+        if end > start:
+            out.append(c_bytes(bitmap[start:end]))
+        out.append("")
+    out.append("    /* RLE 디코더가 마지막 글리프 뒤 1 byte 를 더 읽음 */")
+    out.append("    0x00")
+    out.append("};")
+    out.append("")
+    out.append("")
+    out.append("/*---------------------")
+    out.append(" *  GLYPH DESCRIPTION")
+    out.append(" *--------------------*/")
+    out.append("")
+    out.append("static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {")
+    out.append("    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,")
+    for i, gid in enumerate(old_gids):
+        _, adv_w, w, h, ox, oy = font.glyphs[gid]
+        sep = "," if i + 1 < len(old_gids) else ""
+        out.append(f"    {{.bitmap_index = {index[i]}, .adv_w = {adv_w}, .box_w = {w}, .box_h = {h}, "
+                   f".ofs_x = {ox}, .ofs_y = {oy}}}{sep}")
+    out.append("};")
+    out.append("")
+    out.append("/*---------------------")
+    out.append(" *  CHARACTER MAPPING")
+    out.append(" *--------------------*/")
+    out.append("")
+    for i, cm in enumerate(cmaps):
+        if cm["list"] is not None:
+            out.append(f"static const uint16_t unicode_list_{i}[] = {{")
+            out.append(c_ints(cm["list"], per_line=8, fmt="0x{:x}").rstrip(","))
+            out.append("};")
+            out.append("")
+    out.append("/*Collect the unicode lists and glyph_id offsets*/")
+    out.append("static const lv_font_fmt_txt_cmap_t cmaps[] = {")
+    for i, cm in enumerate(cmaps):
+        sep = "," if i + 1 < len(cmaps) else ""
+        if cm["list"] is None:
+            ulist, llen, kind = "NULL", 0, "LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY"
+        else:
+            ulist, llen, kind = f"unicode_list_{i}", len(cm["list"]), "LV_FONT_FMT_TXT_CMAP_SPARSE_TINY"
+        out.append("    {")
+        out.append(f"        .range_start = {cm['start']}, .range_length = {cm['length']}, .glyph_id_start = {cm['gid']},")
+        out.append(f"        .unicode_list = {ulist}, .glyph_id_ofs_list = NULL, .list_length = {llen}, .type = {kind}")
+        out.append("    }" + sep)
+    out.append("};")
+    out.append("")
+    if kern:
+        left_map, right_map, values, left_cnt, right_cnt = kern
+        out.append("/*-----------------")
+        out.append(" *    KERNING")
+        out.append(" *----------------*/")
+        out.append("")
+        out.append("/*Map glyph_ids to kern left classes*/")
+        out.append("static const uint8_t kern_left_class_mapping[] = {")
+        out.append(c_ints(left_map, per_line=8).rstrip(","))
+        out.append("};")
+        out.append("")
+        out.append("/*Map glyph_ids to kern right classes*/")
+        out.append("static const uint8_t kern_right_class_mapping[] = {")
+        out.append(c_ints(right_map, per_line=8).rstrip(","))
+        out.append("};")
+        out.append("")
+        out.append("/*Kern values between classes*/")
+        out.append("static const int8_t kern_class_values[] = {")
+        out.append(c_ints(values, per_line=8).rstrip(","))
+        out.append("};")
+        out.append("")
+        out.append("/*Collect the kern class' data in one place*/")
+        out.append("static const lv_font_fmt_txt_kern_classes_t kern_classes = {")
+        out.append("    .class_pair_values   = kern_class_values,")
+        out.append("    .left_class_mapping  = kern_left_class_mapping,")
+        out.append("    .right_class_mapping = kern_right_class_mapping,")
+        out.append(f"    .left_class_cnt      = {left_cnt},")
+        out.append(f"    .right_class_cnt     = {right_cnt},")
+        out.append("};")
+        out.append("")
+    out.append("/*--------------------")
+    out.append(" *  ALL CUSTOM DATA")
+    out.append(" *--------------------*/")
+    out.append("")
+    out.append("/*Store all the custom data of the font*/")
+    out.append("static lv_font_fmt_txt_glyph_cache_t cache;")
+    out.append("static const lv_font_fmt_txt_dsc_t font_dsc = {")
+    out.append("    .glyph_bitmap = glyph_bitmap,")
+    out.append("    .glyph_dsc = glyph_dsc,")
+    out.append("    .cmaps = cmaps,")
+    out.append(f"    .kern_dsc = {'&kern_classes' if kern else 'NULL'},")
+    out.append(f"    .kern_scale = {font.kern_scale if kern else 0},")
+    out.append(f"    .cmap_num = {len(cmaps)},")
+    out.append(f"    .bpp = {font.bpp},")
+    out.append(f"    .kern_classes = {1 if kern else 0},")
+    out.append(f"    .bitmap_format = {bitmap_format},")
+    out.append("    .cache = &cache")
+    out.append("};")
+    out.append("")
+    out.append("")
+    out.append("/*-----------------")
+    out.append(" *  PUBLIC FONT")
+    out.append(" *----------------*/")
+    out.append("")
+    out.append("/*Initialize a public general font descriptor*/")
+    out.append(f"const lv_font_t {args.name} = {{")
+    out.append("    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/")
+    out.append("    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/")
+    out.append(f"    .line_height = {font.line_height},          /*The maximum line height required by the font*/")
+    out.append(f"    .base_line = {font.base_line},             /*Baseline measured from the bottom of the line*/")
+    out.append("    .subpx = LV_FONT_SUBPX_NONE,")
+    out.append(f"    .underline_position = {font.underline_position},")
+    out.append(f"    .underline_thickness = {font.underline_thickness},")
+    out.append("    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */")
+    out.append("};")
+    out.append("")
+
+    with open(args.output, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(out))
+
+
+# ---------------------------------------------------------------------------
+# 이미지 입력
+# ---------------------------------------------------------------------------
+
+def load_ppm(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    tokens = []
+    pos = 0
+    while len(tokens) < 4:
+        m = re.compile(rb"\s*(#[^\n]*\n\s*)*(\S+)").match(data, pos)
+        tokens.append(m.group(2))
+        pos = m.end()
+    pos += 1
+    magic, w, h, maxval = tokens[0], int(tokens[1]), int(tokens[2]), int(tokens[3])
+    if maxval != 255 or magic not in (b"P5", b"P6"):
+        raise ValueError(f"{path}: 8bit P5/P6 만 지원합니다")
+    px = []
+    if magic == b"P6":
+        for i in range(w * h):
+            r, g, b = data[pos + i * 3:pos + i * 3 + 3]
+            px.append((r, g, b, 255))
+    else:
+        for i in range(w * h):
+            v = data[pos + i]
+            px.append((v, v, v, 255))
+    return w, h, px
+
+
+def load_png(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError(f"{path}: PNG 가 아닙니다")
+    pos = 8
+    idat = b""
+    palette = []
+    trns = b""
+    while pos < len(data):
+        length, kind = struct.unpack_from(">I4s", data, pos)
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            w, h, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif kind == b"PLTE":
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+        elif kind == b"tRNS":
+            trns = chunk
+        elif kind == b"IDAT":
+            idat += chunk
+    if depth != 8 or interlace != 0:
+        raise ValueError(f"{path}: 8bit, non-interlaced PNG 만 지원합니다")
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color]
+    raw = zlib.decompress(idat)
+    stride = w * channels
+    rows = []
+    prev = bytearray(stride)
+    pos = 0
+    for _ in range(h):
+        ftype = raw[pos]
+        line = bytearray(raw[pos + 1:pos + 1 + stride])
+        pos += 1 + stride
+        for i in range(stride):
+            a = line[i - channels] if i >= channels else 0
+            b = prev[i]
+            c = prev[i - channels] if i >= channels else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[i] = (line[i] + pred) & 0xFF
+        rows.append(line)
+        prev = line
+    px = []
+    for line in rows:
+        for x in range(w):
+            v = line[x * channels:(x + 1) * channels]
+            if color == 0:
+                px.append((v[0], v[0], v[0], 255))
+            elif color == 2:
+                px.append((v[0], v[1], v[2], 255))
+            elif color == 3:
+                r, g, b = palette[v[0]]
+                px.append((r, g, b, trns[v[0]] if v[0] < len(trns) else 255))
+            elif color == 4:
+                px.append((v[0], v[0], v[0], v[1]))
+            else:
+                px.append((v[0], v[1], v[2], v[3]))
+    return w, h, px
+
+
+def load_lv_img(path):
+    """LVGL 이미지 변환기로 만든 .c (LV_COLOR_DEPTH == 32 블록을 읽는다)"""
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    w = c_field(text, "header.w")
+    h = c_field(text, "header.h")
+    cf = re.search(r"\.header\.cf\s*=\s*(\w+)", text).group(1)
+    m = re.search(r"#if LV_COLOR_DEPTH == 32\s*\n(.*?)#endif", text, flags=re.S)
+    if m is None:
+        raise ValueError(f"{path}: LV_COLOR_DEPTH == 32 데이터가 없습니다")
+    data = [int(v, 0) for v in re.findall(r"0x[0-9a-fA-F]+", strip_comments(m.group(1)))]
+    px = []
+    if cf == "LV_IMG_CF_TRUE_COLOR":
+        for i in range(w * h):
+            b, g, r, _ = data[i * 4:i * 4 + 4]
+            px.append((r, g, b, 255))
+    elif cf == "LV_IMG_CF_TRUE_COLOR_ALPHA":
+        for i in range(w * h):
+            b, g, r, a = data[i * 4:i * 4 + 4]
+            px.append((r, g, b, a))
+    else:
+        raise ValueError(f"{path}: 지원하지 않는 형식 {cf}")
+    return w, h, px
+
+
+def load_image(path):
+    ext = os.path.splitext(path)[1].lower()
+    if ext == ".png":
+        return load_png(path)
+    if ext in (".ppm", ".pgm"):
+        return load_ppm(path)
+    if ext == ".c":
+        return load_lv_img(path)
+    raise ValueError(f"{path}: png / ppm / pgm / LVGL .c 만 지원합니다")
+
+
+# ---------------------------------------------------------------------------
+# QGF (quantum/painter/qgf.h)
+# ---------------------------------------------------------------------------
+
+QGF_GRAYSCALE = {1: 0x00, 2: 0x01, 4: 0x02, 8: 0x03}
+QGF_PALETTE = {1: 0x04, 2: 0x05, 4: 0x06, 8: 0x07}
+QGF_RGB565 = 0x08
+
+QGF_COMPRESS_NONE = 0
+QGF_COMPRESS_RLE = 1
+
+
+def qgf_block(type_id, payload):
+    return struct.pack("<BB", type_id, (~type_id) & 0xFF) + struct.pack("<I", len(payload))[:3] + payload
+
+
+def hsv_to_rgb_nocie(h, s, v):
+    """quantum/color.c hsv_to_rgb_impl() 와 같은 정수 연산"""
+    if s == 0:
+        return v, v, v
+    region = h * 6 // 255
+    remainder = ((h * 2 - region * 85) * 3) & 0xFF
+    p = (v * (255 - s)) >> 8
+    q = (v * (255 - ((s * remainder) >> 8))) >> 8
+    t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8
+    return [(v, t, p), (q, v, p), (p, v, t), (p, q, v), (t, p, v), (v, p, q), (v, t, p)][region]
+
+
+def rgb_to_qgf_hsv(r, g, b):
+    """펌웨어의 hsv_to_rgb_nocie() 로 되돌렸을 때 가장 가까운 HSV888"""
+    h, s, v = colorsys.rgb_to_hsv(r / 255, g / 255, b / 255)
+    h0, s0, v0 = round(h * 255) % 256, round(s * 255), round(v * 255)
+    best = None
+    for dh in range(-2, 3):
+        for ds in range(-2, 3):
+            for dv in range(-2, 3):
+                hh, ss, vv = (h0 + dh) % 256, min(max(s0 + ds, 0), 255), min(max(v0 + dv, 0), 255)
+                rr, gg, bb = hsv_to_rgb_nocie(hh, ss, vv)
+                err = (rr - r) ** 2 + (gg - g) ** 2 + (bb - b) ** 2
+                if best is None or err < best[0]:
+                    best = (err, hh, ss, vv)
+    return best[1:]
+
+
+def qmk_rle_encode(data):
+    """qp_draw_codec.c 의 RLE : 0~127 = 다음 byte 를 n 번 반복, 128~255 = 다음 (n-127) byte 를 그대로"""
+    out = bytearray()
+    i = 0
+    literal = bytearray()
+
+    def flush():
+        while literal:
+            chunk = literal[:128]
+            out.append(127 + len(chunk))
+            out.extend(chunk)
+            del literal[:128]
+
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and data[i + run] == data[i] and run < 127:
+            run += 1
+        if run >= 3:
+            flush()
+            out.append(run)
+            out.append(data[i])
+            i += run
+        else:
+            literal.extend(data[i:i + run])
+            i += run
+    flush()
+    return bytes(out)
+
+
+def img_cmd(args):
+    w, h, px = load_image(args.input)
+
+    bg = tuple(int(args.bg[i:i + 2], 16) for i in (0, 2, 4))
+    rgb = []
+    for r, g, b, a in px:
+        # QGF 는 투명도를 지원하지 않으므로 배경색에 섞는다
+        rgb.append(tuple((c * a + k * (255 - a)) // 255 for c, k in zip((r, g, b), bg)))
+
+    colors = sorted(set(rgb))
+    if args.format == "auto":
+        bpp = next((b for b in (1, 2, 4, 8) if len(colors) <= (1 << b)), 16)
+    elif args.format == "rgb565":
+        bpp = 16
+    else:
+        bpp = int(args.format.replace("pal", ""))
+        if len(colors) > (1 << bpp):
+            sys.exit(f"{len(colors)} 색은 {bpp}bpp palette 에 들어가지 않습니다")
+
+    palette = b""
+    if bpp <= 8:
+        fmt = QGF_PALETTE[bpp]
+        lookup = {c: i for i, c in enumerate(colors)}
+        entries = colors + [(0, 0, 0)] * ((1 << bpp) - len(colors))
+        palette = b"".join(bytes(rgb_to_qgf_hsv(*c)) for c in entries)
+        # LSB 부터 채우고 줄 경계와 상관없이 이어서 packing (qp_internal_decode_palette)
+        raw = bytearray()
+        acc = 0
+        nbits = 0
+        for c in rgb:
+            acc |= lookup[c] << nbits
+            nbits += bpp
+            if nbits == 8:
+                raw.append(acc)
+                acc = 0
+                nbits = 0
+        if nbits:
+            raw.append(acc)
+    else:
+        fmt = QGF_RGB565
+        raw = bytearray()
+        for r, g, b in rgb:
+            v = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+            raw += struct.pack(">H", v)  # panel native (big endian)
+
+    rle = qmk_rle_encode(bytes(raw))
+    if args.no_compress or len(rle) >= len(raw):
+        compression, data = QGF_COMPRESS_NONE, bytes(raw)
+    else:
+        compression, data = QGF_COMPRESS_RLE, rle
+
+    # graphics descriptor + frame offsets + frame descriptor [+ palette] + data
+    frame = qgf_block(0x02, struct.pack("<BBBBH", fmt, 0, compression, 0, 0))
+    if palette:
+        frame += qgf_block(0x03, palette)
+    frame += qgf_block(0x05, data)
+
+    desc_size = 5 + 18
+    offsets_size = 5 + 4
+    total = desc_size + offsets_size + len(frame)
+    desc = qgf_block(0x00, struct.pack("<I", 0x464751)[:3] + struct.pack("<BIIHHH", 1, total, (~total) & 0xFFFFFFFF, w, h, 1))
+    offsets = qgf_block(0x01, struct.pack("<I", desc_size + offsets_size))
+    qgf = desc + offsets + frame
+    assert len(qgf) == total
+
+    fmt_name = f"palette {bpp}bpp" if bpp <= 8 else "rgb565"
+    comp_name = "rle" if compression == QGF_COMPRESS_RLE else "raw"
+    print(f"{args.name}: {w}x{h}, {len(colors)} colors, {fmt_name} {comp_name}, "
+          f"{w * h * 2} (rgb565) -> {len(qgf)} bytes")
+
+    if args.dry_run:
+        return
+
+    cmd = "python tool/lv_asset.py img " + " ".join(
+        [os.path.relpath(args.input).replace(os.sep, "/"), "--name", args.name] +
+        (["--format", args.format] if args.format != "auto" else []) +
+        (["--bg", args.bg] if args.bg != "000000" else []) +
+        (["--no-compress"] if args.no_compress else []))
+
+    out = []
+    out.append("/*******************************************************************************")
+    out.append(f" * Size: {w} x {h}, {fmt_name}, {comp_name}")
+    out.append(f" * Source: {os.path.basename(args.input)}")
+    out.append(f" * Opts: {cmd}")
+    out.append(" * 이 파일은 tool/lv_asset.py 로 생성됨 (직접 수정하지 말 것)")
+    out.append(" * QGF 형식 : ap_qgf.c 의 디코더가 LV_IMG_CF_RAW 로 등록된 이미지를 한 줄씩 풀어서 그린다")
+    out.append(" ******************************************************************************/")
+    out.append("")
+    out.append("#ifdef LV_LVGL_H_INCLUDE_SIMPLE")
+    out.append("    #include \"lvgl.h\"")
+    out.append("#else")
+    out.append("    #include \"lvgl/lvgl.h\"")
+    out.append("#endif")
+    out.append("")
+    out.append(f"static LV_ATTRIBUTE_LARGE_CONST const uint8_t {args.name}_qgf[] = {{")
+    out.append(c_bytes(qgf))
+    out.append("};")
+    out.append("")
+    out.append(f"const lv_img_dsc_t {args.name} = {{")
+    out.append("    .header.cf = LV_IMG_CF_RAW,")
+    out.append("    .header.always_zero = 0,")
+    out.append("    .header.reserved = 0,")
+    out.append(f"    .header.w = {w},")
+    out.append(f"    .header.h = {h},")
+    out.append(f"    .data_size = {len(qgf)},")
+    out.append(f"    .data = {args.name}_qgf,")
+    out.append("};")
+    out.append("")
+
+    with open(args.output, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(out))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="LVGL 폰트 subset/RLE, 이미지 QGF 변환")
+    sub = parser.add_subparsers(dest="cmd", required=True)
+
+    p = sub.add_parser("font", help="LVGL 폰트 .c 를 subset + RLE 압축")
+    p.add_argument("input")
+    p.add_argument("--name", required=True, help="생성할 lv_font_t 이름")
+    p.add_argument("--range", action="append", help="코드포인트 범위 (예: 0x20-0x7E,0xB0)")
+    p.add_argument("--chars", action="append", help="남길 글자 (문자열)")
+    p.add_argument("--chars-file", help="남길 글자가 들어있는 텍스트 파일")
+    p.add_argument("--compress", action="store_true", help="RLE 압축 (prefilter 유무 중 작은 쪽)")
+    p.add_argument("--dry-run", action="store_true")
+    p.add_argument("-o", "--output")
+    p.set_defaults(func=font_cmd)
+
+    p = sub.add_parser("img", help="이미지를 QGF(RLE) + lv_img_dsc_t 로 변환")
+    p.add_argument("input", help="png / ppm / pgm / LVGL 이미지 .c")
+    p.add_argument("--name", required=True, help="생성할 lv_img_dsc_t 이름")
+    p.add_argument("--format", default="auto", choices=["auto", "pal1", "pal2", "pal4", "pal8", "rgb565"])
+    p.add_argument("--bg", default="000000", help="투명 픽셀을 섞을 배경색 (RRGGBB)")
+    p.add_argument("--no-compress", action="store_true")
+    p.add_argument("--dry-run", action="store_true")
+    p.add_argument("-o", "--output")
+    p.set_defaults(func=img_cmd)
+
+    args = parser.parse_args()
+    if not args.dry_run and not args.output:
+        parser.error("-o 가 필요합니다 (또는 --dry-run)")
+    args.func(args)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+"""
+키보드 하프 빌드 프로파일(debug / release) 크기 비교
+
+  # 두 프로파일을 빌드하고 비교
+  python tool/profile_size.py --build
+
+  # 이미 빌드된 디렉토리 비교
+  python tool/profile_size.py build/keyboard_debug build/keyboard_release
+
+zephyr.elf 의 PT_LOAD 세그먼트로 Flash/RAM 사용량을 계산한다.
+(외부 패키지 없이 ELF 헤더만 직접 읽음)
+"""
+import argparse
+import os
+import struct
+import subprocess
+import sys
+
+
+RAM_BASE = 0x20000000
+
+PROFILES = [
+    ("debug",   "build/keyboard_debug",   []),
+    ("release", "build/keyboard_release", ["-DFILE_SUFFIX=release"]),
+]
+
+
+def read_elf_usage(elf_path):
+    """PT_LOAD 세그먼트로 (flash, ram) 사용량을 구한다."""
+    with open(elf_path, "rb") as f:
+        data = f.read()
+
+    if data[:4] != b"\x7fELF" or data[4] != 1:
+        raise ValueError(f"{elf_path}: 32bit ELF 가 아닙니다")
+
+    e_phoff, = struct.unpack_from("<I", data, 0x1C)
+    e_phentsize, e_phnum = struct.unpack_from("<HH", data, 0x2A)
+
+    flash = 0
+    ram = 0
+    for i in range(e_phnum):
+        p_type, p_offset, p_vaddr, p_paddr, p_filesz, p_memsz, p_flags, p_align = \
+            struct.unpack_from("<IIIIIIII", data, e_phoff + i * e_phentsize)
+        if p_type != 1:  # PT_LOAD
+            continue
+        # 초기값이 있는 데이터(.data)는 flash 에 저장되고 RAM 으로 복사됨
+        flash += p_filesz
+        if p_vaddr >= RAM_BASE:
+            ram += p_memsz
+
+    return flash, ram
+
+
+def build(board, app_dir):
+    for name, build_dir, extra in PROFILES:
+        cmd = ["west", "build", "-p", "auto", "-b", board, "-d", build_dir, app_dir]
+        if extra:
+            cmd += ["--"] + extra
+        print(f"[{name}] {' '.join(cmd)}")
+        subprocess.run(cmd, check=True)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="debug/release 빌드 크기 비교")
+    parser.add_argument("dirs", nargs="*", help="debug 빌드 디렉토리, release 빌드 디렉토리")
+    parser.add_argument("--build", action="store_true", help="west 로 두 프로파일을 빌드")
+    parser.add_argument("--board", default="nicenanov2")
+    parser.add_argument("--app", default="app_keyboard")
+    args = parser.parse_args()
+
+    if args.build:
+        build(args.board, args.app)
+
+    dirs = args.dirs if args.dirs else [d for _, d, _ in PROFILES]
+    if len(dirs) != 2:
+        parser.error("빌드 디렉토리 두 개가 필요합니다")
+
+    results = []
+    for (name, _, _), build_dir in zip(PROFILES, dirs):
+        elf = os.path.join(build_dir, "zephyr", "zephyr.elf")
+        if not os.path.exists(elf):
+            print(f"{elf} 가 없습니다. --build 로 먼저 빌드하세요.")
+            return 1
+        results.append((name,) + read_elf_usage(elf))
+
+    print()
+    print(f"{'profile':<10}{'flash':>12}{'ram':>12}")
+    for name, flash, ram in results:
+        print(f"{name:<10}{flash:>12,}{ram:>12,}")
+
+    (_, d_flash, d_ram), (_, r_flash, r_ram) = results
+    print(f"{'diff':<10}{r_flash - d_flash:>+12,}{r_ram - d_ram:>+12,}")
+    print()
+    print("idle current 는 빌드로 알 수 없으므로 PPK2 로 측정 (doc/build_profile.md 참고)")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())